@@ -0,0 +1,162 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#include <cmath>        // For sqrt
+#include <fstream>      // For ifstream
+#include <iostream>
+#include <sstream>      // For istringstream
+#include <string>
+
+// Same blackbox as basic/batch/example1, used as a blackbox server
+// (parameter BB_EXE_SERVER): it is started once by Nomad and evaluates all
+// the points received on its standard input.
+// When a file name is given, the points in the file are evaluated as in
+// batch mode.
+
+const int n = 10;
+
+// Evaluate x and write the outputs on a single line.
+// Return true if the evaluation is ok.
+bool eval(const double x[n], std::ostream& out)
+{
+    double f = 1e+20, g1 = 1e+20, g2 = 1e+20, g3 = 1e+20;
+    double sum1 = 0.0, sum2 = 0.0, sum3 = 0.0, prod1 = 1.0, prod2 = 1.0;
+
+    for (int i = 0; i < n ; i++)
+    {
+        sum1  += pow(cos(x[i]), 4);
+        sum2  += x[i];
+        sum3  += (i+1)*x[i]*x[i];
+        prod1 *= pow(cos(x[i]), 2);
+        if (prod2 != 0.0)
+        {
+            if (x[i] == 0.0)
+            {
+                prod2 = 0.0;
+            }
+            else
+            {
+                prod2 *= x[i];
+            }
+        }
+    }
+
+    g1 = -prod2 + 0.75;
+    g2 = sum2 -7.5 * n;
+
+    f = 10*g1 + 10*g2;
+    if (0.0 != sum3)
+    {
+        f -= (sum1 -2*prod1) / std::abs(sqrt(sum3));
+    }
+    // Scale
+    if (!std::isnan(f))
+    {
+        f *= 1e-5;
+    }
+
+    g3 = - (f + 2000);
+
+    out << f << " " << g1 << " " << g2 << " " << g3 << std::endl;
+
+    return !std::isnan(f);
+}
+
+
+// Evaluate the points in the stream, one point per line.
+// An empty line ends a block: The outputs of the block are flushed.
+// Return true if all evaluations are ok.
+bool evalStream(std::istream& points)
+{
+    bool evalOk = true;
+    double x[n];
+    std::string line;
+    while (std::getline(points, line))
+    {
+        if (line.empty())
+        {
+            std::cout.flush();
+            continue;
+        }
+        std::istringstream in(line);
+        for (int i = 0; i < n; i++)
+        {
+            in >> x[i];
+        }
+        if (in.fail())
+        {
+            // Failed evaluation: empty output line.
+            std::cout << std::endl;
+            evalOk = false;
+            continue;
+        }
+        evalOk = eval(x, std::cout) && evalOk;
+    }
+
+    return evalOk;
+}
+
+
+int main (int argc, char **argv)
+{
+    // Batch mode: the points are in the file given as argument.
+    if (argc >= 2)
+    {
+        std::ifstream in (argv[1]);
+        if (in.fail())
+        {
+            std::cerr << "Error reading file " << argv[1] << std::endl;
+            return 1;
+        }
+        return !evalStream(in);
+    }
+
+    // Server mode: the points are received on the standard input until it
+    // is closed by Nomad.
+    evalStream(std::cin);
+
+    return 0;
+}
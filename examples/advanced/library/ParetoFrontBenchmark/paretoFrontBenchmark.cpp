@@ -0,0 +1,327 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------*/
+/*  Benchmark of the updates of a Pareto front approximation, as done by    */
+/*  DMultiMadsBarrier for its feasible points: ParetoFront against the      */
+/*  pairwise comparisons with all the points of the front.                  */
+/*  Then, hypervolume of the front: incremental (2 objectives) against a    */
+/*  recomputation after each insertion, and dimension sweep (3 objectives)  */
+/*  against slicing on the last objective.                                  */
+/*                                                                          */
+/*  Synthetic fronts: the objective vectors are random points of the unit   */
+/*  sphere in the positive orthant, which do not dominate each other,       */
+/*  scaled by a random factor close to 1 so that some points are dominated. */
+/*                                                                          */
+/*  Not built by default:                                                   */
+/*    $ cmake --build build --target paretoFrontBenchmark.exe               */
+/*--------------------------------------------------------------------------*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "Eval/ParetoFront.hpp"
+
+
+// Synthetic stream of feasible eval points with nobj objectives.
+std::vector<NOMAD::EvalPointPtr> makePoints(const size_t nobj, const size_t nbPoints, const double noise)
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> unif(0.0, 1.0);
+
+    NOMAD::BBOutputTypeList bbOutputTypes(nobj, NOMAD::BBOutputType::OBJ);
+
+    std::vector<NOMAD::EvalPointPtr> points;
+    points.reserve(nbPoints);
+    for (size_t i = 0; i < nbPoints; ++i)
+    {
+        std::vector<double> u(nobj);
+        double norm = 0.0;
+        for (auto & ui : u)
+        {
+            ui = unif(gen) + 1e-6;
+            norm += ui * ui;
+        }
+        const double scale = (1.0 + noise * unif(gen)) / std::sqrt(norm);
+        std::string bbo;
+        for (const auto & ui : u)
+        {
+            bbo += std::to_string(ui * scale) + " ";
+        }
+        auto evalPoint = std::make_shared<NOMAD::EvalPoint>(NOMAD::Point(1, double(i)));
+        evalPoint->setBBO(bbo, bbOutputTypes, NOMAD::EvalType::BB);
+        points.push_back(evalPoint);
+    }
+    return points;
+}
+
+
+// Pairwise comparisons with all the points of the front, then sort after each block of points.
+size_t pairwiseUpdate(const std::vector<NOMAD::EvalPointPtr>& points,
+                      const NOMAD::FHComputeType& computeType,
+                      const size_t blockSize)
+{
+    std::vector<NOMAD::EvalPointPtr> front;
+    size_t nbInBlock = 0;
+    for (const auto & evalPoint : points)
+    {
+        bool isDominated = false;
+        std::vector<bool> keep(front.size(), true);
+        for (size_t i = 0; i < front.size(); ++i)
+        {
+            const auto compFlag = evalPoint->compMO(*front[i], computeType);
+            if (NOMAD::CompareType::DOMINATED == compFlag)
+            {
+                isDominated = true;
+                break;
+            }
+            if (NOMAD::CompareType::DOMINATING == compFlag)
+            {
+                keep[i] = false;
+            }
+        }
+        if (isDominated)
+        {
+            continue;
+        }
+        size_t ind = 0;
+        front.erase(std::remove_if(front.begin(), front.end(),
+                                   [&ind, &keep](const NOMAD::EvalPointPtr&) { return !keep[ind++]; }),
+                    front.end());
+        front.push_back(evalPoint);
+
+        if (++nbInBlock == blockSize)
+        {
+            nbInBlock = 0;
+            std::sort(front.begin(), front.end(),
+                      [computeType](const NOMAD::EvalPointPtr& ep1, const NOMAD::EvalPointPtr& ep2)->bool
+                      {
+                          return ep1->getFs(computeType).lexicographicalCmp(ep2->getFs(computeType));
+                      });
+        }
+    }
+    return front.size();
+}
+
+
+size_t paretoFrontUpdate(const std::vector<NOMAD::EvalPointPtr>& points,
+                         const NOMAD::FHComputeType& computeType)
+{
+    const NOMAD::ParetoFront paretoFront(computeType);
+    std::vector<NOMAD::EvalPointPtr> front;
+    for (const auto & evalPoint : points)
+    {
+        paretoFront.compareAndInsert(front, evalPoint);
+    }
+    return front.size();
+}
+
+
+// Hypervolume of the front after each insertion, either maintained
+// incrementally or recomputed. 2 objectives.
+double hypervolumeUpdate(const std::vector<NOMAD::EvalPointPtr>& points,
+                         const NOMAD::FHComputeType& computeType,
+                         const NOMAD::ArrayOfDouble& ref,
+                         const bool incremental)
+{
+    const NOMAD::ParetoFront paretoFront(computeType);
+    std::vector<NOMAD::EvalPointPtr> front;
+    NOMAD::Double hv = 0.0;
+    for (const auto & evalPoint : points)
+    {
+        const auto comparison = paretoFront.compare(front, evalPoint->getFs(computeType));
+        if (NOMAD::CompareType::DOMINATED == comparison.compFlag)
+        {
+            continue;
+        }
+        if (incremental)
+        {
+            hv += paretoFront.hypervolumeImprovement(front, evalPoint->getFs(computeType), comparison, ref);
+        }
+        paretoFront.insert(front, evalPoint, comparison);
+        if (!incremental)
+        {
+            hv = paretoFront.hypervolume(front, ref);
+        }
+    }
+    return hv.todouble();
+}
+
+
+// Hypervolume by slicing on the last objective, with a 2D sweep on each
+// slice: O(N^2 log N). 3 objectives.
+double slicingHypervolume(const std::vector<NOMAD::EvalPointPtr>& front,
+                          const NOMAD::FHComputeType& computeType,
+                          const NOMAD::ArrayOfDouble& ref)
+{
+    std::vector<std::vector<double>> fs;
+    for (const auto & evalPoint : front)
+    {
+        const auto& f = evalPoint->getFs(computeType);
+        fs.push_back({f[0].todouble(), f[1].todouble(), f[2].todouble()});
+    }
+    std::sort(fs.begin(), fs.end(),
+              [](const std::vector<double>& f1, const std::vector<double>& f2) { return f1[2] < f2[2]; });
+
+    double volume = 0.0;
+    std::vector<std::pair<double, double>> slice;
+    for (size_t i = 0; i < fs.size(); ++i)
+    {
+        slice.emplace_back(fs[i][0], fs[i][1]);
+        std::sort(slice.begin(), slice.end());
+        double area = 0.0;
+        double yMin = ref[1].todouble();
+        for (size_t j = 0; j < slice.size(); ++j)
+        {
+            if (slice[j].second < yMin)
+            {
+                double width = ref[0].todouble() - slice[j].first;
+                // Width until the next point of the slice with a better second objective.
+                for (size_t l = j + 1; l < slice.size(); ++l)
+                {
+                    if (slice[l].second < slice[j].second)
+                    {
+                        width = slice[l].first - slice[j].first;
+                        break;
+                    }
+                }
+                area += width * (ref[1].todouble() - slice[j].second);
+                yMin = slice[j].second;
+            }
+        }
+        const double zNext = (i + 1 < fs.size()) ? fs[i+1][2] : ref[2].todouble();
+        volume += area * (zNext - fs[i][2]);
+    }
+    return volume;
+}
+
+
+int main()
+{
+    const NOMAD::FHComputeType computeType = {NOMAD::EvalType::BB, NOMAD::defaultFHComputeTypeS};
+    const size_t blockSize = 8;   // Points per barrier update
+
+    std::cout << "nobj   points   front   pairwise (s)   ParetoFront (s)" << std::endl;
+    for (const size_t nobj : {2, 3, 5})
+    {
+        for (const size_t nbPoints : {1000, 2000, 4000})
+        {
+            const auto points = makePoints(nobj, nbPoints, 0.01);
+
+            auto start = std::chrono::steady_clock::now();
+            const size_t nbPairwise = pairwiseUpdate(points, computeType, blockSize);
+            const std::chrono::duration<double> tPairwise = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            const size_t nbParetoFront = paretoFrontUpdate(points, computeType);
+            const std::chrono::duration<double> tParetoFront = std::chrono::steady_clock::now() - start;
+
+            if (nbPairwise != nbParetoFront)
+            {
+                std::cerr << "Error: the fronts have different sizes: " << nbPairwise << " and " << nbParetoFront << std::endl;
+                return 1;
+            }
+
+            std::cout << nobj << "      " << nbPoints << "    " << nbParetoFront << "    "
+                      << tPairwise.count() << "    " << tParetoFront.count() << std::endl;
+        }
+    }
+
+    std::cout << std::endl << "nobj   points   hypervolume   recomputed (s)   incremental/sweep (s)" << std::endl;
+    for (const size_t nbPoints : {1000, 2000, 4000})
+    {
+        // 2 objectives: incremental update against recomputation.
+        const NOMAD::ArrayOfDouble ref2(2, 1.1);
+        const auto points = makePoints(2, nbPoints, 0.01);
+
+        auto start = std::chrono::steady_clock::now();
+        const double hvRecomputed = hypervolumeUpdate(points, computeType, ref2, false);
+        const std::chrono::duration<double> tRecomputed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        const double hvIncremental = hypervolumeUpdate(points, computeType, ref2, true);
+        const std::chrono::duration<double> tIncremental = std::chrono::steady_clock::now() - start;
+
+        if (std::fabs(hvRecomputed - hvIncremental) > 1e-9)
+        {
+            std::cerr << "Error: the hypervolumes are different: " << hvRecomputed << " and " << hvIncremental << std::endl;
+            return 1;
+        }
+        std::cout << "2      " << nbPoints << "    " << hvIncremental << "    "
+                  << tRecomputed.count() << "    " << tIncremental.count() << std::endl;
+    }
+    for (const size_t nbPoints : {1000, 2000, 4000})
+    {
+        // 3 objectives: dimension sweep against slicing, on the final front.
+        const NOMAD::ArrayOfDouble ref3(3, 1.1);
+        const NOMAD::ParetoFront paretoFront(computeType);
+        std::vector<NOMAD::EvalPointPtr> front;
+        for (const auto & evalPoint : makePoints(3, nbPoints, 0.01))
+        {
+            paretoFront.compareAndInsert(front, evalPoint);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        const double hvSlicing = slicingHypervolume(front, computeType, ref3);
+        const std::chrono::duration<double> tSlicing = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        const double hvSweep = paretoFront.hypervolume(front, ref3).todouble();
+        const std::chrono::duration<double> tSweep = std::chrono::steady_clock::now() - start;
+
+        if (std::fabs(hvSlicing - hvSweep) > 1e-9)
+        {
+            std::cerr << "Error: the hypervolumes are different: " << hvSlicing << " and " << hvSweep << std::endl;
+            return 1;
+        }
+        std::cout << "3      " << nbPoints << "    " << hvSweep << "    "
+                  << tSlicing.count() << "    " << tSweep.count() << std::endl;
+    }
+
+    return 0;
+}
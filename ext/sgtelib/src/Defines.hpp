@@ -62,6 +62,10 @@ namespace SGTELIB {
   const double INF = std::numeric_limits<double>::max(); ///< Infinity
   const double NaN = std::numeric_limits<double>::quiet_NaN();
 
+  // The prediction kernels (design matrices, kernel values) share the
+  // rows of their matrix between threads above this number of terms.
+  const double PARALLEL_MIN_TERMS = 1E5;
+
   const bool APPROX_CDF = true;
   // If true, then the lower bound of standard deviation is EPSILON. 
   // This allows to avoid flat EI and P functions. 
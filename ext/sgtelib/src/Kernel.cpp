@@ -299,24 +299,126 @@ double SGTELIB::kernel (  const SGTELIB::kernel_t kt ,
   } // end switch
 }//
 
+/*----------------------------------------------*/
+/*  Apply the kernel f to each term of R. The   */
+/*  rows are shared between threads when R has  */
+/*  more than PARALLEL_MIN_TERMS terms.         */
+/*----------------------------------------------*/
+namespace {
+  template <typename F>
+  void kernel_rows ( SGTELIB::Matrix * R , const F & f ){
+    const int nbRows = R->get_nb_rows();
+    const int nbCols = R->get_nb_cols();
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) if ( double(nbRows)*nbCols > SGTELIB::PARALLEL_MIN_TERMS )
+    #endif
+    for (int i=0 ; i<nbRows ; i++){
+      double * r = R->get_row_data(i);
+      for (int j=0 ; j<nbCols ; j++){
+        r[j] = f(r[j]);
+      }
+    }
+  }//
+}
+
 /*----------------------------------------------*/
 /*       Compute the value of the kernel        */
 /*----------------------------------------------*/
 SGTELIB::Matrix SGTELIB::kernel (  const SGTELIB::kernel_t kt , 
                                    const double ks ,
                                    SGTELIB::Matrix R ){
-
-  const int nbRows = R.get_nb_rows();
-  const int nbCols = R.get_nb_cols();
-  int i,j;
-  for (i=0 ; i<nbRows ; i++){
-    for (j=0 ; j<nbCols ; j++){
-      R.set(i,j,kernel(kt,ks,R.get(i,j)));
-    }
-  }
+  kernel(kt,ks,&R);
   return R;
 }//
 
+/*----------------------------------------------*/
+/*  Compute the value of the kernel, in place   */
+/*----------------------------------------------*/
+// Same values as kernel(kt,ks,r), but the kernel type is only
+// tested once for the whole matrix.
+void SGTELIB::kernel (  const SGTELIB::kernel_t kt , 
+                        const double ks ,
+                        SGTELIB::Matrix * R ){
+
+  switch (kt){
+    case SGTELIB::KERNEL_D1:
+      // Gaussian
+      kernel_rows(R,[ks](const double r){ return exp(-PI*ks*ks*r*r); });
+      break;
+    case SGTELIB::KERNEL_D2:
+      // Inverse Quadratic
+      kernel_rows(R,[ks](const double r){ return 1.0/(1.0+PI*PI*ks*ks*r*r); });
+      break;
+    case SGTELIB::KERNEL_D3:
+      // Inverse Multiquadratic
+      kernel_rows(R,[ks](const double r){ return 1.0/sqrt(1.0+52.015*ks*ks*r*r); });
+      break;
+    case SGTELIB::KERNEL_D4:
+      // Bi-quadratic 
+      kernel_rows(R,[ks](const double r){
+        double ksr = fabs(ks*r)*16.0/15.0;
+        if (ksr<=1){
+          double d = (1-ksr*ksr);
+          return d*d;
+        }
+        return 0.0;
+      });
+      break;
+    case SGTELIB::KERNEL_D5:
+      // Tri-cubic
+      kernel_rows(R,[ks](const double r){
+        double ksr = fabs(ks*r)*162.0/140.0;
+        if (ksr<=1.0){
+          double d = (1-ksr*ksr*ksr);
+          return d*d*d;
+        }   
+        return 0.0;
+      });
+      break;
+    case SGTELIB::KERNEL_D6:
+      // Exp-Root
+      kernel_rows(R,[ks](const double r){ return exp(-sqrt(4*ks*r)); });
+      break;
+    case SGTELIB::KERNEL_D7:
+      // Epanechnikov
+      kernel_rows(R,[ks](const double r){
+        double ksr = fabs(ks*r);
+        if (ksr<=3/4) return double(1-(16/9)*ksr*ksr);
+        return 0.0;
+      });
+      break;
+    case SGTELIB::KERNEL_I0:
+      // Multiquadratic
+      kernel_rows(R,[ks](const double r){ return sqrt(1.0+ks*ks*r*r); });
+      break;
+    case SGTELIB::KERNEL_I1:
+      // Polyharmonique spline (k=1)
+      break;
+    case SGTELIB::KERNEL_I2:
+      // Polyharmonique spline (k=2) (Thin Plate Splin)
+      kernel_rows(R,[](const double r){
+        if (r==0.0) return 0.0;
+        return log(r)*r*r;
+      });
+      break;
+    case SGTELIB::KERNEL_I3:
+      // Polyharmonique spline (k=3)
+      kernel_rows(R,[](const double r){ return r*r*r; });
+      break;
+    case SGTELIB::KERNEL_I4:
+      // Polyharmonique spline (k=4)
+      kernel_rows(R,[](const double r){
+        if (r==0.0) return 0.0;
+        double r2 = r*r;
+        return r2*r2*log(r);
+      });
+      break;
+    default:
+      throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+               "kernel: undefined kernel type" );
+  } // end switch
+}//
+
 
 
 
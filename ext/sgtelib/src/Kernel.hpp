@@ -52,6 +52,7 @@ namespace SGTELIB {
   // kernel
   double kernel ( const SGTELIB::kernel_t kt , const double ks ,const double r );
   SGTELIB::Matrix kernel ( const SGTELIB::kernel_t kt , const double ks , SGTELIB::Matrix R );
+  void kernel ( const SGTELIB::kernel_t kt , const double ks , SGTELIB::Matrix * R );
   // kernel is decreasing ?
   bool kernel_is_decreasing ( const SGTELIB::kernel_t kt );
   // kernel has a shape parameter ?
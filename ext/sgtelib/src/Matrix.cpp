@@ -25,6 +25,71 @@
 
 #include "Matrix.hpp"
 
+/*---------------------------------------------------*/
+/* Block sizes of the products and of the Cholesky   */
+/* factorization. A block of BLOCK_INTER rows of B   */
+/* and BLOCK_COLS columns (128 KB) stays in cache    */
+/* while it is used for BLOCK_ROWS rows of C.        */
+/* The products and the distances are parallel       */
+/* (OpenMP) when they have more than                 */
+/* PARALLEL_MIN_FLOPS multiplications.               */
+/* The triangular solves of the inverses treat       */
+/* BLOCK_RHS right-hand sides at once.               */
+/* Within a block, each term of C still accumulates  */
+/* its products in the order of the inner index, so  */
+/* the results are the same as with the plain loops. */
+/*---------------------------------------------------*/
+namespace {
+  const int    BLOCK_ROWS  = 32;
+  const int    BLOCK_INTER = 64;
+  const int    BLOCK_COLS  = 256;
+  const int    BLOCK_RHS   = 64;
+  const double PARALLEL_MIN_FLOPS = 1e6;
+
+  /*---------------------------------------------------*/
+  /* Forward substitution L*Y = B, in place in Y (=B), */
+  /* for the columns k0 to k1-1. L is lower triangular */
+  /* with a unit diagonal if unit_diag is true.        */
+  /* The rows of a block of BLOCK_ROWS rows are first  */
+  /* updated with each block of previous rows, which   */
+  /* stays in cache, and then with the rows of their   */
+  /* own block.                                        */
+  /*---------------------------------------------------*/
+  void tril_solve_rows ( double * const * Y ,
+                         const double * const * L ,
+                         const int n ,
+                         const int k0 ,
+                         const int k1 ,
+                         const bool unit_diag ) {
+    for (int i0=0 ; i0<n ; i0+=BLOCK_ROWS){
+      const int i1 = std::min(i0+BLOCK_ROWS,n);
+      for (int j0=0 ; j0<i0 ; j0+=BLOCK_ROWS){
+        const int j1 = j0+BLOCK_ROWS;
+        for (int i=i0 ; i<i1 ; i++){
+          double * Yi = Y[i];
+          for (int j=j0 ; j<j1 ; j++){
+            const double a = L[i][j];
+            const double * Yj = Y[j];
+            for (int k=k0 ; k<k1 ; k++) Yi[k] -= a*Yj[k];
+          }
+        }
+      }
+      for (int i=i0 ; i<i1 ; i++){
+        double * Yi = Y[i];
+        for (int j=i0 ; j<i ; j++){
+          const double a = L[i][j];
+          const double * Yj = Y[j];
+          for (int k=k0 ; k<k1 ; k++) Yi[k] -= a*Yj[k];
+        }
+        if ( ! unit_diag){
+          const double d = L[i][i];
+          for (int k=k0 ; k<k1 ; k++) Yi[k] /= d;
+        }
+      }
+    }
+  }
+}
+
 /*---------------------------*/
 /*        constructor 1      */
 /*---------------------------*/
@@ -39,15 +104,8 @@ SGTELIB::Matrix::Matrix ( const std::string & name ,
     throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
              "Matrix::constructor 1: bad dimensions" );
 
-
-  int i , j;
-
-  _X = new double * [_nbRows];
-  for ( i = 0 ; i < _nbRows ; ++i ) {
-    _X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      _X[i][j] = 0.0;
-  }
+  allocate(_nbRows);
+  std::fill ( _data , _data+_nbRows*_nbCols , 0.0 );
 }//
 
 /*---------------------------*/
@@ -64,14 +122,9 @@ SGTELIB::Matrix::Matrix ( const std::string & name ,
     throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
               "Matrix::constructor 2: bad dimensions" );
 
-  int i , j;
-
-  _X = new double * [_nbRows];
-  for ( i = 0 ; i < _nbRows ; ++i ) {
-    _X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      _X[i][j] = A[i][j];
-  }
+  allocate(_nbRows);
+  for ( int i = 0 ; i < _nbRows ; ++i )
+    std::copy ( A[i] , A[i]+_nbCols , _X[i] );
 }//
 
 /*---------------------------*/
@@ -81,7 +134,9 @@ SGTELIB::Matrix::Matrix ( const std::string & file_name ) :
                   _name ( "no_name" ) ,
                   _nbRows    ( 0         ) ,
                   _nbCols    ( 0         ) ,
-                  _X    ( NULL      )   {
+                  _X    ( NULL      ) ,
+                  _data ( NULL      ) ,
+                  _rowCapacity ( 0  )   {
   *this = import_data(file_name);
 }//
 
@@ -93,7 +148,7 @@ SGTELIB::Matrix::Matrix (void) :
                _name ( "" ) ,
                _nbRows    ( 0   ) ,
                _nbCols    ( 0   ) {
-  _X = new double * [0];
+  allocate(0);
 }//
 
 /*---------------------------*/
@@ -106,8 +161,7 @@ SGTELIB::Matrix::Matrix (double v) :
   #ifdef SGTELIB_DEBUG
     std::cout << "Matrix Constructor 5\n";
   #endif
-  _X = new double * [1];
-  _X[0] = new double [1];
+  allocate(1);
   _X[0][0] = v;
 }//
 
@@ -123,13 +177,8 @@ SGTELIB::Matrix::Matrix ( const SGTELIB::Matrix & A ) :
   if ( _nbRows < 0 || _nbCols < 0 )
     throw SGTELIB::Exception ( __FILE__ , __LINE__ ,"Matrix::constructor copy : bad dimensions" );
 
-  int i , j;
-  _X = new double * [_nbRows];
-  for ( i = 0 ; i < _nbRows ; ++i ) {
-    _X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      _X[i][j] = A._X[i][j];
-  }
+  allocate(_nbRows);
+  std::copy ( A._data , A._data+_nbRows*_nbCols , _data );
 }//
 
 
@@ -143,29 +192,13 @@ SGTELIB::Matrix & SGTELIB::Matrix::operator = ( const SGTELIB::Matrix & A ) {
   if ( this == &A )
     return *this;
 
-  int i , j;
-
-  if ( _nbRows != A._nbRows || _nbCols != A._nbCols ) {
-
-    for ( i = 0 ; i < _nbRows ; ++i )
-      delete [] _X[i];
-    delete [] _X;
-
-    _nbRows = A._nbRows;
+  if ( _nbCols != A._nbCols || _rowCapacity < A._nbRows ) {
+    deallocate();
     _nbCols = A._nbCols;
-
-    _X = new double * [_nbRows];
-    for ( i = 0 ; i < _nbRows ; ++i ) {
-      _X[i] = new double [_nbCols];
-      for ( j = 0 ; j < _nbCols ; ++j )
-        _X[i][j] = A._X[i][j];
-    }
-  }
-  else {
-    for ( i = 0 ; i < _nbRows ; ++i )
-      for ( j = 0 ; j < _nbCols ; ++j )
-        _X[i][j] = A._X[i][j];
+    allocate(A._nbRows);
   }
+  _nbRows = A._nbRows;
+  std::copy ( A._data , A._data+_nbRows*_nbCols , _data );
 
   _name = A._name;
 
@@ -351,9 +384,7 @@ SGTELIB::Matrix::~Matrix ( void ) {
     std::cout.flush();
   #endif
   */
-  for ( int i = 0 ; i < _nbRows ; ++i )
-    delete [] _X[i];
-  delete [] _X;
+  deallocate();
   /*
   #ifdef SGTELIB_DEBUG
     std::cout << "Deleted.\n";
@@ -362,21 +393,61 @@ SGTELIB::Matrix::~Matrix ( void ) {
 }//
 
 /*---------------------------*/
-/*        add one row        */
+/*          storage          */
 /*---------------------------*/
-void SGTELIB::Matrix::add_row  ( const double * row ) {
+void SGTELIB::Matrix::allocate ( const int rowCapacity ) {
+  _rowCapacity = rowCapacity;
+  _data = new double [_rowCapacity*_nbCols];
+  // _X has at least one element, so that testNull() can read _X[0].
+  _X = new double * [std::max(_rowCapacity,1)];
+  set_row_pointers();
+}//
 
-  double ** new_X = new double * [_nbRows+1];
+void SGTELIB::Matrix::deallocate ( void ) {
+  delete [] _data;
+  delete [] _X;
+  _data = NULL;
+  _X = NULL;
+  _rowCapacity = 0;
+}//
 
-  for ( int i = 0 ; i < _nbRows ; ++i )
-    new_X[i] = _X[i];
+void SGTELIB::Matrix::set_row_pointers ( void ) {
+  if ( _rowCapacity == 0 ) {
+    _X[0] = nullptr;
+    return;
+  }
+  for ( int i = 0 ; i < _rowCapacity ; ++i )
+    _X[i] = _data + i*_nbCols;
+}//
 
-  new_X[_nbRows] = new double [_nbCols];
-  for ( int j = 0 ; j < _nbCols ; ++j )
-    new_X[_nbRows][j] = row[j];
+/*---------------------------------------*/
+/*  make room for nbRows rows            */
+/*  (the capacity grows geometrically,   */
+/*  so that adding rows one at a time    */
+/*  does not copy the matrix each time)  */
+/*---------------------------------------*/
+void SGTELIB::Matrix::reserve_rows ( const int nbRows ) {
 
-  delete [] _X;
-  _X = new_X;
+  if ( nbRows <= _rowCapacity )
+    return;
+
+  double *  old_data = _data;
+  double ** old_X    = _X;
+
+  allocate ( std::max ( nbRows , 2*_rowCapacity ) );
+  std::copy ( old_data , old_data+_nbRows*_nbCols , _data );
+
+  delete [] old_data;
+  delete [] old_X;
+}//
+
+/*---------------------------*/
+/*        add one row        */
+/*---------------------------*/
+void SGTELIB::Matrix::add_row  ( const double * row ) {
+
+  reserve_rows ( _nbRows+1 );
+  std::copy ( row , row+_nbCols , _data+_nbRows*_nbCols );
   ++_nbRows;
 }//
 
@@ -389,22 +460,17 @@ void SGTELIB::Matrix::add_rows ( const Matrix & A ) {
     throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
              "Matrix::add_rows(): bad dimensions" );
 
-  int i , j;
-  int new_nbRows = _nbRows + A._nbRows;
-
-  double ** new_X = new double * [new_nbRows];
-
-  for ( i = 0 ; i < _nbRows ; ++i )
-    new_X[i] = _X[i];
-
-  for ( i = _nbRows ; i < new_nbRows ; ++i ) {
-    new_X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      new_X[i][j] = A._X[i-_nbRows][j];
+  // A may be *this: copy before the storage is reallocated.
+  if ( this == &A ) {
+    const SGTELIB::Matrix B ( A );
+    add_rows ( B );
+    return;
   }
 
-  delete [] _X;
-  _X = new_X;
+  const int new_nbRows = _nbRows + A._nbRows;
+
+  reserve_rows ( new_nbRows );
+  std::copy ( A._data , A._data+A._nbRows*_nbCols , _data+_nbRows*_nbCols );
   _nbRows = new_nbRows;
 }//
 
@@ -417,26 +483,30 @@ void SGTELIB::Matrix::add_cols ( const Matrix & A ) {
     throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
              "Matrix::add_cols(): bad dimensions" );
 
-  int i , j;
-  int new_nbCols = _nbCols + A._nbCols;
-  double * x;
+  // A may be *this: copy before the storage is reallocated.
+  if ( this == &A ) {
+    const SGTELIB::Matrix B ( A );
+    add_cols ( B );
+    return;
+  }
+
+  int i;
+  const int old_nbCols = _nbCols;
+  double *  old_data = _data;
+  double ** old_X    = _X;
+
+  _nbCols += A._nbCols;
+  allocate ( _nbRows );
 
   for ( i = 0 ; i < _nbRows ; ++i ) {
-    // Complete line
-    x = new double [new_nbCols];
     // Original columns
-    for ( j = 0 ; j < _nbCols ; ++j )
-      x[j] = _X[i][j];
+    std::copy ( old_X[i] , old_X[i]+old_nbCols , _X[i] );
     // Additional columns
-    for ( j = _nbCols ; j < new_nbCols ; ++j )
-      x[j] = A._X[i][j-_nbCols];
-    // Remove original line
-    delete [] _X[i];
-    // Put new line
-    _X[i] = x;
+    std::copy ( A._X[i] , A._X[i]+A._nbCols , _X[i]+old_nbCols );
   }
 
-  _nbCols = new_nbCols;
+  delete [] old_data;
+  delete [] old_X;
 }//
 
 /*---------------------------------*/
@@ -444,23 +514,10 @@ void SGTELIB::Matrix::add_cols ( const Matrix & A ) {
 /*---------------------------------*/
 void SGTELIB::Matrix::add_rows ( const int p ) {
 
-  int i , j;
-  int new_nbRows = _nbRows + p;
-
-  double ** new_X = new double * [new_nbRows];
-
-  for ( i = 0 ; i < _nbRows ; ++i )
-    new_X[i] = _X[i];
-
-  for ( i = _nbRows ; i < new_nbRows ; ++i ) {
-    new_X[i] = new double [_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      new_X[i][j] = 0.0;
-  }
+  const int new_nbRows = _nbRows + p;
 
-  delete [] _X;
-
-  _X = new_X;
+  reserve_rows ( new_nbRows );
+  std::fill ( _data+_nbRows*_nbCols , _data+new_nbRows*_nbCols , 0.0 );
   _nbRows = new_nbRows;
 }//
 
@@ -468,21 +525,8 @@ void SGTELIB::Matrix::add_rows ( const int p ) {
 /*         remove last rows        */
 /*---------------------------------*/
 void SGTELIB::Matrix::remove_rows ( const int p ) {
-
-  int i;
-  int new_nbRows = _nbRows - p;
-
-  double ** new_X = new double * [new_nbRows];
-
-  for ( i = 0 ; i < new_nbRows ; ++i )
-    new_X[i] = _X[i];
-
-  for ( i = new_nbRows ; i < _nbRows ; ++i )
-    delete [] _X[i];
-
-  delete [] _X;
-  _X = new_X;
-  _nbRows = new_nbRows;
+  // The storage is kept for the rows that may be added later.
+  _nbRows -= p;
 }//
 
 /*---------------------------------*/
@@ -490,22 +534,21 @@ void SGTELIB::Matrix::remove_rows ( const int p ) {
 /*---------------------------------*/
 void SGTELIB::Matrix::add_cols ( const int p ) {
 
-  int i , j;
-  int new_nbCols = _nbCols + p;
+  int i;
+  const int old_nbCols = _nbCols;
+  double *  old_data = _data;
+  double ** old_X    = _X;
 
-  double * x;
+  _nbCols += p;
+  allocate ( _nbRows );
 
   for ( i = 0 ; i < _nbRows ; ++i ) {
-    x = new double [new_nbCols];
-    for ( j = 0 ; j < _nbCols ; ++j )
-      x[j] = _X[i][j];
-    for ( j = _nbCols ; j < new_nbCols ; ++j )
-      x[j] = 0.0;
-    delete [] _X[i];
-    _X[i] = x;
+    std::copy ( old_X[i] , old_X[i]+old_nbCols , _X[i] );
+    std::fill ( _X[i]+old_nbCols , _X[i]+_nbCols , 0.0 );
   }
 
-  _nbCols = new_nbCols;
+  delete [] old_data;
+  delete [] old_X;
 }//
 
 /*-----------------------------------------*/
@@ -563,18 +606,13 @@ void SGTELIB::Matrix::fill ( double v ) {
 }//
 
 /*---------------------------*/
-/*     set element (i,j)     */
+/*  error of set element     */
 /*---------------------------*/
-void SGTELIB::Matrix::set ( const int i , const int j , const double d ) {
-
-    if ( i < 0 || i >= _nbRows || j < 0 || j >= _nbCols ){
-      display(std::cout);
-      std::cout << "Error: try to set (" << i << "," << j << ") while dim is [" << _nbRows << "," << _nbCols << "]\n";
-      std::cout.flush();
-      throw SGTELIB::Exception ( __FILE__ , __LINE__ , "Matrix::set(i,j): bad index" );
-    }
-
-  _X[i][j] = d;
+void SGTELIB::Matrix::set_bad_index ( const int i , const int j ) const {
+  display(std::cout);
+  std::cout << "Error: try to set (" << i << "," << j << ") while dim is [" << _nbRows << "," << _nbCols << "]\n";
+  std::cout.flush();
+  throw SGTELIB::Exception ( __FILE__ , __LINE__ , "Matrix::set(i,j): bad index" );
 }//
 
 void SGTELIB::Matrix::set_row (const SGTELIB::Matrix & T , const int i){
@@ -936,18 +974,45 @@ void SGTELIB::Matrix::inplace_product(
     }
 
     // Compute
-    int i,j,k;
     const int nb_rows = C.get_nb_rows();
     const int nb_cols = C.get_nb_cols();
     const int nb_inter= A.get_nb_cols();
-    //double v;
-    for ( i = 0 ; i < nb_rows ; ++i ) {
-        for ( j = 0 ; j < nb_cols ; ++j ){
-            C._X[i][j] = 0;
-        }
-        for ( k = 0 ; k < nb_inter; ++k ){
-            for ( j = 0 ; j < nb_cols ; ++j ){
-                C._X[i][j] += A._X[i][k]*B._X[k][j];
+    std::fill ( C._data , C._data+nb_rows*nb_cols , 0.0 );
+    block_product ( C , A , B , nb_rows , nb_inter , nb_cols );
+}//
+
+/*---------------------------------------------------*/
+/* C += A*B on the p first rows and r first columns  */
+/* of C, with the q first columns of A and the q     */
+/* first rows of B.                                  */
+/*---------------------------------------------------*/
+void SGTELIB::Matrix::block_product ( SGTELIB::Matrix & C,
+                                      const SGTELIB::Matrix & A,
+                                      const SGTELIB::Matrix & B,
+                                      const int p,
+                                      const int q,
+                                      const int r )
+{
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) if ( double(p)*q*r > PARALLEL_MIN_FLOPS )
+    #endif
+    for ( int i0 = 0 ; i0 < p ; i0 += BLOCK_ROWS ) {
+        const int i1 = std::min ( i0+BLOCK_ROWS , p );
+        for ( int k0 = 0 ; k0 < q ; k0 += BLOCK_INTER ) {
+            const int k1 = std::min ( k0+BLOCK_INTER , q );
+            for ( int j0 = 0 ; j0 < r ; j0 += BLOCK_COLS ) {
+                const int j1 = std::min ( j0+BLOCK_COLS , r );
+                for ( int i = i0 ; i < i1 ; ++i ) {
+                    double * Ci = C._X[i];
+                    const double * Ai = A._X[i];
+                    for ( int k = k0 ; k < k1 ; ++k ) {
+                        const double a = Ai[k];
+                        const double * Bk = B._X[k];
+                        for ( int j = j0 ; j < j1 ; ++j ) {
+                            Ci[j] += a*Bk[j];
+                        }
+                    }
+                }
             }
         }
     }
@@ -1092,13 +1157,7 @@ SGTELIB::Matrix SGTELIB::Matrix::subset_product (const SGTELIB::Matrix & A,
   }
 
   SGTELIB::Matrix C("A*B",p,r);
-  for (int i=0 ; i<p ; i++){
-    for (int j=0 ; j<r ; j++){
-      for (int k=0 ; k<q ; k++){
-        C._X[i][j] += A._X[i][k]*B._X[k][j];
-      }
-    }
-  }
+  block_product ( C , A , B , p , q , r );
   return C;
 
 }//
@@ -1123,11 +1182,9 @@ SGTELIB::Matrix SGTELIB::Matrix::hadamard_product ( const SGTELIB::Matrix & A,
   SGTELIB::Matrix C(A.get_name()+".*"+B.get_name(),nb_rows,nb_cols);
 
   // Compute
-  int i,j;
-  for ( i = 0 ; i < nb_rows ; ++i ) {
-    for ( j = 0 ; j < nb_cols ; ++j ){
-      C.set(i,j,A.get(i,j)*B.get(i,j));
-    }
+  const int n = nb_rows*nb_cols;
+  for ( int k = 0 ; k < n ; ++k ) {
+    C._data[k] = A._data[k]*B._data[k];
   }
   return C;
 }//
@@ -1374,16 +1431,43 @@ SGTELIB::Matrix SGTELIB::Matrix::transposeA_product ( const SGTELIB::Matrix & A,
   SGTELIB::Matrix C(A.get_name()+"'*"+B.get_name(),A.get_nb_cols(),B.get_nb_cols());
 
   // Compute
-  int i,j,k;
   const int nb_rows = C.get_nb_rows();
   const int nb_cols = C.get_nb_cols();
   const int nb_inter= A.get_nb_rows();
-  //double v;
-  for ( i = 0 ; i < nb_rows ; ++i ) {
-    for ( j = 0 ; j < nb_cols ; ++j ){
-      C._X[i][j] = 0;
-      for ( k = 0 ; k < nb_inter; ++k ){
-        C._X[i][j] += A._X[k][i]*B._X[k][j];
+
+  // A'*A is symmetric: only compute the upper triangle.
+  const bool symmetric = ( &A == &B );
+
+  // Same blocks as block_product, where the row i of A' is
+  // the column i of A.
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) if ( double(nb_rows)*nb_inter*nb_cols > PARALLEL_MIN_FLOPS )
+  #endif
+  for ( int i0 = 0 ; i0 < nb_rows ; i0 += BLOCK_ROWS ) {
+    const int i1 = std::min ( i0+BLOCK_ROWS , nb_rows );
+    for ( int k0 = 0 ; k0 < nb_inter ; k0 += BLOCK_INTER ) {
+      const int k1 = std::min ( k0+BLOCK_INTER , nb_inter );
+      for ( int j0 = (symmetric) ? i0 : 0 ; j0 < nb_cols ; j0 += BLOCK_COLS ) {
+        const int j1 = std::min ( j0+BLOCK_COLS , nb_cols );
+        for ( int i = i0 ; i < i1 ; ++i ) {
+          double * Ci = C._X[i];
+          const int jmin = (symmetric) ? std::max ( j0 , i ) : j0;
+          for ( int k = k0 ; k < k1 ; ++k ) {
+            const double a = A._X[k][i];
+            const double * Bk = B._X[k];
+            for ( int j = jmin ; j < j1 ; ++j ) {
+              Ci[j] += a*Bk[j];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  if ( symmetric ) {
+    for ( int i = 0 ; i < nb_rows ; ++i ) {
+      for ( int j = 0 ; j < i ; ++j ) {
+        C._X[i][j] = C._X[j][i];
       }
     }
   }
@@ -1995,17 +2079,26 @@ SGTELIB::Matrix SGTELIB::Matrix::cholesky ( void ) const {
   const int n = get_nb_rows();
   SGTELIB::Matrix L ("L",n,n);
 
+  // The rows of L are computed by blocks of BLOCK_ROWS rows,
+  // so that each row j of L is read once per block instead of
+  // once per row. The term (i,j) only needs the row j and the
+  // first j terms of the row i, which are computed before.
   double s;
   int i,j,k;
-  for (i = 0; i < n; i++) {
-    for (j = 0; j < (i+1); j++) {
-      s = 0;
-      for (k = 0; k < j; k++){
-        s += L._X[i][k] * L._X[j][k];
+  for (int i0 = 0 ; i0 < n ; i0 += BLOCK_ROWS) {
+    const int i1 = std::min ( i0+BLOCK_ROWS , n );
+    for (j = 0; j < i1; j++) {
+      const double * Lj = L._X[j];
+      for (i = std::max(i0,j); i < i1; i++) {
+        const double * Li = L._X[i];
+        s = 0;
+        for (k = 0; k < j; k++){
+          s += Li[k] * Lj[k];
+        }
+        L._X[i][j] = (i == j) ?
+           sqrt(_X[i][i] - s) :
+           (1.0 / Lj[j] * (_X[i][j] - s));
       }
-      L._X[i][j] = (i == j) ?
-         sqrt(_X[i][i] - s) :
-         (1.0 / L._X[j][j] * (_X[i][j] - s));
     }
   }
   return L;
@@ -2021,35 +2114,185 @@ SGTELIB::Matrix SGTELIB::Matrix::cholesky_inverse ( void ) const {
 
 SGTELIB::Matrix SGTELIB::Matrix::cholesky_inverse ( double * det ) const {
   SGTELIB::Matrix L  = cholesky();
+  if (det) *det = cholesky_factor_det(L);
+  return cholesky_factor_inverse(L);
+}//
+
+/*--------------------------------------*/
+/*  inverse of L*L' from its Cholesky   */
+/*  factor L                            */
+/*--------------------------------------*/
+SGTELIB::Matrix SGTELIB::Matrix::cholesky_factor_inverse ( const SGTELIB::Matrix & L ) {
   SGTELIB::Matrix Li = tril_inverse(L);
 
-  const int n = _nbRows;
+  const int n = L._nbRows;
 
   // Compute A = Li'*Li
   // Note: by taking into account the fact that Li is tri inf,
   // It is possible to divide the cost of the computation
   // of Li'*Li by 3.
+  // The term (i,j) is the sum for k>=max(i,j) of Li(k,i)*Li(k,j).
+  // It is accumulated row by row of Li, which are contiguous.
   SGTELIB::Matrix A ("A",n,n);
-  int i,j,k,kmin;
+  int i,j,k;
   for (i=0 ; i<n ; i++){
-    for (j=0 ; j<n ; j++){
-      A._X[i][j] = 0;
-      kmin = std::max(i,j);
-      for (k=kmin ; k<n ; k++){
-          A._X[i][j] += Li._X[k][i]*Li._X[k][j];
+    double * Ai = A._X[i];
+    for (k=i ; k<n ; k++){
+      const double a = Li._X[k][i];
+      const double * Lik = Li._X[k];
+      for (j=0 ; j<=k ; j++){
+        Ai[j] += a*Lik[j];
       }
     }
   }
 
-  if (det){
-    double v = 1;
-    for (i=0 ; i<n ; i++) v *= L._X[i][i];
-    v *= v;
-    if ( isnan(v)) v=+INF;
-    *det = v;
+  return A;
+}//
+
+/*--------------------------------------*/
+/*  determinant of L*L' from its        */
+/*  Cholesky factor L                   */
+/*--------------------------------------*/
+double SGTELIB::Matrix::cholesky_factor_det ( const SGTELIB::Matrix & L ) {
+  double v = 1;
+  for (int i=0 ; i<L._nbRows ; i++) v *= L._X[i][i];
+  v *= v;
+  if ( isnan(v)) v=+INF;
+  return v;
+}//
+
+/*--------------------------------------------*/
+/*  add rows to a Cholesky factor             */
+/*  L is the factor of the p first rows and   */
+/*  cols of a symmetric matrix, and A its k   */
+/*  last rows. The new rows of L are computed */
+/*  as in cholesky(), so L is the same as the */
+/*  factor of the whole matrix. Returns false */
+/*  if a pivot is not positive, or has lost   */
+/*  most of its digits.                       */
+/*--------------------------------------------*/
+bool SGTELIB::Matrix::cholesky_add_rows ( SGTELIB::Matrix & L ,
+                                          const SGTELIB::Matrix & A ) {
+
+  const int p = L._nbRows;
+  const int k = A._nbRows;
+  if ( (L._nbCols!=p) || (A._nbCols!=p+k) ){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Matrix::cholesky_add_rows(): dimension error" );
+  }
+
+  L.add_cols(k);
+  L.add_rows(k);
+
+  double s , d;
+  int i,j,l;
+  for (i=p ; i<p+k ; i++){
+    double * Li = L._X[i];
+    const double * Ai = A._X[i-p];
+    for (j=0 ; j<=i ; j++){
+      const double * Lj = L._X[j];
+      s = 0;
+      for (l=0 ; l<j ; l++){
+        s += Li[l] * Lj[l];
+      }
+      if (i==j){
+        d = Ai[i] - s;
+        if ( ! (d > EPSILON*fabs(Ai[i])) ) return false;
+        Li[i] = sqrt(d);
+      }
+      else{
+        Li[j] = 1.0 / Lj[j] * (Ai[j] - s);
+      }
+    }
+  }
+  return true;
+}//
+
+/*--------------------------------------------*/
+/*  add rows to the inverse of L*L'           */
+/*  Ai is the inverse of the p first rows and */
+/*  cols of L*L'. With L = [L11 0 ; L21 L22], */
+/*  the inverse of L is [Li11 0 ; M Li22]     */
+/*  where M = -Li22*L21*Li11, so the inverse  */
+/*  of L*L' is                                */
+/*    [ Ai + M'*M , M'*Li22 ; Li22'*M , Li22'*Li22 ] */
+/*  which costs O(p^2*k) instead of O(p^3).   */
+/*--------------------------------------------*/
+void SGTELIB::Matrix::cholesky_inverse_add_rows ( SGTELIB::Matrix & Ai ,
+                                                  const SGTELIB::Matrix & L ) {
+
+  const int p = Ai._nbRows;
+  const int n = L._nbRows;
+  const int k = n-p;
+  if ( (Ai._nbCols!=p) || (L._nbCols!=n) || (k<0) ){
+    throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
+             "Matrix::cholesky_inverse_add_rows(): dimension error" );
+  }
+  if (k==0) return;
+
+  int i,j,r,l;
+
+  // M = -L21*Li11, by solving M*L11 = -L21, row by row.
+  SGTELIB::Matrix M ("M",k,p);
+  for (r=0 ; r<k ; r++){
+    double * Mr = M._X[r];
+    const double * L21r = L._X[p+r];
+    for (j=0 ; j<p ; j++) Mr[j] = -L21r[j];
+    for (i=p-1 ; i>=0 ; i--){
+      const double * L11i = L._X[i];
+      Mr[i] /= L11i[i];
+      const double m = Mr[i];
+      for (j=0 ; j<i ; j++) Mr[j] -= m*L11i[j];
+    }
+  }
+
+  // L22 and its inverse
+  SGTELIB::Matrix L22 ("L22",k,k);
+  for (r=0 ; r<k ; r++){
+    std::copy ( L._X[p+r]+p , L._X[p+r]+n , L22._X[r] );
+  }
+  const SGTELIB::Matrix Li22 = tril_inverse(L22);
+
+  // M = Li22*M, from the last row, which is the only one
+  // to use all the rows of M.
+  for (r=k-1 ; r>=0 ; r--){
+    double * Mr = M._X[r];
+    const double d = Li22._X[r][r];
+    for (j=0 ; j<p ; j++) Mr[j] *= d;
+    for (l=0 ; l<r ; l++){
+      const double a = Li22._X[r][l];
+      const double * Ml = M._X[l];
+      for (j=0 ; j<p ; j++) Mr[j] += a*Ml[j];
+    }
+  }
+
+  const SGTELIB::Matrix Ai22 = cholesky_factor_inverse(L22);
+
+  Ai.add_cols(k);
+  Ai.add_rows(k);
+
+  // Ai11 += M'*M
+  for (r=0 ; r<k ; r++){
+    const double * Mr = M._X[r];
+    for (i=0 ; i<p ; i++){
+      double * Aii = Ai._X[i];
+      const double m = Mr[i];
+      for (j=0 ; j<p ; j++) Aii[j] += m*Mr[j];
+    }
+  }
+
+  // Ai21 = Li22'*M, and Ai12 = Ai21'
+  for (l=0 ; l<k ; l++){
+    double * Ail = Ai._X[p+l];
+    for (r=l ; r<k ; r++){
+      const double a = Li22._X[r][l];
+      const double * Mr = M._X[r];
+      for (j=0 ; j<p ; j++) Ail[j] += a*Mr[j];
+    }
+    for (j=0 ; j<p ; j++) Ai._X[j][p+l] = Ail[j];
+    std::copy ( Ai22._X[l] , Ai22._X[l]+k , Ail+p );
   }
 
-  return A;
 }//
 
 /*-----------------------------------------*/
@@ -2088,13 +2331,13 @@ SGTELIB::Matrix SGTELIB::Matrix::triu_solve( const SGTELIB::Matrix & U ,
 /*-----------------------------------------*/
 SGTELIB::Matrix SGTELIB::Matrix::tril_inverse( const SGTELIB::Matrix & L ){
   const int n = L.get_nb_rows();
-  SGTELIB::Matrix Li = L;
-  SGTELIB::Matrix b ("b",n,1);
+  SGTELIB::Matrix Li = SGTELIB::Matrix::identity(n);
+  Li.set_name(L.get_name());
 
-  for (int i=0 ; i<n ; i++){
-    b.set(i,0,1.0);
-    Li.set_col( SGTELIB::Matrix::tril_solve(L,b) , i);
-    b.set(i,0,0.0);
+  // Same as tril_solve for each column of the identity,
+  // with BLOCK_RHS columns at a time.
+  for (int k0=0 ; k0<n ; k0+=BLOCK_RHS){
+    tril_solve_rows ( Li._X , L._X , n , k0 , std::min(k0+BLOCK_RHS,n) , false );
   }
 
   return Li;
@@ -2910,18 +3153,22 @@ SGTELIB::Matrix SGTELIB::Matrix::get_distances_norm2 ( const SGTELIB::Matrix & A
   const int pa = A.get_nb_rows();
   const int pb = B.get_nb_rows();
   SGTELIB::Matrix D = SGTELIB::Matrix("D",pa,pb);
-  double v,d;
-  int ia, ib, j;
 
-  for (ia=0 ; ia < pa ; ia++){
-    for (ib=0 ; ib < pb ; ib++){
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) if ( double(pa)*pb*n > PARALLEL_MIN_FLOPS )
+  #endif
+  for (int ia=0 ; ia < pa ; ia++){
+    const double * a = A._X[ia];
+    double * Da = D._X[ia];
+    for (int ib=0 ; ib < pb ; ib++){
       // Distance between the point ia of the cache and the point ib of the matrix XXs
-      v = 0;
-      for (j=0 ; j < n ; j++){
-        d = A._X[ia][j]-B._X[ib][j];
+      const double * b = B._X[ib];
+      double v = 0;
+      for (int j=0 ; j < n ; j++){
+        const double d = a[j]-b[j];
         v += d*d;
       }
-      D._X[ia][ib] = sqrt(v);
+      Da[ib] = sqrt(v);
     }
   }
   return D;
@@ -2940,17 +3187,21 @@ SGTELIB::Matrix SGTELIB::Matrix::get_distances_norm1 ( const SGTELIB::Matrix & A
   const int pa = A.get_nb_rows();
   const int pb = B.get_nb_rows();
   SGTELIB::Matrix D = SGTELIB::Matrix("D",pa,pb);
-  double v;
-  int ia, ib, j;
 
-  for (ia=0 ; ia < pa ; ia++){
-    for (ib=0 ; ib < pb ; ib++){
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) if ( double(pa)*pb*n > PARALLEL_MIN_FLOPS )
+  #endif
+  for (int ia=0 ; ia < pa ; ia++){
+    const double * a = A._X[ia];
+    double * Da = D._X[ia];
+    for (int ib=0 ; ib < pb ; ib++){
       // Distance between the point ia of the cache and the point ib of the matrix XXs
-      v = 0;
-      for (j=0 ; j < n ; j++){
-        v += fabs(A._X[ia][j]-B._X[ib][j]);
+      const double * b = B._X[ib];
+      double v = 0;
+      for (int j=0 ; j < n ; j++){
+        v += fabs(a[j]-b[j]);
       }
-      D._X[ia][ib] = v;
+      Da[ib] = v;
     }
   }
   return D;
@@ -2969,17 +3220,21 @@ SGTELIB::Matrix SGTELIB::Matrix::get_distances_norminf ( const SGTELIB::Matrix &
   const int pa = A.get_nb_rows();
   const int pb = B.get_nb_rows();
   SGTELIB::Matrix D = SGTELIB::Matrix("D",pa,pb);
-  double v;
-  int ia, ib, j;
 
-  for (ia=0 ; ia < pa ; ia++){
-    for (ib=0 ; ib < pb ; ib++){
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) if ( double(pa)*pb*n > PARALLEL_MIN_FLOPS )
+  #endif
+  for (int ia=0 ; ia < pa ; ia++){
+    const double * a = A._X[ia];
+    double * Da = D._X[ia];
+    for (int ib=0 ; ib < pb ; ib++){
       // Distance between the point ia of the cache and the point ib of the matrix XXs
-      v = 0;
-      for (j=0 ; j < n ; j++){
-        v = std::max( v , fabs(A._X[ia][j]-B._X[ib][j]) );
+      const double * b = B._X[ib];
+      double v = 0;
+      for (int j=0 ; j < n ; j++){
+        v = std::max( v , fabs(a[j]-b[j]) );
       }
-      D._X[ia][ib] = v;
+      Da[ib] = v;
     }
   }
   return D;
@@ -3010,6 +3265,20 @@ double SGTELIB::Matrix::distNorm2(const SGTELIB::Matrix& v1, const SGTELIB::Matr
 }
 
 
+/*-------------------------------------------------*/
+/* has_leading_block                               */
+/* Check if A is the upper left block of the matrix*/
+/*-------------------------------------------------*/
+bool SGTELIB::Matrix::has_leading_block ( const SGTELIB::Matrix & A ) const {
+
+  if ( (A._nbRows>_nbRows) || (A._nbCols>_nbCols) ) return false;
+
+  for (int i=0 ; i<A._nbRows ; i++){
+    if ( ! std::equal ( A._X[i] , A._X[i]+A._nbCols , _X[i] ) ) return false;
+  }
+  return true;
+}//
+
 /*-------------------------------------------------*/
 /* find_row                                        */
 /* Check if the matrix has a row identical to R    */
@@ -3188,33 +3457,60 @@ SGTELIB::Matrix SGTELIB::Matrix::lu_inverse ( double * det ) const{
   int * P = new int [N];
   for (i=0 ; i<N ; i++) P[i]=i;
 
+  // Number of elimination steps applied to each row.
+  // The steps are applied to a row only when it is needed (as pivot row)
+  // or at the end of a block of BLOCK_ROWS steps, so that the pivot rows
+  // of the block stay in cache while all the other rows are updated.
+  // Each row still receives the steps in the same order as with a step by
+  // step elimination.
+  int * nbSteps = new int [N];
+  for (i=0 ; i<N ; i++) nbSteps[i]=0;
+
+  // Apply the elimination steps nbSteps[j] to kmax-1 to row j
+  auto eliminate = [&A,N,nbSteps] ( const int j , const int kmax ) {
+    double * Aj = A._X[j];
+    for (int kk=nbSteps[j] ; kk<kmax ; kk++){
+      const double * Akk = A._X[kk];
+      const double piv = Aj[kk]/Akk[kk];
+      Aj[kk] = piv;
+      for (int ii=kk+1 ; ii<N ; ii++) Aj[ii] -= piv*Akk[ii];
+    }
+    nbSteps[j] = std::max ( nbSteps[j] , kmax );
+  };
+
   // LU factorization (in-place)
-  for (k=0 ; k<N-1 ; k++){
-
-    // Find pivot
-    pivot_max = -1;
-    for (i=k ; i<N ; i++){
-      pivot = A._X[k][i];
-      if (pivot<0) pivot*=-1;
-      if (pivot>pivot_max){
-        ip = i;
-        pivot_max = pivot;
+  for (int k0=0 ; k0<N-1 ; k0+=BLOCK_ROWS){
+    const int k1 = std::min(k0+BLOCK_ROWS,N-1);
+
+    for (k=k0 ; k<k1 ; k++){
+
+      // Row k is up to date
+      eliminate(k,k);
+
+      // Find pivot
+      pivot_max = -1;
+      for (i=k ; i<N ; i++){
+        pivot = A._X[k][i];
+        if (pivot<0) pivot*=-1;
+        if (pivot>pivot_max){
+          ip = i;
+          pivot_max = pivot;
+        }
       }
-    }
 
-    // Swap rows of A and P
-    if (ip!=k){
-      A.swap_rows(ip,k);
-      i=P[ip]; P[ip]=P[k]; P[k]=i;
+      // Swap rows of A and P
+      if (ip!=k){
+        eliminate(ip,k);
+        A.swap_rows(ip,k);
+        i=P[ip]; P[ip]=P[k]; P[k]=i;
+        std::swap ( nbSteps[ip] , nbSteps[k] );
+      }
     }
 
-    // Gaussian elimination
-    for (j=k+1 ; j<N ; j++){
-      pivot = A._X[j][k]/A._X[k][k];
-      A._X[j][k] = pivot;
-      for (i=k+1 ; i<N ; i++) A._X[j][i] -= pivot*A._X[k][i];
-    }
+    // Gaussian elimination of the other rows with the pivot rows k0 to k1-1
+    for (j=k1 ; j<N ; j++) eliminate(j,k1);
   }
+  delete [] nbSteps;
 
   // Construct the whole matrix P (under the name Ai)
   SGTELIB::Matrix Ai ("Ai",N,N);
@@ -3241,27 +3537,26 @@ SGTELIB::Matrix SGTELIB::Matrix::lu_inverse ( double * det ) const{
     *det = v;
   }
 
-  // Triangular inversion for each column of Ai.
-  SGTELIB::Matrix y;
-  for (k=0 ; k<N; k++){
-    y = Ai.get_col(k);
+  // Triangular inversion of the columns of Ai, BLOCK_RHS columns at a time.
+  // The rows of Ai are updated as a whole, which is equivalent to solving
+  // the columns one by one.
+  for (int k0=0 ; k0<N ; k0+=BLOCK_RHS){
+    const int k1 = std::min(k0+BLOCK_RHS,N);
 
     // Tri-L solve
-    for (i=0 ; i<N ; i++){
-      for (j=0 ; j<i ; j++){
-        y._X[i][0] -= A._X[i][j]*y._X[j][0];
-      }
-    }
+    tril_solve_rows ( Ai._X , A._X , N , k0 , k1 , true );
 
     // Tri-U solve
-    for (int i=N-1 ; i>=0 ; i--){
-      for (int j=i+1 ; j<N ; j++){
-        y._X[i][0] -= A._X[i][j]*y._X[j][0];
+    for (i=N-1 ; i>=0 ; i--){
+      double * Yi = Ai._X[i];
+      for (j=i+1 ; j<N ; j++){
+        const double a = A._X[i][j];
+        const double * Yj = Ai._X[j];
+        for (k=k0 ; k<k1 ; k++) Yi[k] -= a*Yj[k];
       }
-      y._X[i][0] /= A._X[i][i];
+      const double d = A._X[i][i];
+      for (k=k0 ; k<k1 ; k++) Yi[k] /= d;
     }
-
-    Ai.set_col(y,k);
   }
 
   delete [] P;
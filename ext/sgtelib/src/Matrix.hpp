@@ -48,7 +48,29 @@ namespace SGTELIB {
     int _nbRows; // nbRows x nbCols matrix
     int _nbCols;
 
+    // The values are stored row by row in one block (_data).
+    // _X[i] points to the start of row i in _data.
     double ** _X;
+    double *  _data;
+    int _rowCapacity; // Number of rows that fit in _data
+
+    // Storage
+    void allocate ( const int rowCapacity ); // _data and _X, values not initialized
+    void deallocate ( void );
+    void set_row_pointers ( void );
+    void reserve_rows ( const int nbRows ); // keep the values
+
+    // Error of set(i,j) (throws)
+    void set_bad_index ( const int i , const int j ) const;
+
+    // C += A*B, cache-blocked, on the p first rows and r first columns of C
+    // and the q first columns of A / rows of B.
+    static void block_product ( SGTELIB::Matrix & C,
+                                const SGTELIB::Matrix & A,
+                                const SGTELIB::Matrix & B,
+                                const int p,
+                                const int q,
+                                const int r );
 
   public:
 
@@ -121,6 +143,11 @@ namespace SGTELIB {
     const double & operator [] ( int k ) const;
     double & operator [] ( int k );
 
+    // access to the values of row i, which are contiguous
+    // (for the kernels that process whole rows)
+    inline const double * get_row_data ( const int i ) const { return _X[i]; }
+    inline double * get_row_data ( const int i ) { return _X[i]; }
+
 
 
     SGTELIB::Matrix get ( const std::list<int> & list_cols ,
@@ -151,7 +178,11 @@ namespace SGTELIB {
     inline void set_name ( const std::string & name ) { _name = name; }
     inline std::string get_name ( void ) const { return _name; }
 
-    void set     (const int i , const int j , const double d );
+    // set element (i,j)
+    inline void set ( const int i , const int j , const double d ){
+      if ( i < 0 || i >= _nbRows || j < 0 || j >= _nbCols ) set_bad_index(i,j);
+      _X[i][j] = d;
+    }//
     void set_row (const SGTELIB::Matrix & T , const int i); // T is row vector
     void set_col (const SGTELIB::Matrix & T , const int j); // T is col vector
     void set_row (const double v , const int i); // T is row vector
@@ -320,6 +351,16 @@ namespace SGTELIB {
     SGTELIB::Matrix cholesky_inverse ( void ) const;
     static SGTELIB::Matrix cholesky_solve ( const SGTELIB::Matrix & A ,
                                             const SGTELIB::Matrix & b );
+    // Inverse of L*L' from the Cholesky factor L
+    static SGTELIB::Matrix cholesky_factor_inverse ( const SGTELIB::Matrix & L );
+    static double cholesky_factor_det ( const SGTELIB::Matrix & L );
+    // Add to the Cholesky factor L of the p first rows and cols
+    // of a matrix its last rows A (dimension k x p+k)
+    static bool cholesky_add_rows ( SGTELIB::Matrix & L ,
+                                    const SGTELIB::Matrix & A );
+    // Extend Ai, inverse of the p first rows and cols of L*L', to the inverse of L*L'
+    static void cholesky_inverse_add_rows ( SGTELIB::Matrix & Ai ,
+                                            const SGTELIB::Matrix & L );
 
     // LDLt factorization
     SGTELIB::Matrix LDLt_decomposition ( void ) const;
@@ -409,6 +450,8 @@ namespace SGTELIB {
     static double distNorm2(const SGTELIB::Matrix& v1, const SGTELIB::Matrix & v2);
 
     int find_row (SGTELIB::Matrix & R);
+    // True if A is the upper left block of the matrix
+    bool has_leading_block ( const SGTELIB::Matrix & A ) const;
 
     // nan
     bool has_nan (void) const;
@@ -24,6 +24,12 @@
 /*-------------------------------------------------------------------------------------*/
 
 #include "Surrogate.hpp"
+#include "Surrogate_Factory.hpp"
+#include <algorithm>
+#include <exception>
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
 
 using namespace SGTELIB;
 
@@ -1231,6 +1237,77 @@ SGTELIB::Matrix SGTELIB::Surrogate::get_distance_to_closest ( const SGTELIB::Mat
 /*=======================================*/
 
 
+namespace {
+
+  /*--------------------------------------*/
+  /*  snap a set of parameters to bounds  */
+  /*--------------------------------------*/
+  void snap_to_bounds ( SGTELIB::Matrix & x ,
+                        const SGTELIB::Matrix & lb ,
+                        const SGTELIB::Matrix & ub ,
+                        const SGTELIB::param_domain_t * domain ) {
+    int k;
+    double d;
+    for (int j=0 ; j<x.get_nb_cols() ; j++){
+      d = x[j];
+      // Snap to bounds
+      double lbj = lb[j];
+      double ubj = ub[j];
+      switch (domain[j]){
+        case SGTELIB::PARAM_DOMAIN_CONTINUOUS:
+          if (d<lbj) d = lbj;
+          if (d>ubj) d = ubj;
+          break;
+        case SGTELIB::PARAM_DOMAIN_INTEGER:
+          d = double(SGTELIB::round(d));
+          if (d<lbj) d=lbj;
+          if (d>ubj) d=ubj;
+          break;
+        case SGTELIB::PARAM_DOMAIN_CAT:
+          k = SGTELIB::round(d);
+          while (k>ubj) k-=int(ubj-lbj);
+          while (k<lbj) k+=int(ubj-lbj);
+          d = double(k);
+          break;
+        case SGTELIB::PARAM_DOMAIN_BOOL:
+          d = (d>1/2)?1.0:0.0;
+          break;
+        case SGTELIB::PARAM_DOMAIN_MISC:
+          throw SGTELIB::Exception ( __FILE__ , __LINE__ ,"Invalid variable domain!" );
+          break;
+      }
+      x.set(0,j,d);
+    }
+  }//
+
+  /*--------------------------------------*/
+  /*  poll candidates around xmin         */
+  /*--------------------------------------*/
+  SGTELIB::Matrix poll_candidates ( const SGTELIB::Matrix & xmin ,
+                                    const SGTELIB::Matrix & scaling ,
+                                    const SGTELIB::param_domain_t * domain ,
+                                    const bool * logscale ,
+                                    const double psize ) {
+    const int N = xmin.get_nb_cols();
+    double d;
+    SGTELIB::Matrix xtry ("xtry",1,N);
+    SGTELIB::Matrix POLL = SGTELIB::Matrix::get_poll_directions(scaling,domain,psize);
+    for (int i=0 ; i<POLL.get_nb_rows() ; i++){
+      for (int j=0 ; j<N ; j++){
+        // Add poll directions to poll center
+        d = xmin[j];
+        if (logscale[j]) d *= pow(4.0,POLL.get(i,j));  //exp(POLL.get(i,j));
+        else             d += POLL.get(i,j);
+        xtry.set(0,j,d);
+      }// End build candidate
+      POLL.set_row(xtry,i);
+    }
+    POLL.set_name("POLL-CANDIDATES");
+    return POLL;
+  }//
+
+}
+
 /*--------------------------------------*/
 /*  optimize model parameters           */
 /*--------------------------------------*/
@@ -1241,7 +1318,7 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
   // Budget
   int budget = N*_param.get_budget();
 
-  int i,j,k;
+  int i,j;
   double d;
   const bool display = false;
   if (display){
@@ -1351,6 +1428,22 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
   // Add the default values.
   X0.add_rows(_param.get_x());
 
+  // Several searches, run concurrently
+  if (_param.get_optim_starts()>1){
+    SGTELIB::Matrix xmin = X0.get_row(0);
+    bool ok = optimize_parameters_multistart ( X0 , budget , lb , ub , scaling , domain , logscale , xmin );
+    delete [] logscale;
+    delete [] domain;
+    if ( ! ok ) return false;
+
+    // Set param to optimal value
+    _param.set_x(xmin);
+    _param.check();
+    eval_objective();
+
+    // Check for Nan
+    return ( ! xmin.has_nan()) && ( ! xmin.has_inf());
+  }
 
 
 
@@ -1407,19 +1500,7 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
 
     if (iter){
       // Create POLL candidates
-      POLL = SGTELIB::Matrix::get_poll_directions(scaling,domain,psize);
-      //POLL.display(std::cout);
-      for (i=0 ; i<POLL.get_nb_rows() ; i++){
-        for (j=0 ; j<N ; j++){
-          // Add poll directions to poll center
-          d = xmin[j];
-          if (logscale[j]) d *= pow(4.0,POLL.get(i,j));  //exp(POLL.get(i,j));
-          else             d += POLL.get(i,j);
-          xtry.set(0,j,d);
-        }// End build candidate
-        POLL.set_row(xtry,i);
-      } // End Create POLL
-      POLL.set_name("POLL-CANDIDATES");
+      POLL = poll_candidates(xmin,scaling,domain,logscale,psize);
       //POLL.display(std::cout);
     }
     else{
@@ -1445,36 +1526,7 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
       }
 
       // Snap to bounds
-      for (j=0 ; j<N ; j++){
-        d = xtry[j];
-        // Snap to bounds
-        double lbj = lb[j];
-        double ubj = ub[j];
-        switch (domain[j]){
-          case SGTELIB::PARAM_DOMAIN_CONTINUOUS:
-            if (d<lbj) d = lbj;
-            if (d>ubj) d = ubj;
-            break;
-          case SGTELIB::PARAM_DOMAIN_INTEGER:
-            d = double(round(d));
-            if (d<lbj) d=lbj;
-            if (d>ubj) d=ubj;
-            break;
-          case SGTELIB::PARAM_DOMAIN_CAT:
-            k = round(d);
-            while (k>ubj) k-=int(ubj-lbj);
-            while (k<lbj) k+=int(ubj-lbj);
-            d = double(k);
-            break;
-          case SGTELIB::PARAM_DOMAIN_BOOL:
-            d = (d>1/2)?1.0:0.0;
-            break;
-          case SGTELIB::PARAM_DOMAIN_MISC:
-            throw SGTELIB::Exception ( __FILE__ , __LINE__ ,"Invalid variable domain!" );
-            break;
-        }
-        xtry.set(0,j,d);
-      }
+      snap_to_bounds(xtry,lb,ub,domain);
 
       // Check Cache
       cache_hit = (CACHE.find_row(xtry)!=-1);
@@ -1485,14 +1537,7 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
         // --------------------------------------
         // EVALUATION of metric and penalty
         // --------------------------------------
-        // Register the xtry values in the parameter of the model
-        _param.set_x(xtry);
-        // Check that the parameters are consistent.
-        _param.check();
-        // Eval the objective (metric of the model)
-        ftry = eval_objective();
-        // Call the parameter class to get the penalty value.
-        ptry = _param.get_x_penalty();
+        eval_parameters(xtry,ftry,ptry);
         // Reduce evaluation budget
         budget--;
         // Add the current point to the CACHE.
@@ -1566,6 +1611,231 @@ bool SGTELIB::Surrogate::optimize_parameters ( void ) {
 }//
 
 
+/*--------------------------------------*/
+/*  optimize model parameters from      */
+/*  several starting points             */
+/*--------------------------------------*/
+// The starting points are evaluated concurrently. The best
+// OPTIM_STARTS of them are then improved by as many MADS searches,
+// which share the remaining budget and progress by rounds: a round
+// performs one poll of each search, in parallel. After each round,
+// the searches that are clearly worse than the best one are abandoned
+// and their budget is given to the best one.
+// The sets of parameters are evaluated on copies of the model (one
+// per thread) and each evaluation or poll draws its random numbers
+// from its own stream, so the result does not depend on the number
+// of threads.
+bool SGTELIB::Surrogate::optimize_parameters_multistart ( const SGTELIB::Matrix & X0 ,
+                                                          const int budget ,
+                                                          const SGTELIB::Matrix & lb ,
+                                                          const SGTELIB::Matrix & ub ,
+                                                          const SGTELIB::Matrix & scaling ,
+                                                          const SGTELIB::param_domain_t * domain ,
+                                                          const bool * logscale ,
+                                                          SGTELIB::Matrix & xmin ) {
+
+  const int N = X0.get_nb_cols();
+  int i,k,s;
+
+  //-----------------------------------------
+  // Copies of the model
+  //-----------------------------------------
+  // The copies share the training set of the model. They are initialized
+  // with the same random numbers, so that they are identical.
+  int nb_threads = 1;
+  #ifdef _OPENMP
+    nb_threads = omp_get_max_threads();
+  #endif
+  std::vector<SGTELIB::Surrogate *> copies;
+  const unsigned int seed_copies = SGTELIB::Random_Stream::draw_seed();
+  bool ok = true;
+  for (k=0 ; (k<nb_threads) && ok ; k++){
+    SGTELIB::Surrogate * S = SGTELIB::Surrogate_Factory(_trainingset,_param);
+    copies.push_back(S);
+    S->_selected_points = _selected_points;
+    S->_p_ts = _p_ts;
+    S->_p = _p;
+    S->_display = false;
+    SGTELIB::Random_Stream stream (seed_copies);
+    ok = S->init_private();
+  }
+  if ( ! ok ){
+    for (k=0 ; k<static_cast<int>(copies.size()) ; k++) SGTELIB::surrogate_delete(copies[k]);
+    return false;
+  }
+  // Exception raised by each thread
+  // (an exception can not leave a parallel loop).
+  std::vector<std::exception_ptr> errors (nb_threads);
+
+  //-----------------------------------------
+  // Evaluation of the starting points
+  //-----------------------------------------
+  // CACHE contains the starting points, snapped to bounds, without duplicates.
+  SGTELIB::Matrix CACHE ("CACHE",0,N);
+  SGTELIB::Matrix xtry;
+  for (i=0 ; i<X0.get_nb_rows() ; i++){
+    xtry = X0.get_row(i);
+    snap_to_bounds(xtry,lb,ub,domain);
+    if (CACHE.find_row(xtry)==-1) CACHE.add_rows(xtry);
+  }
+  const int nx0 = CACHE.get_nb_rows();
+  std::vector<double> f0 (nx0);
+  std::vector<double> p0 (nx0);
+  const unsigned int seed_x0 = SGTELIB::Random_Stream::draw_seed();
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic)
+  #endif
+  for (i=0 ; i<nx0 ; i++){
+    int t = 0;
+    #ifdef _OPENMP
+      t = omp_get_thread_num();
+    #endif
+    if (errors[t]) continue;
+    try{
+      SGTELIB::Random_Stream stream (seed_x0+i);
+      copies[t]->eval_parameters(CACHE.get_row(i),f0[i],p0[i]);
+    }
+    catch (...){
+      errors[t] = std::current_exception();
+    }
+  }
+
+  //-----------------------------------------
+  // Starting points of the searches
+  //-----------------------------------------
+  // The starting points are ordered by metric, then by penalty.
+  std::vector<int> order (nx0);
+  for (i=0 ; i<nx0 ; i++) order[i] = i;
+  std::stable_sort ( order.begin() , order.end() ,
+                     [&f0,&p0](const int a, const int b){
+                       return (f0[a]<f0[b]) || ((f0[a]==f0[b]) && (p0[a]<p0[b]));
+                     } );
+
+  // State of a search
+  struct Search {
+    SGTELIB::Matrix xmin;
+    double fmin;
+    double pmin;
+    double psize;
+    int budget;
+    bool active;
+    unsigned int seed;
+    SGTELIB::Matrix cache;
+  };
+  const int nb_searches = std::min(_param.get_optim_starts(),nx0);
+  const int budget_left = budget-nx0;
+  std::vector<Search> searches (nb_searches);
+  for (s=0 ; s<nb_searches ; s++){
+    Search & S = searches[s];
+    S.xmin = CACHE.get_row(order[s]);
+    S.fmin = f0[order[s]];
+    S.pmin = p0[order[s]];
+    S.psize = 0.5;
+    S.budget = (budget_left>0)? budget_left/nb_searches + ((s<budget_left%nb_searches)?1:0) : 0;
+    S.active = (S.budget>0);
+    S.seed = SGTELIB::Random_Stream::draw_seed();
+    S.cache = CACHE;
+  }
+
+  //-----------------------------------------
+  // Rounds
+  //-----------------------------------------
+  int best = 0;
+  bool active = true;
+  for (k=0 ; k<nb_threads ; k++) if (errors[k]) active = false;
+  while (active){
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic)
+    #endif
+    for (s=0 ; s<nb_searches ; s++){
+      int t = 0;
+      #ifdef _OPENMP
+        t = omp_get_thread_num();
+      #endif
+      Search & S = searches[s];
+      if ( ( ! S.active) || (errors[t]) ) continue;
+      try{
+        SGTELIB::Random_Stream stream (S.seed);
+        const SGTELIB::Matrix POLL = poll_candidates(S.xmin,scaling,domain,logscale,S.psize);
+        bool success = false;
+        double ftry, ptry;
+        for (int ip=0 ; ip<POLL.get_nb_rows() ; ip++){
+          SGTELIB::Matrix x = POLL.get_row(ip);
+          snap_to_bounds(x,lb,ub,domain);
+          if (S.cache.find_row(x)!=-1) continue;
+          copies[t]->eval_parameters(x,ftry,ptry);
+          S.budget--;
+          S.cache.add_rows(x);
+          // Opportunistic evaluation of the poll
+          if ( (ftry<S.fmin) || ((ftry==S.fmin) && (ptry<S.pmin)) ){
+            S.xmin = x;
+            S.fmin = ftry;
+            S.pmin = ptry;
+            success = true;
+            break;
+          }
+        }
+        // Update poll size
+        if (success) S.psize*=2;
+        else S.psize/=2;
+        // Check convergence
+        S.active = (S.psize>=1e-6) && (S.budget>0);
+        S.seed = SGTELIB::Random_Stream::draw_seed();
+      }
+      catch (...){
+        errors[t] = std::current_exception();
+      }
+    }// END LOOP ON SEARCHES
+
+    for (k=0 ; k<nb_threads ; k++) if (errors[k]) break;
+    if (k<nb_threads) break;
+
+    // Best search so far
+    best = 0;
+    for (s=1 ; s<nb_searches ; s++){
+      if ( (searches[s].fmin<searches[best].fmin) ||
+           ((searches[s].fmin==searches[best].fmin) && (searches[s].pmin<searches[best].pmin)) ) best = s;
+    }
+    // Abandon the searches that are clearly dominated
+    const double fbest = searches[best].fmin;
+    active = false;
+    for (s=0 ; s<nb_searches ; s++){
+      Search & S = searches[s];
+      if ( (S.active) && (s!=best) && (S.fmin>fbest+fabs(fbest)) ){
+        S.active = false;
+        if (searches[best].active) searches[best].budget += S.budget;
+      }
+      if (S.active) active = true;
+    }
+
+  }// End of rounds
+
+  for (k=0 ; k<static_cast<int>(copies.size()) ; k++) SGTELIB::surrogate_delete(copies[k]);
+  for (k=0 ; k<nb_threads ; k++) if (errors[k]) std::rethrow_exception(errors[k]);
+
+  xmin = searches[best].xmin;
+  return true;
+
+}//
+
+
+/*--------------------------------------*/
+/*  Evaluation of a set of parameters   */
+/*--------------------------------------*/
+void SGTELIB::Surrogate::eval_parameters ( const SGTELIB::Matrix & x , double & f , double & p ){
+  // Register the x values in the parameter of the model
+  _param.set_x(x);
+  // Check that the parameters are consistent.
+  _param.check();
+  // Eval the objective (metric of the model)
+  f = eval_objective();
+  // Call the parameter class to get the penalty value.
+  p = _param.get_x_penalty();
+}//
+
+
 /*--------------------------------------*/
 /*    Evaluation of the error metric    */
 /*       for a set of parameters        */
@@ -111,6 +111,17 @@ namespace SGTELIB {
 
     SGTELIB::Matrix compute_fh ( const SGTELIB::Matrix & Zs );
 
+    // Parameter optimization from several starting points
+    bool optimize_parameters_multistart ( const SGTELIB::Matrix & X0 ,
+                                          const int budget ,
+                                          const SGTELIB::Matrix & lb ,
+                                          const SGTELIB::Matrix & ub ,
+                                          const SGTELIB::Matrix & scaling ,
+                                          const SGTELIB::param_domain_t * domain ,
+                                          const bool * logscale ,
+                                          SGTELIB::Matrix & xmin );
+    void eval_parameters ( const SGTELIB::Matrix & x , double & f , double & p );
+
     // predict model (private):
     virtual void predict_private ( const SGTELIB::Matrix & XXs,
                                          SGTELIB::Matrix * ZZs,
@@ -200,6 +211,7 @@ namespace SGTELIB {
     SGTELIB::Matrix get_distance_to_closest ( const SGTELIB::Matrix & XX ) const;
 
     bool is_ready                (void) const {return _ready;};
+    void set_not_ready           (void) {_ready = false;}; // Build needed before use
     void display_trainingset     (void) const {_trainingset.build();_trainingset.display(std::cout);};
     SGTELIB::model_t get_type    (void) const {return _param.get_type();};
     std::string get_string       (void) const {return _param.get_string();};
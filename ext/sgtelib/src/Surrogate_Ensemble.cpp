@@ -24,6 +24,7 @@
 /*-------------------------------------------------------------------------------------*/
 
 #include "Surrogate_Ensemble.hpp"
+#include <exception>
 
 /*----------------------------*/
 /*         constructor        */
@@ -189,14 +190,45 @@ bool SGTELIB::Surrogate_Ensemble::init_private ( void ) {
     return false;
   }
 
-  // Build them & count the number of ready
+  // Build them & count the number of ready.
+  // The models are built concurrently, with the metric used to select
+  // them. Each model draws its random numbers from its own stream, so
+  // the ensemble does not depend on the number of threads nor on the
+  // order in which the models are built.
   _kready = 0;
   int k;
+  std::vector<unsigned int> seeds (_kmax);
   for (k=0 ; k<_kmax ; k++){
+    seeds[k] = SGTELIB::Random_Stream::draw_seed();
+  }
+  std::vector<char> ready (_kmax,0);
+  std::vector<std::exception_ptr> errors (_kmax);
+  const SGTELIB::metric_t mt = _param.get_metric_type();
+
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic)
+  #endif
+  for (k=0 ; k<_kmax ; k++){
+    // An exception can not leave the parallel loop.
+    try{
+      SGTELIB::Random_Stream stream (seeds[k]);
+      SGTELIB::Surrogate * surrogate = _surrogates.at(k);
+      if (surrogate->build()){
+        surrogate->get_metric(mt);
+        ready[k] = 1;
+      }
+    }
+    catch (...){
+      errors[k] = std::current_exception();
+    }
+  }
+
+  for (k=0 ; k<_kmax ; k++){
+    if (errors[k]) std::rethrow_exception(errors[k]);
     #ifdef ENSEMBLE_DEBUG
       std::cout << "Init model " << k << "/" << _kmax << ": " << _surrogates.at(k)->get_short_string();
     #endif
-    if (_surrogates.at(k)->build()){
+    if (ready[k]){
       _kready++;
       #ifdef ENSEMBLE_DEBUG
         std::cout << " (ready)\n";
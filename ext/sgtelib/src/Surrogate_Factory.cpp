@@ -54,16 +54,24 @@ SGTELIB::Surrogate * SGTELIB::Surrogate_Factory ( SGTELIB::TrainingSet & TS,
     TS.info();
   #endif
 
-  SGTELIB::Surrogate * S;
   SGTELIB::Surrogate_Parameters p ( s );
-  
+  return SGTELIB::Surrogate_Factory(TS,p);
+
+}//
+
 
+/*----------------------------------------------------------*/
+SGTELIB::Surrogate * SGTELIB::Surrogate_Factory ( SGTELIB::TrainingSet & TS,
+                                                  const SGTELIB::Surrogate_Parameters & p ) {
+/*----------------------------------------------------------*/
+
+  SGTELIB::Surrogate * S;
 
   switch ( p.get_type() ) {
 
   case SGTELIB::SVN: 
     throw SGTELIB::Exception ( __FILE__ , __LINE__ ,
-      "Surrogate_Factory: not implemented yet! \""+s+"\"" );
+      "Surrogate_Factory: not implemented yet! \""+p.get_string()+"\"" );
 
   case SGTELIB::PRS: 
     S = new Surrogate_PRS(TS,p);
@@ -32,6 +32,7 @@ SGTELIB::Surrogate_Kriging::Surrogate_Kriging ( SGTELIB::TrainingSet & trainings
                                                 const SGTELIB::Surrogate_Parameters& param) :
   SGTELIB::Surrogate ( trainingset , param ),
   _R                 ( "R",0,0             ),  
+  _L                 ( "L",0,0             ),
   _Ri                ( "Ri",0,0            ),  
   _H                 ( "H",0,0             ),
   _alpha             ( "alpha",0,0         ),
@@ -83,9 +84,8 @@ bool SGTELIB::Surrogate_Kriging::build_private ( void ) {
   const int nvar = _trainingset.get_nvar();
   const SGTELIB::Matrix & Zs = get_matrix_Zs();
 
-  _R = compute_covariance_matrix(get_matrix_Xs());
+  compute_covariance_inverse(compute_covariance_matrix(get_matrix_Xs()));
   _H = SGTELIB::Matrix::ones(_p,1);
-  _Ri = _R.lu_inverse(&_detR);
 
   if (_detR<=0){
     _detR = +INF;
@@ -130,23 +130,26 @@ bool SGTELIB::Surrogate_Kriging::build_private ( void ) {
 /*--------------------------------------*/
 const SGTELIB::Matrix SGTELIB::Surrogate_Kriging::compute_covariance_matrix ( const SGTELIB::Matrix & XXs ) {
 
-  // Xs can be, either the training set, to build the model, or prediction points.
+  // XXs can be, either the training set, to build the model, or prediction points.
   const int pxx = XXs.get_nb_rows();
-  const SGTELIB::Matrix Xs = get_matrix_Xs();
   const SGTELIB::Matrix coef = _param.get_covariance_coef();
-  const SGTELIB::Matrix D = _trainingset.get_distances(XXs,get_matrix_Xs(),_param.get_distance_type());
-
-  SGTELIB::Matrix R ("R",pxx,_p);
-
-  double d, cov;// dsum;
+  const double c0 = coef[0];
+  const double c1 = coef[1];
+  // Value on the diagonal (noise added when the distance is 0)
+  const double r0 = 1.0+_param.get_ridge();
+
+  // The covariance is computed in place in the distance matrix.
+  SGTELIB::Matrix R = _trainingset.get_distances(XXs,get_matrix_Xs(),_param.get_distance_type());
+  R.set_name("R");
+
+#ifdef _OPENMP
+  #pragma omp parallel for if(double(pxx)*_p > SGTELIB::PARALLEL_MIN_TERMS)
+#endif
   for (int i1=0 ; i1<pxx ; i1++){
+    double * r = R.get_row_data(i1);
     for (int i2=0 ; i2<_p ; i2++){
-      d = D.get(i1,i2);
-      cov = coef[1] * pow(d,coef[0]);
-      cov = exp(-cov);
-      // Add noise if the distance is 0.
-      if (d==0) cov = 1.0+_param.get_ridge();
-      R.set(i1,i2,cov);
+      const double d = r[i2];
+      r[i2] = (d==0) ? r0 : exp(-c1*pow(d,c0));
     }
   }
   
@@ -156,6 +159,50 @@ const SGTELIB::Matrix SGTELIB::Surrogate_Kriging::compute_covariance_matrix ( co
 
 
 
+/*--------------------------------------*/
+/*   Inverse of the covariance matrix   */
+/*--------------------------------------*/
+void SGTELIB::Surrogate_Kriging::compute_covariance_inverse ( const SGTELIB::Matrix & R ) {
+
+  const int p_old = _R.get_nb_rows();
+
+  // If the points of the previous build are the first points of the
+  // training set, and their covariances did not change (same scaling
+  // and same hyperparameters), the previous covariance matrix is the
+  // upper left block of R. Then, the Cholesky factor and the inverse
+  // are extended with the rows of the new points, in O(p^2*k).
+  if ( (p_old>0) && (_L.get_nb_rows()==p_old) && R.has_leading_block(_R) ){
+    if (p_old==_p){
+      // Same matrix, only _detR may have been reset by a failed build.
+      _detR = SGTELIB::Matrix::cholesky_factor_det(_L);
+      return;
+    }
+    if (SGTELIB::Matrix::cholesky_add_rows(_L,R.get_rows(p_old,_p))){
+      SGTELIB::Matrix::cholesky_inverse_add_rows(_Ri,_L);
+      _detR = SGTELIB::Matrix::cholesky_factor_det(_L);
+      _R = R;
+      return;
+    }
+  }
+
+  // Otherwise (or if the update is not stable), factorize R.
+  _R = R;
+  _L = R.cholesky();
+  for (int i=0 ; i<_p ; i++){
+    const double d = _L.get(i,i);
+    if ( ! (d*d > EPSILON*R.get(i,i)) ){
+      // R is not numerically positive definite.
+      _L = SGTELIB::Matrix("L",0,0);
+      _Ri = _R.lu_inverse(&_detR);
+      return;
+    }
+  }
+  _Ri = SGTELIB::Matrix::cholesky_factor_inverse(_L);
+  _detR = SGTELIB::Matrix::cholesky_factor_det(_L);
+
+}//
+
+
 /*--------------------------------------*/
 /*       predict (ZZs only)             */
 /*--------------------------------------*/
@@ -163,8 +210,7 @@ void SGTELIB::Surrogate_Kriging::predict_private ( const SGTELIB::Matrix & XXs,
                                                      SGTELIB::Matrix * ZZs) {
   check_ready(__FILE__,__FUNCTION__,__LINE__);
   const int pxx = XXs.get_nb_rows();
-  const SGTELIB::Matrix r = compute_covariance_matrix(XXs).transpose();
-  *ZZs =  SGTELIB::Matrix::ones(pxx,1)*_beta + r.transpose() * _alpha;
+  *ZZs =  SGTELIB::Matrix::ones(pxx,1)*_beta + compute_covariance_matrix(XXs) * _alpha;
 }//
 
 
@@ -181,12 +227,12 @@ void SGTELIB::Surrogate_Kriging::predict_private_objective ( const std::vector<S
   // Loop on all pxx points 
   for (int i=0 ; i<static_cast<int>(pxx) ; i++){
     // *(XXd[i]) is of dimension nbd * _n
-    const SGTELIB::Matrix r = compute_covariance_matrix(*(XXd[i])).transpose();
+    const SGTELIB::Matrix R = compute_covariance_matrix(*(XXd[i]));
     // Compute only objectives
     for (int j=0 ; j<_m ; j++){
       if (_trainingset.get_bbo(j)==SGTELIB::BBO_OBJ){
         // Row i of ZZsurr_around is set to [f(x_i + d_1) , ... , f(x_i + d_nbd)]
-        temp = SGTELIB::Matrix::ones(nbd,1) * _beta.get_col(j) + r.transpose() * _alpha.get_col(j);
+        temp = SGTELIB::Matrix::ones(nbd,1) * _beta.get_col(j) + R * _alpha.get_col(j);
         ZZsurr_around->set_row( temp.transpose() , i);
         break;
       }
@@ -205,24 +251,33 @@ void SGTELIB::Surrogate_Kriging::predict_private (const SGTELIB::Matrix & XXs,
 
   const int pxx = XXs.get_nb_rows();
   const double fs_min = _trainingset.get_fs_min();
-  const SGTELIB::Matrix r = compute_covariance_matrix(XXs).transpose();
+  // Covariance between the points XXs and the training points
+  const SGTELIB::Matrix R = compute_covariance_matrix(XXs);
   int i,j;
 
   // Predict ZZ
-  if (ZZs) predict_private(XXs,ZZs);
+  if (ZZs) *ZZs = SGTELIB::Matrix::ones(pxx,1)*_beta + R * _alpha;
 
   // Predict std
+  SGTELIB::Matrix std_local;
   if (std) std->fill(-SGTELIB::INF);
-  else std = new SGTELIB::Matrix ("std",pxx,_m);
+  else{
+    std_local = SGTELIB::Matrix ("std",pxx,_m);
+    std = &std_local;
+  }
 
   double rRr;
   const double HRH = (_H.transpose()*_Ri*_H).get(0,0);
 
+  // Row i of RRi is r_i^T * Ri, so that r_i^T * Ri * r_i is a dot product.
+  const SGTELIB::Matrix RRi = R*_Ri;
+
   double v;
-  SGTELIB::Matrix ri;
   for (i=0 ; i<pxx ; i++){
-    ri = r.get_col(i);
-    rRr = (ri.transpose()*_Ri*ri).get(0,0);
+    const double * r  = R.get_row_data(i);
+    const double * rr = RRi.get_row_data(i);
+    rRr = 0;
+    for (j=0 ; j<_p ; j++) rRr += rr[j]*r[j];
     if (fabs(rRr-1)<EPSILON){
       v = fabs(rRr-1);
     }
@@ -48,6 +48,7 @@ namespace SGTELIB {
     /*          Attributes                  */
     /*--------------------------------------*/
     SGTELIB::Matrix _R; // Covariance Matrix
+    SGTELIB::Matrix _L; // Cholesky factor of _R (empty if _Ri is obtained by LU)
     SGTELIB::Matrix _Ri; // Inverte of _R
     SGTELIB::Matrix _H; // Polynomial terms
     SGTELIB::Matrix _alpha;
@@ -59,6 +60,7 @@ namespace SGTELIB {
     /*          Building methods            */
     /*--------------------------------------*/
     const SGTELIB::Matrix compute_covariance_matrix ( const SGTELIB::Matrix & XXs ); 
+    void compute_covariance_inverse ( const SGTELIB::Matrix & R );
 
     /*--------------------------------------*/
     /*          Build model                 */
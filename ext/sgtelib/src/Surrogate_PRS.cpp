@@ -34,9 +34,14 @@ SGTELIB::Surrogate_PRS::Surrogate_PRS ( SGTELIB::TrainingSet & trainingset,
   _q                 ( 0           ),
   _M                 ( "M",0,0     ),
   _H                 ( "H",0,0     ),
+  _HtH               ( "HtH",0,0   ),
+  _HtZ               ( "HtZ",0,0   ),
   _Ai                ( "Ai",0,0    ),
   _alpha             ( "alpha",0,0 ),
-  _preComputeForJacobianAndHessianDone( false){
+  _preComputeForJacobianAndHessianDone( false),
+  _Xs_H              ( "Xs_H",0,0  ),
+  _Zs_H              ( "Zs_H",0,0  ),
+  _nb_removed_H      ( 0           ){
   #ifdef SGTELIB_DEBUG
     std::cout << "constructor PRS\n";
   #endif
@@ -48,6 +53,16 @@ SGTELIB::Surrogate_PRS::Surrogate_PRS ( SGTELIB::TrainingSet & trainingset,
 /*----------------------------*/
 SGTELIB::Surrogate_PRS::~Surrogate_PRS ( void ) {
     
+    delete_derivative_matrices();
+
+}//
+
+/*--------------------------------------------*/
+/*  delete the matrices of the derivatives    */
+/*  (they depend on alpha)                    */
+/*--------------------------------------------*/
+void SGTELIB::Surrogate_PRS::delete_derivative_matrices ( void ) {
+
     if (_preComputeForJacobianAndHessianDone)
     {
         for (int i=0 ; i<_n ; i++)
@@ -62,6 +77,7 @@ SGTELIB::Surrogate_PRS::~Surrogate_PRS ( void ) {
         delete [] _M_dxj;
         delete [] _alpha_dxj;
     }
+    _preComputeForJacobianAndHessianDone = false;
 
 }//
 
@@ -90,13 +106,19 @@ bool SGTELIB::Surrogate_PRS::build_private ( void ) {
     _Ai = Matrix( "Ai",0,0    );
     _alpha = Matrix( "alpha",0,0 );
 
+  // The derivatives of the previous build are obsolete
+  delete_derivative_matrices();
+
   // If _q is too big or there is not enough points, then quit
   if (_q>200)
       return false;
     
 // Let's try to building model with less points by adding a small ridge
-  if ( (_q>pvar) && (_param.get_ridge()==0) )
-          _param.set_ridge(0.001);
+// (the parameter is not modified, as the model can be built again on
+// other points)
+  double ridge = _param.get_ridge();
+  if ( (_q>pvar) && (ridge==0) )
+          ridge = 0.001;
 
   // Compute the exponents of the basis functions
   _M = get_PRS_monomes(nvar,_param.get_degree());
@@ -104,8 +126,18 @@ bool SGTELIB::Surrogate_PRS::build_private ( void ) {
   // DESIGN MATRIX H
   _H = compute_design_matrix ( _M , get_matrix_Xs() );
 
+  // NORMAL EQUATIONS Ht*H and Ht*Zs
+  // Update them with the points added and removed if possible,
+  // else compute them from H.
+  if ( ! update_normal_equations() ){
+    compute_normal_equations();
+    _Xs_H = get_matrix_Xs();
+    _Zs_H = get_matrix_Zs();
+    _frame_H = get_frame();
+  }
+
   // Compute alpha
-  if ( !  compute_alpha())
+  if ( !  compute_alpha(ridge))
       return false;
 
   _ready = true; 
@@ -120,40 +152,51 @@ const SGTELIB::Matrix SGTELIB::Surrogate_PRS::compute_design_matrix ( const SGTE
 
   const int n = Xs.get_nb_cols(); // Nb of points in the matrix X given in argument
   const int p = Xs.get_nb_rows(); // Nb of points in the matrix X given in argument
-  double v;
-  int i,j,jj,k,exponent;
+  int j,jj,k,exponent;
 
   const int nbMonomes = Monomes.get_nb_rows();
 
-  // Init the design matrix  
-  SGTELIB::Matrix H("H",p,nbMonomes);
-  // Current basis function (vector column to construct 1 basis function)
-  SGTELIB::Matrix h("h",p,1);
-
+  // Factors of each monome: (jj,exponent) for each varying input with a
+  // non-zero exponent.
   // j is the corresponding index among all input (j in [0;n-1])
   // jj is the index of the input variabe amongst the varying input (jj in [0;nvar-1])
   // k is the index of the monome (ie: the basis function) (k in [0;q-1])
-  // i is the index of a point (i in [0;p-1])
-  // Loop on the monomes
+  std::vector< std::vector< std::pair<int,int> > > factors (nbMonomes);
   for (k=0 ; k<nbMonomes ; k++){
-    h.fill(1.0);
     jj=0;
     // Loop on the input variables
     for (j=0 ; j<n ; j++){
       if (_trainingset.get_X_nbdiff(j)>1)
       {
         exponent = int(Monomes.get(k,jj)); 
-        if (exponent>0){
-          for (i=0 ; i<p ; i++){
-            v = h.get(i,0);
-            v *= pow(Xs.get(i,jj),exponent);
-            h.set(i,0,v);
-          }
-        }
+        if (exponent>0) factors[k].push_back(std::make_pair(jj,exponent));
         jj++;
       }
     }
-    H.set_col(h,k);
+  }
+
+  // Init the design matrix  
+  SGTELIB::Matrix H("H",p,nbMonomes);
+
+  // The design matrix is built one point (row) at a time, and the points
+  // are shared between threads for large batches.
+  // x^1 and x^2 are computed with products rather than with pow.
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(static) if ( double(p)*nbMonomes > SGTELIB::PARALLEL_MIN_TERMS )
+  #endif
+  for (int i=0 ; i<p ; i++){
+    const double * x = Xs.get_row_data(i);
+    double * h = H.get_row_data(i);
+    for (int km=0 ; km<nbMonomes ; km++){
+      double v = 1.0;
+      for (const std::pair<int,int> & f : factors[km]){
+        const double xj = x[f.first];
+        if      (f.second==1) v *= xj;
+        else if (f.second==2) v *= xj*xj;
+        else                  v *= pow(xj,f.second);
+      }
+      h[km] = v;
+    }
   }
   return H;
 }//
@@ -196,35 +239,122 @@ void SGTELIB::Surrogate_PRS::compute_dxi_matrices (
 /*--------------------------------------*/
 /*       compute alpha                  */
 /*--------------------------------------*/
-bool SGTELIB::Surrogate_PRS::compute_alpha ( void ){
+/*--------------------------------------*/
+/*   Normal equations Ht*H and Ht*Zs    */
+/*--------------------------------------*/
+void SGTELIB::Surrogate_PRS::compute_normal_equations ( void ){
+  _HtH = SGTELIB::Matrix::transposeA_product(_H,_H);
+  _HtZ = SGTELIB::Matrix::transposeA_product(_H,get_matrix_Zs());
+  _nb_removed_H = 0;
+  _frame_H.clear();
+}//
 
-  const SGTELIB::Matrix   Ht = _H.transpose();
+/*--------------------------------------*/
+/*  Frame of the design matrix: degree, */
+/*  varying inputs, and scaling         */
+/*--------------------------------------*/
+std::vector<double> SGTELIB::Surrogate_PRS::get_frame ( void ) const {
+  std::vector<double> frame;
+  frame.push_back(_param.get_degree());
+  for (int j=0 ; j<_n ; j++){
+    frame.push_back(_trainingset.get_X_nbdiff(j)>1);
+    frame.push_back(_trainingset.get_X_scaling_a(j));
+    frame.push_back(_trainingset.get_X_scaling_b(j));
+  }
+  for (int j=0 ; j<_m ; j++){
+    frame.push_back(_trainingset.get_Z_scaling_a(j));
+    frame.push_back(_trainingset.get_Z_scaling_b(j));
+  }
+  return frame;
+}//
+
+/*--------------------------------------*/
+/*   Update the normal equations with   */
+/*   the points added and removed       */
+/*--------------------------------------*/
+// The normal equations of the previous build are updated if the basis
+// functions and the scaling are unchanged (see TrainingSet::set_keep_scaling).
+// The rows of the previous points that are not matched, in order, by the
+// current points are removed, and the remaining current points are added.
+// The points kept by TrainingSet::update_points keep their order, so only the
+// points that changed are processed. Returns false if the normal equations
+// have to be computed from H.
+bool SGTELIB::Surrogate_PRS::update_normal_equations ( void ){
+
+  if ( (_HtH.get_nb_rows()!=_q) || (_frame_H.empty()) || (get_frame()!=_frame_H) ) return false;
+
+  const SGTELIB::Matrix & Xs = get_matrix_Xs();
   const SGTELIB::Matrix & Zs = get_matrix_Zs();
+  const int p_old = _Xs_H.get_nb_rows();
+
+  // Match the previous and current points
+  std::list<int> removed;
+  int i = 0;
+  for (int i_old=0 ; i_old<p_old ; i_old++){
+    if ( (i<_p)
+         && std::equal(Xs.get_row_data(i),Xs.get_row_data(i)+_n,_Xs_H.get_row_data(i_old))
+         && std::equal(Zs.get_row_data(i),Zs.get_row_data(i)+_m,_Zs_H.get_row_data(i_old)) ){
+      i++;
+    }
+    else{
+      removed.push_back(i_old);
+    }
+  }
+  std::list<int> added;
+  for ( ; i<_p ; i++) added.push_back(i);
+
+  // Compute from H when most points changed, or when many rows have been
+  // removed since the last full computation (the subtractions lose accuracy).
+  const int nb_removed = static_cast<int>(removed.size());
+  const int nb_added = static_cast<int>(added.size());
+  if ( (nb_removed+nb_added>=_p) || (_nb_removed_H+nb_removed>_p) ) return false;
+
+  if (nb_removed>0){
+    const SGTELIB::Matrix Hr = compute_design_matrix(_M,_Xs_H.get_rows(removed));
+    _HtH.sub(SGTELIB::Matrix::transposeA_product(Hr,Hr));
+    _HtZ.sub(SGTELIB::Matrix::transposeA_product(Hr,_Zs_H.get_rows(removed)));
+  }
+  if (nb_added>0){
+    const SGTELIB::Matrix Ha = _H.get_rows(added);
+    _HtH.add(SGTELIB::Matrix::transposeA_product(Ha,Ha));
+    _HtZ.add(SGTELIB::Matrix::transposeA_product(Ha,Zs.get_rows(added)));
+  }
+  _nb_removed_H += nb_removed;
+  _Xs_H = Xs;
+  _Zs_H = Zs;
+
+  return true;
+}//
+
+/*--------------------------------------*/
+/*     Coefficients of the model        */
+/*--------------------------------------*/
+bool SGTELIB::Surrogate_PRS::compute_alpha ( const double ridge ){
 
   // Ridge
-  double r = _param.get_ridge();
+  double r = ridge;
 
-    if (_H.has_inf() || _H.has_nan() || Ht.has_inf() || Ht.has_nan())
+    if (_H.has_inf() || _H.has_nan())
     {
         return false;
     }
   // COMPUTE COEFS
   if (r>0)
   {
-    _Ai = (Ht*_H+r*SGTELIB::Matrix::identity(_q)).SVD_inverse();
-    //_Ai = (Ht*_H+r*SGTELIB::Matrix::identity(_q)).cholesky_inverse();
+    _Ai = (_HtH+r*SGTELIB::Matrix::identity(_q)).SVD_inverse();
+    //_Ai = (_HtH+r*SGTELIB::Matrix::identity(_q)).cholesky_inverse();
   }
   else
   {
-      _Ai = (Ht*_H).SVD_inverse();
-      //_Ai = (Ht*_H).cholesky_inverse();
+      _Ai = _HtH.SVD_inverse();
+      //_Ai = _HtH.cholesky_inverse();
       
       // We may not have enough points to compute all coefficients of the monome
       // Let's try with a small ridge
       if (_Ai.has_nan())
       {
           r = 1E-3;
-          _Ai = (Ht*_H+r*SGTELIB::Matrix::identity(_q)).SVD_inverse();
+          _Ai = (_HtH+r*SGTELIB::Matrix::identity(_q)).SVD_inverse();
           
       }
   }
@@ -233,9 +363,9 @@ bool SGTELIB::Surrogate_PRS::compute_alpha ( void ){
       return false;
   }
     
-  _alpha = _Ai * (Ht * Zs);
+  _alpha = _Ai * _HtZ;
     
-    SGTELIB::Matrix sing_val = (Ht*_H).get_singular_values();
+    SGTELIB::Matrix sing_val = _HtH.get_singular_values();
     double sing_val_min = sing_val.min();
     if (sing_val_min > 0)
     {
@@ -55,12 +55,25 @@ namespace SGTELIB {
       
       
       double _cond;
+
+      // Data of the normal equations, to update them when the training set
+      // changes (see update_normal_equations)
+      SGTELIB::Matrix _Xs_H; // Scaled inputs of the rows of _HtH
+      SGTELIB::Matrix _Zs_H; // Scaled outputs of the rows of _HtZ
+      std::vector<double> _frame_H; // Degree, varying inputs and scaling
+      int _nb_removed_H; // Nb of rows removed since the last full computation
+
+      std::vector<double> get_frame ( void ) const;
+      bool update_normal_equations ( void );
+      void delete_derivative_matrices ( void );
       
   protected:
 
     int _q; // Nb of basis function
     SGTELIB::Matrix _M; // Monomes
     SGTELIB::Matrix _H; // Design matrix
+    SGTELIB::Matrix _HtH; // Ht*H
+    SGTELIB::Matrix _HtZ; // Ht*Zs
     SGTELIB::Matrix _Ai; // Inverse of Ht*H
     SGTELIB::Matrix _alpha; // Coefficients
 
@@ -87,7 +100,8 @@ namespace SGTELIB {
     const SGTELIB::Matrix * get_matrix_Zvs (void) override;
       
 
-    bool compute_alpha ( void );
+    void compute_normal_equations ( void );
+    bool compute_alpha ( const double ridge );
       
 
   public:
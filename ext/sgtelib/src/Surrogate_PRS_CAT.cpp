@@ -94,7 +94,8 @@ bool SGTELIB::Surrogate_PRS_CAT::build_private ( void ) {
   _H = compute_design_matrix ( _M , get_matrix_Xs() );
 
   // Compute alpha
-  bool ok = compute_alpha();   
+  compute_normal_equations();
+  bool ok = compute_alpha(_param.get_ridge());   
   return ok;
 }//
 
@@ -74,7 +74,8 @@ bool SGTELIB::Surrogate_PRS_EDGE::build_private ( void ) {
   // DESIGN MATRIX H
   _H = compute_design_matrix ( _M , get_matrix_Xs() );
 
-  return compute_alpha();   
+  compute_normal_equations();
+  return compute_alpha(_param.get_ridge());   
 }//
 
 
@@ -148,6 +148,11 @@ std::string SGTELIB::Surrogate_Parameters::to_standard_field_name (const std::st
   if ( streqi(field,"OPTIMIZATION_BUDGET") ) return "BUDGET";
   if ( streqi(field,"BUDGET_OPTIMIZATION") ) return "BUDGET";
 
+  if ( streqi(field,"OPTIM_STARTS") )        return "OPTIM_STARTS";
+  if ( streqi(field,"STARTS") )              return "OPTIM_STARTS";
+  if ( streqi(field,"MULTISTART") )          return "OPTIM_STARTS";
+  if ( streqi(field,"MULTI_START") )         return "OPTIM_STARTS";
+
   if ( streqi(field,"PRESET") )         return "PRESET";
 
   if ( streqi(field,"OUTPUT") )         return "OUTPUT";
@@ -329,6 +334,13 @@ void SGTELIB::Surrogate_Parameters::read_string (const std::string & model_descr
       _budget = SGTELIB::stoi(content);
       // Cannot be optimized
     }
+    else if ( streqi(field,"OPTIM_STARTS") ){
+      _optim_starts = SGTELIB::stoi(content);
+      if (_optim_starts<1){
+        throw SGTELIB::Exception ( __FILE__ , __LINE__ , "OPTIM_STARTS must be positive" );
+      }
+      // Cannot be optimized
+    }
     else if ( streqi(field,"PRESET") ){
       _preset = content;
       // Cannot be optimized
@@ -355,6 +367,7 @@ bool SGTELIB::Surrogate_Parameters::authorized_field ( const std::string & field
   if (streqi(field,"OUTPUT")) return true;
   if (streqi(field,"METRIC_TYPE")) return true;
   if (streqi(field,"BUDGET")) return true;
+  if (streqi(field,"OPTIM_STARTS")) return true;
 
   switch (_type) {
     case SGTELIB::LINEAR:
@@ -446,6 +459,7 @@ bool SGTELIB::Surrogate_Parameters::authorized_optim ( const std::string & field
   if (streqi(field,"METRIC_TYPE"))   return false;
   if (streqi(field,"PRESET"))        return false;
   if (streqi(field,"BUDGET"))        return false;
+  if (streqi(field,"OPTIM_STARTS"))  return false;
   if (streqi(field,"UNCERTAINTY_TYPE")) return false; 
   if (streqi(field,"UNCERTAINTY"))   return false; 
   if (streqi(field,"SIZE_PARAM"))    return false; 
@@ -648,6 +662,7 @@ void SGTELIB::Surrogate_Parameters::display ( std::ostream & out ) const {
 void SGTELIB::Surrogate_Parameters::set_defaults ( void ) {
 
   _budget = 100;
+  _optim_starts = 1;
   _metric_type = SGTELIB::METRIC_AOECV;
   _distance_type = SGTELIB::DISTANCE_NORM2;
   _distance_type_status = SGTELIB::STATUS_FIXED;
@@ -79,6 +79,8 @@ namespace SGTELIB {
     std::string _output;
     // Optimization budget
     int _budget;
+    // Nb of local searches run concurrently by the optimization
+    int _optim_starts;
 
     // Nb of parameters that are optimized
     int _nb_parameter_optimization;
@@ -124,6 +126,7 @@ namespace SGTELIB {
     std::string     get_output          (void) const {return _output;};
     SGTELIB::Matrix get_covariance_coef (void) const {return _covariance_coef;};
     int             get_budget          (void) const {return _budget;};
+    int             get_optim_starts    (void) const {return _optim_starts;};
     // Get the distance type (return OPTIM if the distance type has to be optimized).
     std::string get_distance_type_str (void) const {
       if (_distance_type_status==SGTELIB::STATUS_OPTIM) return "OPTIM";
@@ -39,8 +39,10 @@ SGTELIB::Surrogate_RBF::Surrogate_RBF ( SGTELIB::TrainingSet & trainingset,
   _HtH               ( "HtH",0,0           ),
   _HtZ               ( "HtZ",0,0           ),
   _Ai                ( "Ai",0,0            ),
+  _ridge             ( -1.0                ),
   _Alpha             ( "alpha",0,0         ),
-  _selected_kernel   (1,-1                 ){
+  _selected_kernel   (1,-1                 ),
+  _Xkernel           ( "Xkernel",0,0       ){
   #ifdef SGTELIB_DEBUG
     std::cout << "constructor RBF\n";
   #endif
@@ -146,6 +148,9 @@ bool SGTELIB::Surrogate_RBF::build_private ( void ) {
 
   // The build primarily consists of computing alpha  
 
+  // Centers of the kernels, used by every call to compute_design_matrix
+  _Xkernel = get_matrix_Xs().get_rows(_selected_kernel);
+
   // Compute scaling distance for each training point
   const SGTELIB::Matrix & Zs = get_matrix_Zs();
 
@@ -157,6 +162,7 @@ bool SGTELIB::Surrogate_RBF::build_private ( void ) {
     _H = compute_design_matrix(get_matrix_Xs(),true); 
     // Inverte matrix
     _Ai = _H.lu_inverse();
+    _ridge = -1.0;
     // Product (only the p first rows of Ai)
     _Alpha = SGTELIB::Matrix::subset_product(_Ai,Zs,-1,_p,-1);
   }
@@ -166,36 +172,41 @@ bool SGTELIB::Surrogate_RBF::build_private ( void ) {
     // =========================================
 
     // Build design matrix WITHOUT constraints lines
-    _H = compute_design_matrix(get_matrix_Xs(),false);
-    _HtH = SGTELIB::Matrix::transposeA_product(_H,_H);
-    _HtZ = SGTELIB::Matrix::transposeA_product(_H,get_matrix_Zs());
-    SGTELIB::Matrix A = _HtH;
-
+    const SGTELIB::Matrix H = compute_design_matrix(get_matrix_Xs(),false);
     const double r = _param.get_ridge();
-  
-    // Add regularization term
-    if ( string_find(_param.get_preset(),"1") ){
-      // Add ridge to all basis function
-      for (int i=0 ; i<_q ; i++) A.add(i,i,r);
-    }
-    else if ( string_find(_param.get_preset(),"2") ){
-      // Add ridge to all basis function except constant
-      for (int i=0 ; i<_q-1 ; i++) A.add(i,i,r);
-    }
-    else if ( string_find(_param.get_preset(),"3") ){
-      // Add ridge to all radial basis function
-      for (int i=0 ; i<_qrbf ; i++) A.add(i,i,r);
-    }
-    else {
-      // Add ridge to all radial basis function (Same as R3)
-      for (int i=0 ; i<_qrbf ; i++) A.add(i,i,r);
+
+    if ( ! update_inverse(H,r) ){
+      _H = H;
+      _HtH = SGTELIB::Matrix::transposeA_product(_H,_H);
+      SGTELIB::Matrix A = _HtH;
+
+      // Add regularization term
+      if ( string_find(_param.get_preset(),"1") ){
+        // Add ridge to all basis function
+        for (int i=0 ; i<_q ; i++) A.add(i,i,r);
+      }
+      else if ( string_find(_param.get_preset(),"2") ){
+        // Add ridge to all basis function except constant
+        for (int i=0 ; i<_q-1 ; i++) A.add(i,i,r);
+      }
+      else if ( string_find(_param.get_preset(),"3") ){
+        // Add ridge to all radial basis function
+        for (int i=0 ; i<_qrbf ; i++) A.add(i,i,r);
+      }
+      else {
+        // Add ridge to all radial basis function (Same as R3)
+        for (int i=0 ; i<_qrbf ; i++) A.add(i,i,r);
+      }
+      _Ai = A.cholesky_inverse();
+      _ridge = r;
     }
-    _Ai = A.cholesky_inverse();
+    _HtZ = SGTELIB::Matrix::transposeA_product(_H,get_matrix_Zs());
     _Alpha = _Ai*_HtZ;
   }
 
   // Check for Nan  
   if (_Alpha.has_nan()){
+    _ridge = -1.0;
     return false;
   }
 
@@ -208,6 +219,40 @@ bool SGTELIB::Surrogate_RBF::build_private ( void ) {
 
 
 
+/*--------------------------------------*/
+/*   Update of Ai with new points       */
+/*--------------------------------------*/
+bool SGTELIB::Surrogate_RBF::update_inverse ( const SGTELIB::Matrix & H , const double r ) {
+
+  // If the basis functions and the ridge did not change, and the points
+  // of the previous build are the first points of the training set, the
+  // previous design matrix is made of the first rows of H. Then Ht*H+r*J
+  // only gets the term Hk'*Hk, where Hk are the rows of the k new points,
+  // and its inverse is updated with the Woodbury formula, in O(q^2*k):
+  //   Ai = Ai - Ai*Hk'*(I+Hk*Ai*Hk')^-1*Hk*Ai
+  const int p_old = _H.get_nb_rows();
+  if ( (r!=_ridge) || (p_old==0) || (_Ai.get_nb_rows()!=_q) ) return false;
+  if ( (H.get_nb_cols()!=_H.get_nb_cols()) || ( ! H.has_leading_block(_H)) ) return false;
+  if (p_old==_p) return true;
+
+  const SGTELIB::Matrix Hk = H.get_rows(p_old,_p);
+  const SGTELIB::Matrix G = _Ai*Hk.transpose();
+  SGTELIB::Matrix C = Hk*G;
+  for (int i=0 ; i<_p-p_old ; i++) C.add(i,i,1.0);
+  const SGTELIB::Matrix Ai = _Ai - G*C.cholesky_inverse()*G.transpose();
+
+  // Ai is positive definite, unless the update is not stable.
+  for (int i=0 ; i<_q ; i++){
+    if ( ! (Ai.get(i,i)>0) ) return false;
+  }
+
+  _Ai = Ai;
+  _HtH = _HtH + SGTELIB::Matrix::transposeA_product(Hk,Hk);
+  _H = H;
+  return true;
+}//
+
+
 /*--------------------------------------*/
 /*         Compute Design matrix        */
 /*--------------------------------------*/
@@ -220,14 +265,9 @@ const SGTELIB::Matrix SGTELIB::Surrogate_RBF::compute_design_matrix ( const SGTE
   const int pxx = XXs.get_nb_rows();
 
   // Get the distance from each input point XXs to each kernel
-  SGTELIB::Matrix H = _trainingset.get_distances(XXs,get_matrix_Xs().get_rows(_selected_kernel),_param.get_distance_type());
-  // Apply kernel values
-  /*
-  for ( int i=0 ; i<_qrbf ; i++ ){
-    H.set_col(kernel(_param.get_kernel_type(),_kernel_coef,H.get_col(i)),i);
-  }
-  */
-  H = kernel(_param.get_kernel_type(),_param.get_kernel_coef(),H);
+  SGTELIB::Matrix H = _trainingset.get_distances(XXs,_Xkernel,_param.get_distance_type());
+  // Apply kernel values (in place)
+  kernel(_param.get_kernel_type(),_param.get_kernel_coef(),&H);
 
   // If there are some PRS basis functions
   if (_qprs>0){
@@ -54,9 +54,11 @@ namespace SGTELIB {
     SGTELIB::Matrix _HtH; // H'*H
     SGTELIB::Matrix _HtZ; // H'*Z
     SGTELIB::Matrix _Ai; // inverse of H or Ht*H+r*J
+    double _ridge; // r used in _Ai (negative if _Ai can not be updated)
     SGTELIB::Matrix _Alpha; // Coefficients
 
     std::list<int> _selected_kernel;
+    SGTELIB::Matrix _Xkernel; // Centers of the kernels (scaled)
 
 
     /*--------------------------------------*/
@@ -68,6 +70,7 @@ namespace SGTELIB {
     /*          Build model                 */
     /*--------------------------------------*/
     bool select_kernels ( void ); 
+    bool update_inverse ( const SGTELIB::Matrix & H , const double r );
     virtual bool build_private (void) override;
     virtual bool init_private  (void) override;
     //SGTELIB::Matrix get_bumpiness (void);
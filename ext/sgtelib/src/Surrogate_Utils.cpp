@@ -744,13 +744,46 @@ int SGTELIB::diff_ms(timeval t1, timeval t2){
   return static_cast<int>((((t1.tv_sec - t2.tv_sec) * 1000000) + (t1.tv_usec - t2.tv_usec +500))/1000);
 }//
 
+namespace {
+  // Stream used by uniform_rand() in this thread (NULL: use rand()).
+  thread_local SGTELIB::Random_Stream * current_stream = NULL;
+}
+
 /*----------------------------------------*/
 /*  uniform rand generator               */
 /*----------------------------------------*/
 double SGTELIB::uniform_rand (void){
+  if (current_stream) return current_stream->uniform_rand();
   return double(rand() / double(INT_MAX));
 }//
 
+/*----------------------------------------*/
+/*  random stream                         */
+/*----------------------------------------*/
+SGTELIB::Random_Stream::Random_Stream ( const unsigned int seed ) :
+  _generator ( seed           ) ,
+  _previous  ( current_stream ) {
+  current_stream = this;
+}//
+
+SGTELIB::Random_Stream::~Random_Stream ( void ) {
+  current_stream = _previous;
+}//
+
+double SGTELIB::Random_Stream::uniform_rand ( void ){
+  return double(_generator()) / double(std::minstd_rand::max());
+}//
+
+/*----------------------------------------*/
+/*  Seed of a new stream, drawn with      */
+/*  uniform_rand(), so that the seeds are */
+/*  reproducible when they are drawn by   */
+/*  one thread.                           */
+/*----------------------------------------*/
+unsigned int SGTELIB::Random_Stream::draw_seed ( void ){
+  return 1+static_cast<unsigned int>(SGTELIB::uniform_rand()*double(std::minstd_rand::max()-2));
+}//
+
 /*----------------------------------------*/
 /*  quick gaussian random generator       */
 /*----------------------------------------*/
@@ -56,6 +56,7 @@ typedef struct timeval {
 
 #include <cstring>
 #include <cctype>
+#include <random>
 
 namespace SGTELIB {
 
@@ -210,6 +211,26 @@ namespace SGTELIB {
 
   double uniform_rand (void);
   double quick_norm_rand (void);
+
+  /*--------------------------------------------------*/
+  /*  While a Random_Stream exists, uniform_rand()    */
+  /*  draws the numbers of the thread that created it */
+  /*  from the stream instead of rand(). A stream     */
+  /*  gives the same numbers for a given seed,        */
+  /*  whatever the other threads do.                  */
+  /*--------------------------------------------------*/
+  class DLL_API Random_Stream {
+  private:
+    std::minstd_rand _generator;
+    Random_Stream * _previous; // Stream replaced by this one in this thread
+    Random_Stream ( const Random_Stream & );
+    Random_Stream & operator = ( const Random_Stream & );
+  public:
+    explicit Random_Stream ( const unsigned int seed );
+    ~Random_Stream ( void );
+    double uniform_rand ( void );
+    static unsigned int draw_seed ( void );
+  };
 }
 
 #endif
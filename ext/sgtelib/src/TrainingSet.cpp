@@ -24,6 +24,7 @@
 /*-------------------------------------------------------------------------------------*/
 
 #include "TrainingSet.hpp"
+#include <map>
 using namespace SGTELIB;
 
 /*--------------------------------------*/
@@ -67,7 +68,9 @@ SGTELIB::TrainingSet::TrainingSet ( const Matrix & X ,
   _Z_std        ( new double   [_m] ) ,
   _Zs_mean      ( new double   [_m] ) , // Mean of each normalized output
   _Z_nbdiff     ( new int      [_m] ) ,
-_Ds_mean      ( 0.0               ) {
+  _Ds_mean      ( 0.0               ) ,
+  _keep_scaling ( false             ) ,
+  _scaling_is_def ( false           ) {
     
     // Init bounds
     for (int i=0 ; i<_n ; i++){
@@ -127,7 +130,9 @@ SGTELIB::TrainingSet::TrainingSet ( int n, int m  ) :
         _Z_std        ( new double   [_m] ) ,
         _Zs_mean      ( new double   [_m] ) , // Mean of each normalized output
         _Z_nbdiff     ( new int      [_m] ) ,
-        _Ds_mean      ( 0.0               )
+        _Ds_mean      ( 0.0               ) ,
+        _keep_scaling ( false             ) ,
+        _scaling_is_def ( false           )
       {
           
           // No training set sample -> all diff.
@@ -353,7 +358,9 @@ void SGTELIB::TrainingSet::build ( void ){
   }
 
   // _bbo is considered as defined. It can not be modified anymore.
-  _bbo_is_def = true;
+  // (Not written if already set: the models of an ensemble call build()
+  // concurrently on their common training set.)
+  if ( ! _bbo_is_def) _bbo_is_def = true;
 
 }//
 
@@ -469,6 +476,76 @@ bool SGTELIB::TrainingSet::partial_reset_and_add_points ( const Matrix & Xnew ,
     return true;
 }
 
+/*--------------------------------------*/
+/*              update_points           */
+/*--------------------------------------*/
+// The points of (Xnew,Znew) that are already in the training set keep their
+// rank, the other points of the training set are removed, and the new points
+// are added at the end. Returns the number of points added and removed.
+int SGTELIB::TrainingSet::update_points ( const Matrix & Xnew ,
+                                          const Matrix & Znew ) {
+
+  // Check dim
+  if ( Xnew.get_nb_rows() != Znew.get_nb_rows() || Xnew.get_nb_cols() != _n || Znew.get_nb_cols() != _m ){
+    throw Exception ( __FILE__ , __LINE__ , "TrainingSet::update_points(): dimension error" );
+  }
+
+  // A point is identified by its inputs and outputs
+  const auto point = [this] ( const Matrix & X , const Matrix & Z , const int i ){
+    std::vector<double> xz (X.get_row_data(i),X.get_row_data(i)+_n);
+    xz.insert(xz.end(),Z.get_row_data(i),Z.get_row_data(i)+_m);
+    return xz;
+  };
+
+  // Rows of each new point
+  const int pnew = Xnew.get_nb_rows();
+  std::map< std::vector<double> , std::list<int> > new_rows;
+  for (int i=0 ; i<pnew ; i++){
+    new_rows[point(Xnew,Znew,i)].push_back(i);
+  }
+
+  // Points to keep
+  std::list<int> kept;
+  std::vector<bool> is_kept (pnew,false);
+  for (int i=0 ; i<_p ; i++){
+    const auto it = new_rows.find(point(_X,_Z,i));
+    if ( (it!=new_rows.end()) && ( ! it->second.empty()) ){
+      kept.push_back(i);
+      is_kept[it->second.front()] = true;
+      it->second.pop_front();
+    }
+  }
+
+  // Points to add
+  std::list<int> added;
+  for (int i=0 ; i<pnew ; i++){
+    if ( ! is_kept[i]) added.push_back(i);
+  }
+
+  const int nb_removed = _p-static_cast<int>(kept.size());
+  const int nb_added = static_cast<int>(added.size());
+  if ( (nb_removed==0) && (nb_added==0) ) return 0;
+
+  if (nb_removed>0){
+    _X = _X.get_rows(kept);
+    _Z = _Z.get_rows(kept);
+  }
+  if (nb_added>0){
+    _X.add_rows(Xnew.get_rows(added));
+    _Z.add_rows(Znew.get_rows(added));
+  }
+  _p = _X.get_nb_rows();
+
+  _Xs = SGTELIB::Matrix( "TrainingSet._Xs" , _p , _n );
+  _Zs = SGTELIB::Matrix( "TrainingSet._Zs" , _p , _m );
+  _Ds = SGTELIB::Matrix( "TrainingSet._Ds" , _p , _p );
+
+  // Note that the trainingset needs to be updated.
+  _ready = false;
+
+  return nb_removed+nb_added;
+}//
+
 /*--------------------------------------*/
 /*                 add_point            */
 /*--------------------------------------*/
@@ -669,6 +746,10 @@ void SGTELIB::TrainingSet::compute_nvar_mvar ( void ){
 void SGTELIB::TrainingSet::compute_scaling ( void ){
   int j=0;
 
+  // Keep the previous scaling if it still suits the points
+  if ( _keep_scaling && _scaling_is_def && check_previous_scaling() ) return;
+  _scaling_is_def = true;
+
   // Neutral values
   for ( j = 0 ; j < _n ; j++ ) {
     _X_scaling_a[j] = 1;
@@ -711,6 +792,41 @@ void SGTELIB::TrainingSet::compute_scaling ( void ){
 }//
 
 
+/*---------------------------------------------------*/
+/*  check if the scaling of the previous build       */
+/*  still suits the points                           */
+/*---------------------------------------------------*/
+// With the MEANSTD scaling, the previous scaling constants are kept if each
+// scaled input and output has a mean in [-1,1] and a std in [1/4,4]. The
+// scaled data, and the models built on them, are then unchanged for the
+// points that were already in the training set.
+bool SGTELIB::TrainingSet::check_previous_scaling ( void ){
+
+  if (scaling_method!=SCALING_MEANSTD) return false;
+
+  compute_mean_std();
+
+  int j;
+  double mean_s, std_s;
+  for ( j = 0 ; j < _n ; j++ ) {
+    mean_s = _X_mean[j]*_X_scaling_a[j]+_X_scaling_b[j];
+    if (fabs(mean_s)>1) return false;
+    if (_X_nbdiff[j]>1){
+      std_s = _X_std[j]*fabs(_X_scaling_a[j]);
+      if ( (std_s<0.25) || (std_s>4) ) return false;
+    }
+  }
+  for ( j = 0 ; j < _m ; j++ ) {
+    mean_s = _Z_mean[j]*_Z_scaling_a[j]+_Z_scaling_b[j];
+    if (fabs(mean_s)>1) return false;
+    if (_Z_nbdiff[j]>1){
+      std_s = _Z_std[j]*fabs(_Z_scaling_a[j]);
+      if ( (std_s<0.25) || (std_s>4) ) return false;
+    }
+  }
+  return true;
+}//
+
 /*---------------------------------------------------*/
 /*  compute scale matrices _Xs and _Zs               */
 /*---------------------------------------------------*/
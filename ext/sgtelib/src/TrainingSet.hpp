@@ -95,6 +95,10 @@ namespace SGTELIB {
     // Mean distance between points 
     double _Ds_mean;
 
+    // Keep the scaling of the previous build (see set_keep_scaling)
+    bool _keep_scaling;
+    bool _scaling_is_def;
+
     // private affectation operator:
     TrainingSet & operator = ( const TrainingSet & );
 
@@ -108,6 +112,7 @@ namespace SGTELIB {
     void compute_mean_std        (void);
     void compute_nvar_mvar       (void);
     void compute_scaling         (void);
+    bool check_previous_scaling  (void);
     void compute_Ds              (void);
     void compute_scaled_matrices (void);
     void compute_f_min           (void);
@@ -151,6 +156,13 @@ namespace SGTELIB {
     bool add_point  ( const double * xnew ,
                       const double * znew  );
 
+    // replace the points, keeping the ones already in the training set:
+    int update_points ( const SGTELIB::Matrix & Xnew ,
+                        const SGTELIB::Matrix & Znew  );
+
+    // keep the scaling of the previous build while it suits the points:
+    void set_keep_scaling ( const bool keep ) { _keep_scaling = keep; };
+
     // scale and unscale:
     void   X_scale      ( double * x ) const;
     void   X_unscale    ( double * y ) const;
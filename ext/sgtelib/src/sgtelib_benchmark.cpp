@@ -0,0 +1,109 @@
+/*-------------------------------------------------------------------------------------*/
+/*  sgtelib - A surrogate model library for derivative-free optimization               */
+/*  Version 2.0.3                                                                      */
+/*                                                                                     */
+/*  Copyright (C) 2012-2017  Sebastien Le Digabel - Ecole Polytechnique, Montreal      */
+/*                           Bastien Talgorn - McGill University, Montreal             */
+/*                                                                                     */
+/*  Author: Bastien Talgorn                                                            */
+/*  email: bastientalgorn@fastmail.com                                                 */
+/*                                                                                     */
+/*  This program is free software: you can redistribute it and/or modify it under the  */
+/*  terms of the GNU Lesser General Public License as published by the Free Software   */
+/*  Foundation, either version 3 of the License, or (at your option) any later         */
+/*  version.                                                                           */
+/*                                                                                     */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT ANY    */
+/*  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A    */
+/*  PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.   */
+/*                                                                                     */
+/*  You should have received a copy of the GNU Lesser General Public License along     */
+/*  with this program. If not, see <http://www.gnu.org/licenses/>.                     */
+/*                                                                                     */
+/*  You can find information on sgtelib at https://github.com/bastientalgorn/sgtelib   */
+/*-------------------------------------------------------------------------------------*/
+
+// Micro-benchmark of the predictions of the surrogates.
+// sgtelib_benchmark.exe [n] [p]
+// For each model, builds the model on p points in dimension n, then
+// reports the number of predictions per second for batches of
+// increasing size.
+
+#include "sgtelib.hpp"
+#include "Surrogate_Factory.hpp"
+#include "Tests.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*--------------------------------------*/
+/*  predictions per second of a model   */
+/*  for batches of pxx points           */
+/*--------------------------------------*/
+double predictions_per_second ( SGTELIB::Surrogate * S , const int n , const int pxx ){
+
+  SGTELIB::Matrix XX ("XX",pxx,n);
+  XX.set_random(-5,+5,false);
+  SGTELIB::Matrix ZZ;
+
+  // Repeat the prediction during at least 0.5 second
+  const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  double elapsed = 0;
+  long nb_predictions = 0;
+  while (elapsed<0.5){
+    S->predict(XX,&ZZ);
+    nb_predictions += pxx;
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now()-t0).count();
+  }
+  return double(nb_predictions)/elapsed;
+}//
+
+/*--------------------------------------*/
+/*                 main                 */
+/*--------------------------------------*/
+int main ( int argc , char ** argv ) {
+
+  const int n = (argc>1) ? std::atoi(argv[1]) : 4;
+  const int p = (argc>2) ? std::atoi(argv[2]) : 200;
+  if ( (n<1) || (p<2) ){
+    std::cout << "Usage: sgtelib_benchmark.exe [n] [p]\n";
+    return 1;
+  }
+
+  // Training set
+  SGTELIB::Matrix X ("X",p,n);
+  X.set_random(-5,+5,false);
+  const SGTELIB::Matrix Z = SGTELIB::test_functions(X);
+  SGTELIB::TrainingSet TS (X,Z);
+
+  const std::string models [] = { "TYPE PRS DEGREE 2 RIDGE 0" ,
+                                  "TYPE RBF PRESET I" ,
+                                  "TYPE RBF PRESET R KERNEL_TYPE D1" ,
+                                  "TYPE KRIGING" ,
+                                  "TYPE KS" };
+  const int batch_sizes [] = { 1 , 10 , 100 , 1000 , 10000 };
+
+  std::printf("n = %d, p = %d, predictions per second\n",n,p);
+  std::printf("%-36s","batch size");
+  for (const int pxx : batch_sizes) std::printf("%12d",pxx);
+  std::printf("\n");
+
+  for (const std::string & model : models){
+    SGTELIB::Surrogate * S = SGTELIB::Surrogate_Factory(TS,model);
+    std::printf("%-36s",model.c_str());
+    if (S->build()){
+      for (const int pxx : batch_sizes){
+        std::printf("%12.4g",predictions_per_second(S,n,pxx));
+      }
+    }
+    else{
+      std::printf("  (not ready)");
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+    SGTELIB::surrogate_delete(S);
+  }
+
+  return 0;
+}//
@@ -31,7 +31,7 @@
 //  Get dimension of HELP_DATA
 //================================
 int SGTELIB::dim_help_data (void){
-  return 32;
+  return 34;
 }//
 
 //================================
@@ -39,7 +39,7 @@ int SGTELIB::dim_help_data (void){
 //================================
 std::string ** SGTELIB::get_help_data (void){
   int i;
-  const int NL = 32;
+  const int NL = 34;
   const int NC = 3;
   std::string ** HELP_DATA = new std::string * [NL];
   for (i = 0 ; i<NL ; i++) HELP_DATA[i] = new std::string [NC];
@@ -124,6 +124,7 @@ std::string ** SGTELIB::get_help_data (void){
 " * PRESET: Special information for some types of model \n"
 " * WEIGHT_TYPE: Defines how the weights of Ensemble of model are computed \n"
 " * BUDGET: Defines the parameter optimization budget \n"
+" * OPTIM_STARTS: Number of concurrent local searches of the parameter optimization \n"
 " * OUTPUT: Defines the output text file ";
   i++;
   //================================
@@ -464,6 +465,17 @@ std::string ** SGTELIB::get_help_data (void){
 "Example\n"
 "      TYPE LOWESS KERNEL_SHAPE OPTIM METRIC AOECV BUDGET 100\n"
 "      TYPE ENSEMBLE WEIGHT OPTIM METRIC RMSECV BUDGET 50";
+  i++;
+  //================================
+  //      OPTIM_STARTS
+  //================================
+  HELP_DATA[i][0] = "OPTIM_STARTS";
+  HELP_DATA[i][1] = "PARAMETER PARAMETERS OPTIM OPTIMIZATION BUDGET PARALLEL MULTISTART";
+  HELP_DATA[i][2] = "Number of local searches of the model parameter optimization. When greater than 1, the local searches start from the best initial sets of parameters and are run concurrently, and the searches that are clearly worse than the best one are abandoned. The result does not depend on the number of threads.\n"
+"Default values 1\n"
+" \n"
+"Example\n"
+"      TYPE LOWESS DEGREE OPTIM KERNEL_COEF OPTIM OPTIM_STARTS 4";
   i++;
   //================================
   //      SGTELIB_SERVER_START
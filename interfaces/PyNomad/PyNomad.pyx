@@ -101,6 +101,8 @@ def setSeed(seed):
     cdef RNG rng
     rng.setSeed(seed)
 
+# The RNG state is a string. With RNG_STREAMS, it also holds the state of the
+# random stream of the calling thread.
 def getRNGState():
     cdef RNG rng
     state = rng.getPrivateSeedAsString()
@@ -124,6 +126,32 @@ def resetRandomNumberGenerator():
     current_seed = rng.getSeed()
     rng.setSeed(current_seed) # Set seed performs a reset of the private seed
 
+# Read a history file written with HISTORY_FILE_BINARY true.
+# Returns the points and the blackbox outputs (NaN if undefined) as lists of rows,
+# the evaluation status (EvalStatusType values, EVAL_OK=5), the evaluation thread and
+# the time in seconds since the history file was opened.
+def readBinaryHistory(fileName):
+    cdef BinaryHistoryReader* reader = new BinaryHistoryReader(fileName.encode(u"ascii"))
+    cdef vector[double] x
+    cdef vector[double] bbo
+    cdef vector[int] evalStatus
+    cdef vector[int] threadNum
+    cdef vector[double] time
+    try:
+        nbRecords = reader.readColumns(x, bbo, evalStatus, threadNum, time)
+        n = reader.getN()
+        m = reader.getM()
+        bbOutputType = reader.getBBOutputType().decode('utf-8').split()
+    finally:
+        del reader
+
+    xList = x
+    bboList = bbo
+    return {'n': n, 'bb_output_type': bbOutputType,
+            'x': [xList[k*n:(k+1)*n] for k in range(nbRecords)],
+            'bbo': [bboList[k*m:(k+1)*m] for k in range(nbRecords)],
+            'eval_status': evalStatus, 'thread': threadNum, 'time': time}
+
 
 def observe(params,points,evals,udpatedCacheFileName):
     cdef shared_ptr[AllParameters] allParameters_ptr = make_shared[AllParameters]()
@@ -257,6 +285,14 @@ cdef extern from "Math/ArrayOfDouble.hpp" namespace "NOMAD":
       const Double& operator[](size_t i) const
       size_t size()
 
+cdef extern from "Output/BinaryHistory.hpp" namespace "NOMAD":
+    cdef cppclass BinaryHistoryReader:
+      BinaryHistoryReader(const string & fileName) except+
+      size_t getN()
+      size_t getM()
+      const string & getBBOutputType()
+      size_t readColumns(vector[double] & x, vector[double] & bbo, vector[int] & evalStatus, vector[int] & threadNum, vector[double] & time) except+
+
 cdef extern from "Math/RNG.hpp" namespace "NOMAD":
     cdef cppclass RNG:
       void setSeed(int s)
@@ -266,7 +302,7 @@ cdef extern from "Math/RNG.hpp" namespace "NOMAD":
       @staticmethod
       string getPrivateSeedAsString()
       @staticmethod
-      void setPrivateSeedAsString(const string & s)
+      void setPrivateSeedAsString(const string & s) except+
 
 cdef class PyNomadMainStep:
     cdef MainStep ms
@@ -86,6 +86,8 @@ static void printPyNomadUsage()
     std::cout << "    Help    : PyNomad.help(\"keywords\") or PyNomad.help()"           << std::endl;
     std::cout << "    Version : PyNomad.version()"                                      << std::endl;
     std::cout << "    Usage   : PyNomad.usage()"                                        << std::endl;
+    std::cout << "    History : PyNomad.readBinaryHistory(\"history file\")"            << std::endl;
+    std::cout << "              (history file written with HISTORY_FILE_BINARY true)"   << std::endl;
     std::cout << "--------------------------------------------------------------"       << std::endl;
     std::cout                                                                           << std::endl;
     std::cout << " PyNomad.optimize input parameters:"                                  << std::endl;
@@ -56,10 +56,7 @@
 #include "../Output/OutputQueue.hpp"
 #include "../Math/RNG.hpp"
 #include "../Util/fileutils.hpp"
-
-#ifdef TIME_STATS
-#include "../Util/Clock.hpp"
-#endif // TIME_STATS
+#include "../Util/MemoryPool.hpp"
 
 void NOMAD::Algorithm::init()
 {
@@ -98,7 +95,7 @@ void NOMAD::Algorithm::init()
 
     // Update SubproblemManager
     // When the flag use only local variables is true, only the fixed variables given in _pbParams are considered. Otherwise, we use the subproblem manager to fetch the fixed variables from the parent pb.
-    NOMAD::Point fullFixedVariable = (isRootAlgo()||_useOnlyLocalFixedVariables) ? _pbParams->getAttributeValue<NOMAD::Point>("FIXED_VARIABLE")
+    NOMAD::Point fullFixedVariable = (isRootAlgo()||_useOnlyLocalFixedVariables) ? _pbParams->getAttributeValue(NOMAD::Attr::FIXED_VARIABLE)
                                    : NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(_parentStep);
 
     NOMAD::Subproblem subproblem(_pbParams, fullFixedVariable);
@@ -112,7 +109,7 @@ void NOMAD::Algorithm::init()
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     if (! _isSubAlgo && nullptr != evc)
     {
-        auto hNormType = _runParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+        auto hNormType = _runParams->getAttributeValue(NOMAD::Attr::H_NORM);
         auto computeType = NOMAD::ComputeType::STANDARD; // Default compute type is set here. Override only by PhaseOne algo.
         evc->setHNormType(hNormType);
         evc->setComputeType(computeType);
@@ -135,13 +132,6 @@ NOMAD::Algorithm::~Algorithm()
 void NOMAD::Algorithm::startImp()
 {
 
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _startTime = NOMAD::Clock::getCPUTime();
-    }
-#endif // TIME_STATS
-    
     // Reset the current counters. The total counters are not reset (done only once when algo constructor is called).
     _trialPointStats.resetCurrentStats();
     
@@ -216,13 +206,6 @@ void NOMAD::Algorithm::endImp()
     if ( _endDisplay )
     {
         displayBestSolutions();
-#ifdef TIME_STATS
-        if (isRootAlgo())
-        {
-            _totalRealAlgoTime = NOMAD::Clock::getTimeSinceStart();
-            _totalCPUAlgoTime += NOMAD::Clock::getCPUTime() - _startTime;
-        }
-#endif // TIME_STATS
 
         displayEvalCounts();
     }
@@ -261,21 +244,9 @@ void NOMAD::Algorithm::updateStats(TrialPointStats &trialPointStats)
 
 void NOMAD::Algorithm::hotRestartOnUserInterrupt()
 {
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _totalCPUAlgoTime += NOMAD::Clock::getCPUTime() - _startTime;
-    }
-#endif // TIME_STATS
     hotRestartBeginHelper();
 
     hotRestartEndHelper();
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _startTime = NOMAD::Clock::getCPUTime();
-    }
-#endif // TIME_STATS
 }
 
 
@@ -296,11 +267,11 @@ void NOMAD::Algorithm::saveInformationForHotRestart() const
     {
         NOMAD::CacheBase::getInstance()->write();
     }
-    if ( _runParams->getAttributeValue<bool>("HOT_RESTART_WRITE_FILES"))
+    if ( _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_WRITE_FILES))
     {
         std::cout << "Save information for hot restart." << std::endl;
         std::cout << "Write hot restart file." << std::endl;
-        NOMAD::write(*this, _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE"));
+        NOMAD::write(*this, _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE));
     }
 }
 
@@ -601,7 +572,7 @@ void NOMAD::Algorithm::displayEvalCounts() const
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     if (nullptr != evc)
     {
-        surrogateCost = evc->getEvaluatorControlGlobalParams()->getAttributeValue<size_t>("EVAL_SURROGATE_COST");
+        surrogateCost = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::EVAL_SURROGATE_COST);
     }
     
     std::string sBbEval           = "Blackbox evaluations: " + sFeedBbEval + NOMAD::itos(bbEval);
@@ -621,11 +592,6 @@ void NOMAD::Algorithm::displayEvalCounts() const
     std::string sSurrogateEvalFromCacheForRerun    = "Static surrogate evaluations (cache rerun): " + sFeedSurrogateEvalFromCacheForRerun + NOMAD::itos(surrogateEvalFromCacheForRerun);
     std::string sLapSurrogateEval = "Sub-optimization static surrogate evaluations: " + sFeedLapSurrogateEval + NOMAD::itos(lapSurrogateEval);
 
-#ifdef TIME_STATS
-    std::string sTotalRealTime  = "Total real time (round s):    " + std::to_string(_totalRealAlgoTime);
-    std::string sTotalCPUTime   = "Total CPU time (s):           " + std::to_string(_totalCPUAlgoTime);
-#endif // TIME_STATS
-
     AddOutputInfo("", outputLevelHigh); // skip line
     // Always show number of blackbox evaluations
     AddOutputInfo(sBbEval, outputLevelHigh);
@@ -670,13 +636,14 @@ void NOMAD::Algorithm::displayEvalCounts() const
     {
         AddOutputInfo(sNbRevealingIter, outputLevelNormal);
     }
-
-#ifdef TIME_STATS
+    if (!_isSubAlgo)
     {
-        AddOutputInfo(sTotalRealTime, outputLevelNormal);
-        AddOutputInfo(sTotalCPUTime, outputLevelNormal);
+        // Verify that the memory of the trial points is reused
+        std::string sPoolAllocations = "Memory pool allocations: " + NOMAD::itos(NOMAD::MemoryPool::getNbAllocations());
+        sPoolAllocations += " (" + NOMAD::itos(NOMAD::MemoryPool::getNbSystemAllocations()) + " from system)";
+        AddOutputInfo(sPoolAllocations, NOMAD::OutputLevel::LEVEL_INFO);
     }
-#endif // TIME_STATS
+
 }
 
 NOMAD::EvalPoint NOMAD::Algorithm::getBestSolution(bool bestFeas) const
@@ -83,12 +83,6 @@ protected:
 
     bool                             _algoSuccessful;
 
-#ifdef TIME_STATS
-    size_t _totalRealAlgoTime;
-    double _startTime;
-    double _totalCPUAlgoTime;
-#endif // TIME_STATS
-
     TrialPointStats                        _trialPointStats;   ///< The trial point counters stats for algo execution
     
     bool _useOnlyLocalFixedVariables ; ///< When this flag is true, we force an algo to use only local fixed variable. The original problem fixed variables are not considered. This is useful when we change the design space like when doing quad model search. The evaluation of the quad model are only in the sub space and maybe there are some local fixed variables.
@@ -116,11 +110,6 @@ public:
         _termination(nullptr),
         _refMegaIteration(nullptr),
         _endDisplay(true),
-#ifdef TIME_STATS
-        _totalRealAlgoTime(0),
-        _startTime(0.0),
-        _totalCPUAlgoTime(0.0),
-#endif // TIME_STATS
         _trialPointStats(parentStep),
         _useOnlyLocalFixedVariables(useOnlyLocalFixedVariables),
         _evalOpportunistic(true)
@@ -69,7 +69,7 @@ void NOMAD::COOPMads::init(const std::vector<NOMAD::EvaluatorPtr> & evaluators,
     setStepType(NOMAD::StepType::ALGORITHM_COOP_MADS);
     verifyParentNotNull();
 
-    auto blockSize = NOMAD::EvcInterface::getEvaluatorControl()->getEvaluatorControlGlobalParams()->getAttributeValue<size_t>("BB_MAX_BLOCK_SIZE");
+    auto blockSize = NOMAD::EvcInterface::getEvaluatorControl()->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::BB_MAX_BLOCK_SIZE);
     if (blockSize > 1)
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "COOP-Mads: eval points blocks are not supported.");
@@ -94,7 +94,7 @@ void NOMAD::COOPMads::init(const std::vector<NOMAD::EvaluatorPtr> & evaluators,
     // Add an evaluator for each thread and a default evaluator type.
     // The main threads will be the ones with thread numbers 0-(nbMainThreads-1).
     // Main thread 0 is already added to EvaluatorControl at its creation.
-    size_t nbMainThreads = _runParams->getAttributeValue<size_t>("COOP_MADS_NB_PROBLEM");
+    size_t nbMainThreads = _runParams->getAttributeValue(NOMAD::Attr::COOP_MADS_NB_PROBLEM);
     for (int mainThreadNum = 1; mainThreadNum < (int)nbMainThreads; mainThreadNum++)
     {
         auto problemEvalContParams = std::make_unique<NOMAD::EvaluatorControlParameters>(*evalContParams);
@@ -117,15 +117,15 @@ bool NOMAD::COOPMads::runImp()
 {
 
     // Set parameters for problems
-    auto problemPbParams = std::make_shared<NOMAD::PbParameters>(*_pbParams);
-    auto problemRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams);
+    auto problemPbParams = std::make_shared<NOMAD::PbParameters>(*_pbParams, NOMAD::ParametersOverlay());
+    auto problemRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams, NOMAD::ParametersOverlay());
     problemPbParams->checkAndComply();
 
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     auto evcParams = evc->getEvaluatorControlGlobalParams();
     problemRunParams->checkAndComply(evcParams, problemPbParams);
 
-    size_t t = _runParams->getAttributeValue<size_t>("COOP_MADS_NB_PROBLEM");
+    size_t t = _runParams->getAttributeValue(NOMAD::Attr::COOP_MADS_NB_PROBLEM);
 #pragma omp parallel num_threads(t) default(none) shared(problemRunParams,problemPbParams,evc)
     {
         auto madsStopReasons = std::make_shared<NOMAD::AlgoStopReasons<NOMAD::MadsStopType>>();
@@ -70,7 +70,7 @@ void NOMAD::CacheSearchMethod::init()
         throw NOMAD::Exception(__FILE__,__LINE__,"For COOP-Mads cache search, we need a cache.");
     }
     
-    const bool isEnabled = getRunParams()->getAttributeValue<bool>("COOP_MADS_OPTIMIZATION_CACHE_SEARCH");
+    const bool isEnabled = getRunParams()->getAttributeValue(NOMAD::Attr::COOP_MADS_OPTIMIZATION_CACHE_SEARCH);
     setEnabled(isEnabled);
     
 }
@@ -98,7 +98,7 @@ void NOMAD::CacheSearchMethod::generateTrialPointsFinal()
     for (auto & ep: evalPointList)
     {
         // Test best points on barrier
-        if ( NOMAD::SuccessType::FULL_SUCCESS == barrier->getSuccessTypeOfPoints(std::make_shared<EvalPoint>(ep), nullptr))
+        if ( NOMAD::SuccessType::FULL_SUCCESS == barrier->getSuccessTypeOfPoints(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(ep), nullptr))
         {
             OUTPUT_INFO_START
             std::string s = "Cache search found a point in cache that dominates the best feasible point in barrier: ";
@@ -118,7 +118,7 @@ void NOMAD::CacheSearchMethod::generateTrialPointsFinal()
     cacheInterface.findBestInf(evalPointList, barrier->getHMax(), computeType);
     for (auto & ep: evalPointList)
     {
-        if ( NOMAD::SuccessType::FULL_SUCCESS == barrier->getSuccessTypeOfPoints(std::make_shared<EvalPoint>(ep), nullptr))
+        if ( NOMAD::SuccessType::FULL_SUCCESS == barrier->getSuccessTypeOfPoints(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(ep), nullptr))
         {
             OUTPUT_INFO_START
             std::string s = "Cache search found a point in cache that dominates one of the best infeasible point in barrier: ";
@@ -135,6 +135,47 @@ size_t NOMAD::CacheInterface::find(std::function<bool(const NOMAD::EvalPoint&)>
     return evalPointList.size();
 }
 
+
+// Points in the subspace share the fixed variable values: the distance in full
+// space is the same as the distance in subspace.
+size_t NOMAD::CacheInterface::findWithinRadius(const NOMAD::Point& X,
+                                               const NOMAD::Double& radius,
+                                               std::function<bool(const NOMAD::EvalPoint&)> crit,
+                                               std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    NOMAD::Point xFull = X.makeFullSpacePointFromFixed(_fixedVariable);
+    auto critSubSpace = [&](const NOMAD::EvalPoint& evalPoint)
+    {
+        return evalPoint.hasFixed(_fixedVariable)
+            && crit(evalPoint.makeSubSpacePointFromFixed(_fixedVariable));
+    };
+    NOMAD::CacheBase::getInstance()->findWithinRadius(xFull, radius, critSubSpace, evalPointList);
+
+    NOMAD::convertPointListToSub(evalPointList, _fixedVariable);
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheInterface::findKNearest(const NOMAD::Point& X,
+                                           const size_t k,
+                                           std::function<bool(const NOMAD::EvalPoint&)> crit,
+                                           std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    NOMAD::Point xFull = X.makeFullSpacePointFromFixed(_fixedVariable);
+    auto critSubSpace = [&](const NOMAD::EvalPoint& evalPoint)
+    {
+        return evalPoint.hasFixed(_fixedVariable)
+            && crit(evalPoint.makeSubSpacePointFromFixed(_fixedVariable));
+    };
+    NOMAD::CacheBase::getInstance()->findKNearest(xFull, k, critSubSpace, evalPointList);
+
+    NOMAD::convertPointListToSub(evalPointList, _fixedVariable);
+
+    return evalPointList.size();
+}
+
+
 size_t NOMAD::CacheInterface::getAllPoints(std::vector<NOMAD::EvalPoint> &evalPointList) const
 {
     NOMAD::CacheBase::getInstance()->find(
@@ -136,6 +136,32 @@ public:
                 bool findInSubspace = false ) const;
 
 
+    /// Find points of the current subspace within a Euclidean distance of X and fulfilling a criteria
+    /**
+     \param X                The point of reference, in subspace -- \b IN.
+     \param radius           Select the points at distance lower than or equal to radius -- \b IN.
+     \param crit             The criteria function (function of EvalPoint in subspace) -- \b IN.
+     \param evalPointList    The vector of EvalPoints found, in subspace -- \b OUT.
+     \return                 The number of points found
+    */
+    size_t findWithinRadius(const Point& X,
+                            const Double& radius,
+                            std::function<bool(const EvalPoint&)> crit,
+                            std::vector<EvalPoint> &evalPointList) const;
+
+    /// Find the k points of the current subspace closest to X and fulfilling a criteria
+    /**
+     \param X                The point of reference, in subspace -- \b IN.
+     \param k                The maximum number of points to find -- \b IN.
+     \param crit             The criteria function (function of EvalPoint in subspace) -- \b IN.
+     \param evalPointList    The vector of EvalPoints found, in subspace, by increasing distance to X -- \b OUT.
+     \return                 The number of points found
+    */
+    size_t findKNearest(const Point& X,
+                        const size_t k,
+                        std::function<bool(const EvalPoint&)> crit,
+                        std::vector<EvalPoint> &evalPointList) const;
+
     /// Get all points from the cache
     /**
      \param evalPointList The vector of EvalPoints -- \b OUT
@@ -57,9 +57,6 @@
 #include "../../Output/OutputQueue.hpp"
 #include "../../Cache/CacheBase.hpp"
 #include "../../Util/fileutils.hpp"
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-#endif
 
 void NOMAD::CS::init(bool barrierInitializedFromCache)
 {
@@ -141,12 +138,6 @@ void NOMAD::CS::hotRestartOnUserInterrupt()
     {
         return;
     }
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _totalCPUAlgoTime += NOMAD::Clock::getCPUTime() - _startTime;
-    }
-#endif // TIME_STATS
     hotRestartBeginHelper();
 
     // Reset mesh because parameters have changed.
@@ -164,12 +155,6 @@ void NOMAD::CS::hotRestartOnUserInterrupt()
     }
 
     hotRestartEndHelper();
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _startTime = NOMAD::Clock::getCPUTime();
-    }
-#endif // TIME_STATS
 }
 
 
@@ -180,10 +165,10 @@ void NOMAD::CS::readInformationForHotRestart()
     // For this, we need to read some files.
     // Note: Cache file is treated independently of hot restart file.
 
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         // Verify the files exist and are readable.
-        std::string hotRestartFile = _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE");
+        std::string hotRestartFile = _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE);
         if (NOMAD::checkReadFile(hotRestartFile))
         {
             std::string s = "Read hot restart file " + hotRestartFile;
@@ -192,7 +177,7 @@ void NOMAD::CS::readInformationForHotRestart()
             // Create a CSMesh and an MadsMegaIteration with default values, to be filled
             // by istream is.
             // NOTE: Working in full dimension
-            auto barrier = std::make_shared<NOMAD::ProgressiveBarrier>(NOMAD::INF, NOMAD::Point(_pbParams->getAttributeValue<size_t>("DIMENSION")), NOMAD::EvalType::BB);
+            auto barrier = std::make_shared<NOMAD::ProgressiveBarrier>(NOMAD::INF, NOMAD::Point(_pbParams->getAttributeValue(NOMAD::Attr::DIMENSION)), NOMAD::EvalType::BB);
             std::shared_ptr<NOMAD::MeshBase> mesh = std::make_shared<NOMAD::CSMesh>(_pbParams);
 
             _refMegaIteration = std::make_shared<NOMAD::CSMegaIteration>(this, 0, barrier, mesh, NOMAD::SuccessType::UNDEFINED);
@@ -50,22 +50,12 @@
 #include "../../Algos/CoordinateSearch/CSIteration.hpp"
 #include "../../Output/OutputQueue.hpp"
 
-//#ifdef TIME_STATS
-//#include "../../Algos/EvcInterface.hpp"
-//#include "../../Util/Clock.hpp"
-//
-//// Initialize static variables
-//double NOMAD::CSIteration::_iterTime = 0.0;
-//double NOMAD::CSIteration::_pollTime = 0.0;
-//double NOMAD::CSIteration::_pollEvalTime = 0.0;
-//#endif // TIME_STATS
-
 
 void NOMAD::CSIteration::init()
 {
     setStepType(NOMAD::StepType::ITERATION);
     
-    if (nullptr != _runParams && _runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL"))
+    if (nullptr != _runParams && _runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL))
     {
         throw NOMAD::Exception(__FILE__, __LINE__,"CS does not support Mega Search Poll. ");
     }
@@ -79,9 +69,6 @@ void NOMAD::CSIteration::init()
 
 void NOMAD::CSIteration::startImp()
 {
-//#ifdef TIME_STATS
-//    _iterStartTime = NOMAD::Clock::getCPUTime();
-//#endif // TIME_STATS
 }
 
 
@@ -96,10 +83,6 @@ bool NOMAD::CSIteration::runImp()
     
     if ( ! _stopReasons->checkTerminate() )
     {
-//#ifdef TIME_STATS
-//        double pollStartTime = NOMAD::Clock::getCPUTime();
-//        double pollEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-//#endif // TIME_STATS
         // 2. CS Poll
         _csPoll->start();
         // Iteration is a success if either a better xFeas or
@@ -108,10 +91,6 @@ bool NOMAD::CSIteration::runImp()
         iterationSuccess = _csPoll->run();
         _csPoll->end();
         
-//#ifdef TIME_STATS
-//        _pollTime += NOMAD::Clock::getCPUTime() - pollStartTime;
-//        _pollEvalTime += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - pollEvalStartTime;
-//#endif // TIME_STATS
     }
     
     // End of the iteration: iterationSuccess is true iff we have a full success.
@@ -119,12 +98,5 @@ bool NOMAD::CSIteration::runImp()
 }
 
 
-//#ifdef TIME_STATS
-//void NOMAD::CSIteration::endImp()
-//{
-//    _iterTime += NOMAD::Clock::getCPUTime() - _iterStartTime;
-//}
-//#endif // TIME_STATS
-
 
 
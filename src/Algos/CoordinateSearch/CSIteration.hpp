@@ -93,13 +93,6 @@ public:
      */
     const MeshBasePtr getMesh() const override { return _mesh; }
 
-//#ifdef TIME_STATS
-//    /// Time stats
-//    static double getIterTime()         { return _iterTime; }
-//    static double getPollTime()         { return _pollTime; }
-//    static double getPollEvalTime()     { return _pollEvalTime; }
-//#endif // TIME_STATS
-
     /*---------------------*/
     /* Other class methods */
     /*---------------------*/
@@ -117,9 +110,6 @@ private:
      */
     virtual bool runImp() override;
 
-//#ifdef TIME_STATS
-//    virtual void endImp() override;
-//#endif // TIME_STATS
 };
 
 #include "../../nomad_nsend.hpp"
@@ -374,7 +374,7 @@ NOMAD::Double NOMAD::CSMesh::scaleAndProjectOnMesh(size_t i, const NOMAD::Double
 NOMAD::ArrayOfDouble NOMAD::CSMesh::scaleAndProjectOnMesh(
     const NOMAD::Direction &dir) const
 {
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     NOMAD::ArrayOfDouble proj(n);
 
     NOMAD::Double infiniteNorm = dir.infiniteNorm();
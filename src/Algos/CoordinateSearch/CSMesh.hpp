@@ -80,7 +80,7 @@ public:
       : MeshBase(parameters),
         _initFrameSize(ArrayOfDouble()),
         _frameSize(ArrayOfDouble()),
-        _granularity(parameters->getAttributeValue<ArrayOfDouble>("GRANULARITY"))
+        _granularity(parameters->getAttributeValue(Attr::GRANULARITY))
     {
         init();
     }
@@ -65,7 +65,7 @@ void NOMAD::CSPoll::startImp()
     
     
     // Generate CS poll methods
-    NOMAD::DirectionTypeList dirTypes = _runParams->getAttributeValue<DirectionTypeList>("DIRECTION_TYPE");
+    NOMAD::DirectionTypeList dirTypes = _runParams->getAttributeValue(NOMAD::Attr::DIRECTION_TYPE);
     
     if (dirTypes.size() != 1 || dirTypes[0] != DirectionType::CS)
     {
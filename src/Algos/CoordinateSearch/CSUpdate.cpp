@@ -190,7 +190,7 @@ bool NOMAD::CSUpdate::runImp()
         bool clearEvalQueue = true;
         if (nullptr != evc)
         {
-            clearEvalQueue = evc->getEvaluatorControlGlobalParams()->getAttributeValue<bool>("EVAL_QUEUE_CLEAR");
+            clearEvalQueue = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::EVAL_QUEUE_CLEAR);
         }
         const bool megaIterEvaluated = (NOMAD::SuccessType::UNDEFINED != megaIter->getSuccessType());
         if (!clearEvalQueue && megaIterEvaluated && (success != megaIter->getSuccessType()))
@@ -74,7 +74,7 @@ bool NOMAD::DMultiMads::runImp()
 {
     _algoSuccessful = false;
     
-    if ( !_runParams->getAttributeValue<bool>("DMULTIMADS_OPTIMIZATION") )
+    if ( !_runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_OPTIMIZATION) )
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"DMultiMads is a standalone optimization algo. Cannot be used as a Mads search method.");
     }
@@ -125,7 +125,7 @@ bool NOMAD::DMultiMads::runImp()
 
 void NOMAD::DMultiMads::readInformationForHotRestart()
 {
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"DMultiMads does not currently support hot restart.");
     }
@@ -56,6 +56,7 @@
 #include "../../Cache/CacheSet.hpp"
 #include "../../Eval/ComputeSuccessType.hpp"
 #include "../../Eval/MeshBase.hpp"
+#include "../../Eval/ParetoFront.hpp"
 #include "../../Output/OutputQueue.hpp"
 
 // Initialization from cache
@@ -98,13 +99,14 @@ void NOMAD::DMultiMadsBarrier::init(const NOMAD::Point& fixedVariables,
         auto cache = CacheBase::getInstance().get();
         if (cache->findBestFeas(cachePoints, fixedVariables, _computeType) > 0)
         {
+            // The feasible points are kept non dominated, in lexicographic order.
+            const NOMAD::ParetoFront paretoFront(_computeType);
             for (const auto & evalPoint : cachePoints)
             {
-                NOMAD::EvalPointPtr evalPointSub = std::make_shared<EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariables));
-                _xFeas.push_back(evalPointSub);
+                NOMAD::EvalPointPtr evalPointSub = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariables));
+                paretoFront.compareAndInsert(_xFeas, evalPointSub);
             }
             cachePoints.clear();
-            lexicographicallyObjOrder(_computeType, _xFeas);
         }
         if (cache->findFilterInf(cachePoints, _hMax, fixedVariables, _computeType) > 0)
         {
@@ -113,7 +115,7 @@ void NOMAD::DMultiMadsBarrier::init(const NOMAD::Point& fixedVariables,
                 // Consider points with h < INF. That is, points that are not excluded by extreme barrier constraints.
                 if (evalPoint.getH(_computeType) < NOMAD::INF)
                 {
-                    NOMAD::EvalPointPtr evalPointSub = std::make_shared<EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariables));
+                    NOMAD::EvalPointPtr evalPointSub = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariables));
                     _xInf.push_back(evalPointSub);
                 }
             }
@@ -128,7 +130,7 @@ void NOMAD::DMultiMadsBarrier::init(const NOMAD::Point& fixedVariables,
         {
             for (const auto & evalPoint : cachePoints)
             {
-                NOMAD::EvalPointPtr evalPointSub = std::make_shared<EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariables));
+                NOMAD::EvalPointPtr evalPointSub = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariables));
                 _xFilterInf.push_back(evalPointSub);
             }
             cachePoints.clear();
@@ -151,6 +153,8 @@ void NOMAD::DMultiMadsBarrier::init(const NOMAD::Point& fixedVariables,
         
         // Update the incumbents used by DMultiMads algo as frameCenter
         updateCurrentIncumbents();
+
+        updateIndicators();
     }
 }
 
@@ -283,6 +287,7 @@ void NOMAD::DMultiMadsBarrier::clearXFeas()
     // Update the current incumbents. Both the feasible and infeasible ones.
     updateCurrentIncumbents();
     updateCurrentIdealFeas();
+    updateIndicators();
 }
 
 
@@ -600,7 +605,7 @@ NOMAD::CompareType NOMAD::DMultiMadsBarrier::updateFeasWithPoint(const EvalPoint
 
     if (_xFeas.empty())
     {
-        _xFeas.push_back(std::make_shared<NOMAD::EvalPoint>(evalPoint));
+        _xFeas.push_back(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint));
         OUTPUT_DEBUG_START
         s = "New dominating xFeas: " + evalPoint.display();
         NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
@@ -608,64 +613,47 @@ NOMAD::CompareType NOMAD::DMultiMadsBarrier::updateFeasWithPoint(const EvalPoint
         return NOMAD::CompareType::DOMINATING;
     }
 
-    // Ensure evalPoint is as good as previous points in xFeas
-    std::vector<bool> keepInXFeas(_xFeas.size(), true);
-    int currentInd = 0;
-    auto compFlag = NOMAD::CompareType::INDIFFERENT;
-    for (const auto& xFeas: _xFeas)
+    // Ensure evalPoint is as good as previous points in xFeas.
+    // The points of xFeas are in lexicographic order: the points that dominate
+    // evalPoint are before it and the points it dominates are after it.
+    const NOMAD::ParetoFront paretoFront(_computeType);
+    const auto comparison = paretoFront.compare(_xFeas, evalPoint.getFs(_computeType));
+    const auto compFlag = comparison.compFlag;
+    if (compFlag == CompareType::DOMINATED)
     {
-        const auto currentCompFlag = evalPoint.compMO(*xFeas, _computeType);
-        if (currentCompFlag == CompareType::DOMINATED)
-        {
-            OUTPUT_DEBUG_START
-            s = "evalPoint is dominated by " + xFeas->display();
-            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-            s = "evalPoint is rejected";
-            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-            OUTPUT_DEBUG_END
-            return currentCompFlag;
-        }
-        if (currentCompFlag == CompareType::EQUAL)
-        {
-            if (!keepAllPoints)
-                return currentCompFlag;
+        OUTPUT_DEBUG_START
+        s = "evalPoint is dominated by " + _xFeas[comparison.dominatingInd]->display();
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+        s = "evalPoint is rejected";
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+        OUTPUT_DEBUG_END
+        return compFlag;
+    }
+    if (compFlag == CompareType::EQUAL)
+    {
+        if (!keepAllPoints)
+            return compFlag;
 
-            // If new point is not already there, add it
-            // One should never add two times the same point into the barrier.
-            if (findEvalPoint(_xFeas.begin(), _xFeas.end(), evalPoint) != _xFeas.end())
-            {
-                OUTPUT_DEBUG_START
-                s = "EvalPoint " + evalPoint.display() + "is already in xFeas";
-                NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-                OUTPUT_DEBUG_END
-                return NOMAD::CompareType::UNDEFINED;
-            }
-            compFlag = NOMAD::CompareType::EQUAL;
-        }
-        if (currentCompFlag == CompareType::DOMINATING)
+        // If new point is not already there, add it
+        // One should never add two times the same point into the barrier.
+        if (findEvalPoint(_xFeas.begin(), _xFeas.end(), evalPoint) != _xFeas.end())
         {
             OUTPUT_DEBUG_START
-            s = "EvalPoint " + xFeas->display() + "in xFeas is dominated by " + evalPoint.display();
+            s = "EvalPoint " + evalPoint.display() + "is already in xFeas";
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
             OUTPUT_DEBUG_END
-            keepInXFeas[currentInd] = false;
-            compFlag = NOMAD::CompareType::DOMINATING;
+            return NOMAD::CompareType::UNDEFINED;
         }
-        currentInd++;
     }
 
-    // Remove all dominated elements.
-    currentInd = 0;
-    const size_t prevNbFeasElements = _xFeas.size();
-    _xFeas.erase(std::remove_if(_xFeas.begin(), _xFeas.end(),
-                                [&currentInd, &keepInXFeas](const EvalPointPtr& evalPoint)
-                                {
-                                const bool isRemoved = !keepInXFeas[currentInd];
-                                ++currentInd;
-                                return isRemoved;
-                                }), _xFeas.end());
+    // The dominated elements are removed when the new element is inserted.
     OUTPUT_DEBUG_START
-    s = "Removing " + std::to_string(std::max((int) prevNbFeasElements - (int)_xFeas.size(), 0));
+    for (const auto ind : comparison.dominatedInd)
+    {
+        s = "EvalPoint " + _xFeas[ind]->display() + "in xFeas is dominated by " + evalPoint.display();
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+    }
+    s = "Removing " + std::to_string(comparison.dominatedInd.size());
     s += " dominating feasible eval points";
     NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
     OUTPUT_DEBUG_END
@@ -709,8 +697,14 @@ NOMAD::CompareType NOMAD::DMultiMadsBarrier::updateFeasWithPoint(const EvalPoint
         }
     }
                     
-    // Insert new element
-    _xFeas.push_back(std::make_shared<NOMAD::EvalPoint>(evalPoint));
+    // The hypervolume improvement is computed before the front is modified.
+    if (2 == _nobj && _hypervolume.isDefined())
+    {
+        _hypervolume += paretoFront.hypervolumeImprovement(_xFeas, evalPoint.getFs(_computeType), comparison, _hvReferencePoint);
+    }
+
+    // Insert new element, in lexicographic order
+    paretoFront.insert(_xFeas, NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint), comparison);
                     
     return compFlag;
 }
@@ -747,8 +741,8 @@ NOMAD::CompareType NOMAD::DMultiMadsBarrier::updateInfWithPoint(const EvalPoint
     if (_xInf.empty())
     {
         // New point is first point
-        _xInf.push_back(std::make_shared<NOMAD::EvalPoint>(evalPoint));
-        _xFilterInf.push_back(std::make_shared<NOMAD::EvalPoint>(evalPoint));
+        _xInf.push_back(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint));
+        _xFilterInf.push_back(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint));
         OUTPUT_DEBUG_START
         s = "New current incumbent infeasible: " + evalPoint.display();
         NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
@@ -820,7 +814,7 @@ NOMAD::CompareType NOMAD::DMultiMadsBarrier::updateInfWithPoint(const EvalPoint
     s = "Adding new non dominated eval point in xFilterInf: " + evalPoint.display();
     NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
     OUTPUT_DEBUG_END
-    auto evalPointPtr = std::make_shared<NOMAD::EvalPoint>(evalPoint);
+    auto evalPointPtr = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint);
     _xFilterInf.push_back(evalPointPtr);
 
     // 2- Try to insert the point into _xInf.
@@ -1031,9 +1025,8 @@ bool NOMAD::DMultiMadsBarrier::updateWithPoints(
             feasSuccessType = NOMAD::SuccessType::FULL_SUCCESS;
     }
 
-    // Lexicographically order the set of feasible non-dominated solutions.
-    if (updatedIncFeas)
-        lexicographicallyObjOrder(_computeType, _xFeas);
+    // NB: The set of feasible non-dominated solutions is kept in lexicographic
+    // order by updateFeasWithPoint.
 
     // Do separate loop on evalPointList
     // Second loop update the bestInfeasible.
@@ -1187,6 +1180,12 @@ bool NOMAD::DMultiMadsBarrier::updateWithPoints(
         setN();
     }
 
+    // Points were inserted in xFeas.
+    if (updatedIncFeas)
+    {
+        updateIndicators();
+    }
+
     const bool updated = updatedFeas || updatedInf;
     OUTPUT_DEBUG_START
     if (updated)
@@ -1574,25 +1573,27 @@ void NOMAD::DMultiMadsBarrier::updateCurrentIncumbentFeas()
         return;
     }
     
-    // Set max frame size of all elements
+    // Set max frame size of each element and of all elements.
+    // The frame sizes are computed once: the meshes do not change during the selection.
+    std::vector<NOMAD::Double> maxFrameSizeElts(_xFeas.size());
     NOMAD::Double maxFrameSizeFeasElts = -1.0;
-    for (const auto& xFeas: _xFeas)
+    for (size_t i = 0; i < _xFeas.size(); ++i)
     {
-        maxFrameSizeFeasElts = std::max(getMeshMaxFrameSize(xFeas), maxFrameSizeFeasElts);
+        maxFrameSizeElts[i] = getMeshMaxFrameSize(_xFeas[i]);
+        maxFrameSizeFeasElts = std::max(maxFrameSizeElts[i], maxFrameSizeFeasElts);
     }
     
     // Select candidates
     std::vector<bool> canBeFrameCenter(_xFeas.size(), false);
     size_t nbSelectedCandidates = 0;
     
+    // Casting is required to avoid an integer overflow.
+    const NOMAD::Double minFrameSizeCandidate = std::pow(10.0, -(double)_incumbentSelectionParam) * maxFrameSizeFeasElts;
+
     // See article DMultiMads Algorithm 4.
     for (size_t i = 0; i < _xFeas.size(); ++i)
     {
-        
-        const NOMAD::Double maxFrameSizeElt = getMeshMaxFrameSize(_xFeas[i]);
-        
-        // Casting is required to avoid an integer overflow.
-        if ((std::pow(10.0, -(double)_incumbentSelectionParam) * maxFrameSizeFeasElts <= maxFrameSizeElt) )
+        if (minFrameSizeCandidate <= maxFrameSizeElts[i])
         {
             canBeFrameCenter[i] = true;
             nbSelectedCandidates += 1;
@@ -1784,3 +1785,54 @@ void NOMAD::DMultiMadsBarrier::updateCurrentIdealInf()
         }
     }
 }
+
+
+void NOMAD::DMultiMadsBarrier::updateIndicators()
+{
+    if (_xFeas.empty())
+    {
+        _hypervolume = NOMAD::Double();
+        _spacing = NOMAD::Double();
+        return;
+    }
+
+    // The reference point is set once, from the first feasible points: their
+    // nadir point, shifted by 10% of the range of each objective (or of the
+    // objective value when the range is null).
+    if (!_hvReferencePoint.isComplete())
+    {
+        _hvReferencePoint = NOMAD::ArrayOfDouble(_nobj);
+        for (size_t obj = 0; obj < _nobj; ++obj)
+        {
+            NOMAD::Double ideal = NOMAD::INF;
+            NOMAD::Double nadir = NOMAD::M_INF;
+            for (const auto& xFeas: _xFeas)
+            {
+                const NOMAD::Double& fObj = xFeas->getFs(_computeType)[obj];
+                ideal = NOMAD::min(ideal, fObj);
+                nadir = NOMAD::max(nadir, fObj);
+            }
+            NOMAD::Double range = nadir - ideal;
+            if (0.0 == range)
+            {
+                range = NOMAD::max(nadir.abs(), 1.0);
+            }
+            _hvReferencePoint[obj] = nadir + 0.1 * range;
+        }
+        _hypervolume = NOMAD::Double();
+
+        OUTPUT_INFO_START
+        std::string s = "DMultiMadsBarrier: hypervolume reference point set to " + _hvReferencePoint.display();
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
+        OUTPUT_INFO_END
+    }
+
+    const NOMAD::ParetoFront paretoFront(_computeType);
+
+    // With 2 objectives, updateFeasWithPoint maintains the hypervolume once it is defined.
+    if (2 != _nobj || !_hypervolume.isDefined())
+    {
+        _hypervolume = paretoFront.hypervolume(_xFeas, _hvReferencePoint);
+    }
+    _spacing = paretoFront.spacing(_xFeas);
+}
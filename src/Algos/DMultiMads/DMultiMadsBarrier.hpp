@@ -95,6 +95,16 @@ private:
 
     size_t _incumbentSelectionParam;
 
+    /// Reference point for the hypervolume.
+    /**
+     If not provided, it is set from the first feasible points (see updateIndicators)
+     and kept for the rest of the optimization, so that the hypervolume values are comparable.
+     */
+    ArrayOfDouble _hvReferencePoint;
+
+    Double _hypervolume;  ///< Hypervolume of the feasible points. Updated incrementally for 2 objectives.
+    Double _spacing;      ///< Spacing of the feasible points.
+
 
 public:
     /// Constructor
@@ -107,6 +117,8 @@ public:
      \param computeType     Type of function computation (standard, phase-one or user) -- \b IN.
      \param evalPointList   Additional points to consider in building the barrier -- \b IN.
      \param barrierInitializedFromCache Flag to initialize the barrier from cache -- \b IN.
+     \param bbInputsType    The types of the variables -- \b IN.
+     \param hvReferencePoint Reference point for the hypervolume. Set from the first feasible points if undefined -- \b IN.
      */
     DMultiMadsBarrier(size_t nbObj,
                       const Double& hMax = INF,
@@ -116,7 +128,8 @@ public:
                       FHComputeTypeS computeType = defaultFHComputeTypeS,
                       const std::vector<EvalPoint>& evalPointList = std::vector<EvalPoint>(),
                       bool barrierInitializedFromCache= true,
-                      const BBInputTypeList bbInputsType= std::vector<BBInputType>())
+                      const BBInputTypeList bbInputsType= std::vector<BBInputType>(),
+                      const ArrayOfDouble& hvReferencePoint = ArrayOfDouble())
       : BarrierBase(evalType, computeType, hMax),
         _nobj(nbObj), 
         _currentIncumbentFeas(nullptr),
@@ -126,10 +139,20 @@ public:
         _currentIdealInf(nbObj, NOMAD::INF),
         _fixedVariables(fixedVariables),
         _bbInputsType(bbInputsType),
-        _incumbentSelectionParam(incumbentSelectionParam)
+        _incumbentSelectionParam(incumbentSelectionParam),
+        _hvReferencePoint(hvReferencePoint),
+        _hypervolume(),
+        _spacing()
     {
         checkHMax();
 
+        if (_hvReferencePoint.size() > 0 && _hvReferencePoint.size() != _nobj)
+        {
+            std::string s = "Error: Construction of a DMultiMadsBarrier with a hypervolume reference point of dimension ";
+            s += std::to_string(_hvReferencePoint.size()) + ". It must be the number of objectives (" + std::to_string(_nobj) + ").";
+            throw NOMAD::Exception(__FILE__,__LINE__,s);
+        }
+
         // The number of objectives is initialized via the call to the cache.
         init(fixedVariables, barrierInitializedFromCache); // Initialize with cache (if flag is true)
         init(fixedVariables, evalPointList); // Initialize with a list of points
@@ -149,6 +172,7 @@ public:
         _hMax = b._hMax;
         _bbInputsType = b._bbInputsType;
         _fixedVariables = b._fixedVariables;
+        _hvReferencePoint = b._hvReferencePoint;
     }
     
     std::shared_ptr<BarrierBase> clone() const override {
@@ -309,6 +333,18 @@ public:
      */
     std::vector<std::string> display(const size_t max = INF_SIZE_T, const bool displayMeshes = false) const;
 
+    /// Hypervolume of the feasible points, with respect to the reference point.
+    /**
+     Undefined when there are no feasible points or more than 3 objectives.
+     */
+    Double getHypervolume() const override { return _hypervolume; }
+
+    /// Spacing of the feasible points. Undefined with less than 2 feasible points.
+    Double getSpacing() const override { return _spacing; }
+
+    /// Reference point used for the hypervolume. Undefined until there are feasible points.
+    const ArrayOfDouble& getHypervolumeReferencePoint() const { return _hvReferencePoint; }
+
 private:
 
     /**
@@ -364,7 +400,7 @@ private:
     
     NOMAD::Double getMeshMaxFrameSize(const NOMAD::EvalPointPtr& pt) const;
     
-    /// Helper for updateWithPoints
+    /// Helper for updateWithPoints. Keeps _xFeas in lexicographic order (see ParetoFront).
     NOMAD::CompareType updateFeasWithPoint(const EvalPoint& evalPoint,
                                            const bool keepAllPoints);
     
@@ -390,6 +426,13 @@ private:
      * \brief Helper function to update the infeasible ideal objective vector.
      */
     void updateCurrentIdealInf();
+
+    /**
+     * \brief Update the hypervolume and spacing after the feasible points have changed.
+     *
+     * With 2 objectives, the hypervolume is maintained by updateFeasWithPoint and only computed here the first time.
+     */
+    void updateIndicators();
 };
 
 /// Display useful values so that a new Barrier could be constructed using these values.
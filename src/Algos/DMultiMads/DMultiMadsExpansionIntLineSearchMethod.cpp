@@ -64,20 +64,20 @@ void NOMAD::DMultiMadsExpansionIntLineSearchMethod::init()
 
     setStepType(NOMAD::StepType::SEARCH_METHOD_DMULTIMADS_EXPANSIONINT_LINESEARCH);
 
-    _bbInputTypes = _pbParams->getAttributeValue<NOMAD::BBInputTypeList>("BB_INPUT_TYPE");
+    _bbInputTypes = _pbParams->getAttributeValue(NOMAD::Attr::BB_INPUT_TYPE);
     const bool hasIntegerVariables = !_bbInputTypes.empty() && std::any_of(_bbInputTypes.cbegin(), _bbInputTypes.cend(),
                                                                            [](const NOMAD::BBInputType bbi)
                                                                            {
                                                                                return bbi == NOMAD::BBInputType::INTEGER;
                                                                            });
 
-    const bool runExpansionLinesearch = _runParams->getAttributeValue<bool>("DMULTIMADS_EXPANSIONINT_LINESEARCH");
+    const bool runExpansionLinesearch = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_EXPANSIONINT_LINESEARCH);
     const bool isEnabled = runExpansionLinesearch && hasIntegerVariables;
     setEnabled(isEnabled);
 
     // Save lower and upper bounds
-    _lb = getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-    _ub = getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+    _lb = getPbParams()->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+    _ub = getPbParams()->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
 
     // Deactivate the projection on the mesh for this search, as we only change integer variables.
     _projectOnMesh = false;
@@ -326,7 +326,7 @@ void NOMAD::DMultiMadsExpansionIntLineSearchMethod::generateTrialPointsFinal()
 
     // First candidate tentative
     auto ev1 = NOMAD::EvalPoint(*currentFrameCenter->getX() + scaledDir);
-    ev1.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*currentFrameCenter),
+    ev1.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*currentFrameCenter),
                            NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
     ev1.addGenStep(getStepType());
     snapPointToBoundsAndProjectOnMesh(ev1, _lb, _ub);
@@ -383,7 +383,7 @@ void NOMAD::DMultiMadsExpansionIntLineSearchMethod::generateTrialPointsFinal()
 
     auto ev2 = NOMAD::EvalPoint(*currentFrameCenter->getX() + scaledDir);
 
-    ev2.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*currentFrameCenter),
+    ev2.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*currentFrameCenter),
                            NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
     ev2.addGenStep(getStepType());
     snapPointToBoundsAndProjectOnMesh(ev2, _lb, _ub);
@@ -62,7 +62,7 @@ void NOMAD::DMultiMadsMiddlePointSearchMethod::init()
 
     setStepType(NOMAD::StepType::SEARCH_METHOD_DMULTIMADS_MIDDLEPOINT);
 
-    const bool isEnabled = _runParams->getAttributeValue<bool>("DMULTIMADS_MIDDLEPOINT_SEARCH");
+    const bool isEnabled = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_MIDDLEPOINT_SEARCH);
     setEnabled(isEnabled);
 }
 
@@ -144,7 +144,7 @@ void NOMAD::DMultiMadsMiddlePointSearchMethod::generateTrialPointsFinal()
         // Generate candidate: no need to check if it exists in cache. We are ready to pay
         // the potential cache hit.
         auto evalPoint = NOMAD::EvalPoint(xcandidate);
-        evalPoint.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*currentFrameCenter),
+        evalPoint.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*currentFrameCenter),
                                NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
         evalPoint.addGenStep(getStepType());
         insertTrialPoint(evalPoint);
@@ -155,10 +155,10 @@ void NOMAD::DMultiMadsMiddlePointSearchMethod::generateTrialPointsFinal()
     // Obtain cache.
     const auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     const bool useCache = evc->getUseCache();
-    const NOMAD::ArrayOfDouble lb = getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-    const NOMAD::ArrayOfDouble ub = getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+    const NOMAD::ArrayOfDouble lb = getPbParams()->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+    const NOMAD::ArrayOfDouble ub = getPbParams()->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
 
-    const size_t nbMaxCacheSearchPerObj = getRunParams()->getAttributeValue<size_t>("DMULTIMADS_MIDDLEPOINT_SEARCH_CACHE_MAX");
+    const size_t nbMaxCacheSearchPerObj = getRunParams()->getAttributeValue(NOMAD::Attr::DMULTIMADS_MIDDLEPOINT_SEARCH_CACHE_MAX);
 
     const size_t nbObj = dMadsBarrier->getNbObj();
     const NOMAD::FHComputeType initFHComputeType = dMadsBarrier->getFHComputeType();
@@ -229,7 +229,7 @@ void NOMAD::DMultiMadsMiddlePointSearchMethod::generateTrialPointsFinal()
 
             // Generate a middle point candidate
             auto evalPoint = NOMAD::EvalPoint(xcandidate);
-            evalPoint.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*currentFrameCenter),
+            evalPoint.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*currentFrameCenter),
                                    NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
             evalPoint.addGenStep(getStepType());
         
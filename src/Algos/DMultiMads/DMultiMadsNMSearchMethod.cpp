@@ -63,14 +63,14 @@ void NOMAD::DMultiMadsNMSearchMethod::init()
         throw NOMAD::Exception(__FILE__,__LINE__,"DMultiMadsNMSearch only works for DMultiMads");
     }
 
-    const bool isEnabled = getRunParams()->getAttributeValue<bool>("NM_SEARCH");
+    const bool isEnabled = getRunParams()->getAttributeValue(NOMAD::Attr::NM_SEARCH);
     setEnabled(isEnabled);
 
     if (isEnabled)
     {
         // Set the lap counter
-        const auto nmFactor = _runParams->getAttributeValue<size_t>("NM_SEARCH_MAX_TRIAL_PTS_NFACTOR");
-        const auto dim = _pbParams->getAttributeValue<size_t>("DIMENSION");
+        const auto nmFactor = _runParams->getAttributeValue(NOMAD::Attr::NM_SEARCH_MAX_TRIAL_PTS_NFACTOR);
+        const auto dim = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
         if (nmFactor < NOMAD::INF_SIZE_T)
         {
             NOMAD::EvcInterface::getEvaluatorControl()->setLapMaxBbEval( dim*nmFactor );
@@ -89,7 +89,7 @@ void NOMAD::DMultiMadsNMSearchMethod::init()
 
     setStepType(NOMAD::StepType::SEARCH_METHOD_NM);
 
-    const auto nmStrategy = getRunParams()->getAttributeValue<NOMAD::DMultiMadsNMSearchType>("DMULTIMADS_NM_STRATEGY");
+    const auto nmStrategy = getRunParams()->getAttributeValue(NOMAD::Attr::DMULTIMADS_NM_STRATEGY);
 
     _use_dom_strategy = nmStrategy == NOMAD::DMultiMadsNMSearchType::DOM;
 }
@@ -622,7 +622,7 @@ bool NOMAD::DMultiMadsNMSearchMethod::postRunUpdates()
     {
         ep.setMesh(megaIter->getMesh());
 
-        const auto epPtr = std::make_shared<EvalPoint>(ep);
+        const auto epPtr = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(ep);
         if (megaIterSuccess != NOMAD::SuccessType::FULL_SUCCESS)
         {
             _ref_dmads_barrier->checkForFHComputeType(completeComputeType);
@@ -103,8 +103,8 @@ void NOMAD::DMultiMadsQuadDMSSearchMethod::init()
     
     setStepType(NOMAD::StepType::SEARCH_METHOD_DMULTIMADS_QUAD_DMS);
 
-    const bool runQuadSearch = getRunParams()->getAttributeValue<bool>("QUAD_MODEL_SEARCH");
-    const auto quadStrategy = getRunParams()->getAttributeValue<NOMAD::DMultiMadsQuadSearchType>("DMULTIMADS_QUAD_MODEL_STRATEGY");
+    const bool runQuadSearch = getRunParams()->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH);
+    const auto quadStrategy = getRunParams()->getAttributeValue(NOMAD::Attr::DMULTIMADS_QUAD_MODEL_STRATEGY);
     const bool isEnabled = runQuadSearch && quadStrategy == NOMAD::DMultiMadsQuadSearchType::DMS;
     setEnabled(isEnabled);
     
@@ -363,7 +363,7 @@ bool NOMAD::DMultiMadsQuadDMSSearchMethod::postRunUpdates()
             continue;
         }
 
-        const auto epPtr = std::make_shared<EvalPoint>(ep);
+        const auto epPtr = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(ep);
         megaIterSuccess = ep.isFeasible(completeComputeType) ? _ref_dmads_barrier->getSuccessTypeOfPoints(epPtr, nullptr)
                                                              : _ref_dmads_barrier->getSuccessTypeOfPoints(nullptr, epPtr);
     }
@@ -95,14 +95,14 @@ void NOMAD::DMultiMadsQuadModSearchMethod::init()
     
     setStepType(NOMAD::StepType::SEARCH_METHOD_QUAD_MODEL);
 
-    const bool runQuadSearch = getRunParams()->getAttributeValue<bool>("QUAD_MODEL_SEARCH");
-    const auto quadStrategy = getRunParams()->getAttributeValue<NOMAD::DMultiMadsQuadSearchType>("DMULTIMADS_QUAD_MODEL_STRATEGY");
+    const bool runQuadSearch = getRunParams()->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH);
+    const auto quadStrategy = getRunParams()->getAttributeValue(NOMAD::Attr::DMULTIMADS_QUAD_MODEL_STRATEGY);
     const bool isEnabled = runQuadSearch &&
                            (quadStrategy == NOMAD::DMultiMadsQuadSearchType::DOM ||
                             quadStrategy == NOMAD::DMultiMadsQuadSearchType::MULTI);
     setEnabled(isEnabled);
 
-    _flagPriorCombineObjsForModel = _runParams->getAttributeValue<bool>("DMULTIMADS_QMS_PRIOR_COMBINE_OBJ");
+    _flagPriorCombineObjsForModel = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_QMS_PRIOR_COMBINE_OBJ);
     _use_dom_strategy = quadStrategy == NOMAD::DMultiMadsQuadSearchType::DOM;
 #ifndef USE_SGTELIB
     if (isEnabled())
@@ -44,6 +44,7 @@
 /*                                                                                 */
 /*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
 /*---------------------------------------------------------------------------------*/
+#include "../../Algos/AlgoStopReasons.hpp"
 #include "../../Algos/DMultiMads/DMultiMadsBarrier.hpp"
 #include "../../Algos/DMultiMads/DMultiMadsMegaIteration.hpp"
 #include "../../Algos/DMultiMads/DMultiMadsUpdate.hpp"
@@ -54,6 +55,12 @@ void NOMAD::DMultiMadsUpdate::init()
 {
     setStepType(NOMAD::StepType::UPDATE);
     verifyParentNotNull();
+
+    if (nullptr != _runParams)
+    {
+        _hvStallMaxIterations = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_HV_STALL_ITERATIONS);
+        _hvStallTolerance = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_HV_STALL_TOLERANCE);
+    }
 }
 
 
@@ -163,8 +170,47 @@ bool NOMAD::DMultiMadsUpdate::runImp()
     AddOutputInfo("Number of points in Lk (feas+inf): " + std::to_string(barrier->nbXFeas()+barrier->nbXInf()));
     AddOutputInfo("delta mesh size = " + iter->getFrameCenter()->getMesh()->getdeltaMeshSize().display());
     AddOutputInfo("Delta frame size = " + iter->getFrameCenter()->getMesh()->getDeltaFrameSize().display());
+    AddOutputInfo("Hypervolume = " + barrier->getHypervolume().display() + ", spacing = " + barrier->getSpacing().display());
     OUTPUT_INFO_END
-    
+
+    if (checkHypervolumeStall(barrier->getHypervolume()))
+    {
+        auto stopReason = NOMAD::AlgoStopReasons<NOMAD::MadsStopType>::get(getAllStopReasons());
+        stopReason->set(NOMAD::MadsStopType::HV_STALLED);
+
+        OUTPUT_INFO_START
+        s = "Hypervolume did not improve by more than " + _hvStallTolerance.display();
+        s += " (relative) during " + std::to_string(_hvStallIterations) + " iterations";
+        AddOutputInfo(s);
+        OUTPUT_INFO_END
+    }
     
     return true;
 }
+
+
+bool NOMAD::DMultiMadsUpdate::checkHypervolumeStall(const NOMAD::Double& hypervolume)
+{
+    if (NOMAD::INF_SIZE_T == _hvStallMaxIterations)
+    {
+        return false;
+    }
+
+    // No feasible point yet, or more than 3 objectives.
+    if (!hypervolume.isDefined())
+    {
+        _hvStallRef = NOMAD::Double();
+        _hvStallIterations = 0;
+        return false;
+    }
+
+    if (!_hvStallRef.isDefined() || hypervolume > _hvStallRef + _hvStallTolerance * _hvStallRef.abs())
+    {
+        _hvStallRef = hypervolume;
+        _hvStallIterations = 0;
+        return false;
+    }
+
+    _hvStallIterations++;
+    return (_hvStallIterations >= _hvStallMaxIterations);
+}
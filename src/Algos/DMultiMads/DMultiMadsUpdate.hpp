@@ -55,13 +55,24 @@
 /// The DMultiMads algorithm update step.
 /**
  The ref best feasible and ref best infeasible points are updated.
+ The hypervolume stall stopping criterion (DMULTIMADS_HV_STALL_ITERATIONS) is checked.
  */
 class DMultiMadsUpdate: public Step
 {
+private:
+    size_t  _hvStallMaxIterations;  ///< DMULTIMADS_HV_STALL_ITERATIONS
+    Double  _hvStallTolerance;      ///< DMULTIMADS_HV_STALL_TOLERANCE
+    Double  _hvStallRef;            ///< Hypervolume at the last significant improvement
+    size_t  _hvStallIterations;     ///< Number of iterations since the last significant improvement
+
 public:
     // Constructor
     explicit DMultiMadsUpdate(const Step* parentStep)
-      : Step(parentStep)
+      : Step(parentStep),
+        _hvStallMaxIterations(INF_SIZE_T),
+        _hvStallTolerance(0.0),
+        _hvStallRef(),
+        _hvStallIterations(0)
     {
         init();
     }
@@ -89,6 +100,9 @@ private:
     /// Helper for constructor
     void init();
 
+    /// Helper for runImp. Returns true if the hypervolume has stalled.
+    bool checkHypervolumeStall(const Double& hypervolume);
+
 
 };
 
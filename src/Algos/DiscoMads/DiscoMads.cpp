@@ -62,9 +62,6 @@
 #include "../../Eval/ProgressiveBarrier.hpp"
 #include "../../Output/OutputQueue.hpp"
 #include "../../Util/fileutils.hpp"
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-#endif
 
 void NOMAD::DiscoMads::init(bool barrierInitializedFromCache)
 {
@@ -78,11 +75,11 @@ void NOMAD::DiscoMads::init(bool barrierInitializedFromCache)
 
 
     // -- Display discoMads parameters
-    bool detectHiddConst = _runParams->getAttributeValue<bool>("DISCO_MADS_HID_CONST");                   // only for hidden constraints revaluation
+    bool detectHiddConst = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_HID_CONST);                   // only for hidden constraints revaluation
 
     if(detectHiddConst)
     {   // use to reveal hidden constraints
-        NOMAD::Double highValue = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_HID_CONST_OUTPUT_VALUE");   
+        NOMAD::Double highValue = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_HID_CONST_OUTPUT_VALUE);   
         OUTPUT_INFO_START
             AddOutputInfo("DiscoMads used to reveal hidden constraints.",true,false);
             AddOutputInfo("Value attributed to OBJ/PB output of failed evaluations: "+highValue.tostring());
@@ -90,17 +87,17 @@ void NOMAD::DiscoMads::init(bool barrierInitializedFromCache)
     }
     else{
         // use to reveal discontinuities
-        NOMAD::Double detectionRadius = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_DETECTION_RADIUS"); 
-        NOMAD::Double limitRate = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_LIMIT_RATE");
+        NOMAD::Double detectionRadius = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_DETECTION_RADIUS); 
+        NOMAD::Double limitRate = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_LIMIT_RATE);
         OUTPUT_INFO_START
             AddOutputInfo("DiscoMads used to reveal discontinuities.",true,false);
             AddOutputInfo("Discontinuities characterized by detection radius "+detectionRadius.tostring()+" and limit rate "+limitRate.tostring());
         OUTPUT_INFO_END
     }
         // Common parameters
-    NOMAD::Double exclusionRadius = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_EXCLUSION_RADIUS");
-    size_t revealingPollnbPoints = _runParams->getAttributeValue<size_t>("DISCO_MADS_REVEALING_POLL_NB_POINTS"); 
-    NOMAD::Double revealingPollRadius = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_REVEALING_POLL_RADIUS");    
+    NOMAD::Double exclusionRadius = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_EXCLUSION_RADIUS);
+    size_t revealingPollnbPoints = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_REVEALING_POLL_NB_POINTS); 
+    NOMAD::Double revealingPollRadius = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_REVEALING_POLL_RADIUS);    
     OUTPUT_INFO_START
         AddOutputInfo("Exclusion radius: "+exclusionRadius.tostring());
         AddOutputInfo("Revealing poll: "+to_string(revealingPollnbPoints)+" points, radius = "+revealingPollRadius.tostring());
@@ -188,12 +185,6 @@ void NOMAD::DiscoMads::hotRestartOnUserInterrupt()
     {
         return;
     }
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _totalCPUAlgoTime += NOMAD::Clock::getCPUTime() - _startTime;
-    }
-#endif // TIME_STATS
     hotRestartBeginHelper();
 
     // Reset mesh because parameters have changed.
@@ -212,12 +203,6 @@ void NOMAD::DiscoMads::hotRestartOnUserInterrupt()
     }
 
     hotRestartEndHelper();
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _startTime = NOMAD::Clock::getCPUTime();
-    }
-#endif // TIME_STATS
 }
 
 void NOMAD::DiscoMads::readInformationForHotRestart()
@@ -226,10 +211,10 @@ void NOMAD::DiscoMads::readInformationForHotRestart()
     // For this, we need to read some files.
     // Note: Cache file is treated independently of hot restart file.
 
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         // Verify the files exist and are readable.
-        std::string hotRestartFile = _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE");
+        std::string hotRestartFile = _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE);
         if (NOMAD::checkReadFile(hotRestartFile))
         {
             std::string s = "Read hot restart file " + hotRestartFile;
@@ -238,7 +223,7 @@ void NOMAD::DiscoMads::readInformationForHotRestart()
             // Create a GMesh and an DiscoMadsMegaIteration with default values, to be filled
             // by istream is.
             // NOTE: Working in full dimension
-            auto barrier = std::make_shared<NOMAD::ProgressiveBarrier>(NOMAD::INF, NOMAD::Point(_pbParams->getAttributeValue<size_t>("DIMENSION")), NOMAD::EvalType::BB);
+            auto barrier = std::make_shared<NOMAD::ProgressiveBarrier>(NOMAD::INF, NOMAD::Point(_pbParams->getAttributeValue(NOMAD::Attr::DIMENSION)), NOMAD::EvalType::BB);
             
             std::shared_ptr<NOMAD::MeshBase> mesh = std::make_shared<NOMAD::GMesh>(_pbParams,_runParams);
 
@@ -226,7 +226,7 @@ bool NOMAD::DiscoMadsBarrier::updateWithPoints(const std::vector<NOMAD::EvalPoin
             // locate neighbours points around the new revealing point
             std::vector<NOMAD::EvalPoint> evalPointToUpdate; 
             auto crittest = [&](const EvalPoint& x2){return this->proximityTest(revealingPoint, x2);};
-            cache->find(crittest,evalPointToUpdate);
+            cache->findWithinRadius(*revealingPoint.getX(), _exclusionRadius, crittest, evalPointToUpdate);
 
             OUTPUT_DEBUG_START
                 s = "Points close to revealing point "+ std::to_string(revealingPoint.getTag())+": ";
@@ -57,15 +57,11 @@
 #include "../../Algos/DiscoMads/DiscoMadsIteration.hpp"
 #include "../../Algos/DiscoMads/RevealingPoll.hpp"
 
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-#endif // TIME_STATS
-
 void NOMAD::DiscoMadsIteration::init()
 {
     // Initialize revealing poll for discoMads
     // For some testing, it is possible that _runParams is null
-    if (nullptr == _runParams || !_runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL"))
+    if (nullptr == _runParams || !_runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL))
     {
         _revealingPoll = std::make_unique<NOMAD::RevealingPoll>(this);
     }
@@ -98,18 +94,10 @@ bool NOMAD::DiscoMadsIteration::runImp()
         // 1. Search
         if ( nullptr != _search && ! _stopReasons->checkTerminate() )
         {
-#ifdef TIME_STATS
-            double searchStartTime = NOMAD::Clock::getCPUTime();
-            double searchEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-#endif // TIME_STATS
         
             _search->start();
             iterationSuccess = _search->run();
             _search->end();
-#ifdef TIME_STATS
-            _searchTime += NOMAD::Clock::getCPUTime() - searchStartTime;
-            _searchEvalTime += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - searchEvalStartTime;
-#endif // TIME_STATS
 
         }
 
@@ -123,10 +111,6 @@ bool NOMAD::DiscoMadsIteration::runImp()
             }
             else
             {
-#ifdef TIME_STATS
-                double pollStartTime = NOMAD::Clock::getCPUTime();
-                double pollEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-#endif // TIME_STATS
                 // 2. Revealing Poll
                 _revealingPoll->start();
                 iterationSuccess = _revealingPoll->run();
@@ -150,10 +134,6 @@ bool NOMAD::DiscoMadsIteration::runImp()
                     _poll->end();
                 }
 
-#ifdef TIME_STATS
-                _pollTime += NOMAD::Clock::getCPUTime() - pollStartTime;
-                _pollEvalTime += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - pollEvalStartTime;
-#endif // TIME_STATS
             }
         }
     }
@@ -187,8 +187,9 @@ void NOMAD::DiscoMadsMegaIteration::callbackCheckIfRevealingAndUpdate(NOMAD::Eva
         // or reveal discontinuities
         else{
             // Revelation test between recently evaluated point evalQueuePoint and cache points
+            // Only points within the detection radius can be revealing: use the cache spatial index.
             auto crittest = [&](const EvalPoint& x2){return this->discontinuityTest(*evalQueuePoint, x2);};
-            cache->find(crittest,revealingPointList);   // NB: revealingPointList does not contain evalQueuePoint
+            cache->findWithinRadius(*evalQueuePoint->getX(), _detectionRadius, crittest, revealingPointList);   // NB: revealingPointList does not contain evalQueuePoint
 
             // If we have detected at least one revealing point thanks to evalQueuePoint...
             if(!revealingPointList.empty())
@@ -233,7 +234,7 @@ void NOMAD::DiscoMadsMegaIteration::callbackCheckIfRevealingAndUpdate(NOMAD::Eva
             // locate revealing neighbours points
             std::vector<NOMAD::EvalPoint> revealingNeighbours; 
             auto crittest = [&](const EvalPoint& x2){return this->proximityTestOnRevealingPoint(*evalQueuePoint, x2);};
-            cache->find(crittest,revealingNeighbours);
+            cache->findWithinRadius(*evalQueuePoint->getX(), _exclusionRadius, crittest, revealingNeighbours);
     
             if(!revealingNeighbours.empty())
             {
@@ -487,13 +488,13 @@ void NOMAD::DiscoMadsMegaIteration::init()
     // Get values of discomads parameters
 
 
-    _detectionRadius = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_DETECTION_RADIUS");   // only for discontinuity revelation
-    _limitRate = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_LIMIT_RATE");               // only for discontinuity revelation
-    _exclusionRadius  = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_EXCLUSION_RADIUS");
+    _detectionRadius = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_DETECTION_RADIUS);   // only for discontinuity revelation
+    _limitRate = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_LIMIT_RATE);               // only for discontinuity revelation
+    _exclusionRadius  = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_EXCLUSION_RADIUS);
 
 
-    _detectHiddConst = _runParams->getAttributeValue<bool>("DISCO_MADS_HID_CONST");                   // only for hidden constraints revelation
-    _hiddConstOutputValue = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_HID_CONST_OUTPUT_VALUE");               // only for hidden constraints revelation
+    _detectHiddConst = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_HID_CONST);                   // only for hidden constraints revelation
+    _hiddConstOutputValue = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_HID_CONST_OUTPUT_VALUE);               // only for hidden constraints revelation
 
 
 
@@ -75,7 +75,7 @@ void NOMAD::DiscoMadsUpdate::init()
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     if (nullptr != evc)
     {
-        _clearEvalQueue = evc->getEvaluatorControlGlobalParams()->getAttributeValue<bool>("EVAL_QUEUE_CLEAR");
+        _clearEvalQueue = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::EVAL_QUEUE_CLEAR);
     }
 
 }
@@ -65,10 +65,6 @@
 
 #include "../../Algos/DiscoMads/RevealingPoll.hpp"
 
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-#endif // TIME_STATS
-
 void NOMAD::RevealingPoll::init()
 {
     setStepType(NOMAD::StepType::REVEALING_POLL);
@@ -78,8 +74,8 @@ void NOMAD::RevealingPoll::init()
     _hasSecondPass = false;
 
     // Set revealing search parameters
-    _nbPoints = _runParams->getAttributeValue<size_t>("DISCO_MADS_REVEALING_POLL_NB_POINTS"); 
-    _searchRadius = _runParams->getAttributeValue<NOMAD::Double>("DISCO_MADS_REVEALING_POLL_RADIUS"); 
+    _nbPoints = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_REVEALING_POLL_NB_POINTS); 
+    _searchRadius = _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_REVEALING_POLL_RADIUS); 
 }
 
 
@@ -101,7 +97,7 @@ void NOMAD::RevealingPoll::generateTrialPointsImp()
     }
 
     //Warning about groups of variables.
-    auto varGroups = _pbParams->getAttributeValue<NOMAD::ListOfVariableGroup>("VARIABLE_GROUP");
+    auto varGroups = _pbParams->getAttributeValue(NOMAD::Attr::VARIABLE_GROUP);
     if (!varGroups.empty())
     {
         OUTPUT_INFO_START
@@ -110,7 +106,7 @@ void NOMAD::RevealingPoll::generateTrialPointsImp()
     }
 
     // 1. Create random directions and manage group of variables 
-    auto n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     std::list<NOMAD::Direction> directionsFullSpace;
     generateDirections(directionsFullSpace,n);
 
@@ -152,7 +148,7 @@ void NOMAD::RevealingPoll::generateTrialPointsImp()
         auto evalPoint = NOMAD::EvalPoint(pt);
 
         // Insert the point in eval list
-        evalPoint.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*centerRevealingPoll), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
+        evalPoint.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*centerRevealingPoll), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
         evalPoint.addGenStep(getStepType());
         insertTrialPoint(evalPoint);
     }
@@ -165,8 +161,8 @@ void NOMAD::RevealingPoll::generateTrialPointsImp()
 
     for (auto evalPoint : searchMethodPoints)
     {
-        ArrayOfDouble lb = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-        ArrayOfDouble ub = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+        ArrayOfDouble lb = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+        ArrayOfDouble ub = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
         if (snapPointToBoundsAndProjectOnMesh(evalPoint, lb, ub))
         {
             snappedTrialPoints.push_back(evalPoint);
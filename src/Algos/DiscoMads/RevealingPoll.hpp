@@ -68,10 +68,6 @@
 class RevealingPoll: public Poll
 {
 private:
-#ifdef TIME_STATS
-    DLL_ALGO_API static double  _pollTime;      ///< Total time spent running the poll
-    DLL_ALGO_API static double  _pollEvalTime;  ///< Total time spent evaluating poll points
-#endif // TIME_STATS
 
     size_t _nbPoints;                 ///< nb of points to generate during revealing poll
     NOMAD::Double _searchRadius;      ///< radius of the revealing poll
@@ -88,12 +84,6 @@ public:
     }
     virtual ~RevealingPoll() {}
 
-#ifdef TIME_STATS
-    /// Time stats
-    static double getPollTime()       { return _pollTime; }
-    static double getPollEvalTime()   { return _pollEvalTime; }
-#endif // TIME_STATS
-
 
 private:
 
@@ -145,7 +145,7 @@ std::vector<NOMAD::EvalPoint> NOMAD::EvcInterface::getSortedTrialPoints(const NO
         }
         if (doEval)
         {
-            evalPointsPtrToSort.push_back(std::make_shared<EvalQueuePoint>(trialPoint,evalType));
+            evalPointsPtrToSort.push_back(NOMAD::makeSharedFromPool<NOMAD::EvalQueuePoint>(trialPoint,evalType));
             
             OUTPUT_DEBUG_START
             _step->AddOutputDebug("New point added for sorting: " + trialPoint.display());
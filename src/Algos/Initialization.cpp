@@ -59,8 +59,8 @@ void NOMAD::Initialization::init()
     setStepType(NOMAD::StepType::INITIALIZATION);
     verifyParentNotNull();
     
-    _x0s = _pbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
-    _n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    _x0s = _pbParams->getAttributeValue(NOMAD::Attr::X0);
+    _n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     
 }
 
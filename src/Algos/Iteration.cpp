@@ -48,6 +48,8 @@
 #include <algorithm>    // For std::merge and std::unique
 
 #include "../Algos/Iteration.hpp"
+#include "../Algos/MegaIteration.hpp"
+#include "../Math/RNG.hpp"
 #include "../Output/OutputQueue.hpp"
 #include "../Type/CallbackType.hpp"
 
@@ -66,7 +68,40 @@ void NOMAD::Iteration::init()
     _userCallbackEnabled = false;
     if (nullptr != _runParams)
     {
-        _userCallbackEnabled = _runParams->getAttributeValue<bool>("USER_CALLS_ENABLED");
+        _userCallbackEnabled = _runParams->getAttributeValue(NOMAD::Attr::USER_CALLS_ENABLED);
+    }
+}
+
+
+void NOMAD::Iteration::incrementCounters()
+{
+    _k++;
+
+    if (NOMAD::RNG::areStreamsEnabled())
+    {
+        // The stream index depends only on the step hierarchy: the step types
+        // and the iteration counters of this iteration and its ancestors.
+        // The random draws of this iteration do not depend on what the other
+        // main threads draw.
+        uint64_t streamIndex = 14695981039346656037ULL;  // FNV-1a
+        auto mix = [&streamIndex](uint64_t value)
+        {
+            streamIndex ^= value;
+            streamIndex *= 1099511628211ULL;
+        };
+        for (const NOMAD::Step* step = this; nullptr != step; step = step->getParentStep())
+        {
+            mix(static_cast<uint64_t>(step->getStepType()));
+            if (auto iteration = dynamic_cast<const NOMAD::Iteration*>(step))
+            {
+                mix(iteration->getK());
+            }
+            else if (auto megaIteration = dynamic_cast<const NOMAD::MegaIteration*>(step))
+            {
+                mix(megaIteration->getK());
+            }
+        }
+        NOMAD::RNG::selectStream(streamIndex);
     }
 }
 
@@ -123,7 +123,10 @@ protected:
 private:
     
     /// Implementation to increment the iteration counter
-    virtual void incrementCounters() override { _k++ ;}
+    /**
+     When RNG streams are enabled, also select the random stream of this iteration.
+     */
+    virtual void incrementCounters() override;
 
 };
 
@@ -110,16 +110,16 @@ void NOMAD::IterationUtils::init()
     }
     if (nullptr != search && nullptr != search->getRunParams())
     {
-        _projectOnMesh = search->getRunParams()->getAttributeValue<bool>("SEARCH_METHOD_MESH_PROJECTION");
+        _projectOnMesh = search->getRunParams()->getAttributeValue(NOMAD::Attr::SEARCH_METHOD_MESH_PROJECTION);
     }
     
     auto runParams = _parentStep->getRunParams();
     _frameCenterUseCache = false;
     if (nullptr != runParams )
     {
-        _frameCenterUseCache = _parentStep->getRunParams()->getAttributeValue<bool>("FRAME_CENTER_USE_CACHE");
+        _frameCenterUseCache = _parentStep->getRunParams()->getAttributeValue(NOMAD::Attr::FRAME_CENTER_USE_CACHE);
     
-        _pointPrecisionFull = _parentStep->getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("POINT_FORMAT");
+        _pointPrecisionFull = _parentStep->getPbParams()->getAttributeValue(NOMAD::Attr::POINT_FORMAT);
     }
 
 }
@@ -48,7 +48,7 @@
 #include "../../Algos/EvcInterface.hpp"
 #include "../../Algos/LatinHypercubeSampling/LH.hpp"
 #include "../../Algos/Mads/GMesh.hpp"
-#include "../../Math/LHS.hpp"
+#include "../../Math/SpaceFillingDesign.hpp"
 #include "../../Output/OutputQueue.hpp"
 
 void NOMAD::LH::init()
@@ -86,29 +86,30 @@ void NOMAD::LH::startImp()
 void NOMAD::LH::generateTrialPointsImp()
 {
 
-    auto lhEvals = _runParams->getAttributeValue<size_t>("LH_EVAL");
+    auto lhEvals = _runParams->getAttributeValue(NOMAD::Attr::LH_EVAL);
     if (NOMAD::INF_SIZE_T == lhEvals)
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "The number of evaluations for LH cannot be infinite.");
     }
 
-    auto n = _pbParams->getAttributeValue<size_t>("DIMENSION");
-    auto lowerBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
+    auto n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
+    auto lowerBound = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
 
     if (!lowerBound.isComplete())
     {
         throw NOMAD::Exception(__FILE__,__LINE__,getName() + " requires a complete lower bound vector");
     }
 
-    auto upperBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+    auto upperBound = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
     if (!upperBound.isComplete())
     {
         throw NOMAD::Exception(__FILE__,__LINE__,getName() + " requires a complete upper bound vector");
     }
 
-    // Apply Latin Hypercube algorithm
-    NOMAD::LHS lhs(n, lhEvals, lowerBound, upperBound);
-    auto pointVector = lhs.Sample();
+    // Apply Latin Hypercube algorithm, or the space-filling design given by LH_DESIGN.
+    // The points are streamed from the design.
+    auto design = NOMAD::SpaceFillingDesign::create(_runParams->getAttributeValue(NOMAD::Attr::LH_DESIGN),
+                                                    n, lhEvals, lowerBound, upperBound);
 
     // Create a mesh and project points on this mesh. It will ensure that parameters
     // BB_INPUT_TYPE and GRANULARITY are satisfied.
@@ -116,7 +117,7 @@ void NOMAD::LH::generateTrialPointsImp()
     mesh->setEnforceSanityChecks(false);
     // Modify mesh so it is the finest possible.
     // Note: GRANULARITY is already adjusted in regard to BB_INPUT_TYPE.
-    NOMAD::ArrayOfDouble newMeshSize = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("GRANULARITY");
+    NOMAD::ArrayOfDouble newMeshSize = _pbParams->getAttributeValue(NOMAD::Attr::GRANULARITY);
     auto eps = NOMAD::Double::getEpsilon();
     for (size_t i = 0; i < newMeshSize.size(); i++)
     {
@@ -130,10 +131,11 @@ void NOMAD::LH::generateTrialPointsImp()
     mesh->setDeltas(newMeshSize, newMeshSize);
     auto center = NOMAD::Point(n, 0);
 
-    for (auto point : pointVector)
+    while (design->hasNext())
     {
+        auto point = design->next();
         // First, project on mesh.
-        if (_runParams->getAttributeValue<bool>("SEARCH_METHOD_MESH_PROJECTION"))
+        if (_runParams->getAttributeValue(NOMAD::Attr::SEARCH_METHOD_MESH_PROJECTION))
         {
             point = mesh->projectOnMesh(point, center);
         }
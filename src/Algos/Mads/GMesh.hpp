@@ -103,12 +103,12 @@ public:
                 _frameSizeMant(ArrayOfDouble()),
                 _frameSizeExp(ArrayOfDouble()),
                 _finestMeshSize(ArrayOfDouble()),
-                _granularity(parameters->getAttributeValue<ArrayOfDouble>("GRANULARITY")),
+                _granularity(parameters->getAttributeValue(Attr::GRANULARITY)),
                 _enforceSanityChecks(true),
                 _allGranular(true),
-                _anisotropyFactor(runParams->getAttributeValue<NOMAD::Double>("ANISOTROPY_FACTOR")),
-                _anisotropicMesh(runParams->getAttributeValue<bool>("ANISOTROPIC_MESH")),
-                _refineFreq(runParams->getAttributeValue<size_t>("ORTHO_MESH_REFINE_FREQ")),
+                _anisotropyFactor(runParams->getAttributeValue(Attr::ANISOTROPY_FACTOR)),
+                _anisotropicMesh(runParams->getAttributeValue(Attr::ANISOTROPIC_MESH)),
+                _refineFreq(runParams->getAttributeValue(Attr::ORTHO_MESH_REFINE_FREQ)),
                 _refineCount(0)
     {
         init();
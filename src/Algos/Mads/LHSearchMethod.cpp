@@ -47,7 +47,7 @@
 
 #include "../../Algos/Mads/LHSearchMethod.hpp"
 #include "../../Algos/SubproblemManager.hpp"
-#include "../../Math/LHS.hpp"
+#include "../../Math/SpaceFillingDesign.hpp"
 #include "../../Type/LHSearchType.hpp"
 
 void NOMAD::LHSearchMethod::init()
@@ -57,7 +57,7 @@ void NOMAD::LHSearchMethod::init()
     // For some testing, it is possible that _runParams is null
     if ( nullptr != _runParams)
     {
-        auto lhSearch = _runParams->getAttributeValue<NOMAD::LHSearchType>("LH_SEARCH");
+        auto lhSearch = _runParams->getAttributeValue(NOMAD::Attr::LH_SEARCH);
         setEnabled(lhSearch.isEnabled());
     }
     else
@@ -88,24 +88,26 @@ void NOMAD::LHSearchMethod::generateTrialPointsFinal()
     }
     auto frameCenter = barrier->getFirstPoint();
 
-    auto lhSearch = _runParams->getAttributeValue<NOMAD::LHSearchType>("LH_SEARCH");
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto lhSearch = _runParams->getAttributeValue(NOMAD::Attr::LH_SEARCH);
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     size_t p = (0 == _iterAncestor->getK()) ? lhSearch.getNbInitial() : lhSearch.getNbIteration();
-    auto lowerBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-    auto upperBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+    auto lowerBound = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+    auto upperBound = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
 
     NOMAD::ArrayOfDouble deltaFrameSize = mesh->getDeltaFrameSize();
     NOMAD::Double scaleFactor = sqrt(-log(NOMAD::DEFAULT_EPSILON));
-    // Apply Latin Hypercube algorithm (provide frameCenter, deltaFrameSize, and scaleFactor for updating bounds)
-    NOMAD::LHS lhs(n, p, lowerBound, upperBound, *frameCenter, deltaFrameSize, scaleFactor);
-    auto pointVector = lhs.Sample();
+    // Apply Latin Hypercube algorithm, or the space-filling design given by LH_DESIGN
+    // (provide frameCenter, deltaFrameSize, and scaleFactor for updating bounds)
+    auto design = NOMAD::SpaceFillingDesign::create(_runParams->getAttributeValue(NOMAD::Attr::LH_DESIGN),
+                                                    n, p, lowerBound, upperBound, *frameCenter, deltaFrameSize, scaleFactor);
 
     // Insert the point. Projection on mesh and snap to bounds is done in SearchMethod
-    for (const auto & point : pointVector)
+    while (design->hasNext())
     {
+        const auto point = design->next();
         // Insert point (if possible)
         NOMAD::EvalPoint evalPoint(point);
-        evalPoint.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this)); // !!! Point from is a copy of frame center
+        evalPoint.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this)); // !!! Point from is a copy of frame center
         evalPoint.addGenStep(getStepType());
         insertTrialPoint(evalPoint);
     }
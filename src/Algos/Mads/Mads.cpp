@@ -56,9 +56,6 @@
 #include "../../Eval/ProgressiveBarrier.hpp"
 #include "../../Output/OutputQueue.hpp"
 #include "../../Util/fileutils.hpp"
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-#endif
 
 NOMAD::UserSearchMethodCbFunc NOMAD::Mads::_cbUserSearchMethod = [](const Step& step, EvalPointSet & trialPoints)->bool{ return true;};
 NOMAD::UserSearchMethodCbFunc NOMAD::Mads::_cbUserSearchMethod_2 = [](const Step& step, EvalPointSet & trialPoints)->bool{ return true;};
@@ -76,7 +73,7 @@ void NOMAD::Mads::init(bool barrierInitializedFromCache)
     _initialization = std::make_unique<NOMAD::MadsInitialization>( this , barrierInitializedFromCache);
 
     // We can accept Mads with more than one objective when doing a PhaseOneSearch of DMultiMads optimization.
-    if (!_runParams->getAttributeValue<bool>("DMULTIMADS_OPTIMIZATION") && NOMAD::Algorithm::getNbObj() > 1)
+    if (!_runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_OPTIMIZATION) && NOMAD::Algorithm::getNbObj() > 1)
     {
         throw NOMAD::InvalidParameter(__FILE__,__LINE__,"Mads solves single objective problems. To handle several objectives please use DMultiMads: DMULTIMADS_OPTIMIZATION yes");
     }
@@ -114,16 +111,16 @@ void NOMAD::Mads::observe(const std::vector<NOMAD::EvalPoint>& evalPointList)
 
     auto mesh = std::make_shared<NOMAD::GMesh>(_pbParams, _runParams);
     mesh->setEnforceSanityChecks(false);
-    mesh->setDeltas(_pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("INITIAL_MESH_SIZE"),
-                    _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("INITIAL_FRAME_SIZE"));
+    mesh->setDeltas(_pbParams->getAttributeValue(NOMAD::Attr::INITIAL_MESH_SIZE),
+                    _pbParams->getAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE));
     OUTPUT_DEBUG_START
     AddOutputDebug("Delta frame size: " + mesh->getDeltaFrameSize().display());
     AddOutputDebug("Delta mesh size:  " + mesh->getdeltaMeshSize().display());
     OUTPUT_DEBUG_END
     // Create progressive barrier from current points in cache.
-    auto n = _pbParams->getAttributeValue<size_t>("DIMENSION");
-    auto hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
-    auto hNormType = _runParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+    auto n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
+    auto hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
+    auto hNormType = _runParams->getAttributeValue(NOMAD::Attr::H_NORM);
     FHComputeTypeS computeType; // Default struct initializer is used
     computeType.hNormType = hNormType;
     std::shared_ptr<NOMAD::ProgressiveBarrier> barrier;
@@ -238,12 +235,6 @@ void NOMAD::Mads::hotRestartOnUserInterrupt()
     {
         return;
     }
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _totalCPUAlgoTime += NOMAD::Clock::getCPUTime() - _startTime;
-    }
-#endif // TIME_STATS
     hotRestartBeginHelper();
 
     // Reset mesh because parameters have changed.
@@ -262,12 +253,6 @@ void NOMAD::Mads::hotRestartOnUserInterrupt()
     }
 
     hotRestartEndHelper();
-#ifdef TIME_STATS
-    if (isRootAlgo())
-    {
-        _startTime = NOMAD::Clock::getCPUTime();
-    }
-#endif // TIME_STATS
 }
 
 
@@ -277,10 +262,10 @@ void NOMAD::Mads::readInformationForHotRestart()
     // For this, we need to read some files.
     // Note: Cache file is treated independently of hot restart file.
 
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         // Verify the files exist and are readable.
-        std::string hotRestartFile = _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE");
+        std::string hotRestartFile = _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE);
         if (NOMAD::checkReadFile(hotRestartFile))
         {
             std::string s = "Read hot restart file " + hotRestartFile;
@@ -289,7 +274,7 @@ void NOMAD::Mads::readInformationForHotRestart()
             // Create a GMesh and an MadsMegaIteration with default values, to be filled
             // by istream is.
             // NOTE: Working in full dimension
-            auto barrier = std::make_shared<NOMAD::ProgressiveBarrier>(NOMAD::INF, NOMAD::Point(_pbParams->getAttributeValue<size_t>("DIMENSION")), NOMAD::EvalType::BB);
+            auto barrier = std::make_shared<NOMAD::ProgressiveBarrier>(NOMAD::INF, NOMAD::Point(_pbParams->getAttributeValue(NOMAD::Attr::DIMENSION)), NOMAD::EvalType::BB);
 
             std::shared_ptr<NOMAD::MeshBase> mesh = std::make_shared<NOMAD::GMesh>(_pbParams,_runParams);
 
@@ -331,7 +316,7 @@ void NOMAD::Mads::addCallback(const NOMAD::CallbackType& callbackType,
                               const NOMAD::UserSearchMethodCbFunc& userMethodCbFunc)
 {
 
-    auto us = _runParams->getAttributeValue<bool>("USER_SEARCH");
+    auto us = _runParams->getAttributeValue(NOMAD::Attr::USER_SEARCH);
     switch (callbackType)
     {
         case NOMAD::CallbackType::USER_METHOD_SEARCH:
@@ -364,7 +349,7 @@ void NOMAD::Mads::addCallback(const NOMAD::CallbackType& callbackType,
 void NOMAD::Mads::addCallback(const NOMAD::CallbackType& callbackType,
                               const NOMAD::UserPollMethodCbFunc& userMethodCbFunc)
 {
-    auto dt = _runParams->getAttributeValue<NOMAD::DirectionTypeList>("DIRECTION_TYPE");
+    auto dt = _runParams->getAttributeValue(NOMAD::Attr::DIRECTION_TYPE);
     switch (callbackType)
     {
         case NOMAD::CallbackType::USER_METHOD_SEARCH:
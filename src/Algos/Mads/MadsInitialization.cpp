@@ -63,9 +63,9 @@ void NOMAD::MadsInitialization::init()
 {
     _initialMesh = std::make_shared<NOMAD::GMesh>(_pbParams,_runParams);
 
-    _bbInputType = _pbParams->getAttributeValue<NOMAD::BBInputTypeList>("BB_INPUT_TYPE");
+    _bbInputType = _pbParams->getAttributeValue(NOMAD::Attr::BB_INPUT_TYPE);
 
-    _hMax0 = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+    _hMax0 = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
 }
 
 
@@ -234,7 +234,15 @@ bool NOMAD::MadsInitialization::eval_x0s()
                     evalPointX0.setMesh(_initialMesh);
                 }
             }
-            const size_t incumbentSelectionThreshold = _runParams->getAttributeValue<size_t>("DMULTIMADS_SELECT_INCUMBENT_THRESHOLD");
+            const size_t incumbentSelectionThreshold = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_SELECT_INCUMBENT_THRESHOLD);
+
+            // Optional reference point for the hypervolume.
+            const auto& hvReferencePointStr = _runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_HV_REFERENCE_POINT);
+            NOMAD::ArrayOfDouble hvReferencePoint(hvReferencePointStr.size());
+            for (size_t i = 0; i < hvReferencePointStr.size(); i++)
+            {
+                hvReferencePoint[i].atof(hvReferencePointStr[i]);
+            }
 
             _barrier = std::make_shared<NOMAD::DMultiMadsBarrier>(
                                     NOMAD::Algorithm::getNbObj(),
@@ -245,7 +253,8 @@ bool NOMAD::MadsInitialization::eval_x0s()
                                     computeType,
                                     evalPointX0s,
                                     false, /*  barrier NOT initialized from Cache */
-                                    _bbInputType);
+                                    _bbInputType,
+                                    hvReferencePoint);
 
         }
         else if(_isUsedForDiscoMads)
@@ -256,7 +265,7 @@ bool NOMAD::MadsInitialization::eval_x0s()
                                                     computeType,
                                                     evalPointX0s,
                                                     _barrierInitializedFromCache,
-                                                    _runParams->getAttributeValue<Double>("DISCO_MADS_EXCLUSION_RADIUS")
+                                                    _runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_EXCLUSION_RADIUS)
                                                    );
         }
         else
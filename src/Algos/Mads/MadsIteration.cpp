@@ -54,24 +54,12 @@
 #include "../../Cache/CacheBase.hpp"
 #include "../../Output/OutputQueue.hpp"
 
-#ifdef TIME_STATS
-#include "../../Algos/EvcInterface.hpp"
-#include "../../Util/Clock.hpp"
-
-// Initialize static variables
-double NOMAD::MadsIteration::_iterTime = 0.0;
-double NOMAD::MadsIteration::_searchTime = 0.0;
-double NOMAD::MadsIteration::_searchEvalTime = 0.0;
-double NOMAD::MadsIteration::_pollTime = 0.0;
-double NOMAD::MadsIteration::_pollEvalTime = 0.0;
-#endif // TIME_STATS
-
 
 void NOMAD::MadsIteration::init()
 {
 
     // For some testing, it is possible that _runParams is null
-    if (nullptr != _runParams && _runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL"))
+    if (nullptr != _runParams && _runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL))
     {
         _megasearchpoll = std::make_unique<NOMAD::MegaSearchPoll>(this);
     }
@@ -99,9 +87,6 @@ void NOMAD::MadsIteration::init()
 void NOMAD::MadsIteration::startImp()
 {
 
-#ifdef TIME_STATS
-    _iterStartTime = NOMAD::Clock::getCPUTime();
-#endif // TIME_STATS
 }
 
 
@@ -177,18 +162,10 @@ bool NOMAD::MadsIteration::runImp()
         // 1. Search
         if ( nullptr != _search && ! _stopReasons->checkTerminate() )
         {
-#ifdef TIME_STATS
-            double searchStartTime = NOMAD::Clock::getCPUTime();
-            double searchEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-#endif // TIME_STATS
 
             _search->start();
             iterationSuccess = _search->run();
             _search->end();
-#ifdef TIME_STATS
-            _searchTime += NOMAD::Clock::getCPUTime() - searchStartTime;
-            _searchEvalTime += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - searchEvalStartTime;
-#endif // TIME_STATS
 
         }
 
@@ -202,10 +179,6 @@ bool NOMAD::MadsIteration::runImp()
             }
             else
             {
-#ifdef TIME_STATS
-                double pollStartTime = NOMAD::Clock::getCPUTime();
-                double pollEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-#endif // TIME_STATS
                 // 2. Poll
                 _poll->start();
                 // Iteration is a success if either a better xFeas or
@@ -213,10 +186,6 @@ bool NOMAD::MadsIteration::runImp()
                 // See Algorithm 12.2 from DFBO.
                 iterationSuccess = _poll->run();
                 _poll->end();
-#ifdef TIME_STATS
-                _pollTime += NOMAD::Clock::getCPUTime() - pollStartTime;
-                _pollEvalTime += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - pollEvalStartTime;
-#endif // TIME_STATS
             }
         }
     }
@@ -226,10 +195,3 @@ bool NOMAD::MadsIteration::runImp()
     return iterationSuccess;
 }
 
-
-#ifdef TIME_STATS
-void NOMAD::MadsIteration::endImp()
-{
-    _iterTime += NOMAD::Clock::getCPUTime() - _iterStartTime;
-}
-#endif // TIME_STATS
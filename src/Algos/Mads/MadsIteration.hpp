@@ -69,16 +69,6 @@ protected:
     std::unique_ptr<Search> _search;
     std::unique_ptr<MegaSearchPoll> _megasearchpoll;
     
-#ifdef TIME_STATS
-    /// Time counters
-    DLL_ALGO_API static double  _iterTime;          ///< Total time spent running this class
-    DLL_ALGO_API static double  _searchTime;        ///< Total time spent running searches
-    DLL_ALGO_API static double  _searchEvalTime;    ///< Total time spent evaluating search points
-    DLL_ALGO_API static double  _pollTime;          ///< Total time spent running polls
-    DLL_ALGO_API static double  _pollEvalTime;      ///< Total time spent evaluating poll points
-    double                      _iterStartTime;     ///< Time at which the start method was called
-#endif // TIME_STATS
-
 public:
     /// Constructor
     /**
@@ -94,9 +84,6 @@ public:
         _poll(nullptr),
         _search(nullptr),
         _megasearchpoll(nullptr)
-#ifdef TIME_STATS
-        ,_iterStartTime(0.0)
-#endif // TIME_STATS
     {
         init();
     }
@@ -112,15 +99,6 @@ public:
     const MeshBasePtr getMesh() const override { return _mesh; }
 
 
-#ifdef TIME_STATS
-    /// Time stats
-    static double getIterTime()         { return _iterTime; }
-    static double getSearchTime()       { return _searchTime; }
-    static double getSearchEvalTime()   { return _searchEvalTime; }
-    static double getPollTime()         { return _pollTime; }
-    static double getPollEvalTime()     { return _pollEvalTime; }
-#endif // TIME_STATS
-
     /*---------------------*/
     /* Other class methods */
     /*---------------------*/
@@ -138,9 +116,6 @@ private:
      */
     virtual bool runImp() override;
 
-#ifdef TIME_STATS
-    virtual void endImp() override;
-#endif // TIME_STATS
 };
 
 #include "../../nomad_nsend.hpp"
@@ -96,7 +96,7 @@ void NOMAD::MadsMegaIteration::observe(const std::vector<NOMAD::EvalPoint>& eval
 
     // Update barrier with new points.
     _barrier->updateRefBests();
-    _barrier->updateWithPoints(evalPointList, _runParams->getAttributeValue<bool>("FRAME_CENTER_USE_CACHE"), true /* true: update incumbents and hMax */);
+    _barrier->updateWithPoints(evalPointList, _runParams->getAttributeValue(NOMAD::Attr::FRAME_CENTER_USE_CACHE), true /* true: update incumbents and hMax */);
 
     // Update main mesh
     NOMAD::MadsUpdate update(this);
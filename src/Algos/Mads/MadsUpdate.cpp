@@ -68,7 +68,7 @@ void NOMAD::MadsUpdate::init()
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     if (nullptr != evc)
     {
-        _clearEvalQueue = evc->getEvaluatorControlGlobalParams()->getAttributeValue<bool>("EVAL_QUEUE_CLEAR");
+        _clearEvalQueue = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::EVAL_QUEUE_CLEAR);
     }
 
 }
@@ -57,7 +57,7 @@ void NOMAD::NMSearchMethod::init()
     bool nmSearch = false;
     if ( nullptr != _runParams && nullptr != NOMAD::EvcInterface::getEvaluatorControl() )
     {
-        if ( _runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL") )
+        if ( _runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL) )
         {
             setStepType(NOMAD::StepType::SEARCH_METHOD_NM);
         }
@@ -65,7 +65,7 @@ void NOMAD::NMSearchMethod::init()
         {
             setStepType(NOMAD::StepType::ALGORITHM_NM);
         }
-        nmSearch = _runParams->getAttributeValue<bool>("NM_SEARCH");
+        nmSearch = _runParams->getAttributeValue(NOMAD::Attr::NM_SEARCH);
     }
     setEnabled(nmSearch);
     
@@ -85,8 +85,8 @@ void NOMAD::NMSearchMethod::init()
     if (nmSearch)
     {
         // Set the lap counter
-        const auto nmFactor = _runParams->getAttributeValue<size_t>("NM_SEARCH_MAX_TRIAL_PTS_NFACTOR");
-        const auto dim = _pbParams->getAttributeValue<size_t>("DIMENSION");
+        const auto nmFactor = _runParams->getAttributeValue(NOMAD::Attr::NM_SEARCH_MAX_TRIAL_PTS_NFACTOR);
+        const auto dim = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
         if (nmFactor < NOMAD::INF_SIZE_T)
         {
             NOMAD::EvcInterface::getEvaluatorControl()->setLapMaxBbEval( dim*nmFactor );
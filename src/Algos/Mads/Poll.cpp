@@ -59,13 +59,6 @@
 #include "../../Output/OutputQueue.hpp"
 #include "../../Type/DirectionType.hpp"
 
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-// Initialize static variables
-double NOMAD::Poll::_pollTime;
-double NOMAD::Poll::_pollEvalTime;
-#endif // TIME_STATS
-
 /// <#Description#>
 void NOMAD::Poll::init()
 {
@@ -80,8 +73,8 @@ void NOMAD::Poll::init()
     if ( nullptr != _runParams)
     {
         // The direction types for primary and secondary poll centers
-        _primaryDirectionTypes = _runParams->getAttributeValue<DirectionTypeList>("DIRECTION_TYPE");
-        _secondaryDirectionTypes = _runParams->getAttributeValue<DirectionTypeList>("DIRECTION_TYPE_SECONDARY_POLL");
+        _primaryDirectionTypes = _runParams->getAttributeValue(NOMAD::Attr::DIRECTION_TYPE);
+        _secondaryDirectionTypes = _runParams->getAttributeValue(NOMAD::Attr::DIRECTION_TYPE_SECONDARY_POLL);
 
         // Ortho n+1 poll methods generate n trial points in a first pass and, if not successful, generate the n+1 th point (second pass)
         for (auto dirType : _primaryDirectionTypes)
@@ -106,17 +99,17 @@ void NOMAD::Poll::init()
         }
 
         // Rho parameter of the progressive barrier. Used to choose if the primary frame center is the feasible or infeasible incumbent.
-        _rho = _runParams->getAttributeValue<NOMAD::Double>("RHO");
+        _rho = _runParams->getAttributeValue(NOMAD::Attr::RHO);
 
         // Complete the primary and secondary poll directions to reach the given target number. Only for single pass direction type (ortho 2n). Managed by checkAndComply.
-        _trialPointMaxAddUp = _runParams->getAttributeValue<size_t>("TRIAL_POINT_MAX_ADD_UP");
+        _trialPointMaxAddUp = _runParams->getAttributeValue(NOMAD::Attr::TRIAL_POINT_MAX_ADD_UP);
 
     }
 
     // Groups of variables.
     if ( nullptr != _pbParams)
     {
-        _varGroups = _pbParams->getAttributeValue<NOMAD::ListOfVariableGroup>("VARIABLE_GROUP");
+        _varGroups = _pbParams->getAttributeValue(NOMAD::Attr::VARIABLE_GROUP);
         if (!_varGroups.empty())
         {
             _mapDirTypeToVG = _runParams->getMapDirTypeToVG();
@@ -153,10 +146,6 @@ bool NOMAD::Poll::runImp()
     s = "Generate points for " + getName();
     AddOutputDebug(s);
     OUTPUT_DEBUG_END
-#ifdef TIME_STATS
-    double pollStartTime = NOMAD::Clock::getCPUTime();
-    double pollEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-#endif // TIME_STATS
 
     // 1- Create poll methods and generate points (first pass)
     generateTrialPoints();
@@ -217,11 +206,6 @@ bool NOMAD::Poll::runImp()
         }
     }
 
-#ifdef TIME_STATS
-    _pollTime += NOMAD::Clock::getCPUTime() - pollStartTime;
-    _pollEvalTime += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - pollEvalStartTime;
-#endif // TIME_STATS
-
     OUTPUT_INFO_START
     s = getName();
     s += (pollSuccessful) ? " is successful" : " is not successful";
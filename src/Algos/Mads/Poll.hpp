@@ -61,10 +61,6 @@
 class Poll: public Step, public IterationUtils
 {
 private:
-#ifdef TIME_STATS
-    DLL_ALGO_API static double  _pollTime;      ///< Total time spent running the poll
-    DLL_ALGO_API static double  _pollEvalTime;  ///< Total time spent evaluating poll points
-#endif // TIME_STATS
 
     DirectionTypeList _primaryDirectionTypes, _secondaryDirectionTypes;  ///< The poll methods implement different direction types for primary and secondary poll centers.
 
@@ -120,12 +116,6 @@ public:
       */
     void generateTrialPointsExtra();
 
-#ifdef TIME_STATS
-    /// Time stats
-    static double getPollTime()       { return _pollTime; }
-    static double getPollEvalTime()   { return _pollEvalTime; }
-#endif // TIME_STATS
-
 protected:
     /// Helper for start: get lists of Primary and Secondary Polls
     void computePrimarySecondaryPollCenters(std::vector<EvalPointPtr> &primaryCenters, std::vector<EvalPointPtr> &secondaryCenters) const;
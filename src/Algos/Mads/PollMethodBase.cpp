@@ -58,9 +58,9 @@ void NOMAD::PollMethodBase::init()
 
     if (nullptr != _pbParams)
     {
-        _n = _pbParams->getAttributeValue<size_t>("DIMENSION");
-        _lb = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-        _ub = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+        _n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
+        _lb = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+        _ub = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
     }
 }
 
@@ -60,7 +60,7 @@ void NOMAD::QPSolverAlgoSearchMethod::init()
     // For some testing, it is possible that _runParams is null or evaluator control is null
     setEnabled((nullptr == parentSearch)
                && (nullptr !=_runParams)
-               && _runParams->getAttributeValue<bool>("QP_SEARCH")
+               && _runParams->getAttributeValue(NOMAD::Attr::QP_SEARCH)
                &&  (nullptr != EvcInterface::getEvaluatorControl()));
 #ifndef USE_SGTELIB
     if (isEnabled())
@@ -92,7 +92,7 @@ void NOMAD::QPSolverAlgoSearchMethod::init()
             setEnabled(false);
         }
 
-        const auto& modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+        const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
         _displayLevel = modelDisplay.empty()
                             ? NOMAD::OutputLevel::LEVEL_DEBUGDEBUG
                             : NOMAD::OutputLevel::LEVEL_INFO;
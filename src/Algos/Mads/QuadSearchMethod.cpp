@@ -68,7 +68,7 @@ void NOMAD::QuadSearchMethod::init()
     // For some testing, it is possible that _runParams is null or evaluator control is null
     setEnabled((nullptr == parentSearch)
                && (nullptr !=_runParams)
-               && (_runParams->getAttributeValue<bool>("QUAD_MODEL_SEARCH") || _runParams->getAttributeValue<bool>("QUAD_MODEL_SEARCH_SIMPLE_MADS"))
+               && (_runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH) || _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH_SIMPLE_MADS))
                &&  (nullptr != EvcInterface::getEvaluatorControl()));
 #ifndef USE_SGTELIB
     if (isEnabled())
@@ -100,7 +100,7 @@ void NOMAD::QuadSearchMethod::init()
             setEnabled(false);
         }
 
-        const auto& modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+        const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
         _displayLevel = modelDisplay.empty()
                             ? NOMAD::OutputLevel::LEVEL_DEBUGDEBUG
                             : NOMAD::OutputLevel::LEVEL_INFO;
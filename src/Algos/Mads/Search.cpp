@@ -60,15 +60,6 @@
 #include "../../Algos/Mads/VNSSearchMethod.hpp"
 #include "../../Output/OutputQueue.hpp"
 
-#ifdef TIME_STATS
-#include "../../Util/Clock.hpp"
-
-// Initialize static variables
-// 11 search methods are available
-std::vector<double> NOMAD::Search::_searchTime(11, 0.0);
-std::vector<double> NOMAD::Search::_searchEvalTime(11, 0.0);
-#endif // TIME_STATS
-
 void NOMAD::Search::init()
 {
     setStepType(NOMAD::StepType::SEARCH);
@@ -179,20 +170,10 @@ bool NOMAD::Search::runImp()
         }
 
 
-#ifdef TIME_STATS
-        double searchStartTime = NOMAD::Clock::getCPUTime();
-        double searchEvalStartTime = NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime();
-#endif // TIME_STATS
-
         searchMethod->start();
         searchMethod->run();
         searchMethod->end();
 
-#ifdef TIME_STATS
-        _searchTime[i] += NOMAD::Clock::getCPUTime() - searchStartTime;
-        _searchEvalTime[i] += NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime() - searchEvalStartTime;
-#endif // TIME_STATS
-
         // Search is successful only if full success type.
         searchSuccessful = (searchMethod->getSuccessType() >= NOMAD::SuccessType::FULL_SUCCESS);
         if (searchSuccessful)
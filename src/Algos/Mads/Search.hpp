@@ -56,10 +56,6 @@ class Search final : public Step , public IterationUtils
 {
 private:
     std::vector<std::shared_ptr<SearchMethodBase>> _searchMethods;
-#ifdef TIME_STATS
-    DLL_ALGO_API static std::vector<double> _searchTime;        ///< Total time spent running each search
-    DLL_ALGO_API static std::vector<double> _searchEvalTime;    ///< Total time spent evaluating search points
-#endif // TIME_STATS
 
 public:
     /// Constructor
@@ -76,12 +72,6 @@ public:
 
     virtual ~Search() {}
 
-#ifdef TIME_STATS
-    /// Time stats
-    static std::vector<double> getSearchTime()       { return _searchTime; }
-    static std::vector<double> getSearchEvalTime()   { return _searchEvalTime; }
-#endif // TIME_STATS
-
     /**
      - Insert extra search method at a given position. For example, DMultiMads-NM search method.
      */
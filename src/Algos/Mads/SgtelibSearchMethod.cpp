@@ -65,7 +65,7 @@ void NOMAD::SgtelibSearchMethod::init()
 
     const auto parentSearch = getParentStep()->getParentOfType<NOMAD::SgtelibSearchMethod*>(false);
     // For some testing, it is possible that _runParams is null
-    setEnabled((nullptr == parentSearch) && (nullptr != _runParams) && _runParams->getAttributeValue<bool>("SGTELIB_MODEL_SEARCH"));
+    setEnabled((nullptr == parentSearch) && (nullptr != _runParams) && _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH));
 #ifndef USE_SGTELIB
     if (isEnabled())
     {
@@ -96,7 +96,7 @@ void NOMAD::SgtelibSearchMethod::init()
             setEnabled(false);
         }
 
-        const auto& modelDisplay = _runParams->getAttributeValue<std::string>("SGTELIB_MODEL_DISPLAY");
+        const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_DISPLAY);
         _displayLevel = modelDisplay.empty()
                             ? NOMAD::OutputLevel::LEVEL_DEBUGDEBUG
                             : NOMAD::OutputLevel::LEVEL_INFO;
@@ -151,7 +151,7 @@ void NOMAD::SgtelibSearchMethod::generateTrialPointsFinal()
         // Here, NOMAD 3 uses parameter SGTELIB_MODEL_TRIALS: Max number of
         // sgtelib model search failures before going to the poll step.
         // Not used.
-        //const size_t kkmax = _runParams->getAttributeValue<size_t>("SGTELIB_MODEL_SEARCH_TRIALS");
+        //const size_t kkmax = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH_TRIALS);
         /*----------------*/
         /*  oracle points */
         /*----------------*/
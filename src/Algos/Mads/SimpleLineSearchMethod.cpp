@@ -59,9 +59,9 @@ void NOMAD::SimpleLineSearchMethod::init()
     {
         setStepType(NOMAD::StepType::SEARCH_METHOD_SIMPLE_LINE_SEARCH);
 
-        bool enabled = _runParams->getAttributeValue<bool>("SIMPLE_LINE_SEARCH");
+        bool enabled = _runParams->getAttributeValue(NOMAD::Attr::SIMPLE_LINE_SEARCH);
         
-        if (enabled && _runParams->getAttributeValue<bool>("SPECULATIVE_SEARCH"))
+        if (enabled && _runParams->getAttributeValue(NOMAD::Attr::SPECULATIVE_SEARCH))
         {
             throw NOMAD::Exception(__FILE__,__LINE__,"SimpleLineSearchMethod: cannot work with speculative search.");
         }
@@ -71,7 +71,7 @@ void NOMAD::SpeculativeSearchMethod::init()
     // For some testing, it is possible that _runParams is null
     if (nullptr != _runParams)
     {
-        enabled = _runParams->getAttributeValue<bool>("SPECULATIVE_SEARCH");
+        enabled = _runParams->getAttributeValue(NOMAD::Attr::SPECULATIVE_SEARCH);
     }
     setEnabled(enabled);
     
@@ -80,10 +80,10 @@ void NOMAD::SpeculativeSearchMethod::init()
     _baseFactor = 0.0;
     if (nullptr != _runParams)
     {
-        _nbSearches = _runParams->getAttributeValue<size_t>("SPECULATIVE_SEARCH_MAX");
+        _nbSearches = _runParams->getAttributeValue(NOMAD::Attr::SPECULATIVE_SEARCH_MAX);
         
         // Base factor to control the extent of the speculative direction
-        _baseFactor = _runParams->getAttributeValue<NOMAD::Double>("SPECULATIVE_SEARCH_BASE_FACTOR");
+        _baseFactor = _runParams->getAttributeValue(NOMAD::Attr::SPECULATIVE_SEARCH_BASE_FACTOR);
     }
 }
 
@@ -163,7 +163,7 @@ void NOMAD::SpeculativeSearchMethod::generateTrialPointsFinal()
                 auto evalPoint = NOMAD::EvalPoint(*(pointFrom->getX()) + diri);
 
                 // Insert the point
-                evalPoint.setPointFrom(std::make_shared<NOMAD::EvalPoint>(frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
+                evalPoint.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
                 evalPoint.addGenStep(getStepType());
                 insertTrialPoint(evalPoint);
             }
@@ -57,7 +57,7 @@ void NOMAD::TemplateAlgoSearchMethod::init()
     bool randomAlgoSearch = false;
     if ( nullptr != _runParams && nullptr != NOMAD::EvcInterface::getEvaluatorControl() )
     {
-        if ( _runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL") )
+        if ( _runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL) )
         {
             setStepType(NOMAD::StepType::SEARCH_METHOD_ALGO_RANDOM);
         }
@@ -66,7 +66,7 @@ void NOMAD::TemplateAlgoSearchMethod::init()
             setStepType(NOMAD::StepType::ALGORITHM_RANDOM);
         }
         // TEMPLATE use for a new search method: a new parameter must be defined to enable or not the search method (see ../Attributes/runAttributesDefinition.txt)
-        randomAlgoSearch = _runParams->getAttributeValue<bool>("RANDOM_ALGO_SEARCH");
+        randomAlgoSearch = _runParams->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_SEARCH);
     }
     setEnabled(randomAlgoSearch);
     
@@ -74,8 +74,8 @@ void NOMAD::TemplateAlgoSearchMethod::init()
     if (randomAlgoSearch)
     {
         // TEMPLATE for a new search method: parameters can be defined to control the search method (see ../Attributes/runAttributesDefinition.txt)
-        auto dummyFactor = _runParams->getAttributeValue<size_t>("RANDOM_ALGO_DUMMY_FACTOR");
-        auto dim = _pbParams->getAttributeValue<size_t>("DIMENSION");
+        auto dummyFactor = _runParams->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_DUMMY_FACTOR);
+        auto dim = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
         if (dummyFactor < NOMAD::INF_SIZE_T)
         {
             NOMAD::EvcInterface::getEvaluatorControl()->setLapMaxBbEval( dim*dummyFactor ); // In this example, the single pass (lap) max bb eval is set.
@@ -115,7 +115,7 @@ void NOMAD::UserSearchMethod::generateTrialPointsFinal()
     // Insert the point. Projection on mesh and snap to bounds is done later
     for (auto tp : _trialPoints)
     {
-        tp.setPointFrom(std::make_shared<NOMAD::EvalPoint>(*frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this)); // !!! Point from is a copy of frame center
+        tp.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this)); // !!! Point from is a copy of frame center
         tp.addGenStep(getStepType());
         insertTrialPoint(tp);
     }
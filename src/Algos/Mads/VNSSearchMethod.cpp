@@ -71,7 +71,7 @@ void NOMAD::VNSSearchMethod::init()
     {
         
         // Use of surrogate for VNS
-        _useSurrogate = _runParams->getAttributeValue<bool>("VNS_MADS_SEARCH_WITH_SURROGATE");
+        _useSurrogate = _runParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH_WITH_SURROGATE);
         if (_useSurrogate)
         {
             try
@@ -92,7 +92,7 @@ void NOMAD::VNSSearchMethod::init()
         bool SGTEEval = ( evc->getCurrentEvalType() == EvalType::SURROGATE ) ;
         
         // For some testing, it is possible that _runParams is null
-        setEnabled((nullptr == parentSearch) && _runParams->getAttributeValue<bool>("VNS_MADS_SEARCH") && (bBEval || SGTEEval));
+        setEnabled((nullptr == parentSearch) && _runParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH) && (bBEval || SGTEEval));
     }
     else
     {
@@ -100,7 +100,7 @@ void NOMAD::VNSSearchMethod::init()
     }
     if (isEnabled())
     {
-        _trigger = _runParams->getAttributeValue<NOMAD::Double>("VNS_MADS_SEARCH_TRIGGER").todouble();
+        _trigger = _runParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH_TRIGGER).todouble();
         
         // At first the reference frame center is not defined.
         // We obtain the frame center from the EvaluatorControl. If
@@ -242,7 +242,7 @@ bool NOMAD::VNSSearchMethod::runImp()
                     if ( NOMAD::EvalType::BB == searchEvalType )
                     {
                         barrier->updateWithPoints(vnsBarrier->getAllPoints(),
-                                                  _runParams->getAttributeValue<bool>("FRAME_CENTER_USE_CACHE"),
+                                                  _runParams->getAttributeValue(NOMAD::Attr::FRAME_CENTER_USE_CACHE),
                                                                     true /*true: update incumbents and hMax*/);
                     }
                     else
@@ -280,7 +280,7 @@ void NOMAD::VNSSearchMethod::generateTrialPointsFinal()
     /*
     // Note: Use first point of barrier as simplex center.
     NOMAD::VNSSingle singleVNS(this,
-                            std::make_shared<NOMAD::EvalPoint>(getMegaIterationBarrier()->getFirstPoint()),
+                            NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(getMegaIterationBarrier()->getFirstPoint()),
                             madsIteration->getMesh());
     singleVNS.start();
     singleVNS.end();
@@ -66,7 +66,7 @@ void NOMAD::VNSmartAlgoSearchMethod::init()
         bool bBEval = ( NOMAD::EvcInterface::getEvaluatorControl()->getCurrentEvalType() == EvalType::BB ) ;
         
         // For some testing, it is possible that _runParams is null
-        setEnabled((nullptr == parentSearch) && nullptr != _runParams && _runParams->getAttributeValue<bool>("VNSMART_MADS_SEARCH") && bBEval);
+        setEnabled((nullptr == parentSearch) && nullptr != _runParams && _runParams->getAttributeValue(NOMAD::Attr::VNSMART_MADS_SEARCH) && bBEval);
     }
     else
     {
@@ -78,7 +78,7 @@ void NOMAD::VNSmartAlgoSearchMethod::init()
         // We obtain the frame center from the EvaluatorControl. If
         _refFrameCenter = NOMAD::Point();
         
-        _stopConsFailures = _runParams->getAttributeValue<int>("VNSMART_MADS_SEARCH_THRESHOLD");
+        _stopConsFailures = _runParams->getAttributeValue(NOMAD::Attr::VNSMART_MADS_SEARCH_THRESHOLD);
         
         // Create the VNS algorithm with its own stop reason
         _vnsStopReasons = std::make_shared<NOMAD::AlgoStopReasons<NOMAD::VNSStopType>>();
@@ -183,7 +183,7 @@ bool NOMAD::VNSmartAlgoSearchMethod::runImp()
                     
                     // Update the barrier
                     barrier->updateWithPoints(vnsBarrier->getAllPoints(),
-                                              _runParams->getAttributeValue<bool>("FRAME_CENTER_USE_CACHE"),
+                                              _runParams->getAttributeValue(NOMAD::Attr::FRAME_CENTER_USE_CACHE),
                                                                     true /* true: update incumbents and hMax */);
                     
                 }
@@ -51,21 +51,28 @@
  \date   June 2018
  */
 
+#include <cmath>
+#include <cstdio>
+
 // Generic
 #include "../Algos/AlgoStopReasons.hpp"
 #include "../Algos/EvcInterface.hpp"
 #include "../Algos/MainStep.hpp"
 #include "../Algos/SubproblemManager.hpp"
 #include "../Cache/CacheSet.hpp"
+#include "../Cache/CacheShardedSet.hpp"
 #include "../Eval/ProgressiveBarrier.hpp"
 #include "../Math/LHS.hpp"
 #include "../Math/RNG.hpp"
+#include "../Output/BinaryHistory.hpp"
 #include "../Output/OutputQueue.hpp"
 #include "../Output/OutputDirectToFile.hpp"
 #include "../Util/Clock.hpp"
 #include "../Type/EvalSortType.hpp"
 #include "../Util/Clock.hpp"
 #include "../Util/fileutils.hpp"
+#include "../Util/MemoryPool.hpp"
+#include "../Util/Profiler.hpp"
 
 // Specific algos
 #include "../Algos/LatinHypercubeSampling/LH.hpp"
@@ -83,6 +90,7 @@
 #ifdef USE_SGTELIB
 #include "../Algos/QPSolverAlgo/QPSolverAlgo.hpp"
 #include "../Algos/QuadModel/QuadModelAlgo.hpp"
+#include "../Algos/QuadModel/QuadModelManager.hpp"
 #include "../Algos/SgtelibModel/SgtelibModel.hpp"
 #endif
 #include "../Algos/DiscoMads/DiscoMads.hpp"
@@ -116,6 +124,9 @@ void NOMAD::MainStep::init()
 
     // Start the clock
     NOMAD::Clock::reset();
+
+    // Count the allocations of this run only
+    NOMAD::MemoryPool::resetCounters();
 }
 
 
@@ -130,43 +141,47 @@ NOMAD::ArrayOfPoint NOMAD::MainStep::suggest()
     AddOutputInfo("Start step " + getName(), true, false);
 
     // No X0 should be provided
-    auto x0s = _allParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+    auto x0s = _allParams->getAttributeValue(NOMAD::Attr::X0);
     if (!x0s.empty() && !x0s[0].toBeDefined())
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "Using suggest with x0 provided. Use x0 instead of calling suggest.");
     }
 
     // Display attributes and check attribute consistency
-    if (_allParams->getAttributeValue<int>("DISPLAY_DEGREE") >= (int)NOMAD::OutputLevel::LEVEL_DEBUG)
+    if (_allParams->getAttributeValue(NOMAD::Attr::DISPLAY_DEGREE) >= (int)NOMAD::OutputLevel::LEVEL_DEBUG)
     {
         _allParams->display( std::cout );
     }
 
     NOMAD::OutputQueue::getInstance()->initParameters( _allParams->getDispParams() );
-    NOMAD::OutputDirectToFile::getInstance()->init( _allParams->getDispParams() );
+    NOMAD::OutputDirectToFile::getInstance()->init( _allParams->getDispParams(), _allParams->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE) );
 
     // Create internal cache
     // The attribute passed to the function must be true for a cold suggest.
     // A cold suggest has a new MainStep created everytime suggest is called.
     // We rerun the algo using the points provided up to a certain state from a previous suggest. Then new points can be suggested.
     // For warm suggest the MainStep is reused and algo iterates from the state it was before.
-    createCache(_allParams->getAttributeValue<bool>("USE_CACHE_FILE_FOR_RERUN"));
+    createCache(_allParams->getAttributeValue(NOMAD::Attr::USE_CACHE_FILE_FOR_RERUN));
 
-    size_t nbLHEval = _allParams->getAttributeValue<size_t>("LH_EVAL");
+    // With RNG_STREAMS, open the random streams of this suggest. They follow
+    // the RNG state restored by the caller. No effect otherwise.
+    NOMAD::RNG::openStreams();
+
+    size_t nbLHEval = _allParams->getAttributeValue(NOMAD::Attr::LH_EVAL);
 
     if (0 != nbLHEval)
     {
         suggestedPoints = suggestFromLH(nbLHEval);
     }
-    else if (_allParams->getAttributeValue<bool>("MEGA_SEARCH_POLL"))
+    else if (_allParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL))
     {
-        auto cacheFile = _allParams->getCacheParams()->getAttributeValue<std::string>("CACHE_FILE");
+        auto cacheFile = _allParams->getCacheParams()->getAttributeValue(NOMAD::Attr::CACHE_FILE);
         if (cacheFile.empty() && 0 == NOMAD::CacheBase::getInstance()->size())
         {
             std::string err = "Cache file is not provided or is empty. A cache is required to obtain Suggest points from a Mads MegaSearchPoll. To create a cache file, use suggest with LH_EVAL.";
             throw NOMAD::StepException(__FILE__,__LINE__, err, this);
         }
-        auto lhSearchType = _runParams->getAttributeValue<NOMAD::LHSearchType>("LH_SEARCH");
+        auto lhSearchType = _runParams->getAttributeValue(NOMAD::Attr::LH_SEARCH);
         if (0 != lhSearchType.getNbInitial())
         {
             std::string err = "LH_SEARCH's first value should be set to zero when calling Suggest with Mads MegaSearchPoll ";
@@ -175,7 +190,7 @@ NOMAD::ArrayOfPoint NOMAD::MainStep::suggest()
 
         // Update X0 from CacheFile - to satisfy MadsInitialization().
         updateX0sFromCacheAndFromLHSInit();
-        x0s = _allParams->getPbParams()->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+        x0s = _allParams->getPbParams()->getAttributeValue(NOMAD::Attr::X0);
         if (x0s.empty() || x0s[0].toBeDefined())
         {
             AddOutputInfo("No X0 is available. Cannot suggest any new point with MegaSearchPoll");
@@ -243,13 +258,13 @@ void NOMAD::MainStep::observe(const std::vector<NOMAD::EvalPoint>& evalPointList
     AddOutputInfo("Start step " + getName() , true, false);
 
     // Display attributes and check attribute consistency
-    if (_allParams->getAttributeValue<int>("DISPLAY_DEGREE") >= (int)NOMAD::OutputLevel::LEVEL_DEBUG)
+    if (_allParams->getAttributeValue(NOMAD::Attr::DISPLAY_DEGREE) >= (int)NOMAD::OutputLevel::LEVEL_DEBUG)
     {
         _allParams->display(std::cout);
     }
 
     NOMAD::OutputQueue::getInstance()->initParameters(_allParams->getDispParams());
-    NOMAD::OutputDirectToFile::getInstance()->init(_allParams->getDispParams());
+    NOMAD::OutputDirectToFile::getInstance()->init(_allParams->getDispParams(), _allParams->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE));
 
     // The attribute passed to the function is always false (no cache file read for rerun). The points observed are passed as list to be put into the cache file
     createCache(false);
@@ -263,8 +278,8 @@ void NOMAD::MainStep::observe(const std::vector<NOMAD::EvalPoint>& evalPointList
                                                   false /* false: cache file not used*/);
         mads->observe(evalPointList);
         // Update interesting parameters
-        _allParams->setAttributeValue("INITIAL_FRAME_SIZE", mads->getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("INITIAL_FRAME_SIZE"));
-        _allParams->setAttributeValue("H_MAX_0", mads->getRunParams()->getAttributeValue<NOMAD::Double>("H_MAX_0"));
+        _allParams->setAttributeValue("INITIAL_FRAME_SIZE", mads->getPbParams()->getAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE));
+        _allParams->setAttributeValue("H_MAX_0", mads->getRunParams()->getAttributeValue(NOMAD::Attr::H_MAX_0));
         _allParams->getPbParams()->doNotShowWarnings();
         _allParams->checkAndComply();
     }
@@ -286,7 +301,7 @@ std::vector<std::string> NOMAD::MainStep::observe(const NOMAD::ArrayOfPoint& xs,
                     this);
     }
 
-    auto bbOutputType = _allParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+    auto bbOutputType = _allParams->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE);
     for (size_t i = 0; i < xs.size(); i++)
     {
         NOMAD::EvalPoint evalPoint(xs[i]);
@@ -296,8 +311,8 @@ std::vector<std::string> NOMAD::MainStep::observe(const NOMAD::ArrayOfPoint& xs,
     observe(evalPointList);
 
     std::vector<std::string> updatedParams; // Return parameters as vector of strings, more convenient for PyNomad
-    updatedParams.push_back("INITIAL_FRAME_SIZE ( " + _allParams->getPbParams()->getAttributeValue<NOMAD::ArrayOfDouble>("INITIAL_FRAME_SIZE").display() + " )");
-    updatedParams.push_back("H_MAX_0 " + _allParams->getRunParams()->getAttributeValue<NOMAD::Double>("H_MAX_0").display());
+    updatedParams.push_back("INITIAL_FRAME_SIZE ( " + _allParams->getPbParams()->getAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE).display() + " )");
+    updatedParams.push_back("H_MAX_0 " + _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::H_MAX_0).display());
 
     // Save cache.
     // Note: This is usually done in Algorithm::end() via setInformationForHotRestart().
@@ -314,11 +329,6 @@ std::vector<std::string> NOMAD::MainStep::observe(const NOMAD::ArrayOfPoint& xs,
 
 void NOMAD::MainStep::startImp()
 {
-#ifdef TIME_STATS
-    _startTime = NOMAD::Clock::getCPUTime();
-#endif // TIME_STATS
-
-
     if (nullptr == _allParams)
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "Using Library mode. Parameters must be set prior to running MainStep step.");
@@ -351,28 +361,38 @@ void NOMAD::MainStep::startImp()
 
     // Display attributes and check attribute consistency
     _allParams->checkAndComply();
-    if (_allParams->getAttributeValue<int>("DISPLAY_DEGREE") >= (int)NOMAD::OutputLevel::LEVEL_DEBUG)
+    if (_allParams->getAttributeValue(NOMAD::Attr::DISPLAY_DEGREE) >= (int)NOMAD::OutputLevel::LEVEL_DEBUG)
     {
         _allParams->display( std::cout );
     }
 
+    // With RNG_STREAMS, open the random streams of this run. No effect otherwise.
+    NOMAD::RNG::openStreams();
+
     NOMAD::OutputQueue::getInstance()->initParameters( _allParams->getDispParams() );
-    NOMAD::OutputDirectToFile::getInstance()->init( _allParams->getDispParams() );
+    NOMAD::OutputDirectToFile::getInstance()->init( _allParams->getDispParams(), _allParams->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE) );
+
+    // Time profile of the run
+    const auto& profileTraceFile = _allParams->getAttributeValue(NOMAD::Attr::PROFILE_TRACE_FILE);
+    if (!_allParams->getAttributeValue(NOMAD::Attr::PROFILE_FILE).empty() || !profileTraceFile.empty())
+    {
+        NOMAD::Profiler::start(!profileTraceFile.empty());
+    }
 
     // Solution file is written only at the end
-    if (_allParams->getAttributeValue<bool>("SOLUTION_FILE_FINAL"))
+    if (_allParams->getAttributeValue(NOMAD::Attr::SOLUTION_FILE_FINAL))
     {
         // Disable solution file until the end
         NOMAD::OutputDirectToFile::getInstance()->disableSolutionFile();
     }
 
-    createCache(_allParams->getAttributeValue<bool>("USE_CACHE_FILE_FOR_RERUN"));
+    createCache(_allParams->getAttributeValue(NOMAD::Attr::USE_CACHE_FILE_FOR_RERUN));
     updateX0sFromCacheAndFromLHSInit();
-    auto x0s = _allParams->getPbParams()->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+    auto x0s = _allParams->getPbParams()->getAttributeValue(NOMAD::Attr::X0);
 
-    auto nbLHEval = _allParams->getRunParams()->getAttributeValue<size_t>("LH_EVAL");
-    auto doRandomAlgo = _allParams->getRunParams()->getAttributeValue<bool>("RANDOM_ALGO_OPTIMIZATION");
-    auto doDMultiMadsAlgo = _allParams->getRunParams()->getAttributeValue<bool>("DMULTIMADS_OPTIMIZATION");
+    auto nbLHEval = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::LH_EVAL);
+    auto doRandomAlgo = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_OPTIMIZATION);
+    auto doDMultiMadsAlgo = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::DMULTIMADS_OPTIMIZATION);
 
 
     if ( (x0s.empty() || x0s[0].toBeDefined()) && nbLHEval == 0 && !doRandomAlgo && !doDMultiMadsAlgo)
@@ -381,7 +401,7 @@ void NOMAD::MainStep::startImp()
     }
 
     // Use surrogate function as a blackbox
-    bool surrogateAsBB = _allParams->getAttributeValue<bool>("EVAL_SURROGATE_OPTIMIZATION");
+    bool surrogateAsBB = _allParams->getAttributeValue(NOMAD::Attr::EVAL_SURROGATE_OPTIMIZATION);
     
     // Setup EvaluatorControl
     if (_evaluators.empty())
@@ -395,8 +415,8 @@ void NOMAD::MainStep::startImp()
                                                           NOMAD::EvalXDefined::USE_BB_EVAL));
         if (!surrogateAsBB)
         {
-            auto evalSortType = _allParams->getAttributeValue<NOMAD::EvalSortType>("EVAL_QUEUE_SORT");
-            bool surrogateForVNS = _allParams->getAttributeValue<bool>("VNS_MADS_SEARCH") && _allParams->getAttributeValue<bool>("VNS_MADS_SEARCH_WITH_SURROGATE");
+            auto evalSortType = _allParams->getAttributeValue(NOMAD::Attr::EVAL_QUEUE_SORT);
+            bool surrogateForVNS = _allParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH) && _allParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH_WITH_SURROGATE);
             if (NOMAD::EvalSortType::SURROGATE == evalSortType || surrogateForVNS)
             {
                 _evaluators.push_back(std::make_shared<NOMAD::Evaluator>(_allParams->getEvalParams(),
@@ -444,22 +464,22 @@ void NOMAD::MainStep::startImp()
     // This is caught by checkAndComply().
     _algos.clear();
 
-    auto doCSoptimization = _allParams->getRunParams()->getAttributeValue<bool>("CS_OPTIMIZATION");
-    auto doNMOptimization = _allParams->getRunParams()->getAttributeValue<bool>("NM_OPTIMIZATION");
+    auto doCSoptimization = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::CS_OPTIMIZATION);
+    auto doNMOptimization = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::NM_OPTIMIZATION);
 #ifdef _OPENMP
-    bool doPSDMads = _allParams->getRunParams()->getAttributeValue<bool>("PSD_MADS_OPTIMIZATION");
-    bool doCOOPMads = _allParams->getRunParams()->getAttributeValue<bool>("COOP_MADS_OPTIMIZATION");
+    bool doPSDMads = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::PSD_MADS_OPTIMIZATION);
+    bool doCOOPMads = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::COOP_MADS_OPTIMIZATION);
 #endif
 #ifdef USE_SGTELIB
-    bool doQuadModelOpt = _allParams->getRunParams()->getAttributeValue<bool>("QUAD_MODEL_OPTIMIZATION");
-    bool doSgtelibModelEval = _allParams->getRunParams()->getAttributeValue<bool>("SGTELIB_MODEL_EVAL");
-    bool doQPSolverQuadModelOpt = _allParams->getRunParams()->getAttributeValue<bool>("QP_OPTIMIZATION");
+    bool doQuadModelOpt = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::QUAD_MODEL_OPTIMIZATION);
+    bool doSgtelibModelEval = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_EVAL);
+    bool doQPSolverQuadModelOpt = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::QP_OPTIMIZATION);
 #endif
-    bool doRandomAlgoOpt = _allParams->getRunParams()->getAttributeValue<bool>("RANDOM_ALGO_OPTIMIZATION");
-    bool doDMultimadsOpt = _allParams->getRunParams()->getAttributeValue<bool>("DMULTIMADS_OPTIMIZATION");
-    bool doDiscoMads = _allParams->getRunParams()->getAttributeValue<bool>("DISCO_MADS_OPTIMIZATION");
+    bool doRandomAlgoOpt = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_OPTIMIZATION);
+    bool doDMultimadsOpt = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::DMULTIMADS_OPTIMIZATION);
+    bool doDiscoMads = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::DISCO_MADS_OPTIMIZATION);
     
-    bool evalOpportunistic = _allParams->getAttributeValue<bool>("EVAL_OPPORTUNISTIC");
+    bool evalOpportunistic = _allParams->getAttributeValue(NOMAD::Attr::EVAL_OPPORTUNISTIC);
     // LH_EVAL can be done before another algo (not after!)
     if ( nbLHEval > 0 )
     {
@@ -651,7 +671,7 @@ void NOMAD::MainStep::startImp()
         _algos.push_back(mads);
     }
 
-    bool useIbex = _allParams->getRunParams()->getAttributeValue<bool>("USE_IBEX");
+    bool useIbex = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::USE_IBEX);
 	if (useIbex)
 	{
 
@@ -659,10 +679,10 @@ void NOMAD::MainStep::startImp()
 		// A Set file determine the feasible domain
 
 		// If the Set file is already created, we can load it
-		bool setFile = _allParams->getRunParams()->getAttributeValue<bool>("SET_FILE");
+		bool setFile = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::SET_FILE);
 		if (setFile)
 		{
-			string setFileName = _allParams->getAttributeValue<string>("SET_FILE_NAME");
+			string setFileName = _allParams->getAttributeValue(NOMAD::Attr::SET_FILE_NAME);
 			const char * c = setFileName.c_str();
 			_set = std::make_shared<ibex::Set>(c);
 		}
@@ -670,7 +690,7 @@ void NOMAD::MainStep::startImp()
 		// Else, we can load the system file of the problem (containing the variables, constraints, ...) and then create the Set
 		else
 		{
-			string constraintsFileName = _allParams->getAttributeValue<string>("SYSTEM_FILE_NAME");
+			string constraintsFileName = _allParams->getAttributeValue(NOMAD::Attr::SYSTEM_FILE_NAME);
 		        const char * c = constraintsFileName.c_str();
 
 			ibex::System sys(c);
@@ -724,21 +744,42 @@ void NOMAD::MainStep::endImp()
     // Pass last algo stop reason to MainStep (before clearing the algos)
     _stopReasons = _algos.back()->getAllStopReasons();
 
-
-#ifdef TIME_STATS
-   _totalCPUTime += NOMAD::Clock::getCPUTime() - _startTime;
-#endif // TIME_STATS
-
     displayDetailedStats();
 
+    writeProfile();
+
     writeFinalSolutionFile();
 
+    // Make sure the history and stats files are complete at the end of the run.
+    NOMAD::OutputWriter::Flush();
+
     _algos.clear();
 
 }
 
 
 
+void NOMAD::MainStep::writeProfile() const
+{
+    if (!NOMAD::Profiler::isEnabled())
+    {
+        return;
+    }
+    NOMAD::Profiler::stop();
+
+    const auto& profileFile = _allParams->getAttributeValue(NOMAD::Attr::PROFILE_FILE);
+    if (!profileFile.empty())
+    {
+        NOMAD::Profiler::writeProfile(profileFile);
+    }
+    const auto& profileTraceFile = _allParams->getAttributeValue(NOMAD::Attr::PROFILE_TRACE_FILE);
+    if (!profileTraceFile.empty())
+    {
+        NOMAD::Profiler::writeTrace(profileTraceFile);
+    }
+}
+
+
 void NOMAD::MainStep::printNumThreads() const
 {
 #ifdef _OPENMP
@@ -756,7 +797,7 @@ void NOMAD::MainStep::printNumThreads() const
 // Helper for start
 void NOMAD::MainStep::createCache(bool useCacheForRerun) const
 {
-    // Creation of an instance of CacheSet with CacheParameters
+    // Creation of an instance of CacheSet (or CacheShardedSet) with CacheParameters
     // This must be done ONCE before accessing the singleton using NOMAD::CacheBase::getInstance()
     try
     {
@@ -764,9 +805,17 @@ void NOMAD::MainStep::createCache(bool useCacheForRerun) const
     }
     catch (...)
     {
-        NOMAD::CacheSet::setInstance(_allParams->getCacheParams(),
-                                     _allParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE"),
-                                     _allParams->getAttributeValue<NOMAD::ArrayOfDouble>("BB_EVAL_FORMAT"));
+        const auto cacheParams = _allParams->getCacheParams();
+        const auto bbOutputType = _allParams->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE);
+        const auto bbEvalFormat = _allParams->getAttributeValue(NOMAD::Attr::BB_EVAL_FORMAT);
+        if ("SHARDED" == cacheParams->getAttributeValue(NOMAD::Attr::CACHE_TYPE))
+        {
+            NOMAD::CacheShardedSet::setInstance(cacheParams, bbOutputType, bbEvalFormat);
+        }
+        else
+        {
+            NOMAD::CacheSet::setInstance(cacheParams, bbOutputType, bbEvalFormat);
+        }
         if (useCacheForRerun)
         {
             // Swap cache and cacheForRerun
@@ -780,7 +829,7 @@ void NOMAD::MainStep::createCache(bool useCacheForRerun) const
 void NOMAD::MainStep::updateX0sFromCacheAndFromLHSInit() const
 {
     // Update X0s, if needed.
-    auto x0s = _allParams->getPbParams()->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+    auto x0s = _allParams->getPbParams()->getAttributeValue(NOMAD::Attr::X0);
 
     bool updatedX0s = false;
 
@@ -797,12 +846,12 @@ void NOMAD::MainStep::updateX0sFromCacheAndFromLHSInit() const
             std::vector<NOMAD::EvalPoint> evalPointList;
             // Note: We are working in full dimension here, not in subproblem.
             // For this reason, use cache instance directly, not CacheInterface.
-            auto fixedVariable = _allParams->getAttributeValue<NOMAD::Point>("FIXED_VARIABLE");
-            auto hNormType = _allParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+            auto fixedVariable = _allParams->getAttributeValue(NOMAD::Attr::FIXED_VARIABLE);
+            auto hNormType = _allParams->getAttributeValue(NOMAD::Attr::H_NORM);
             NOMAD::FHComputeType computeType;
             
             // Create a compute for BB or for SURROGATE (when doint surrogate optim).
-            bool surrogateAsBB = _allParams->getAttributeValue<bool>("EVAL_SURROGATE_OPTIMIZATION");
+            bool surrogateAsBB = _allParams->getAttributeValue(NOMAD::Attr::EVAL_SURROGATE_OPTIMIZATION);
             if (surrogateAsBB)
             {
                 computeType = { NOMAD::EvalType::SURROGATE , {NOMAD::ComputeType::STANDARD, hNormType,  NOMAD::defaultEmptySingleOutputCompute /* not used*/}};
@@ -818,7 +867,7 @@ void NOMAD::MainStep::updateX0sFromCacheAndFromLHSInit() const
                                                           computeType);
             if (evalPointList.empty())
             {
-                auto hMax = _allParams->getRunParams()->getAttributeValue<NOMAD::Double>("H_MAX_0");
+                auto hMax = _allParams->getRunParams()->getAttributeValue(NOMAD::Attr::H_MAX_0);
                 NOMAD::CacheBase::getInstance()->findBestInf(evalPointList,
                                                              hMax, fixedVariable,
                                                              computeType);
@@ -832,8 +881,8 @@ void NOMAD::MainStep::updateX0sFromCacheAndFromLHSInit() const
     }
 
     // Complete X0 with LHS sampled points
-    auto lhSearchType = _runParams->getAttributeValue<NOMAD::LHSearchType>("LH_SEARCH");
-    auto fixedVariables = _pbParams->getAttributeValue<NOMAD::Point>("FIXED_VARIABLE");
+    auto lhSearchType = _runParams->getAttributeValue(NOMAD::Attr::LH_SEARCH);
+    auto fixedVariables = _pbParams->getAttributeValue(NOMAD::Attr::FIXED_VARIABLE);
     bool canUseLH = (lhSearchType.isEnabled() && lhSearchType.getNbInitial() > 0);
     if (canUseLH)
     {
@@ -894,6 +943,7 @@ void NOMAD::MainStep::displayUsage( const char* exeName )
       + "Info           : " + strExeName + " -i\n" \
       + "Help           : " + strExeName + " -h [keyword]\n" \
       + "Version        : " + strExeName + " -v\n" \
+      + "Binary history : " + strExeName + " -bh history_file\n" \
       + "Usage          : " + strExeName + " -u\n\n";
 
     NOMAD::OutputQueue::Add(usage, NOMAD::OutputLevel::LEVEL_ERROR);
@@ -994,6 +1044,53 @@ void NOMAD::MainStep::displayCSVDoc()
     _allParams->displayCSVDoc( std::cout );
 }
 
+
+void NOMAD::MainStep::displayBinaryHistory(const std::string& fileName) const
+{
+    NOMAD::BinaryHistoryReader reader(fileName);
+    NOMAD::BinaryHistoryRecord record;
+
+    // The file may be large: format with snprintf and write large blocks.
+    const std::string undefStr = NOMAD::Double::getUndefStr();
+    std::string text;
+    char buf[32];
+    auto appendValue = [&](double v)
+    {
+        if (std::isnan(v))
+        {
+            text += undefStr;
+        }
+        else
+        {
+            text.append(buf, std::snprintf(buf, sizeof(buf), "%.17g", v));
+        }
+        text += ' ';
+    };
+
+    while (reader.next(record))
+    {
+        for (const double v : record.x)
+        {
+            appendValue(v);
+        }
+        for (const double v : record.bbo)
+        {
+            appendValue(v);
+        }
+        text += NOMAD::enumStr(static_cast<NOMAD::EvalStatusType>(record.evalStatus));
+        text += ' ' + NOMAD::itos(record.threadNum) + ' ';
+        text.append(buf, std::snprintf(buf, sizeof(buf), "%.6f", record.time));
+        text += '\n';
+
+        if (text.size() > (1 << 20))
+        {
+            std::cout << text;
+            text.clear();
+        }
+    }
+    std::cout << text << std::flush;
+}
+
 // What to do when user interrupts NOMAD
 void NOMAD::MainStep::hotRestartOnUserInterrupt()
 {
@@ -1079,6 +1176,11 @@ void NOMAD::MainStep::resetComponentsBetweenOptimization()
     // Reset SubproblemManager map
     NOMAD::SubproblemManager::getInstance()->reset();
 
+#ifdef USE_SGTELIB
+    // Forget the quadratic models kept between iterations
+    NOMAD::QuadModelManager::getInstance()->reset();
+#endif
+
     // Reset evaluator control
     NOMAD::EvcInterface::resetEvaluatorControl();
 
@@ -1105,7 +1207,7 @@ void NOMAD::MainStep::resetEvaluatorControl()
 void NOMAD::MainStep::displayDetailedStats() const
 {
     // Display detailed stats
-    std::string evalStatsFile = _allParams->getAttributeValue<std::string>("EVAL_STATS_FILE");
+    std::string evalStatsFile = _allParams->getAttributeValue(NOMAD::Attr::EVAL_STATS_FILE);
 
     if (evalStatsFile.empty() || evalStatsFile == "-")
     {
@@ -1114,10 +1216,8 @@ void NOMAD::MainStep::displayDetailedStats() const
 
     NOMAD::ArrayOfString s1,s2;
 
-#ifndef TIME_STATS
     s1.add("Total real time (s):");
     s2.add(std::to_string(NOMAD::Clock::getTimeSinceStart()));
-#endif
 
     s1.add("Blackbox evaluations:");
     size_t bbEval = NOMAD::EvcInterface::getEvaluatorControl()->getBbEval();
@@ -1190,71 +1290,6 @@ void NOMAD::MainStep::displayDetailedStats() const
         s2.add(NOMAD::itos(nbRevealingIter));
     }
 
-#ifdef TIME_STATS
-    s1.add("");
-    s2.add("");
-
-    s1.add("Time statistics (s)");
-    s2.add("");
-
-    s1.add("Total real time:");
-    s2.add(std::to_string(NOMAD::Clock::getTimeSinceStart()));
-
-    s1.add("Total CPU time:");
-    s2.add(std::to_string(_totalCPUTime));
-
-    s1.add("Total time in Evaluator:");
-    s2.add(std::to_string(NOMAD::EvcInterface::getEvaluatorControl()->getEvalTime()));
-
-    s1.add("Total time in Mads Iterations:");
-    s2.add(std::to_string(NOMAD::MadsIteration::getIterTime()));
-
-    s1.add("Total time in Search:");
-    s2.add(std::to_string(NOMAD::MadsIteration::getSearchTime())
-        +" (Eval: "
-        + std::to_string(NOMAD::MadsIteration::getSearchEvalTime())
-        +")");
-
-    s1.add("Total time in Poll:");
-    s2.add(std::to_string(NOMAD::MadsIteration::getPollTime())
-          +" (Eval: "
-          + std::to_string(NOMAD::MadsIteration::getPollEvalTime())
-          +")");
-
-    std::vector<double> searchTime = NOMAD::Search::getSearchTime();
-    std::vector<double> searchEvalTime = NOMAD::Search::getSearchEvalTime();
-    s1.add("Total time in Speculative Search:");
-    s2.add(std::to_string(searchTime[0])
-          + " (Eval: "
-          + std::to_string(searchEvalTime[0])
-          + ")");
-
-    s1.add("Total time in User Search:");
-    s2.add(std::to_string(searchTime[1])
-          + " (Eval: "
-          + std::to_string(searchEvalTime[1])
-          + ")");
-
-    s1.add("Total time in Sgtelib Search:");
-    s2.add(std::to_string(searchTime[2])
-          + " (Eval: "
-          + std::to_string(searchEvalTime[2])
-          + ")");
-
-    s1.add("Total time in LH Search:");
-    s2.add(std::to_string(searchTime[3])
-          + " (Eval: "
-          + std::to_string(searchEvalTime[3])
-          + ")");
-
-    s1.add("Total time in NM Search:");
-    s2.add(std::to_string(searchTime[4])
-          + " (Eval: "
-          + std::to_string(searchEvalTime[4])
-          + ")");
-
-#endif // TIME_STATS
-
     NOMAD::ArrayOfString paddedStats = NOMAD::ArrayOfString::combineAndAddPadding(s1,s2);
     std::ofstream evalStatsStream;
     // Open eval stats file and clear it (trunc)
@@ -1269,7 +1304,7 @@ void NOMAD::MainStep::displayDetailedStats() const
 
 void NOMAD::MainStep::writeFinalSolutionFile() const
 {
-    if (_allParams->getAttributeValue<bool>("SOLUTION_FILE_FINAL"))
+    if (_allParams->getAttributeValue(NOMAD::Attr::SOLUTION_FILE_FINAL))
     {
         // Enable solution file that was disabled at start
         NOMAD::OutputDirectToFile::getInstance()->enableSolutionFile();
@@ -1320,11 +1355,11 @@ void NOMAD::MainStep::addEvaluator(const EvaluatorPtr& ev)
     }
 
     if (NOMAD::EvalType::SURROGATE == evalTypeAdded &&
-        NOMAD::EvalSortType::SURROGATE != _allParams->getAttributeValue<NOMAD::EvalSortType>("EVAL_QUEUE_SORT") )
+        NOMAD::EvalSortType::SURROGATE != _allParams->getAttributeValue(NOMAD::Attr::EVAL_QUEUE_SORT) )
     {
-        if ( ! _allParams->getAttributeValue<bool>("VNS_MADS_SEARCH") ||
-            ( _allParams->getAttributeValue<bool>("VNS_MADS_SEARCH") &&
-             ! _allParams->getAttributeValue<bool>("VNS_MADS_SEARCH_WITH_SURROGATE") ) )
+        if ( ! _allParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH) ||
+            ( _allParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH) &&
+             ! _allParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH_WITH_SURROGATE) ) )
         {
             std::cout << "Warning: A SURROGATE evaluator is available but it will not be used. To use it, set EVAL_QUEUE_SORT to SURROGATE or set VNS_MADS_SEARCH_WITH_SURROGATE." << std::endl;
         }
@@ -88,12 +88,6 @@ protected:
     std::vector<EvaluatorPtr>           _evaluators; ///<  Can be used in library running mode (not batch mode). Keep evaluators for convenience when constructing evaluator control. See addEvaluator function.
     std::vector<std::shared_ptr<Algorithm>>  _algos;
 
-#ifdef TIME_STATS
-    size_t _totalRealTime;
-    double _startTime;
-    double _totalCPUTime;
-#endif // TIME_STATS
-
 public:
     /// Constructor
     explicit MainStep()
@@ -103,11 +97,6 @@ public:
 #ifdef USE_IBEX
         ,_set(nullptr)
 #endif
-#ifdef TIME_STATS
-        ,_totalRealTime(0),
-        _startTime(0.0),
-        _totalCPUTime(0.0)
-#endif // TIME_STATS
     {
         init();
     }
@@ -183,6 +172,12 @@ public:
     /// Helper to display all parameters in a CSV format to be included in doc.
     void displayCSVDoc();
 
+    /// Helper to display a binary history file (parameter HISTORY_FILE_BINARY) as text.
+    /**
+     One line per evaluation: the point, the blackbox outputs, the evaluation status, the thread and the time.
+     */
+    void displayBinaryHistory(const std::string& fileName) const;
+
     /**
      The user has requested a hot restart. Update the parameters with the changes requested by the user (read file or set inline).
      */
@@ -260,6 +255,9 @@ private:
 
     ///  Detailed stats
     void displayDetailedStats() const;
+
+    /// Stop the profiler and write the profile files, if enabled
+    void writeProfile() const;
     
     /// Final solution file
     void writeFinalSolutionFile() const;
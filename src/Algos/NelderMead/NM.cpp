@@ -79,7 +79,7 @@ bool NOMAD::NM::runImp()
 
         std::shared_ptr<NOMAD::BarrierBase> barrier = nullptr;
         
-        auto nmOpt = _runParams->getAttributeValue<bool>("NM_OPTIMIZATION");
+        auto nmOpt = _runParams->getAttributeValue(NOMAD::Attr::NM_OPTIMIZATION);
 
         if (nmOpt)
         {
@@ -139,10 +139,10 @@ void NOMAD::NM::readInformationForHotRestart()
     // For this, we need to read some files.
     // Note: Cache file is treated independently of hot restart file.
 
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         // Verify the files exist and are readable.
-        const std::string& hotRestartFile = _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE");
+        const std::string& hotRestartFile = _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE);
         if (NOMAD::checkReadFile(hotRestartFile))
         {
             std::cout << "Read hot restart file " << hotRestartFile << std::endl;
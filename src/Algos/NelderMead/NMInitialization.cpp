@@ -80,7 +80,7 @@ void NOMAD::NMInitialization::startImp()
     {
         // If needed, generate trial points and put them in cache to form simplex
         // For a standalone optimization (NM_OPTIMIZATION true), initial trial points must be generated to form a valid simplex around x0. Otherwise, the cache will be used to construct the simplex.
-        auto nm_opt = _runParams->getAttributeValue<bool>("NM_OPTIMIZATION");
+        auto nm_opt = _runParams->getAttributeValue(NOMAD::Attr::NM_OPTIMIZATION);
         if ( nm_opt && ! checkCacheCanFormSimplex() )
         {
             generateTrialPoints();
@@ -100,7 +100,7 @@ void NOMAD::NMInitialization::endImp()
         std::vector<NOMAD::EvalPoint> evalPointList;
         std::copy(_trialPoints.begin(), _trialPoints.end(),
                           std::back_inserter(evalPointList));
-        const auto& hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+        const auto& hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
         _barrier = std::make_shared<NOMAD::ProgressiveBarrier>(hMax,
                                 NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this),
                                 NOMAD::EvcInterface::getEvaluatorControl()->getCurrentEvalType(),
@@ -113,7 +113,7 @@ void NOMAD::NMInitialization::endImp()
 bool NOMAD::NMInitialization::checkCacheCanFormSimplex()
 {
     // Complete this function: see Issue #393
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     if ( NOMAD::CacheBase::getInstance()->size() < n+1 )
         return false;
     return false;
@@ -124,7 +124,7 @@ bool NOMAD::NMInitialization::checkCacheCanFormSimplex()
 void NOMAD::NMInitialization::generateTrialPointsImp()
 {
     NOMAD::Point x0 = _pbParams->getAttributeValue<NOMAD::Point>("X0");
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
 
     if (!x0.isComplete() || x0.size() != n)
     {
@@ -106,7 +106,7 @@ bool NOMAD::NMInitializeSimplex::createSimplex()
     if (nullptr != barrier)
     {
         evalPointList = barrier->getAllPoints();
-        centerPt = std::make_shared<NOMAD::EvalPoint>(evalPointList[0]);
+        centerPt = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPointList[0]);
    
         // Check consistence for compute type between evaluator and barrier
         barrier->checkForFHComputeType(completeComputeType);
@@ -125,12 +125,12 @@ bool NOMAD::NMInitializeSimplex::createSimplex()
     _nmY->clear();
 
     // The pb params handle only variables (no need to consider fixed variables)
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     size_t minYSize = n + 1;
 
     // compute the include radius: points in Y must be at
     // a max distance of centerPt
-    auto includeLength = _runParams->getAttributeValue<NOMAD::Double>("NM_SIMPLEX_INCLUDE_LENGTH");
+    auto includeLength = _runParams->getAttributeValue(NOMAD::Attr::NM_SIMPLEX_INCLUDE_LENGTH);
     NOMAD::ArrayOfDouble includeRectangle(n, includeLength ) ;
 
     NOMAD::OutputInfo dbgInfo(getName(),"Insertion of potential points to include in initial Y: ", NOMAD::OutputLevel::LEVEL_DEBUG);
@@ -138,7 +138,7 @@ bool NOMAD::NMInitializeSimplex::createSimplex()
     // If a mesh and include factor are supplied: the max distance is included factor times Delta
     // Else we use include length
     auto mesh = iter->getMesh(); // The mesh can be null
-    auto includeFactor = _runParams->getAttributeValue<size_t>("NM_SIMPLEX_INCLUDE_FACTOR");
+    auto includeFactor = _runParams->getAttributeValue(NOMAD::Attr::NM_SIMPLEX_INCLUDE_FACTOR);
     if ( mesh != nullptr && includeFactor > 0 && includeFactor < NOMAD::INF_SIZE_T )
     {
         // The max distance is NM_search_include_factor times Delta
@@ -62,8 +62,8 @@ void NOMAD::NMIteration::init()
     
     if (nullptr != _runParams)
     {
-        _nmOpt = _runParams->getAttributeValue<bool>("NM_OPTIMIZATION");
-        _nmSearchStopOnSuccess = _runParams->getAttributeValue<bool>("NM_SEARCH_STOP_ON_SUCCESS");
+        _nmOpt = _runParams->getAttributeValue(NOMAD::Attr::NM_OPTIMIZATION);
+        _nmSearchStopOnSuccess = _runParams->getAttributeValue(NOMAD::Attr::NM_SEARCH_STOP_ON_SUCCESS);
     }
     
 }
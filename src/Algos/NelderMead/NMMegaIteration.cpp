@@ -92,7 +92,7 @@ void NOMAD::NMMegaIteration::startImp()
         if (nullptr != bestXFeas)
         {
             _nmIteration = std::make_shared<NOMAD::NMIteration>(this,
-                                    std::make_shared<NOMAD::EvalPoint>(*bestXFeas),
+                                    NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*bestXFeas),
                                     _k,
                                     mesh);
             _k++;
@@ -100,7 +100,7 @@ void NOMAD::NMMegaIteration::startImp()
         else if (nullptr != bestXInf)
         {
             _nmIteration = std::make_shared<NOMAD::NMIteration>(this,
-                                    std::make_shared<NOMAD::EvalPoint>(*bestXInf),
+                                    NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*bestXInf),
                                     _k,
                                     mesh);
             _k++;
@@ -61,14 +61,14 @@ void NOMAD::NMReflective::init()
     // The pb params handle only variables (fixed variables are not considered)
     if (nullptr != _pbParams)
     {
-        _n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+        _n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
         
-        _lb = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-        _ub = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+        _lb = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+        _ub = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
         
-        _deltaE = _runParams->getAttributeValue<NOMAD::Double>("NM_DELTA_E");
-        _deltaIC = _runParams->getAttributeValue<NOMAD::Double>("NM_DELTA_IC");
-        _deltaOC = _runParams->getAttributeValue<NOMAD::Double>("NM_DELTA_OC");
+        _deltaE = _runParams->getAttributeValue(NOMAD::Attr::NM_DELTA_E);
+        _deltaIC = _runParams->getAttributeValue(NOMAD::Attr::NM_DELTA_IC);
+        _deltaOC = _runParams->getAttributeValue(NOMAD::Attr::NM_DELTA_OC);
     }
 
     if ( _deltaE <= 1 )
@@ -80,8 +80,8 @@ void NOMAD::NMReflective::init()
     if ( _deltaIC > 0 )
         throw NOMAD::Exception(__FILE__,__LINE__,"Delta value deltaIC not compatible with inside contraction");
 
-    auto nmOptimization = _runParams->getAttributeValue<bool>("NM_OPTIMIZATION");
-    auto nmSearchRankEps = _runParams->getAttributeValue<NOMAD::Double>("NM_SEARCH_RANK_EPS");
+    auto nmOptimization = _runParams->getAttributeValue(NOMAD::Attr::NM_OPTIMIZATION);
+    auto nmSearchRankEps = _runParams->getAttributeValue(NOMAD::Attr::NM_SEARCH_RANK_EPS);
     _rankEps = ( nmOptimization ) ? NOMAD::DEFAULT_EPSILON:nmSearchRankEps;
     
     verifyParentNotNull();
@@ -244,7 +244,7 @@ void NOMAD::NMReflective::generateTrialPointsImp()
     auto barrier = getMegaIterationBarrier();
     if (nullptr != barrier)
     {
-        pointFrom = std::make_shared<NOMAD::EvalPoint>(*barrier->getFirstPoint()); // !!!! Do not use directly barrier EvalPoint Ptr. Instead, make a copy.
+        pointFrom = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*barrier->getFirstPoint()); // !!!! Do not use directly barrier EvalPoint Ptr. Instead, make a copy.
         xt.setPointFrom(pointFrom, NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
     }
 
@@ -56,7 +56,7 @@ void NOMAD::NMShrink::init()
     setStepType(NOMAD::StepType::NM_SHRINK);
     _currentStepType = NOMAD::StepType::NM_SHRINK; 
 
-    _gamma = _runParams->getAttributeValue<NOMAD::Double>("NM_GAMMA");
+    _gamma = _runParams->getAttributeValue(NOMAD::Attr::NM_GAMMA);
 
     if ( _gamma <= 0.0 || _gamma > 1 )
         throw NOMAD::Exception(__FILE__,__LINE__,"Gamma value not compatible with shrink");
@@ -108,7 +108,7 @@ void NOMAD::NMShrink::endImp()
 void NOMAD::NMShrink::generateTrialPointsImp ()
 {
 
-    auto n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
 
     OUTPUT_INFO_START
     AddOutputInfo("Shrink simplex with " + getName() +" (gamma=" + _gamma.tostring() +") with " + std::to_string(_nmY->size()) + " points.");
@@ -70,7 +70,7 @@ void NOMAD::PSDMads::init(const std::vector<NOMAD::EvaluatorPtr> &evaluators,
     // Get the evaluator control
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
     
-    auto blockSize = evc->getEvaluatorControlGlobalParams()->getAttributeValue<size_t>("BB_MAX_BLOCK_SIZE");
+    auto blockSize = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::BB_MAX_BLOCK_SIZE);
     if (blockSize > 1)
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "PSD-Mads: eval points blocks are not supported.");
@@ -92,7 +92,7 @@ void NOMAD::PSDMads::init(const std::vector<NOMAD::EvaluatorPtr> &evaluators,
     // Initialize all the main threads we will need.
     // The main threads will be the ones with thread numbers 0-(nbMainThreads-1).
     // Main thread 0 is already added to EvaluatorControl at its creation.
-    size_t nbMainThreads = _runParams->getAttributeValue<size_t>("PSD_MADS_NB_SUBPROBLEM");
+    size_t nbMainThreads = _runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_NB_SUBPROBLEM);
     for (int mainThreadNum = 1; mainThreadNum < (int)nbMainThreads; mainThreadNum++)
     {
         auto subProblemEvalContParams = std::make_unique<NOMAD::EvaluatorControlParameters>(*evalContParams);
@@ -129,7 +129,7 @@ bool NOMAD::PSDMads::runImp()
     bool terminateAll = false;
     size_t k = _masterMegaIteration->getK(); // The iteration counter for the master mega iteration. Should be zero!
 
-    size_t t = _runParams->getAttributeValue<size_t>("PSD_MADS_NB_SUBPROBLEM");
+    size_t t = _runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_NB_SUBPROBLEM);
 
     ///< Lock access to some elements when they are updated.
     omp_lock_t psdMadsLock;
@@ -151,6 +151,7 @@ bool NOMAD::PSDMads::runImp()
             auto barrier = _barrier->clone();                      // Barrier points are not transferred during clone.
             auto success = _masterMegaIteration->getSuccessType(); 
 
+            // Attribute name: NOMAD::Attr identifiers would have to be listed in the default(none) clause.
             NOMAD::Point fixedVariable(_pbParams->getAttributeValue<size_t>("DIMENSION"));
             if (!isPollster)
             {
@@ -259,21 +260,21 @@ void NOMAD::PSDMads::endImp()
 // - Not implemented: if a certain number of mads has been executed.
 bool NOMAD::PSDMads::doUpdateMesh() const
 {
-    if (_runParams->getAttributeValue<bool>("PSD_MADS_ORIGINAL"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_ORIGINAL))
     {
         // Behave like the NOMAD 3 version of PSD-Mads, i.e, always update mesh.
         return true;
     }
 
     bool doUpdate = false;
-    auto coverage = _runParams->getAttributeValue<NOMAD::Double>("PSD_MADS_SUBPROBLEM_PERCENT_COVERAGE");
+    auto coverage = _runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_SUBPROBLEM_PERCENT_COVERAGE);
     coverage /= 100.0;
 
     int nbRemaining = 0;
 
     nbRemaining = (int)_randomPickup.getN();
 
-    if (_lastMadsSuccessful && _runParams->getAttributeValue<bool>("PSD_MADS_ITER_OPPORTUNISTIC"))
+    if (_lastMadsSuccessful && _runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_ITER_OPPORTUNISTIC))
     {
         doUpdate = true;
         OUTPUT_INFO_START
@@ -281,10 +282,10 @@ bool NOMAD::PSDMads::doUpdateMesh() const
         OUTPUT_INFO_END
     }
     // Coverage: a % of variables must have been covered.
-    else if (nbRemaining < (1.0 - coverage.todouble()) * _pbParams->getAttributeValue<size_t>("DIMENSION"))
+    else if (nbRemaining < (1.0 - coverage.todouble()) * _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION))
     {
         OUTPUT_INFO_START
-        NOMAD::Double pctCov = 100.0 - ((100.0 * nbRemaining) / _pbParams->getAttributeValue<size_t>("DIMENSION"));
+        NOMAD::Double pctCov = 100.0 - ((100.0 * nbRemaining) / _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION));
         std::string s = pctCov.tostring() + "% of variables were covered by subproblems. Update mesh.";
         AddOutputInfo(s);
         OUTPUT_INFO_END
@@ -299,7 +300,7 @@ void NOMAD::PSDMads::generateSubproblem(NOMAD::Point &fixedVariable)
     // Setup fixedVariable to define subproblem.
 
     // The fixed variables of the subproblem are set to the value of best point, the remaining variables are undefined.
-    const auto nbVariablesInSubproblem = _runParams->getAttributeValue<size_t>("PSD_MADS_NB_VAR_IN_SUBPROBLEM");
+    const auto nbVariablesInSubproblem = _runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_NB_VAR_IN_SUBPROBLEM);
     if (nbVariablesInSubproblem >= fixedVariable.size())
     {
         throw NOMAD::Exception(__FILE__, __LINE__, "PSD-Mads: NB var in subproblem cannot be greater or equal to the overall dimension.");
@@ -84,7 +84,7 @@ public:
                      const std::shared_ptr<RunParameters>& runParams,
                      const std::shared_ptr<PbParameters>& refPbParams)
       : Algorithm(parentStep, stopReasons, runParams, std::make_shared<PbParameters>(*refPbParams)),
-        _randomPickup(_pbParams->getAttributeValue<size_t>("DIMENSION")),
+        _randomPickup(_pbParams->getAttributeValue(Attr::DIMENSION)),
         _psdMainMesh(nullptr),
         _barrier(nullptr),
         _lastMadsSuccessful(false)
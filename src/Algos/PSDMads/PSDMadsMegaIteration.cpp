@@ -66,8 +66,8 @@ void NOMAD::PSDMadsMegaIteration::startImp()
     bool isPollster = (0 == NOMAD::getThreadNum());
 
     // Set parameters for subproblems
-    auto subProblemPbParams = std::make_shared<NOMAD::PbParameters>(*_pbParams);
-    auto subProblemRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams);
+    auto subProblemPbParams = std::make_shared<NOMAD::PbParameters>(*_pbParams, NOMAD::ParametersOverlay());
+    auto subProblemRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams, NOMAD::ParametersOverlay());
     setupSubproblemParams(subProblemPbParams, subProblemRunParams, isPollster);
 
     // Create Mads for this subproblem
@@ -155,22 +155,22 @@ void NOMAD::PSDMadsMegaIteration::setupSubproblemParams(std::shared_ptr<NOMAD::P
     if (isPollster)
     {
         subProblemRunParams->setAttributeValue("DIRECTION_TYPE", NOMAD::DirectionType::SINGLE);
-        subProblemPbParams->setAttributeValue("INITIAL_FRAME_SIZE", mainFrameSize);
+        subProblemPbParams->setAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE, mainFrameSize);
 
         // Disable all searches
-        subProblemRunParams->setAttributeValue("LH_SEARCH", NOMAD::LHSearchType("0 0"));
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::LH_SEARCH, NOMAD::LHSearchType("0 0"));
 
-        subProblemRunParams->setAttributeValue("NM_SEARCH", false);
-        subProblemRunParams->setAttributeValue("QUAD_MODEL_SEARCH", false);
-        subProblemRunParams->setAttributeValue("SGTELIB_MODEL_SEARCH", false);
-        subProblemRunParams->setAttributeValue("SPECULATIVE_SEARCH", false);
-        subProblemRunParams->setAttributeValue("VNS_MADS_SEARCH", false);  // VNS has static member. Problematic with threads.
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::NM_SEARCH, false);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH, false);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH, false);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::SPECULATIVE_SEARCH, false);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH, false);  // VNS has static member. Problematic with threads.
         
     }
     else
     {
         auto initialFrameSize = _mainMesh->getDeltaFrameSizeCoarser();
-        subProblemPbParams->setAttributeValue("INITIAL_FRAME_SIZE", initialFrameSize);
+        subProblemPbParams->setAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE, initialFrameSize);
 
         // The main frame size is used as minFrameSize for the subproblem.
         // Initial and min must be compatible -> adjust.
@@ -181,21 +181,21 @@ void NOMAD::PSDMadsMegaIteration::setupSubproblemParams(std::shared_ptr<NOMAD::P
                 OUTPUT_INFO_START
                 AddOutputInfo("Set initial frame size to main frame size.");
                 OUTPUT_INFO_END
-                subProblemPbParams->setAttributeValue("INITIAL_FRAME_SIZE", mainFrameSize);
+                subProblemPbParams->setAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE, mainFrameSize);
                 break;
             }
         }
 
         // Issue #685. Force some algo settings. Need to test more thoroughly what give the best results
-        subProblemRunParams->setAttributeValue("NM_SEARCH", false);
-        subProblemRunParams->setAttributeValue("QUAD_MODEL_SEARCH", false);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::NM_SEARCH, false);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH, false);
         
         subProblemRunParams->setAttributeValue("DIRECTION_TYPE",NOMAD::DirectionType::ORTHO_2N);
         
-        subProblemPbParams->setAttributeValue("FIXED_VARIABLE", _fixedVariable);
+        subProblemPbParams->setAttributeValue(NOMAD::Attr::FIXED_VARIABLE, _fixedVariable);
         subProblemPbParams->setAttributeValue("X0", _x0);
-        subProblemPbParams->setAttributeValue("MIN_FRAME_SIZE", mainFrameSize);
-        subProblemRunParams->setAttributeValue("PSD_MADS_NB_VAR_IN_SUBPROBLEM", _fixedVariable.size() - _fixedVariable.nbDefined());
+        subProblemPbParams->setAttributeValue(NOMAD::Attr::MIN_FRAME_SIZE, mainFrameSize);
+        subProblemRunParams->setAttributeValue(NOMAD::Attr::PSD_MADS_NB_VAR_IN_SUBPROBLEM, _fixedVariable.size() - _fixedVariable.nbDefined());
     }
 
     // Set max number of bb evals per subproblem.
@@ -206,8 +206,8 @@ void NOMAD::PSDMadsMegaIteration::setupSubproblemParams(std::shared_ptr<NOMAD::P
     }
     else
     {
-        size_t totalBudget = evc->getEvaluatorControlGlobalParams()->getAttributeValue<size_t>("MAX_BB_EVAL");
-        size_t nbSubproblem = _runParams->getAttributeValue<size_t>("PSD_MADS_NB_SUBPROBLEM");
+        size_t totalBudget = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::MAX_BB_EVAL);
+        size_t nbSubproblem = _runParams->getAttributeValue(NOMAD::Attr::PSD_MADS_NB_SUBPROBLEM);
         size_t budgetPerSubproblem = (totalBudget-1) / nbSubproblem;
         size_t maxBbEvalInSubproblem = evc->getMaxBbEvalInSubproblem();
         if (budgetPerSubproblem < maxBbEvalInSubproblem)
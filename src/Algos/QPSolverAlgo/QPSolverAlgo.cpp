@@ -63,7 +63,7 @@ void NOMAD::QPSolverAlgo::init()
 {
     setStepType(NOMAD::StepType::ALGORITHM_QPSOLVER);
 
-    bool qpsolverAlgoOpt = _runParams->getAttributeValue<bool>("QP_OPTIMIZATION"); // true if standalone
+    bool qpsolverAlgoOpt = _runParams->getAttributeValue(NOMAD::Attr::QP_OPTIMIZATION); // true if standalone
     
     if (!qpsolverAlgoOpt)
     {
@@ -89,8 +89,8 @@ bool NOMAD::QPSolverAlgo::runImp()
         {
             // Barrier constructor automatically finds the best points in the cache.
             
-            auto hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
-            auto hNormType = _runParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+            auto hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
+            auto hNormType = _runParams->getAttributeValue(NOMAD::Attr::H_NORM);
             
             // Compute type for this optim
             FHComputeTypeS computeType; // Default from struct initializer
@@ -143,10 +143,10 @@ void NOMAD::QPSolverAlgo::readInformationForHotRestart()
     // For this, we need to read some files.
     // Note: Cache file is treated independently from hot restart file.
 
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         // Verify the files exist and are readable.
-        const std::string& hotRestartFile = _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE");
+        const std::string& hotRestartFile = _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE);
         if (NOMAD::checkReadFile(hotRestartFile))
         {
             std::cout << "Read hot restart file " << hotRestartFile << std::endl;
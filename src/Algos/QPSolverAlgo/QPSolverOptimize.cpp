@@ -81,14 +81,14 @@ void NOMAD::QPSolverOptimize::init()
     
     // Get the model box size limit.
     // Compare with the actual model bounds to enable or not the search at start
-    _modelBoxSizeLimit = _runParams->getAttributeValue<NOMAD::Double>("QP_SEARCH_MODEL_BOX_SIZE_LIMIT");
+    _modelBoxSizeLimit = _runParams->getAttributeValue(NOMAD::Attr::QP_SEARCH_MODEL_BOX_SIZE_LIMIT);
     
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
-    _bbot = evc->getCurrentEvalParams()->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+    _bbot = evc->getCurrentEvalParams()->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE);
     _m = static_cast<int>(_bbot.size());
     _nbCons = static_cast<int>(getNbConstraints(_bbot));
     
-    _quadModelMaxEval = evc->getEvaluatorControlGlobalParams()->getAttributeValue<size_t>("QUAD_MODEL_MAX_EVAL");
+    _quadModelMaxEval = evc->getEvaluatorControlGlobalParams()->getAttributeValue(NOMAD::Attr::QUAD_MODEL_MAX_EVAL);
 
     if ( _modelFixedVar.nbDefined() == _modelFixedVar.size() )
     {
@@ -126,15 +126,15 @@ void NOMAD::QPSolverOptimize::init()
         OUTPUT_INFO_END
     }
     
-    _verbose = _runParams->getAttributeValue<bool>("QP_verbose");
-    _verboseFull = _runParams->getAttributeValue<bool>("QP_verboseFull");
+    _verbose = _runParams->getAttributeValue(NOMAD::Attr::QP_VERBOSE);
+    _verboseFull = _runParams->getAttributeValue(NOMAD::Attr::QP_VERBOSEFULL);
     
 }
 
 
 void NOMAD::QPSolverOptimize::startImp()
 {
-    auto modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+    auto modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
     _displayLevel = (std::string::npos != modelDisplay.find("O"))
         ? NOMAD::OutputLevel::LEVEL_INFO
         : NOMAD::OutputLevel::LEVEL_DEBUGDEBUG;
@@ -308,10 +308,10 @@ void NOMAD::QPSolverOptimize::generateTrialPointsImp()
         const double condHessian = (sing_val_min > 0) ? svdHLag.max() / sing_val_min : NOMAD::INF;
 
         // Fix tolerances
-        const auto tolMesh = _runParams->getAttributeValue<Double>("QP_tolMesh").todouble();
-        const auto tolCond = _runParams->getAttributeValue<Double>("QP_tolCond").todouble();
-        auto atol =_runParams->getAttributeValue<Double>("QP_absoluteTol").todouble();
-        auto rtol = _runParams->getAttributeValue<Double>("QP_relativeTol").todouble();
+        const auto tolMesh = _runParams->getAttributeValue(NOMAD::Attr::QP_TOLMESH).todouble();
+        const auto tolCond = _runParams->getAttributeValue(NOMAD::Attr::QP_TOLCOND).todouble();
+        auto atol =_runParams->getAttributeValue(NOMAD::Attr::QP_ABSOLUTETOL).todouble();
+        auto rtol = _runParams->getAttributeValue(NOMAD::Attr::QP_RELATIVETOL).todouble();
         if (MeshSize > 0)
         {
             atol = std::min(atol, MeshSize * tolMesh);
@@ -325,22 +325,22 @@ void NOMAD::QPSolverOptimize::generateTrialPointsImp()
         const double ng0 = ng;
         const double tol = atol + ng0 * rtol;
 
-        const auto maxIter = static_cast<int>(_runParams->getAttributeValue<size_t>("QP_maxIter"));
-        const auto tolDistDX = _runParams->getAttributeValue<Double>("QP_tolDistDX").todouble();
+        const auto maxIter = static_cast<int>(_runParams->getAttributeValue(NOMAD::Attr::QP_MAXITER));
+        const auto tolDistDX = _runParams->getAttributeValue(NOMAD::Attr::QP_TOLDISTDX).todouble();
 
         // Parameters specific to augmented Lagrangian
-        const auto mu0 = _runParams->getAttributeValue<Double>("QP_AugLag_mu0").todouble();
-        const auto muDecrease = _runParams->getAttributeValue<Double>("QP_AugLag_muDecrease").todouble();
+        const auto mu0 = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_MU0).todouble();
+        const auto muDecrease = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_MUDECREASE).todouble();
 
-        const auto eta0 = _runParams->getAttributeValue<Double>("QP_AugLag_eta0").todouble();
-        const auto omega0 = _runParams->getAttributeValue<Double>("QP_AugLag_omega0").todouble();
+        const auto eta0 = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_ETA0).todouble();
+        const auto omega0 = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_OMEGA0).todouble();
 
-        const auto successRatio = _runParams->getAttributeValue<Double>("QP_AugLag_successRatio").todouble();
-        const auto maxIterInner = _runParams->getAttributeValue<size_t>("QP_AugLag_maxIterInner");
-        const auto tolDistDXInner = _runParams->getAttributeValue<Double>("QP_AugLag_tolDistDXInner").todouble();
-        const auto maxSuccessiveFail = _runParams->getAttributeValue<size_t>("QP_AugLag_maxSuccessivFail");
+        const auto successRatio = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_SUCCESSRATIO).todouble();
+        const auto maxIterInner = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_MAXITERINNER);
+        const auto tolDistDXInner = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_TOLDISTDXINNER).todouble();
+        const auto maxSuccessiveFail = _runParams->getAttributeValue(NOMAD::Attr::QP_AUGLAG_MAXSUCCESSIVFAIL);
 
-        const auto SelectAlgo = _runParams->getAttributeValue<size_t>("QP_SelectAlgo");
+        const auto SelectAlgo = _runParams->getAttributeValue(NOMAD::Attr::QP_SELECTALGO);
         if (SelectAlgo == 0)
         {
             _verbose && std::cout << "Run solveAugLag (n=" << _n << ", m=" << _nbCons << ")" << std::endl;
@@ -481,7 +481,7 @@ void NOMAD::QPSolverOptimize::setModelBoundsAndFixedVar()
     // When optWithScaleBounds is true, the training set is scaled with some generating directions. Warning: points are not necessarily in [0,1]^n
     const SGTELIB::Matrix & X = _trainingSet->get_matrix_X();
     
-    _n = static_cast<int>(_pbParams->getAttributeValue<size_t>("DIMENSION"));
+    _n = static_cast<int>(_pbParams->getAttributeValue(NOMAD::Attr::DIMENSION));
     
     if (_n != X.get_nb_cols())
     {
@@ -564,7 +564,7 @@ void NOMAD::QPSolverOptimize::setModelBoundsAndFixedVar()
     {
         // Detect the model center of the bounds
         // Scale the bounds around the model center
-        const auto reduction_factor = _runParams->getAttributeValue<NOMAD::Double>("QUAD_MODEL_SEARCH_BOUND_REDUCTION_FACTOR");
+        const auto reduction_factor = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH_BOUND_REDUCTION_FACTOR);
         for (int j = 0; j < nbDim; j++)
         {
             NOMAD::Double lb = _modelLowerBound[j];
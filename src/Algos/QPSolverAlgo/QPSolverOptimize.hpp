@@ -108,10 +108,10 @@ public:
       : Step(parentStep),
       QuadModelIterationUtils (parentStep),
         _displayLevel(OutputLevel::LEVEL_DEBUG),
-        _modelLowerBound(refPbParams->getAttributeValue<size_t>("DIMENSION"), Double()),
-        _modelUpperBound(refPbParams->getAttributeValue<size_t>("DIMENSION"), Double()),
-        _modelFixedVar(refPbParams->getAttributeValue<size_t>("DIMENSION"), Double()),
-        _modelCenter(refPbParams->getAttributeValue<size_t>("DIMENSION"), Double()),
+        _modelLowerBound(refPbParams->getAttributeValue(Attr::DIMENSION), Double()),
+        _modelUpperBound(refPbParams->getAttributeValue(Attr::DIMENSION), Double()),
+        _modelFixedVar(refPbParams->getAttributeValue(Attr::DIMENSION), Double()),
+        _modelCenter(refPbParams->getAttributeValue(Attr::DIMENSION), Double()),
         _refPbParams(refPbParams),
         _optPbParams(nullptr),
         _optWithScaledBounds(optWithScaledBounds),
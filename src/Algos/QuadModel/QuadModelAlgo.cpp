@@ -85,7 +85,7 @@ bool NOMAD::QuadModelAlgo::runImp()
         auto barrier = _initialization->getBarrier();
         if (nullptr == barrier)
         {
-            auto hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+            auto hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
             
             // Create a single objective progressive barrier
             barrier = std::make_shared<NOMAD::ProgressiveBarrier>(hMax,
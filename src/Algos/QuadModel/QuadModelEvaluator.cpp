@@ -47,6 +47,7 @@
 
 #include "../../Algos/QuadModel/QuadModelEvaluator.hpp"
 #include "../../Output/OutputQueue.hpp"
+#include "../../Util/Profiler.hpp"
 
 // Destructor
 NOMAD::QuadModelEvaluator::~QuadModelEvaluator() = default;
@@ -108,7 +109,7 @@ std::vector<bool> NOMAD::QuadModelEvaluator::eval_block(NOMAD::Block &block,
     {
         for (auto& evPt : block)
         {
-            evPt = std::make_shared<NOMAD::EvalPoint>(evPt->makeSubSpacePointFromFixed(_fixedVariable));
+            evPt = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evPt->makeSubSpacePointFromFixed(_fixedVariable));
         }
     }
     
@@ -122,6 +123,9 @@ std::vector<bool> NOMAD::QuadModelEvaluator::eval_block(NOMAD::Block &block,
     SGTELIB::Matrix M_predict (  "M_predict", static_cast<int>(m), static_cast<int>(_nbModels));
     SGTELIB::Matrix X_predict("X_predict", static_cast<int>(m), static_cast<int>(n));
 
+    // The displays of each point are only built when they are shown.
+    const bool display = NOMAD::OutputQueue::GoodLevel(_displayLevel);
+
     int j = 0;
     for (auto it = block.begin(); it != block.end(); it++, j++)
     {
@@ -130,8 +134,11 @@ std::vector<bool> NOMAD::QuadModelEvaluator::eval_block(NOMAD::Block &block,
             throw NOMAD::Exception(__FILE__, __LINE__, "Evaluator: Incomplete point " + (*it)->display());
         }
 
-        std::string s = "X" + itos(j) +" =" + (*it)->display();
-        NOMAD::OutputQueue::Add(s, _displayLevel);
+        if (display)
+        {
+            std::string s = "X" + itos(j) +" =" + (*it)->display();
+            NOMAD::OutputQueue::Add(s, _displayLevel);
+        }
 
         // Set the input matrix
         for (size_t i = 0; i < (*it)->size(); i++)
@@ -152,6 +159,7 @@ std::vector<bool> NOMAD::QuadModelEvaluator::eval_block(NOMAD::Block &block,
 #pragma omp critical(SgtelibEvalBlock)
 #endif // _OPENMP
     {
+        NOMAD_PROFILE_SCOPE("QuadModelEvaluator::predict");
         _model->check_ready(__FILE__,__FUNCTION__,__LINE__);
 
         _model->predict(X_predict, &M_predict);
@@ -162,22 +170,25 @@ std::vector<bool> NOMAD::QuadModelEvaluator::eval_block(NOMAD::Block &block,
     // Verify all points are completely defined
     for (auto it = block.begin(); it != block.end(); it++, j++)
     {
-        std::string s = "X" + itos(j) +": " + (*it)->display();
-        NOMAD::OutputQueue::Add(s, _displayLevel);
-        // ====================================== //
-        // Output display                    //
-        // ====================================== //
-        std::string sObj = "F = ";
-        std::string sCons = "C = [ ";
-        for (size_t i = 0; i < _nbModels; i++)
+        if (display)
         {
-            if (_bbOutputTypeList[i] != NOMAD::BBOutputType::OBJ)
-                sCons += std::to_string(M_predict.get(j,static_cast<int>(i))) + " ";
-            else
-                sObj  += std::to_string(M_predict.get(j,static_cast<int>(i))) + " ";
+            std::string s = "X" + itos(j) +": " + (*it)->display();
+            NOMAD::OutputQueue::Add(s, _displayLevel);
+            // ====================================== //
+            // Output display                    //
+            // ====================================== //
+            std::string sObj = "F = ";
+            std::string sCons = "C = [ ";
+            for (size_t i = 0; i < _nbModels; i++)
+            {
+                if (_bbOutputTypeList[i] != NOMAD::BBOutputType::OBJ)
+                    sCons += std::to_string(M_predict.get(j,static_cast<int>(i))) + " ";
+                else
+                    sObj  += std::to_string(M_predict.get(j,static_cast<int>(i))) + " ";
+            }
+            s = sObj + ((_nbConstraints>0 ) ? sCons+" ]":"") ;
+            NOMAD::OutputQueue::Add(s, _displayLevel);
         }
-        s = sObj + ((_nbConstraints>0 ) ? sCons+" ]":"") ;
-        NOMAD::OutputQueue::Add(s, _displayLevel);
 
         // ====================================== //
         // Application of the formulation         //
@@ -207,7 +218,7 @@ std::vector<bool> NOMAD::QuadModelEvaluator::eval_block(NOMAD::Block &block,
     {
         for (auto& evPt : block)
         {
-            evPt = std::make_shared<NOMAD::EvalPoint>(evPt->makeFullSpacePointFromFixed(_fixedVariable));
+            evPt = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evPt->makeFullSpacePointFromFixed(_fixedVariable));
         }
     }
     
@@ -112,8 +112,8 @@ bool NOMAD::QuadModelInitialization::runImp()
 // The name generateTrialPoints is not well suited here because we use provided X0s and check provided cache.
 void NOMAD::QuadModelInitialization::generateTrialPointsImp()
 {
-    auto x0s = _pbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto x0s = _pbParams->getAttributeValue(NOMAD::Attr::X0);
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     bool validX0available = false;
     std::string err;
 
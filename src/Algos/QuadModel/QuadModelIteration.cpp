@@ -47,9 +47,9 @@
 
 #include "../../Algos/QuadModel/QuadModelAlgo.hpp"
 #include "../../Algos/QuadModel/QuadModelIteration.hpp"
+#include "../../Algos/QuadModel/QuadModelManager.hpp"
 #include "../../Algos/QuadModel/QuadModelOptimize.hpp"
 #include "../../Algos/QuadModel/QuadModelUpdate.hpp"
-#include "../../../ext/sgtelib/src/Surrogate_Factory.hpp"
 
 
 void NOMAD::QuadModelIteration::init()
@@ -65,14 +65,12 @@ void NOMAD::QuadModelIteration::init()
         nbModels = NOMAD::getNbConstraints(bbot) + 1;
     }
 
-    // Init the TrainingSet
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
-    SGTELIB::Matrix empty_X("empty_X", 0, static_cast<int>(n));
-    SGTELIB::Matrix empty_Z("empty_Z", 0, static_cast<int>(nbModels));
-    _trainingSet = std::make_shared<SGTELIB::TrainingSet>(empty_X, empty_Z);
-
-    // The quadratic model is from Sgtelib
-    _model = std::shared_ptr<SGTELIB::Surrogate>(SGTELIB::Surrogate_Factory(*_trainingSet, "TYPE PRS RIDGE 0"));
+    // Get the TrainingSet and the quadratic model (from Sgtelib).
+    // They are kept by the manager between iterations: the training set
+    // contains the points of a previous iteration, and the update only adds
+    // and removes the points that changed.
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
+    NOMAD::QuadModelManager::getInstance()->getQuadModel(n, nbModels, _trainingSet, _model);
     
     if (!_trialPoints.empty())
     {
@@ -0,0 +1,133 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include "../../Algos/QuadModel/QuadModelManager.hpp"
+#include "../../../ext/sgtelib/src/Surrogate_Factory.hpp"
+
+// Initialize singleton
+std::unique_ptr<NOMAD::QuadModelManager> NOMAD::QuadModelManager::_single=nullptr;
+
+
+#ifdef _OPENMP
+omp_lock_t NOMAD::QuadModelManager::_entriesLock;
+#endif
+
+void NOMAD::QuadModelManager::init()
+{
+#ifdef _OPENMP
+    omp_init_lock(&_entriesLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::QuadModelManager::destroy()
+{
+#ifdef _OPENMP
+    omp_destroy_lock(&_entriesLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::QuadModelManager::getQuadModel(const size_t n,
+                                           const size_t nbModels,
+                                           std::shared_ptr<SGTELIB::TrainingSet> & trainingSet,
+                                           std::shared_ptr<SGTELIB::Surrogate> & model)
+{
+#ifdef _OPENMP
+    omp_set_lock(&_entriesLock);
+#endif // _OPENMP
+
+    // Look for an available entry with the same dimensions.
+    // An entry is available when the manager holds the only copies of its pointers.
+    // The copies are made before the lock is released.
+    bool found = false;
+    for (const auto & entry : _entries)
+    {
+        if (entry._n == n && entry._nbModels == nbModels
+            && 1 == entry._model.use_count() && 1 == entry._trainingSet.use_count())
+        {
+            trainingSet = entry._trainingSet;
+            model = entry._model;
+            found = true;
+            break;
+        }
+    }
+
+    if (!found)
+    {
+        // Empty training set
+        SGTELIB::Matrix empty_X("empty_X", 0, static_cast<int>(n));
+        SGTELIB::Matrix empty_Z("empty_Z", 0, static_cast<int>(nbModels));
+        trainingSet = std::make_shared<SGTELIB::TrainingSet>(empty_X, empty_Z);
+
+        // Keep the scaling of the points from one build to the next, as long
+        // as it suits the points. The PRS model can then update its normal
+        // equations instead of computing them again.
+        trainingSet->set_keep_scaling(true);
+
+        // The quadratic model is from Sgtelib
+        model = std::shared_ptr<SGTELIB::Surrogate>(SGTELIB::Surrogate_Factory(*trainingSet, "TYPE PRS RIDGE 0"));
+
+        _entries.push_back({n, nbModels, trainingSet, model});
+    }
+
+#ifdef _OPENMP
+    omp_unset_lock(&_entriesLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::QuadModelManager::reset()
+{
+#ifdef _OPENMP
+    omp_set_lock(&_entriesLock);
+#endif // _OPENMP
+    _entries.clear();
+#ifdef _OPENMP
+    omp_unset_lock(&_entriesLock);
+#endif // _OPENMP
+}
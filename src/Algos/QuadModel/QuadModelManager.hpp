@@ -0,0 +1,152 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+#ifndef __NOMAD_4_5_QUAD_MODEL_MANAGER__
+#define __NOMAD_4_5_QUAD_MODEL_MANAGER__
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+#include <memory>
+#include <vector>
+
+#include "../../nomad_platform.hpp"
+#include "../../../ext/sgtelib/src/Surrogate.hpp"
+#include "../../../ext/sgtelib/src/TrainingSet.hpp"
+
+#include "../../nomad_nsbegin.hpp"
+
+
+/// Class to keep the quadratic models and their training sets between iterations
+/**
+ Each QuadModelIteration gets its training set and its quadratic model from
+ the manager. When the iteration is done, they return to the manager with the
+ points of the iteration. The next iteration with the same dimensions gets
+ them back: QuadModelUpdate only adds the points that entered the selection
+ box and removes the ones that left it (SGTELIB::TrainingSet::update_points),
+ and the PRS model updates its normal equations with these points.
+
+ A training set and its model are given to one iteration at a time: they are
+ available again when no one else holds the model or the training set.
+ */
+class QuadModelManager
+{
+private:
+
+    /// A training set and the quadratic model built on it
+    struct QuadModelEntry
+    {
+        size_t _n;          ///< Dimension of the points
+        size_t _nbModels;   ///< Number of outputs modeled
+        std::shared_ptr<SGTELIB::TrainingSet>   _trainingSet;
+        std::shared_ptr<SGTELIB::Surrogate>     _model;
+    };
+
+    std::vector<QuadModelEntry> _entries;
+
+#ifdef _OPENMP
+    DLL_ALGO_API static omp_lock_t _entriesLock;
+#endif // _OPENMP
+
+    DLL_ALGO_API static std::unique_ptr<QuadModelManager> _single; ///< The singleton
+
+    /// Constructor
+    explicit QuadModelManager()
+    {
+        init();
+    }
+
+    /// Helper for constructor
+    void init();
+
+    /// Helper for destructor
+    void destroy();
+
+public:
+
+    static const std::unique_ptr<QuadModelManager> & getInstance()
+    {
+        if (_single == nullptr)
+        {
+            _single = std::unique_ptr<NOMAD::QuadModelManager>(new QuadModelManager()) ;
+        }
+        return _single;
+    }
+
+    /// Destructor
+    virtual ~QuadModelManager()
+    {
+        destroy();
+    }
+
+    /// Copy constructor not available
+    QuadModelManager ( QuadModelManager const & ) = delete;
+
+    /// Operator= not available
+    QuadModelManager & operator= ( QuadModelManager const & ) = delete;
+
+    /// Get a training set and a quadratic model for points of dimension n and nbModels outputs.
+    /**
+     The training set contains the points of the last iteration that used it (empty if it is new).
+     \param n           Dimension of the points -- \b IN.
+     \param nbModels    Number of outputs modeled -- \b IN.
+     \param trainingSet The training set -- \b OUT.
+     \param model       The quadratic model on the training set -- \b OUT.
+     */
+    void getQuadModel(const size_t n,
+                      const size_t nbModels,
+                      std::shared_ptr<SGTELIB::TrainingSet> & trainingSet,
+                      std::shared_ptr<SGTELIB::Surrogate> & model);
+
+    /// Forget all training sets and models. Called before a new run.
+    void reset();
+
+};
+
+#include "../../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_QUAD_MODEL_MANAGER__
@@ -71,14 +71,14 @@ void NOMAD::QuadModelOptimize::init()
     
     // Flag to force change PB constraint to EB constraint for subproblem optim
     // EB constraints are faster to update in Mads Barrier.
-    _optWithEBConstraints =  _runParams->getAttributeValue<bool>("QUAD_MODEL_SEARCH_FORCE_EB");
+    _optWithEBConstraints =  _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH_FORCE_EB);
 
 }
 
 
 void NOMAD::QuadModelOptimize::startImp()
 {
-    const auto& modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+    const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
     _displayLevel = (std::string::npos != modelDisplay.find("O"))
         ? NOMAD::OutputLevel::LEVEL_INFO
         : NOMAD::OutputLevel::LEVEL_DEBUGDEBUG;
@@ -86,7 +86,7 @@ void NOMAD::QuadModelOptimize::startImp()
     OUTPUT_INFO_START
     std::string s;
     auto evcParams = NOMAD::EvcInterface::getEvaluatorControl()->getEvaluatorControlGlobalParams();
-    s = "QUAD_MODEL_MAX_EVAL: " + std::to_string(evcParams->getAttributeValue<size_t>("QUAD_MODEL_MAX_EVAL"));
+    s = "QUAD_MODEL_MAX_EVAL: " + std::to_string(evcParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_MAX_EVAL));
     AddOutputInfo(s, _displayLevel);
     s = "BBOT: " + NOMAD::BBOutputTypeListToString(NOMAD::Algorithm::getBbOutputType());
     AddOutputInfo(s, _displayLevel);
@@ -140,7 +140,7 @@ void NOMAD::QuadModelOptimize::endImp()
 
 void NOMAD::QuadModelOptimize::setupRunParameters()
 {
-    _optRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams);
+    _optRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams, NOMAD::ParametersOverlay());
 
     _optRunParams->setAttributeValue("MEGA_SEARCH_POLL", false);
 
@@ -179,7 +179,7 @@ void NOMAD::QuadModelOptimize::setupRunParameters()
 
 void NOMAD::QuadModelOptimize::setupPbParameters()
 {
-    _optPbParams = std::make_shared<NOMAD::PbParameters>(*_refPbParams);
+    _optPbParams = std::make_shared<NOMAD::PbParameters>(*_refPbParams, NOMAD::ParametersOverlay());
     _optPbParams->setAttributeValue("LOWER_BOUND", _modelLowerBound);
     _optPbParams->setAttributeValue("UPPER_BOUND", _modelUpperBound);
     _optPbParams->setAttributeValue("FIXED_VARIABLE",_modelFixedVar);
@@ -258,7 +258,7 @@ void NOMAD::QuadModelOptimize::generateTrialPointsImp()
     // Needed when initial point of sub-opt is infeasible. If EB constraint is used, the barrier is empty -> exception. No phase one is done for this optimization.
     auto evalParams = std::make_shared<NOMAD::EvalParameters>(*(evc->getCurrentEvalParams()));
 
-    auto bbot = evc->getCurrentEvalParams()->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+    auto bbot = evc->getCurrentEvalParams()->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE);
     
     for (auto & sbbot : bbot)
     {
@@ -300,7 +300,7 @@ void NOMAD::QuadModelOptimize::generateTrialPointsImp()
 
 
     // Transform RPB constraint (used for some algorithms like DiscoMads) to PB constraint, as DiscoMADS is not used in sub optimization
-    if(_runParams->getAttributeValue<bool>("DISCO_MADS_OPTIMIZATION") && !_optRunParams->getAttributeValue<bool>("DISCO_MADS_OPTIMIZATION"))
+    if(_runParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_OPTIMIZATION) && !_optRunParams->getAttributeValue(NOMAD::Attr::DISCO_MADS_OPTIMIZATION))
     {
         auto it = std::find(bbot.begin(),bbot.end(), NOMAD::BBOutputType::RPB);
         if (it != bbot.end())
@@ -315,7 +315,7 @@ void NOMAD::QuadModelOptimize::generateTrialPointsImp()
     }
     evalParams->checkAndComply(_optRunParams, _optPbParams, evc->getEvaluatorControlGlobalParams(),  evc->getEvaluatorControlParams());
 
-    auto modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+    auto modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
 
     OUTPUT_INFO_START
     std::string s = "Create QuadModelEvaluator with fixed variable = ";
@@ -357,13 +357,13 @@ void NOMAD::QuadModelOptimize::generateTrialPointsImp()
 
     std::unique_ptr<NOMAD::Mads> mads;
     
-    if (_runParams->getAttributeValue<bool>("QUAD_MODEL_SEARCH_SIMPLE_MADS"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH_SIMPLE_MADS))
     {
         
         // Simple Mads for subproblem optimization has direct access to model outputs to compute f and h.
         // The way to compute f may change (for example DMultiMads). Let's pass the compute function from evaluator control.
         // For now, use this formula for max eval
-        size_t maxModelEval = _optPbParams->getAttributeValue<size_t>("DIMENSION")*800;
+        size_t maxModelEval = _optPbParams->getAttributeValue(NOMAD::Attr::DIMENSION)*800;
         if (maxModelEval > 8000)
         {
             maxModelEval = 8000;
@@ -404,8 +404,8 @@ void NOMAD::QuadModelOptimize::generateTrialPointsImp()
     else
     {
         // Get the best points in their reference dimension
-        _bestXFeas = std::make_shared<NOMAD::EvalPoint>(mads->getBestSolution(true));
-        _bestXInf  = std::make_shared<NOMAD::EvalPoint>(mads->getBestSolution(false));
+        _bestXFeas = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(mads->getBestSolution(true));
+        _bestXInf  = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(mads->getBestSolution(false));
         if (_bestXFeas->isComplete())
         {
             // New EvalPoint to be evaluated.
@@ -455,7 +455,7 @@ void NOMAD::QuadModelOptimize::setModelBoundsAndFixedVar()
     // Warning: points are not necessarily in [0,1]^n
     const SGTELIB::Matrix & X = _trainingSet->get_matrix_X();
 
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     if (n != (size_t)X.get_nb_cols())
     {
         throw NOMAD::Exception(__FILE__, __LINE__,
@@ -536,7 +536,7 @@ void NOMAD::QuadModelOptimize::setModelBoundsAndFixedVar()
     {
         // Detect the model center of the bounds
         // Scale the bounds around the model center
-        auto reduction_factor = _runParams->getAttributeValue<NOMAD::Double>("QUAD_MODEL_SEARCH_BOUND_REDUCTION_FACTOR");
+        auto reduction_factor = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_SEARCH_BOUND_REDUCTION_FACTOR);
         for (int j = 0; j < nbDim; j++)
         {
             lb = _modelLowerBound[j];
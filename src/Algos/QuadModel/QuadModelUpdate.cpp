@@ -52,6 +52,7 @@
 #include "../../Algos/QuadModel/QuadModelUpdate.hpp"
 #include "../../Cache/CacheBase.hpp"
 #include "../../Output/OutputQueue.hpp"
+#include "../../Util/Profiler.hpp"
 
 #include "../../../ext/sgtelib/src/Surrogate_PRS.hpp"
 
@@ -73,9 +74,9 @@ void NOMAD::QuadModelUpdate::init()
     _boxFactor = NOMAD::INF;
     if (nullptr != _pbParams)
     {
-        _boxFactor = _runParams->getAttributeValue<NOMAD::Double>("QUAD_MODEL_BOX_FACTOR");
+        _boxFactor = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_BOX_FACTOR);
     }
-    _n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    _n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
 
 
     // Fixed groups of variables.
@@ -256,75 +257,71 @@ bool NOMAD::QuadModelUpdate::runImp()
         // Use CacheInterface to ensure the points are converted to subspace
         NOMAD::CacheInterface cacheInterface(this);
 
-        // Get number of valid points in cache
-
-        std::vector<NOMAD::EvalPoint> evalPointListInCache;
+        // Get valid points in the box. The box is contained in the ball
+        // centered on the model center with radius half the box diagonal:
+        // use the cache spatial index on that ball.
         auto crit0 = [&](const NOMAD::EvalPoint& evalPoint){return this->isValidForUpdate(evalPoint);};
-        cacheInterface.find(crit0, evalPointListInCache, true /*find in subspace*/);
-        size_t nbMaxCache = evalPointListInCache.size();
-
+        auto critInBox = [&](const NOMAD::EvalPoint& evalPoint){return this->isValidForUpdate(evalPoint) && this->isValidForIncludeInModel(evalPoint);};
         evalPointList.clear();
-        for (const auto & evalPoint: evalPointListInCache)
+        cacheInterface.findWithinRadius(_modelCenter, getBoxHalfDiagonal(), critInBox, evalPointList);
+
+        const size_t nbEvalQuadTarget = 0.5*(_n+2)*(_n+1); // Best target to build a quadratic model
+        if (evalPointList.size() < nbEvalQuadTarget)
         {
-            if (isValidForIncludeInModel(evalPoint))
+            // Not enough points in the box. The box may be enlarged:
+            // get all valid points in cache.
+            std::vector<NOMAD::EvalPoint> evalPointListInCache;
+            cacheInterface.find(crit0, evalPointListInCache, true /*find in subspace*/);
+            size_t nbMaxCache = evalPointListInCache.size();
+
+            size_t nbEvalTarget = nbEvalQuadTarget;
+            if (nbMaxCache < nbEvalTarget)
             {
-                evalPointList.push_back(evalPoint);
+                nbEvalTarget = _n;  // Target to build at leat a linear model
             }
-        }
-
-
-        size_t nbEvalTarget = 0.5*(_n+2)*(_n+1); // Best target to build a quadratic model
-        if (nbMaxCache < nbEvalTarget)
-        {
-            nbEvalTarget = _n;  // Target to build at leat a linear model
-        }
-        if ( nbMaxCache >= nbEvalTarget )
-        {
-            size_t nbIncrease = 0;
-            while (nbIncrease < 20 && evalPointList.size() < nbEvalTarget)
+            if ( nbMaxCache >= nbEvalTarget )
             {
-                nbIncrease++;
-                _boxSize *= 2.0;
-                evalPointList.clear();
-                for (const auto & evalPoint: evalPointListInCache)
+                size_t nbIncrease = 0;
+                while (nbIncrease < 20 && evalPointList.size() < nbEvalTarget)
                 {
-                    if (isValidForIncludeInModel(evalPoint))
+                    nbIncrease++;
+                    _boxSize *= 2.0;
+                    evalPointList.clear();
+                    for (const auto & evalPoint: evalPointListInCache)
                     {
-                        evalPointList.push_back(evalPoint);
+                        if (isValidForIncludeInModel(evalPoint))
+                        {
+                            evalPointList.push_back(evalPoint);
+                        }
                     }
+                    OUTPUT_INFO_START
+                    s = "Enlarge box size to get more points: " + _boxSize.display();
+                    AddOutputInfo(s);
+                    OUTPUT_INFO_END
                 }
-                OUTPUT_INFO_START
-                s = "Enlarge box size to get more points: " + _boxSize.display();
-                AddOutputInfo(s);
-                OUTPUT_INFO_END
             }
         }
 
     }
 
     // Minimum and maximum number of valid points to build a model
-    const size_t minNbPoints = _runParams->getAttributeValue<size_t>("SGTELIB_MIN_POINTS_FOR_MODEL");
+    const size_t minNbPoints = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MIN_POINTS_FOR_MODEL);
     if (minNbPoints == NOMAD::INF_SIZE_T)
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"SGTELIB_MIN_POINTS_FOR_MODEL cannot be infinite.");
     }
 
-    const size_t maxNbPoints = _runParams->getAttributeValue<size_t>("SGTELIB_MAX_POINTS_FOR_MODEL");
+    const size_t maxNbPoints = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MAX_POINTS_FOR_MODEL);
 
     size_t nbValidPoints = evalPointList.size();
 
     // Keep the maxNbPoints points closest to the frame center
     if (nbValidPoints > maxNbPoints)
     {
-        // Sort the eval points list based on distance to model center
-        std::sort(evalPointList.begin(), evalPointList.end(),
-                  [&](const NOMAD::EvalPoint& x, const NOMAD::EvalPoint &y)
-                        {
-                            return NOMAD::Point::dist(*x.getX(),_modelCenter) < NOMAD::Point::dist(*y.getX(),_modelCenter) ;
-                        }
-                 );
-        // Keep only the first maxNbPoints elements of list
-        evalPointList.resize(maxNbPoints);
+        // Nearest valid points in the box, using the cache spatial index.
+        NOMAD::CacheInterface cacheInterface(this);
+        auto critInBox = [&](const NOMAD::EvalPoint& evalPoint){return this->isValidForUpdate(evalPoint) && this->isValidForIncludeInModel(evalPoint);};
+        cacheInterface.findKNearest(_modelCenter, maxNbPoints, critInBox, evalPointList);
 
         OUTPUT_INFO_START
         s = "QuadModel found " + std::to_string(nbValidPoints);
@@ -348,6 +345,9 @@ bool NOMAD::QuadModelUpdate::runImp()
         OUTPUT_INFO_START
         AddOutputInfo("QuadModel has not enough points to build model");
         OUTPUT_INFO_END
+
+        // The model may have been built by a previous iteration.
+        model->set_not_ready();
         return false;
     }
     OUTPUT_INFO_START
@@ -385,6 +385,7 @@ bool NOMAD::QuadModelUpdate::runImp()
         {
             s = "xNew = " + evalPoint.display() + " cannot be scaled";
             AddOutputInfo(s, OutputLevel::LEVEL_DEBUG);
+            model->set_not_ready();
             return false;
         }
         else
@@ -449,25 +450,40 @@ bool NOMAD::QuadModelUpdate::runImp()
         AddOutputInfo("Add points to training set...", _displayLevel);
         OUTPUT_INFO_END
 
-        trainingSet->partial_reset_and_add_points(*add_X, *add_Z);
+        // The training set may hold the points of a previous iteration (see
+        // QuadModelManager): only the points that changed are added or removed.
+        const int nbChanges = trainingSet->update_points(*add_X, *add_Z);
 
         OUTPUT_INFO_START
-        AddOutputInfo("OK.", _displayLevel);
-        AddOutputInfo("Build model from training set...", _displayLevel);
+        AddOutputInfo("OK. Points added or removed: " + std::to_string(nbChanges), _displayLevel);
         OUTPUT_INFO_END
 
-        if (model->build())
+        if (0 == nbChanges && model->is_ready())
         {
             OUTPUT_INFO_START
-            AddOutputInfo("OK.", _displayLevel);
+            AddOutputInfo("Training set unchanged. Keep model.", _displayLevel);
             OUTPUT_INFO_END
-
         }
         else
         {
+            NOMAD_PROFILE_SCOPE("QuadModelUpdate::build");
             OUTPUT_INFO_START
-            AddOutputInfo("Cannot build model.", _displayLevel);
+            AddOutputInfo("Build model from training set...", _displayLevel);
             OUTPUT_INFO_END
+
+            if (model->build())
+            {
+                OUTPUT_INFO_START
+                AddOutputInfo("OK.", _displayLevel);
+                OUTPUT_INFO_END
+
+            }
+            else
+            {
+                OUTPUT_INFO_START
+                AddOutputInfo("Cannot build model.", _displayLevel);
+                OUTPUT_INFO_END
+            }
         }
     }
 
@@ -503,6 +519,18 @@ bool NOMAD::QuadModelUpdate::isValidForIncludeInModel(const NOMAD::EvalPoint& ev
 
 }
 
+NOMAD::Double NOMAD::QuadModelUpdate::getBoxHalfDiagonal() const
+{
+    double d2 = 0.0;
+    for (size_t i = 0; i < _boxSize.size(); i++)
+    {
+        const double halfSize = 0.5 * _boxSize[i].todouble();
+        d2 += halfSize * halfSize;
+    }
+    return std::sqrt(d2);
+}
+
+
 bool NOMAD::QuadModelUpdate::isValidForUpdate(const NOMAD::EvalPoint& evalPoint) const
 {
     // Verify that the point is valid
@@ -125,6 +125,7 @@ private:
 
     bool isValidForUpdate(const EvalPoint& evalPoint) const; ///< Helper function for cache find.
     bool isValidForIncludeInModel(const EvalPoint& evalPoint) const; ///< Helper function for cache find.
+    Double getBoxHalfDiagonal() const; ///< Radius of the ball containing the box, for cache find.
     
     bool scalingByDirections( Point & x);
 
@@ -66,9 +66,9 @@ void NOMAD::SgtelibModel::init()
     setStepType(NOMAD::StepType::ALGORITHM_SGTELIB_MODEL);
     verifyParentNotNull();
 
-    auto modelFormulation = _runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION");
-    auto modelFeasibility = _runParams->getAttributeValue<NOMAD::SgtelibModelFeasibilityType>("SGTELIB_MODEL_FEASIBILITY");
-    auto modelDefinition = _runParams->getAttributeValue<NOMAD::ArrayOfString>("SGTELIB_MODEL_DEFINITION");
+    auto modelFormulation = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION);
+    auto modelFeasibility = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FEASIBILITY);
+    auto modelDefinition = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_DEFINITION);
 
     if (NOMAD::SgtelibModelFormulationType::EXTERN == modelFormulation)
     {
@@ -94,7 +94,7 @@ void NOMAD::SgtelibModel::init()
 
 
     // Init the TrainingSet
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     SGTELIB::Matrix empty_X("empty_X", 0, static_cast<int>(n));
     SGTELIB::Matrix empty_Z("empty_Z", 0, static_cast<int>(_nbModels));
     _trainingSet = std::make_shared<SGTELIB::TrainingSet>(empty_X, empty_Z);
@@ -137,7 +137,7 @@ bool NOMAD::SgtelibModel::isReady() const
 
     if (!retReady)
     {
-        auto modelFormulation = _runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION");
+        auto modelFormulation = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION);
         if (NOMAD::SgtelibModelFormulationType::EXTERN == modelFormulation)
         {
             // Extern model.
@@ -206,7 +206,7 @@ void NOMAD::SgtelibModel::info()
 // Update the bounds of the model.
 void NOMAD::SgtelibModel::setModelBounds(std::shared_ptr<SGTELIB::Matrix>& X)
 {
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     if (n != (size_t)X->get_nb_cols())
     {
         throw NOMAD::Exception(__FILE__, __LINE__,
@@ -268,7 +268,7 @@ NOMAD::EvalPointPtr NOMAD::SgtelibModel::getX0() const
 /*------------------------------------------------------------------------*/
 NOMAD::ArrayOfDouble NOMAD::SgtelibModel::getExtendedLowerBound() const
 {
-    auto extLowerBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
+    auto extLowerBound = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
 
     for (size_t i = 0; i < extLowerBound.size(); i++)
     {
@@ -285,7 +285,7 @@ NOMAD::ArrayOfDouble NOMAD::SgtelibModel::getExtendedLowerBound() const
 
 NOMAD::ArrayOfDouble NOMAD::SgtelibModel::getExtendedUpperBound() const
 {
-    auto extUpperBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+    auto extUpperBound = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
 
     for (size_t i = 0; i < extUpperBound.size(); i++)
     {
@@ -319,7 +319,7 @@ bool NOMAD::SgtelibModel::runImp()
         auto barrier = _initialization->getBarrier();
         if (nullptr == barrier)
         {
-            auto hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+            auto hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
             barrier = std::make_shared<NOMAD::ProgressiveBarrier>(hMax, NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this),
                                                        NOMAD::EvcInterface::getEvaluatorControl()->getCurrentEvalType(),
                                                        NOMAD::EvcInterface::getEvaluatorControl()->getFHComputeTypeS());
@@ -366,7 +366,7 @@ bool NOMAD::SgtelibModel::runImp()
 /*------------------------------------------------------------------------*/
 NOMAD::SgtelibModelFormulationType NOMAD::SgtelibModel::getFormulation() const
 {
-    auto formulation = _runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION");
+    auto formulation = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION);
     if ( (formulation != NOMAD::SgtelibModelFormulationType::EXTERN) && ( ! _ready) )
     {
         formulation = NOMAD::SgtelibModelFormulationType::D;
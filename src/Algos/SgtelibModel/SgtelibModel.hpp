@@ -110,8 +110,8 @@ public:
         _nbModels(0),
         _ready(false),
         _foundFeasible(false),
-        _modelLowerBound(pbParams->getAttributeValue<size_t>("DIMENSION"), Double()),
-        _modelUpperBound(pbParams->getAttributeValue<size_t>("DIMENSION"), Double()),
+        _modelLowerBound(pbParams->getAttributeValue(Attr::DIMENSION), Double()),
+        _modelUpperBound(pbParams->getAttributeValue(Attr::DIMENSION), Double()),
         _mesh(mesh)
     {
         init();
@@ -79,9 +79,16 @@ public:
     virtual ~SgtelibModelEvaluator();
 
     bool eval_x(EvalPoint &x,
-                const Double &NOMAD_UNUSED(hMax),
+                const Double &hMax,
                 bool &countEval) const override;
 
+    /**
+     Points for evaluations are given in a block. The model predicts the outputs of all the points of the block at once.
+     */
+    std::vector<bool> eval_block(Block &block,
+                                 const Double &NOMAD_UNUSED(hMax),
+                                 std::vector<bool> &countEval) const override;
+
 private:
     void init();
 
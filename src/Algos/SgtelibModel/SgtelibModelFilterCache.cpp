@@ -113,13 +113,13 @@ bool NOMAD::SgtelibModelFilterCache::runImp()
 {
     std::string s;  // Used for output
     size_t nbModelEval = _cacheModelEval.size();
-    auto modelFormulation = _runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION");
+    auto modelFormulation = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION);
 
     // Get used methods from parameter
     const size_t methodMax = 10;
     bool useMethod[methodMax] = { false };
     size_t nbMethods = 0;
-    std::string filterParam = _runParams->getAttributeValue<std::string>("SGTELIB_MODEL_SEARCH_FILTER");
+    std::string filterParam = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH_FILTER);
     for (size_t i = 0; i < methodMax; i++)
     {
         if (std::string::npos != filterParam.find(NOMAD::itos(i)))
@@ -271,7 +271,7 @@ void NOMAD::SgtelibModelFilterCache::endImp()
 
 void NOMAD::SgtelibModelFilterCache::computeInitialValues()
 {
-    auto modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+    auto modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
     _displayLevel = (std::string::npos != modelDisplay.find("F"))
                                             ? NOMAD::OutputLevel::LEVEL_INFO
                                             : NOMAD::OutputLevel::LEVEL_DEBUGDEBUG;
@@ -279,7 +279,7 @@ void NOMAD::SgtelibModelFilterCache::computeInitialValues()
     size_t nbModelEval = _cacheModelEval.size();
     std::string s;
 
-    auto hNormType = _runParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+    auto hNormType = _runParams->getAttributeValue(NOMAD::Attr::H_NORM);
     NOMAD::FHComputeType computeType = {NOMAD::EvalType::MODEL, {NOMAD::ComputeType::STANDARD, hNormType, defaultEmptySingleOutputCompute /* not used */}};
 
     // Compute values for _f, _h, _hmax, _DX, _DTX.
@@ -295,7 +295,7 @@ void NOMAD::SgtelibModelFilterCache::computeInitialValues()
         _hmax[i] = -NOMAD::INF;
         NOMAD::ArrayOfDouble bbo = x.getEval(NOMAD::EvalType::MODEL)->getBBOutput().getBBOAsArrayOfDouble();
         auto evalParams = NOMAD::EvcInterface::getEvaluatorControl()->getCurrentEvalParams();
-        const auto bbot = evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE");
+        const auto bbot = evalParams->getAttributeValue(NOMAD::Attr::BB_OUTPUT_TYPE);
         for (size_t j = 0; j < bbo.size(); j++)
         {
             if (bbot[j].isConstraint())
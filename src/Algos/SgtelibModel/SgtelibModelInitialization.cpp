@@ -92,8 +92,8 @@ void NOMAD::SgtelibModelInitialization::endImp()
 
 void NOMAD::SgtelibModelInitialization::validateX0s() const
 {
-    auto x0s = _pbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto x0s = _pbParams->getAttributeValue(NOMAD::Attr::X0);
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     bool validX0available = false;
     std::string err;
 
@@ -144,7 +144,7 @@ bool NOMAD::SgtelibModelInitialization::eval_x0s()
 {
     bool evalOk = false;
 
-    auto x0s = _pbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+    auto x0s = _pbParams->getAttributeValue(NOMAD::Attr::X0);
 
     validateX0s();
 
@@ -208,7 +208,7 @@ bool NOMAD::SgtelibModelInitialization::eval_x0s()
     if (evalOk)
     {
         // Construct progressive barrier using x0s
-        auto hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+        auto hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
         _barrier = std::make_shared<NOMAD::ProgressiveBarrier>(hMax,
                                 NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this),
                                 evc->getCurrentEvalType(),
@@ -131,8 +131,8 @@ void NOMAD::SgtelibModelMegaIteration::generateIterations()
     // The X0s will be set to all barrier xfeas and xinf by setupPbParameters().
     size_t k = _k;  // Main iteration counter
     // Note: NOMAD 3 uses SGTELIB_MODEL_TRIALS only.
-    size_t nbIter = _runParams->getAttributeValue<size_t>("MAX_ITERATION_PER_MEGAITERATION");
-    nbIter = std::min(nbIter, _runParams->getAttributeValue<size_t>("SGTELIB_MODEL_SEARCH_TRIALS"));
+    size_t nbIter = _runParams->getAttributeValue(NOMAD::Attr::MAX_ITERATION_PER_MEGAITERATION);
+    nbIter = std::min(nbIter, _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH_TRIALS));
 
     for (size_t iterCount = 0; iterCount < nbIter; iterCount++)
     {
@@ -254,7 +254,7 @@ void NOMAD::SgtelibModelMegaIteration::generateTrialPointsImp()
 void NOMAD::SgtelibModelMegaIteration::filterCache()
 {
     // Select additional candidates out of the cache
-    int nbCandidates = _runParams->getAttributeValue<int>("SGTELIB_MODEL_SEARCH_CANDIDATES_NB");
+    int nbCandidates = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH_CANDIDATES_NB);
     auto evcParams = NOMAD::EvcInterface::getEvaluatorControl()->getEvaluatorControlGlobalParams();
 
     if (nbCandidates < 0)
@@ -262,8 +262,8 @@ void NOMAD::SgtelibModelMegaIteration::filterCache()
         // Update nbCandidates.
         // Use the largest value: Either BB_MAX_BLOCK_SIZE, or 2 * DIMENSION.
         nbCandidates = static_cast<int>(std::max(
-                            evcParams->getAttributeValue<size_t>("BB_MAX_BLOCK_SIZE"),
-                            2 * _pbParams->getAttributeValue<size_t>("DIMENSION")));
+                            evcParams->getAttributeValue(NOMAD::Attr::BB_MAX_BLOCK_SIZE),
+                            2 * _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION)));
     }
 
     // We already have a certain number of points.
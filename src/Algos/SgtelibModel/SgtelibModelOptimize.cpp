@@ -68,7 +68,7 @@ void NOMAD::SgtelibModelOptimize::init()
 
 void NOMAD::SgtelibModelOptimize::startImp()
 {
-    const auto& modelDisplay = _runParams->getAttributeValue<std::string>("SGTELIB_MODEL_DISPLAY");
+    const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_DISPLAY);
     _displayLevel = (std::string::npos != modelDisplay.find("O"))
                         ? NOMAD::OutputLevel::LEVEL_INFO
                         : NOMAD::OutputLevel::LEVEL_DEBUGDEBUG;
@@ -76,11 +76,11 @@ void NOMAD::SgtelibModelOptimize::startImp()
     OUTPUT_INFO_START
     std::string s;
     auto evcParams = NOMAD::EvcInterface::getEvaluatorControl()->getEvaluatorControlGlobalParams();
-    s = "SGTELIB_MODEL_MAX_EVAL: " + std::to_string(evcParams->getAttributeValue<size_t>("SGTELIB_MODEL_MAX_EVAL"));
+    s = "SGTELIB_MODEL_MAX_EVAL: " + std::to_string(evcParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_MAX_EVAL));
     AddOutputInfo(s, _displayLevel);
     s = "BBOT: " + NOMAD::BBOutputTypeListToString(NOMAD::Algorithm::getBbOutputType());
     AddOutputInfo(s, _displayLevel);
-    s = "Formulation: " + NOMAD::SgtelibModelFormulationTypeToString(_runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION"));
+    s = "Formulation: " + NOMAD::SgtelibModelFormulationTypeToString(_runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION));
     AddOutputInfo(s, _displayLevel);
 
     std::ostringstream oss;
@@ -96,7 +96,7 @@ bool NOMAD::SgtelibModelOptimize::runImp()
     bool optimizeOk = false;
     std::string s;
 
-    auto modelFormulation = _runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION");
+    auto modelFormulation = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION);
     auto evc = NOMAD::EvcInterface::getEvaluatorControl();
 
     if (NOMAD::SgtelibModelFormulationType::EXTERN == modelFormulation)
@@ -113,10 +113,10 @@ bool NOMAD::SgtelibModelOptimize::runImp()
         evc->setOpportunisticEval(false);
         evc->setUseCache(false);
 
-        auto modelDisplay = _runParams->getAttributeValue<std::string>("SGTELIB_MODEL_DISPLAY");
-        auto diversification = _runParams->getAttributeValue<NOMAD::Double>("SGTELIB_MODEL_DIVERSIFICATION");
-        auto modelFeasibility = _runParams->getAttributeValue<NOMAD::SgtelibModelFeasibilityType>("SGTELIB_MODEL_FEASIBILITY");
-        double tc = _runParams->getAttributeValue<NOMAD::Double>("SGTELIB_MODEL_SEARCH_EXCLUSION_AREA").todouble();
+        auto modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_DISPLAY);
+        auto diversification = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_DIVERSIFICATION);
+        auto modelFeasibility = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FEASIBILITY);
+        double tc = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_SEARCH_EXCLUSION_AREA).todouble();
 
         if (nullptr == _modelAlgo)
         {
@@ -177,7 +177,7 @@ void NOMAD::SgtelibModelOptimize::endImp()
 
 void NOMAD::SgtelibModelOptimize::setupRunParameters()
 {
-    _optRunParams = std::make_shared<NOMAD::RunParameters>(*_refRunParams);
+    _optRunParams = std::make_shared<NOMAD::RunParameters>(*_refRunParams, NOMAD::ParametersOverlay());
 
     // Ensure there is no model used in model optimization.
     _optRunParams->setAttributeValue("SGTELIB_MODEL_SEARCH", false);
@@ -191,7 +191,7 @@ void NOMAD::SgtelibModelOptimize::setupRunParameters()
     _optRunParams->setAttributeValue("ANISOTROPIC_MESH", false);
 
     auto evcParams = NOMAD::EvcInterface::getEvaluatorControl()->getEvaluatorControlGlobalParams();
-    std::string lhstr = std::to_string(int(evcParams->getAttributeValue<size_t>("SGTELIB_MODEL_MAX_EVAL") * 0.3));
+    std::string lhstr = std::to_string(int(evcParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_MAX_EVAL) * 0.3));
     lhstr += " 0";
     NOMAD::LHSearchType lhSearch(lhstr);
     _optRunParams->setAttributeValue("LH_SEARCH", lhSearch);
@@ -209,7 +209,7 @@ void NOMAD::SgtelibModelOptimize::setupRunParameters()
 void NOMAD::SgtelibModelOptimize::setupPbParameters(const NOMAD::ArrayOfDouble& lowerBound,
                                                     const NOMAD::ArrayOfDouble& upperBound)
 {
-    _optPbParams = std::make_shared<NOMAD::PbParameters>(*_refPbParams);
+    _optPbParams = std::make_shared<NOMAD::PbParameters>(*_refPbParams, NOMAD::ParametersOverlay());
 
     _optPbParams->setAttributeValue("LOWER_BOUND", lowerBound);
     _optPbParams->setAttributeValue("UPPER_BOUND", upperBound);
@@ -230,7 +230,7 @@ void NOMAD::SgtelibModelOptimize::setupPbParameters(const NOMAD::ArrayOfDouble&
     _optPbParams->resetToDefaultValue("VARIABLE_GROUP");
     
     // Access to h norm type
-    auto hNormType = _refRunParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+    auto hNormType = _refRunParams->getAttributeValue(NOMAD::Attr::H_NORM);
     
     // Find best points (MODEL evals) and use them as X0s to optimize models.
     NOMAD::FHComputeType computeType = {NOMAD::EvalType::MODEL, {NOMAD::ComputeType::STANDARD, hNormType, defaultEmptySingleOutputCompute /* not used */}};
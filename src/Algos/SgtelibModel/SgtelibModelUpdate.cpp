@@ -54,6 +54,7 @@
 #include "../../Output/OutputQueue.hpp"
 #include "../../Type/SgtelibModelFeasibilityType.hpp"
 #include "../../Type/SgtelibModelFormulationType.hpp"
+#include "../../Util/Profiler.hpp"
 
 
 NOMAD::SgtelibModelUpdate::~SgtelibModelUpdate() = default;
@@ -77,7 +78,7 @@ std::string NOMAD::SgtelibModelUpdate::getName() const
 
 void NOMAD::SgtelibModelUpdate::startImp()
 {
-    const auto& modelDisplay = _runParams->getAttributeValue<std::string>("SGTELIB_MODEL_DISPLAY");
+    const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_DISPLAY);
     _displayLevel = (std::string::npos != modelDisplay.find("U"))
     ? NOMAD::OutputLevel::LEVEL_INFO
     : NOMAD::OutputLevel::LEVEL_DEBUGDEBUG;
@@ -98,8 +99,8 @@ bool NOMAD::SgtelibModelUpdate::runImp()
     bool updateDone = true;
     std::string s;  // Used for output
 
-    auto modelFeasibility = _runParams->getAttributeValue<NOMAD::SgtelibModelFeasibilityType>("SGTELIB_MODEL_FEASIBILITY");
-    auto modelFormulation = _runParams->getAttributeValue<NOMAD::SgtelibModelFormulationType>("SGTELIB_MODEL_FORMULATION");
+    auto modelFeasibility = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FEASIBILITY);
+    auto modelFormulation = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_FORMULATION);
 
     auto modelAlgo = getParentOfType<NOMAD::SgtelibModel*>();
     if (nullptr == modelAlgo)
@@ -108,7 +109,7 @@ bool NOMAD::SgtelibModelUpdate::runImp()
         throw NOMAD::Exception(__FILE__, __LINE__, s);
     }
 
-    auto n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     const auto bbot = NOMAD::Algorithm::getBbOutputType();
     size_t nbConstraints = NOMAD::getNbConstraints(bbot);
     size_t nbModels = NOMAD::SgtelibModel::getNbModels(modelFeasibility, nbConstraints);
@@ -141,23 +142,16 @@ bool NOMAD::SgtelibModelUpdate::runImp()
     // 1- Get relevant points in cache, around current frame centers.
     //
     std::vector<NOMAD::EvalPoint> evalPointList;
-    if (NOMAD::EvcInterface::getEvaluatorControl()->getUseCache())
-    {
-        // Get valid points: notably, they have a BB evaluation.
-        // Use CacheInterface to ensure the points are converted to subspace
-        NOMAD::CacheInterface cacheInterface(this);
-        cacheInterface.find(validForUpdate, evalPointList);
-    }
 
     // Minimum and maximum number of valid points to build a model
-    const size_t minNbPoints = _runParams->getAttributeValue<size_t>("SGTELIB_MIN_POINTS_FOR_MODEL");
+    const size_t minNbPoints = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MIN_POINTS_FOR_MODEL);
     if (minNbPoints == NOMAD::INF_SIZE_T)
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"SGTELIB_MIN_POINTS_FOR_MODEL cannot be infinite.");
     }
     
     // Not using SGTELIB_MAX_POINTS_FOR_MODEL, see below.
-    //const size_t maxNbPoints = _runParams->getAttributeValue<size_t>("SGTELIB_MAX_POINTS_FOR_MODEL");
+    //const size_t maxNbPoints = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MAX_POINTS_FOR_MODEL);
 
     // Select valid points that are close enough to frame centers
     // Compute distances that must not be violated for each variable.
@@ -168,33 +162,58 @@ bool NOMAD::SgtelibModelUpdate::runImp()
         radius = modelAlgo->getMesh()->getDeltaFrameSize();
     }
     // Multiply by radius parameter
-    auto radiusFactor = _runParams->getAttributeValue<NOMAD::Double>("SGTELIB_MODEL_RADIUS_FACTOR");
+    auto radiusFactor = _runParams->getAttributeValue(NOMAD::Attr::SGTELIB_MODEL_RADIUS_FACTOR);
     radius *= radiusFactor;
 
+    // The box of half-size radius around a center is contained in the ball
+    // of radius the norm of radius. Use the cache spatial index on that ball.
+    double ballRadius2 = 0.0;
+    for (size_t i = 0; i < radius.size(); i++)
+    {
+        ballRadius2 += radius[i].todouble() * radius[i].todouble();
+    }
+    const NOMAD::Double ballRadius = std::sqrt(ballRadius2);
+
     // Get all frame centers
     auto megaIter = getParentOfType<NOMAD::SgtelibModelMegaIteration*>();
     auto allCenters = megaIter->getBarrier()->getAllPoints();
     size_t nbCenters = allCenters.size();
-    std::vector<NOMAD::EvalPoint> evalPointListWithinRadius;
-    for (const auto & evalPoint : evalPointList)
+    auto isWithinRadius = [&](const NOMAD::EvalPoint& center, const NOMAD::EvalPoint& evalPoint)
+    {
+        auto distances = NOMAD::Point::vectorize(*(center.getX()), evalPoint);
+        distances = distances.abs();
+        return (distances <= radius);
+    };
+    if (NOMAD::EvcInterface::getEvaluatorControl()->getUseCache())
     {
-        bool pointAdded = false;
-        for (size_t centerIndex = 0;
-             centerIndex < nbCenters && !pointAdded;
-             centerIndex++)
+        // Get valid points: notably, they have a BB evaluation.
+        // Use CacheInterface to ensure the points are converted to subspace
+        NOMAD::CacheInterface cacheInterface(this);
+        for (size_t centerIndex = 0; centerIndex < nbCenters; centerIndex++)
         {
-            const NOMAD::EvalPoint& center = allCenters[centerIndex];
-            auto distances = NOMAD::Point::vectorize(*(center.getX()), evalPoint);
-            distances = distances.abs();
-            if (distances <= radius)
+            // Points within radius of a previous center are already selected.
+            auto crit = [&](const NOMAD::EvalPoint& evalPoint)
             {
-                // This evalPoint is within radius. Keep it.
-                evalPointListWithinRadius.push_back(evalPoint);
-                pointAdded = true;
-            }
+                if (!validForUpdate(evalPoint) || !isWithinRadius(allCenters[centerIndex], evalPoint))
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < centerIndex; i++)
+                {
+                    if (isWithinRadius(allCenters[i], evalPoint))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            std::vector<NOMAD::EvalPoint> evalPointListWithinRadius;
+            cacheInterface.findWithinRadius(*(allCenters[centerIndex].getX()), ballRadius, crit, evalPointListWithinRadius);
+            evalPointList.insert(evalPointList.end(), evalPointListWithinRadius.begin(), evalPointListWithinRadius.end());
         }
+        // Keep cache order.
+        std::sort(evalPointList.begin(), evalPointList.end(), NOMAD::EvalPointCompare());
     }
-    evalPointList = evalPointListWithinRadius;
     size_t nbValidPoints = evalPointList.size();
 
     /*
@@ -344,6 +363,7 @@ bool NOMAD::SgtelibModelUpdate::runImp()
         AddOutputInfo("Build model...", _displayLevel);
         OUTPUT_INFO_END
 
+        NOMAD_PROFILE_SCOPE("SgtelibModelUpdate::build");
         model->build();
         OUTPUT_INFO_START
         AddOutputInfo("OK.", _displayLevel);
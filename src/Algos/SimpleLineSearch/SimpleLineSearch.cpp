@@ -108,7 +108,7 @@ bool NOMAD::SimpleLineSearch::runImp()
 
 void NOMAD::SimpleLineSearch::readInformationForHotRestart()
 {
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"SimpleLineSearch: cannot be used with hot restart.");
     }
@@ -57,11 +57,11 @@ void NOMAD::SimpleLineSearchMegaIteration::init()
     setStepType(NOMAD::StepType::MEGA_ITERATION);
     
     // Get all parameters required by the method
-    _baseFactor = _runParams->getAttributeValue<NOMAD::Double>("SPECULATIVE_SEARCH_BASE_FACTOR");
+    _baseFactor = _runParams->getAttributeValue(NOMAD::Attr::SPECULATIVE_SEARCH_BASE_FACTOR);
     
     // The pb params handle only variables (fixed variables are not considered)
-    _lb = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-    _ub = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+    _lb = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+    _ub = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
 
 }
 
@@ -148,7 +148,7 @@ bool NOMAD::SimpleLineSearchMegaIteration::runImp()
             auto evalPoint = NOMAD::EvalPoint(*(pointFrom->getX()) + diri);
             
             // Insert the point
-            evalPoint.setPointFrom(std::make_shared<NOMAD::EvalPoint>(frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
+            evalPoint.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
             evalPoint.addGenStep(getStepType());
             
             if (snapPointToBoundsAndProjectOnMesh(evalPoint, _lb, _ub))
@@ -280,7 +280,7 @@ bool NOMAD::SimpleLineSearchMegaIteration::runImp()
             auto evalPointLS = NOMAD::EvalPoint(*pointFrom->getX() + dirLS);
             
             // Insert the point
-            evalPointLS.setPointFrom(std::make_shared<NOMAD::EvalPoint>(frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
+            evalPointLS.setPointFrom(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(frameCenter), NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
             evalPointLS.addGenStep(getStepType());
             
             if (snapPointToBoundsAndProjectOnMesh(evalPointLS, _lb, _ub))
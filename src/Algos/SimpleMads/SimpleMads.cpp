@@ -56,7 +56,7 @@ void NOMAD::SimpleMads::init()
     setStepType(NOMAD::StepType::ALGORITHM_MADS);
     
     // We can accept Mads with more than one objective when doing a PhaseOneSearch of DMultiMads optimization.
-    if (!_runParams->getAttributeValue<bool>("DMULTIMADS_OPTIMIZATION") && NOMAD::Algorithm::getNbObj() > 1)
+    if (!_runParams->getAttributeValue(NOMAD::Attr::DMULTIMADS_OPTIMIZATION) && NOMAD::Algorithm::getNbObj() > 1)
     {
         throw NOMAD::InvalidParameter(__FILE__,__LINE__,"Mads solves single objective problems. To handle several objectives please use DMultiMads: DMULTIMADS_OPTIMIZATION yes");
     }
@@ -134,15 +134,15 @@ void NOMAD::SimplePoll::init()
     _secondaryDirectionType = NOMAD::DirectionType::DOUBLE;
     
     // Rho parameter of the progressive barrier. Used to choose if the primary frame center is the feasible or infeasible incumbent.
-    _rho = _runParams->getAttributeValue<NOMAD::Double>("RHO");
+    _rho = _runParams->getAttributeValue(NOMAD::Attr::RHO);
         
-    _n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    _n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     _fixedVariable = NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(_parentStep);
     _nSimple = _fixedVariable.size();
     _nbOutputs = _bbot.size();
     
     // Evaluated X0
-    const auto X0s = _pbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+    const auto X0s = _pbParams->getAttributeValue(NOMAD::Attr::X0);
     if (X0s.size() != 1 && !X0s[0].isComplete())
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"Simple Mads needs a single valid X0.");
@@ -428,7 +428,7 @@ void NOMAD::SimplePoll::createPollMethod(const bool isPrimary, const SimpleEvalP
     
     // Select the poll methods to be executed
     std::shared_ptr<NOMAD::PollMethodBase> pollMethod;
-    auto fc = std::make_shared<NOMAD::EvalPoint>(frameCenter);
+    auto fc = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(frameCenter);
     if (isPrimary)
     {
         pollMethod = std::make_shared<NOMAD::Ortho2NPollMethod>(this, fc);
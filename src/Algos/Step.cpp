@@ -53,6 +53,35 @@
 #include "../Algos/Step.hpp"
 #include "../Cache/CacheBase.hpp"
 #include "../Output/OutputQueue.hpp"
+#include "../Util/Profiler.hpp"
+
+namespace {
+
+    enum StepPhase { STEP_START, STEP_RUN, STEP_END, NB_STEP_PHASES };
+
+    /// Profiler zone of a phase of the steps of a given StepType, ex. "Poll::run".
+    NOMAD::Profiler::ZoneId stepZone(const NOMAD::StepType& stepType, StepPhase phase)
+    {
+        const size_t nbStepTypes = static_cast<size_t>(NOMAD::StepType::UPDATE) + 1;
+        static const std::vector<NOMAD::Profiler::ZoneId> zones = [nbStepTypes]()
+        {
+            const char* phaseNames[NB_STEP_PHASES] = { "::start", "::run", "::end" };
+            std::vector<NOMAD::Profiler::ZoneId> stepZones;
+            for (size_t i = 0; i < nbStepTypes; i++)
+            {
+                const std::string stepName = NOMAD::stepTypeToString(static_cast<NOMAD::StepType>(i));
+                for (const char* phaseName : phaseNames)
+                {
+                    stepZones.push_back(NOMAD::Profiler::registerZone(stepName + phaseName));
+                }
+            }
+            return stepZones;
+        }();
+
+        return zones[static_cast<size_t>(stepType) * NB_STEP_PHASES + phase];
+    }
+}
+
 
 /*-----------------------------------*/
 /*   static members initialization   */
@@ -132,8 +161,8 @@ void NOMAD::Step::init()
        // In case no run params is provided (not even from parent)
         if ( nullptr != _runParams)
         {
-            _isMegaSearchPoll = _runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL");
-            _hMax0 = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+            _isMegaSearchPoll = _runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL);
+            _hMax0 = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
         }
     }
 }
@@ -286,6 +315,7 @@ void NOMAD::Step::AddOutputInfo(NOMAD::OutputInfo outputInfo) const
 /// Implementation of virtual functions : default start
 void NOMAD::Step::start()
 {
+    NOMAD::ProfileScope profileScope(stepZone(_stepType, STEP_START));
     defaultStart();
     startImp();
 }
@@ -293,6 +323,7 @@ void NOMAD::Step::start()
 
 void NOMAD::Step::end()
 {
+    NOMAD::ProfileScope profileScope(stepZone(_stepType, STEP_END));
     defaultEnd();
     endImp();
 }
@@ -300,6 +331,7 @@ void NOMAD::Step::end()
 
 bool NOMAD::Step::run()
 {
+    NOMAD::ProfileScope profileScope(stepZone(_stepType, STEP_RUN));
     return runImp();
 }
 
@@ -553,7 +585,7 @@ void NOMAD::Step::hotRestartOnUserInterrupt()
 void NOMAD::Step::hotRestartBeginHelper()
 {
     if (nullptr != _runParams
-        && !_runParams->getAttributeValue<bool>("HOT_RESTART_ON_USER_INTERRUPT"))
+        && !_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_ON_USER_INTERRUPT))
     {
         setUserTerminate();
         _stopReasons->set(NOMAD::BaseStopType::CTRL_C);
@@ -73,7 +73,7 @@ void NOMAD::Subproblem::init()
     }
 
     // Compute new dimension
-    NOMAD::Point subFixedVariable = _refPbParams->getAttributeValue<NOMAD::Point>("FIXED_VARIABLE");
+    NOMAD::Point subFixedVariable = _refPbParams->getAttributeValue(NOMAD::Attr::FIXED_VARIABLE);
     _dimension = subFixedVariable.size() - subFixedVariable.nbDefined();
 
 
@@ -89,23 +89,23 @@ void NOMAD::Subproblem::setupProblemParameters()
     // this method will break.
     // It could be generalized by going through each parameter, and adjust it only
     // if it is an ArrayOfDouble, Point, or Dimension. Backlog task.
-    const size_t refDimension = _refPbParams->getAttributeValue<size_t>("DIMENSION");
+    const size_t refDimension = _refPbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     size_t n = _dimension;
 
-    _subPbParams = std::make_shared<NOMAD::PbParameters>(*_refPbParams);
+    _subPbParams = std::make_shared<NOMAD::PbParameters>(*_refPbParams, NOMAD::ParametersOverlay());
     _subPbParams->setAttributeValue("DIMENSION", n);
 
     // Get reference values for parameters
-    const auto refX0s           = _refPbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
-    const auto refLowerBound    = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-    const auto refUpperBound    = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
-    const auto refBBInputType   = _refPbParams->getAttributeValue<NOMAD::BBInputTypeList>("BB_INPUT_TYPE");
-    const auto refInitMeshSize  = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("INITIAL_MESH_SIZE");
-    const auto refInitFrameSize  = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("INITIAL_FRAME_SIZE");
-    const auto refMinMeshSize   = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("MIN_MESH_SIZE");
-    const auto refMinFrameSize   = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("MIN_FRAME_SIZE");
-    const auto refGranularity   = _refPbParams->getAttributeValue<NOMAD::ArrayOfDouble>("GRANULARITY");
-    const auto refListVariableGroup = _refPbParams->getAttributeValue<NOMAD::ListOfVariableGroup>("VARIABLE_GROUP");
+    const auto refX0s           = _refPbParams->getAttributeValue(NOMAD::Attr::X0);
+    const auto refLowerBound    = _refPbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+    const auto refUpperBound    = _refPbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
+    const auto refBBInputType   = _refPbParams->getAttributeValue(NOMAD::Attr::BB_INPUT_TYPE);
+    const auto refInitMeshSize  = _refPbParams->getAttributeValue(NOMAD::Attr::INITIAL_MESH_SIZE);
+    const auto refInitFrameSize  = _refPbParams->getAttributeValue(NOMAD::Attr::INITIAL_FRAME_SIZE);
+    const auto refMinMeshSize   = _refPbParams->getAttributeValue(NOMAD::Attr::MIN_MESH_SIZE);
+    const auto refMinFrameSize   = _refPbParams->getAttributeValue(NOMAD::Attr::MIN_FRAME_SIZE);
+    const auto refGranularity   = _refPbParams->getAttributeValue(NOMAD::Attr::GRANULARITY);
+    const auto refListVariableGroup = _refPbParams->getAttributeValue(NOMAD::Attr::VARIABLE_GROUP);
 
     // Initialize new arrays
     NOMAD::ArrayOfPoint x0s;
@@ -123,7 +123,7 @@ void NOMAD::Subproblem::setupProblemParameters()
 
     // Compute new fixed variable.
     // Current value of _fixedVariable contains only values from parent. Merge in values from _refPbParams.
-    NOMAD::Point refFixedVariable = _refPbParams->getAttributeValue<NOMAD::Point>("FIXED_VARIABLE");
+    NOMAD::Point refFixedVariable = _refPbParams->getAttributeValue(NOMAD::Attr::FIXED_VARIABLE);
 
     // Compute new values, simply using the values on the positions of non-fixed variables.
     size_t i = 0;
@@ -95,7 +95,7 @@ public:
     explicit Subproblem(const std::shared_ptr<PbParameters> refPbParams,
                         const Point& fullFixedVariable)
       : _fixedVariable(fullFixedVariable),
-        _dimension(refPbParams->getAttributeValue<size_t>("DIMENSION")),
+        _dimension(refPbParams->getAttributeValue(Attr::DIMENSION)),
         _refPbParams(refPbParams),
         _subPbParams(nullptr)
     {
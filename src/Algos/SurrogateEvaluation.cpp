@@ -92,7 +92,7 @@ void NOMAD::SurrogateEvaluation::startImp()
     }
     if(EvalType::MODEL == _evalType)
     {
-        const auto& modelDisplay = _runParams->getAttributeValue<std::string>("QUAD_MODEL_DISPLAY");
+        const auto& modelDisplay = _runParams->getAttributeValue(NOMAD::Attr::QUAD_MODEL_DISPLAY);
         
         auto fullFixedVar = NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this);
         OUTPUT_INFO_START
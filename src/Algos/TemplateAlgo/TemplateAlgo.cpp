@@ -69,7 +69,7 @@ bool NOMAD::TemplateAlgo::runImp()
 {
     _algoSuccessful = false;
     
-    bool randomAlgoOpt = _runParams->getAttributeValue<bool>("RANDOM_ALGO_OPTIMIZATION");
+    bool randomAlgoOpt = _runParams->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_OPTIMIZATION);
 
     if ( ! _stopReasons->checkTerminate() )
     {
@@ -139,10 +139,10 @@ void NOMAD::TemplateAlgo::readInformationForHotRestart()
     // For this, we need to read some files.
     // Note: Cache file is treated independently of hot restart file.
 
-    if (_runParams->getAttributeValue<bool>("HOT_RESTART_READ_FILES"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_READ_FILES))
     {
         // Verify the files exist and are readable.
-        const std::string& hotRestartFile = _runParams->getAttributeValue<std::string>("HOT_RESTART_FILE");
+        const std::string& hotRestartFile = _runParams->getAttributeValue(NOMAD::Attr::HOT_RESTART_FILE);
         if (NOMAD::checkReadFile(hotRestartFile))
         {
             std::cout << "Read hot restart file " << hotRestartFile << std::endl;
@@ -83,7 +83,7 @@ void NOMAD::TemplateAlgoInitialization::startImp()
     if ( ! _stopReasons->checkTerminate() )
     {
         // For a standalone random algo optimization (RANDOM_ALGO_OPTIMIZATION true), initial trial points are provided in x0. Else, simply pass.
-        auto templateAlgo_opt = _runParams->getAttributeValue<bool>("RANDOM_ALGO_OPTIMIZATION");
+        auto templateAlgo_opt = _runParams->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_OPTIMIZATION);
         if ( templateAlgo_opt )
         {
             generateTrialPoints();
@@ -109,10 +109,10 @@ void NOMAD::TemplateAlgoInitialization::endImp()
         std::vector<NOMAD::EvalPoint> evalPointList;
         std::copy(_trialPoints.begin(), _trialPoints.end(),
                           std::back_inserter(evalPointList));
-        auto hMax = _runParams->getAttributeValue<NOMAD::Double>("H_MAX_0");
+        auto hMax = _runParams->getAttributeValue(NOMAD::Attr::H_MAX_0);
         
         // Compute type for this optim (eval type, compute type and h norm type)
-        auto hNormType = _runParams->getAttributeValue<NOMAD::HNormType>("H_NORM");
+        auto hNormType = _runParams->getAttributeValue(NOMAD::Attr::H_NORM);
 
         // Eval type for this optim (can be BB or SURROGATE)
         // REM: No PhaseOne search for this algo!
@@ -132,7 +132,7 @@ void NOMAD::TemplateAlgoInitialization::endImp()
 // Generate trial points from x0
 void NOMAD::TemplateAlgoInitialization::generateTrialPointsImp()
 {
-    auto x0s = _pbParams->getAttributeValue<NOMAD::ArrayOfPoint>("X0");
+    auto x0s = _pbParams->getAttributeValue(NOMAD::Attr::X0);
 
     // It is ok if no x0 is provided, just pass
     if(x0s.empty() || !x0s[0].isComplete())
@@ -142,15 +142,15 @@ void NOMAD::TemplateAlgoInitialization::generateTrialPointsImp()
         NOMAD::OutputQueue::Flush();
         OUTPUT_INFO_END
         
-        auto n = _pbParams->getAttributeValue<size_t>("DIMENSION");
-        auto k = _runParams->getAttributeValue<size_t>("RANDOM_ALGO_DUMMY_FACTOR");
+        auto n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
+        auto k = _runParams->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_DUMMY_FACTOR);
         if (k == NOMAD::INF_SIZE_T)
         {
             throw NOMAD::Exception(__FILE__, __LINE__, "RANDOM_ALGO_DUMMY_FACTOR cannot be INF.");
         }
         
-        auto lowerBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-        auto upperBound = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
+        auto lowerBound = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+        auto upperBound = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
 
         if (!lowerBound.isComplete() || !upperBound.isComplete())
         {
@@ -67,7 +67,7 @@ void NOMAD::TemplateAlgoRandom::init()
         throw NOMAD::Exception(__FILE__,__LINE__,"An iteration is required.");
     }
     
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     _boxSize = NOMAD::ArrayOfDouble(n,1);
     if (nullptr != iter->getMesh())
     {
@@ -136,11 +136,11 @@ void NOMAD::TemplateAlgoRandom::generateTrialPointsImp()
     }
     
     // The pb params handle only variables (fixed variables are not considered)
-    size_t n = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    size_t n = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     
-    auto lb = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("LOWER_BOUND");
-    auto ub = _pbParams->getAttributeValue<NOMAD::ArrayOfDouble>("UPPER_BOUND");
-    auto k = _runParams->getAttributeValue<size_t>("RANDOM_ALGO_DUMMY_FACTOR");
+    auto lb = _pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND);
+    auto ub = _pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND);
+    auto k = _runParams->getAttributeValue(NOMAD::Attr::RANDOM_ALGO_DUMMY_FACTOR);
     
 
     // Creation of points
@@ -157,7 +157,7 @@ void NOMAD::TemplateAlgoRandom::generateTrialPointsImp()
         auto barrier = getMegaIterationBarrier();
         if (nullptr != barrier)
         {
-            pointFrom = std::make_shared<NOMAD::EvalPoint>(*(barrier->getFirstPoint())); // Make a copy of Eval Point from the barrier
+            pointFrom = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(*(barrier->getFirstPoint())); // Make a copy of Eval Point from the barrier
             xt.setPointFrom(pointFrom, NOMAD::SubproblemManager::getInstance()->getSubFixedVariable(this));
         }
         
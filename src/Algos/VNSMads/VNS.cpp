@@ -60,7 +60,7 @@
 void NOMAD::VNS::init()
 {
     /*
-    if ( _runParams->getAttributeValue<bool>("MEGA_SEARCH_POLL") )
+    if ( _runParams->getAttributeValue(NOMAD::Attr::MEGA_SEARCH_POLL) )
     {
         _name += " One Iteration";
     }
@@ -99,7 +99,7 @@ bool NOMAD::VNS::runImp()
         return _algoSuccessful;
     }
 
-    if (_runParams->getAttributeValue<bool>("VNS_MADS_OPTIMIZATION"))
+    if (_runParams->getAttributeValue(NOMAD::Attr::VNS_MADS_OPTIMIZATION))
     {
         throw NOMAD::Exception(__FILE__,__LINE__,"VNS_MADS_OPTIMIZATION not yet implemented");
     }
@@ -132,7 +132,7 @@ bool NOMAD::VNS::runImp()
     // shaking: the perturbation is tried twice with dir and -dir
     //          (in case x == x + dir after snapping)
     NOMAD::Point shakePoint = *(_frameCenter->getX()) + dir; // pun intended;
-    shakePoint.snapToBounds(_pbParams->getAttributeValue<ArrayOfDouble>("LOWER_BOUND"),_pbParams->getAttributeValue<ArrayOfDouble>("UPPER_BOUND"));
+    shakePoint.snapToBounds(_pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND),_pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND));
     for ( int nbt = 0 ; nbt < 2 ; ++nbt )
     {
         if ( shakePoint == *(_frameCenter->getX()))
@@ -151,7 +151,7 @@ bool NOMAD::VNS::runImp()
 
             // 2nd try (-dir instead of dir):
             shakePoint =  *(_frameCenter->getX()) - dir;
-            shakePoint.snapToBounds(_pbParams->getAttributeValue<ArrayOfDouble>("LOWER_BOUND"),_pbParams->getAttributeValue<ArrayOfDouble>("UPPER_BOUND"));
+            shakePoint.snapToBounds(_pbParams->getAttributeValue(NOMAD::Attr::LOWER_BOUND),_pbParams->getAttributeValue(NOMAD::Attr::UPPER_BOUND));
         }
     }
 
@@ -201,7 +201,7 @@ void NOMAD::VNS::endImp()
 
 void NOMAD::VNS::setupRunParameters()
 {
-    _optRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams);
+    _optRunParams = std::make_shared<NOMAD::RunParameters>(*_runParams, NOMAD::ParametersOverlay());
 
     _optRunParams->setAttributeValue("MAX_ITERATIONS", INF_SIZE_T);
 
@@ -214,8 +214,8 @@ void NOMAD::VNS::setupRunParameters()
     // No callbacks for mads iterations in VNS optimization : for the Restart_VNS example
     _optRunParams->setAttributeValue("USER_CALLS_ENABLED", false);
     
-    auto vnsFactor = _runParams->getAttributeValue<size_t>("VNS_MADS_SEARCH_MAX_TRIAL_PTS_NFACTOR");
-    auto dim = _pbParams->getAttributeValue<size_t>("DIMENSION");
+    auto vnsFactor = _runParams->getAttributeValue(NOMAD::Attr::VNS_MADS_SEARCH_MAX_TRIAL_PTS_NFACTOR);
+    auto dim = _pbParams->getAttributeValue(NOMAD::Attr::DIMENSION);
     if (vnsFactor < NOMAD::INF_SIZE_T)
     {
         NOMAD::EvcInterface::getEvaluatorControl()->setLapMaxBbEval( dim*vnsFactor );
@@ -229,7 +229,7 @@ void NOMAD::VNS::setupRunParameters()
 
 void NOMAD::VNS::setupPbParameters(const NOMAD::Point & center, const NOMAD::ArrayOfDouble & currentMadsFrameSize)
 {
-    _optPbParams = std::make_shared<NOMAD::PbParameters>(*_pbParams);
+    _optPbParams = std::make_shared<NOMAD::PbParameters>(*_pbParams, NOMAD::ParametersOverlay());
 
     // Reset initial mesh and frame sizes
     // The initial mesh and frame sizes will be calculated from bounds and X0
@@ -59,6 +59,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 // Registered attribute definition names
 const std::string attributeDefinitionNames[20] = { "deprecatedAttributesDefinition",
@@ -95,6 +96,27 @@ const std::map<std::string, bool> attributeFlagsRegistered {
             {"ALGO_COMPATIBILITY_CHECK", false},
             {"UNIQUE_ENTRY", true} };
 
+/// \brief Header with the typed identifiers of all the attributes (see Param/AttributeId.hpp)
+const std::string attributeIdsDefinitionName = "attributeIdsDefinition";
+
+/// \brief C++ type of an attribute, as used by Parameters::registerAttributes
+std::string attributeIdType(const std::string& attributeType)
+{
+    if ("string" == attributeType || "std::string" == attributeType)
+    {
+        return "std::string";
+    }
+    if ("bool" == attributeType || "int" == attributeType || "size_t" == attributeType)
+    {
+        return attributeType;
+    }
+    if (0 == attributeType.find("NOMAD::"))
+    {
+        return attributeType;
+    }
+    return "NOMAD::" + attributeType;
+}
+
 /// \brief Toupper utility
 void  toUpperCase(std::string& str)
 {
@@ -260,6 +282,9 @@ int main(int argc, char *argv[])
     
     std::string fw; // For testing forbidden words (example: runner does not like the word SOLVER)
 
+    // Name and C++ type of the attributes of all definition files
+    std::vector<std::pair<std::string, std::string>> attributeIds;
+
     for ( auto attDefName : attributeDefinitionNames )
     {
         std::string attDefFile      = inputDir + attDefName + ".txt";
@@ -384,6 +409,9 @@ int main(int argc, char *argv[])
                     throw ( Exception(lineNumber,errMsg) );
                 }
                 oss << " \"" << attributeType << "\", " ;
+                std::string attributeIdName = attributeName;
+                toUpperCase(attributeIdName);
+                attributeIds.emplace_back(attributeIdName, attributeIdType(attributeType));
 
                 // Read attribute default value (can be undefined)
                 getline(fin, line);
@@ -547,6 +575,31 @@ int main(int argc, char *argv[])
             return -1;
         }
     }
+
+    // Write the typed identifiers of the attributes.
+    // The file is included several times with different definitions of
+    // NOMAD_ATTRIBUTE_ID: no include guard.
+    std::string attIdsHeader = outputDir + attributeIdsDefinitionName + ".hpp";
+    oss.str("");
+    oss.clear();
+    oss << "//////////// THIS FILE MUST BE CREATED BY EXECUTING WriteAttributeDefinitionFile ////////////" << std::endl;
+    oss << "//////////// DO NOT MODIFY THIS FILE MANUALLY ///////////////////////////////////////////////" << std::endl << std::endl;
+    oss << "// NOMAD_ATTRIBUTE_ID(name, type) for each attribute of the definition files." << std::endl;
+    oss << "// Included by Param/AttributeId.hpp and Param/AttributeId.cpp. No include guard." << std::endl << std::endl;
+    for (const auto& attributeId : attributeIds)
+    {
+        oss << "NOMAD_ATTRIBUTE_ID( " << attributeId.first << ", " << attributeId.second << " )" << std::endl;
+    }
+
+    fout.open( attIdsHeader );
+    if ( fout.fail() )
+    {
+        std::cerr << "ERROR: Failed to open the header file for writing attribute identifiers: " << attIdsHeader << std::endl << std::endl;
+        return -1;
+    }
+    fout << oss.str() ;
+    fout.close();
+
     return 0;
 }
 
@@ -0,0 +1,294 @@
+//////////// THIS FILE MUST BE CREATED BY EXECUTING WriteAttributeDefinitionFile ////////////
+//////////// DO NOT MODIFY THIS FILE MANUALLY ///////////////////////////////////////////////
+
+// NOMAD_ATTRIBUTE_ID(name, type) for each attribute of the definition files.
+// Included by Param/AttributeId.hpp and Param/AttributeId.cpp. No include guard.
+
+NOMAD_ATTRIBUTE_ID( ASYNCHRONOUS, bool )
+NOMAD_ATTRIBUTE_ID( BB_INPUT_INCLUDE_SEED, bool )
+NOMAD_ATTRIBUTE_ID( BB_INPUT_INCLUDE_TAG, bool )
+NOMAD_ATTRIBUTE_ID( CACHE_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( CLOSED_BRACE, std::string )
+NOMAD_ATTRIBUTE_ID( DISABLE, NOMAD::ArrayOfString )
+NOMAD_ATTRIBUTE_ID( EXTENDED_POLL_ENABLED, bool )
+NOMAD_ATTRIBUTE_ID( EXTENDED_POLL_TRIGGER, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( F_TARGET, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( HAS_SGTE, bool )
+NOMAD_ATTRIBUTE_ID( INITIAL_MESH_INDEX, int )
+NOMAD_ATTRIBUTE_ID( INITIAL_POLL_SIZE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( INTENSIFICATION_TYPE, std::string )
+NOMAD_ATTRIBUTE_ID( INT_POLL_DIR_TYPES, NOMAD::DirectionTypeList )
+NOMAD_ATTRIBUTE_ID( L_CURVE_TARGET, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( MAX_CACHE_MEMORY, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_CONSECUTIVE_FAILED_ITERATIONS, int )
+NOMAD_ATTRIBUTE_ID( MAX_EVAL_INTENSIFICATION, int )
+NOMAD_ATTRIBUTE_ID( MAX_SGTE_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_SIM_BB_EVAL, int )
+NOMAD_ATTRIBUTE_ID( MESH_COARSENING_EXPONENT, size_t )
+NOMAD_ATTRIBUTE_ID( MESH_REFINING_EXPONENT, int )
+NOMAD_ATTRIBUTE_ID( MESH_TYPE, std::string )
+NOMAD_ATTRIBUTE_ID( MESH_UPDATE_BASIS, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( MIN_POLL_SIZE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( MODEL_EVAL_SORT, bool )
+NOMAD_ATTRIBUTE_ID( MODEL_EVAL_SORT_CAUTIOUS, bool )
+NOMAD_ATTRIBUTE_ID( MODEL_NP1_QUAD_EPSILON, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( MODEL_QUAD_MAX_Y_SIZE, size_t )
+NOMAD_ATTRIBUTE_ID( MODEL_QUAD_MIN_Y_SIZE, int )
+NOMAD_ATTRIBUTE_ID( MODEL_QUAD_RADIUS_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( MODEL_QUAD_USE_WP, bool )
+NOMAD_ATTRIBUTE_ID( MODEL_RADIUS_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( MODEL_SEARCH, std::string )
+NOMAD_ATTRIBUTE_ID( MODEL_SEARCH_MAX_TRIAL_PTS, size_t )
+NOMAD_ATTRIBUTE_ID( MODEL_SEARCH_OPTIMISTIC, bool )
+NOMAD_ATTRIBUTE_ID( MODEL_SEARCH_OPPORTUNISTIC, bool )
+NOMAD_ATTRIBUTE_ID( MODEL_SEARCH_PROJ_TO_MESH, bool )
+NOMAD_ATTRIBUTE_ID( MULTI_F_BOUNDS, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( MULTI_FORMULATION, std::string )
+NOMAD_ATTRIBUTE_ID( MULTI_NB_MADS_RUNS, size_t )
+NOMAD_ATTRIBUTE_ID( MULTI_OVERALL_BB_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( MULTI_USE_DELTA_CRIT, bool )
+NOMAD_ATTRIBUTE_ID( NEIGHBORS_EXE, std::string )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_DELTA_E, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_DELTA_IC, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_DELTA_OC, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_GAMMA, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_INCLUDE_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_INIT_Y_BEST_VON, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_INIT_Y_ITER, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_INTENSIVE, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_MAX_TRIAL_PTS, int )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_MIN_SIMPLEX_VOL, size_t )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_OPPORTUNISTIC, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_SCALED_DZ, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_USE_ONLY_Y, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_USE_SHORT_Y0, bool )
+NOMAD_ATTRIBUTE_ID( OPEN_BRACE, std::string )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_CACHE_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_EVAL, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_LH, bool )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_LUCKY_EVAL, bool )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_MIN_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_MIN_F_IMPRVMT, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( OPPORTUNISTIC_MIN_NB_SUCCESS, size_t )
+NOMAD_ATTRIBUTE_ID( OPT_ONLY_SGTE, bool )
+NOMAD_ATTRIBUTE_ID( PERIODIC_VARIABLE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( POINT_DISPLAY_LIMIT, size_t )
+NOMAD_ATTRIBUTE_ID( POLL_UPDATE_BASIS, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( RANDOM_EVAL_SORT, bool )
+NOMAD_ATTRIBUTE_ID( ROBUST_MADS, bool )
+NOMAD_ATTRIBUTE_ID( ROBUST_MADS_STANDARD_DEV_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SCALING, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( SEC_POLL_DIR_TYPE, NOMAD::DirectionTypeList )
+NOMAD_ATTRIBUTE_ID( SGTE_CACHE_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( SGTE_COST, size_t )
+NOMAD_ATTRIBUTE_ID( SGTE_EVAL_SORT, bool )
+NOMAD_ATTRIBUTE_ID( SGTE_EXE, std::string )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_CANDIDATES_NB, int )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_EVAL_NB, size_t )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_EXCLUSION_AREA, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_FILTER, std::string )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_TRIALS, int )
+NOMAD_ATTRIBUTE_ID( SNAP_TO_BOUNDS, bool )
+NOMAD_ATTRIBUTE_ID( TREND_MATRIX, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( TREND_MATRIX_BASIC_LINE_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( TREND_MATRIX_EVAL_SORT, bool )
+NOMAD_ATTRIBUTE_ID( VNS_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( NB_THREADS_OPENMP, int )
+NOMAD_ATTRIBUTE_ID( DISPLAY_ALL_EVAL, bool )
+NOMAD_ATTRIBUTE_ID( DISPLAY_DEGREE, int )
+NOMAD_ATTRIBUTE_ID( DISPLAY_HEADER, size_t )
+NOMAD_ATTRIBUTE_ID( DISPLAY_INFEASIBLE, bool )
+NOMAD_ATTRIBUTE_ID( DISPLAY_MAX_STEP_LEVEL, size_t )
+NOMAD_ATTRIBUTE_ID( DISPLAY_STATS, NOMAD::ArrayOfString )
+NOMAD_ATTRIBUTE_ID( DISPLAY_FAILED, bool )
+NOMAD_ATTRIBUTE_ID( DISPLAY_UNSUCCESSFUL, bool )
+NOMAD_ATTRIBUTE_ID( STATS_FILE, NOMAD::ArrayOfString )
+NOMAD_ATTRIBUTE_ID( EVAL_STATS_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( PROFILE_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( PROFILE_TRACE_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( SOL_FORMAT, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( OBJ_WIDTH, size_t )
+NOMAD_ATTRIBUTE_ID( HISTORY_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( HISTORY_FILE_BINARY, bool )
+NOMAD_ATTRIBUTE_ID( SOLUTION_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( SOLUTION_FILE_FINAL, bool )
+NOMAD_ATTRIBUTE_ID( BB_EVAL_FORMAT, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( BB_EXE, std::string )
+NOMAD_ATTRIBUTE_ID( BB_REDIRECTION, bool )
+NOMAD_ATTRIBUTE_ID( BB_EXE_SERVER, bool )
+NOMAD_ATTRIBUTE_ID( BB_OUTPUT_TYPE, NOMAD::BBOutputTypeList )
+NOMAD_ATTRIBUTE_ID( SURROGATE_EXE, std::string )
+NOMAD_ATTRIBUTE_ID( CACHE_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( CACHE_FILE_FORMAT, std::string )
+NOMAD_ATTRIBUTE_ID( CACHE_SAVE_PERIOD, size_t )
+NOMAD_ATTRIBUTE_ID( CACHE_SIZE_MAX, size_t )
+NOMAD_ATTRIBUTE_ID( CACHE_TYPE, std::string )
+NOMAD_ATTRIBUTE_ID( CACHE_NB_SHARDS, size_t )
+NOMAD_ATTRIBUTE_ID( EVAL_OPPORTUNISTIC, bool )
+NOMAD_ATTRIBUTE_ID( EVAL_SURROGATE_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( EVAL_USE_CACHE, bool )
+NOMAD_ATTRIBUTE_ID( EVAL_QUEUE_SORT, NOMAD::EvalSortType )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_SUBPROBLEM_MAX_BB_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( SUBPROBLEM_MAX_BB_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( BB_MAX_BLOCK_SIZE, size_t )
+NOMAD_ATTRIBUTE_ID( SURROGATE_MAX_BLOCK_SIZE, size_t )
+NOMAD_ATTRIBUTE_ID( EVAL_QUEUE_CLEAR, bool )
+NOMAD_ATTRIBUTE_ID( EVAL_QUEUE_STEAL, bool )
+NOMAD_ATTRIBUTE_ID( EVAL_SURROGATE_COST, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_BB_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_BLOCK_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_SURROGATE_EVAL_OPTIMIZATION, size_t )
+NOMAD_ATTRIBUTE_ID( MODEL_MAX_BLOCK_SIZE, size_t )
+NOMAD_ATTRIBUTE_ID( MODEL_MAX_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_MAX_BLOCK_SIZE, size_t )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_MAX_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_MAX_BLOCK_SIZE, size_t )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_MAX_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( TMP_DIR, std::string )
+NOMAD_ATTRIBUTE_ID( USE_CACHE_FILE_FOR_RERUN, bool )
+NOMAD_ATTRIBUTE_ID( NB_THREADS_PARALLEL_EVAL, int )
+NOMAD_ATTRIBUTE_ID( BB_INPUT_TYPE, NOMAD::BBInputTypeList )
+NOMAD_ATTRIBUTE_ID( DIMENSION, size_t )
+NOMAD_ATTRIBUTE_ID( FIXED_VARIABLE, NOMAD::Point )
+NOMAD_ATTRIBUTE_ID( GRANULARITY, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( INITIAL_FRAME_SIZE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( INITIAL_MESH_SIZE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( LOWER_BOUND, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( MIN_FRAME_SIZE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( MIN_MESH_SIZE, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( UPPER_BOUND, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( VARIABLE_GROUP, NOMAD::ListOfVariableGroup )
+NOMAD_ATTRIBUTE_ID( X0, NOMAD::ArrayOfPoint )
+NOMAD_ATTRIBUTE_ID( POINT_FORMAT, NOMAD::ArrayOfDouble )
+NOMAD_ATTRIBUTE_ID( ADD_SEED_TO_FILE_NAMES, bool )
+NOMAD_ATTRIBUTE_ID( ANISOTROPIC_MESH, bool )
+NOMAD_ATTRIBUTE_ID( ANISOTROPY_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SEARCH_METHOD_MESH_PROJECTION, bool )
+NOMAD_ATTRIBUTE_ID( DIRECTION_TYPE, NOMAD::DirectionTypeList )
+NOMAD_ATTRIBUTE_ID( DIRECTION_TYPE_SECONDARY_POLL, NOMAD::DirectionTypeList )
+NOMAD_ATTRIBUTE_ID( TRIAL_POINT_MAX_ADD_UP, size_t )
+NOMAD_ATTRIBUTE_ID( ORTHO_MESH_REFINE_FREQ, size_t )
+NOMAD_ATTRIBUTE_ID( FRAME_CENTER_USE_CACHE, bool )
+NOMAD_ATTRIBUTE_ID( H_MAX_0, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( HOT_RESTART_FILE, std::string )
+NOMAD_ATTRIBUTE_ID( HOT_RESTART_ON_USER_INTERRUPT, bool )
+NOMAD_ATTRIBUTE_ID( HOT_RESTART_READ_FILES, bool )
+NOMAD_ATTRIBUTE_ID( HOT_RESTART_WRITE_FILES, bool )
+NOMAD_ATTRIBUTE_ID( MAX_ITERATIONS, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_ITERATION_PER_MEGAITERATION, size_t )
+NOMAD_ATTRIBUTE_ID( MAX_TIME, size_t )
+NOMAD_ATTRIBUTE_ID( MEGA_SEARCH_POLL, bool )
+NOMAD_ATTRIBUTE_ID( REJECT_UNKNOWN_PARAMETERS, bool )
+NOMAD_ATTRIBUTE_ID( RHO, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SEED, int )
+NOMAD_ATTRIBUTE_ID( RNG_ALT_SEEDING, bool )
+NOMAD_ATTRIBUTE_ID( RNG_STREAMS, bool )
+NOMAD_ATTRIBUTE_ID( SIMPLE_LINE_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( SPECULATIVE_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( SPECULATIVE_SEARCH_BASE_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SPECULATIVE_SEARCH_MAX, size_t )
+NOMAD_ATTRIBUTE_ID( USER_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( STOP_IF_FEASIBLE, bool )
+NOMAD_ATTRIBUTE_ID( STOP_IF_PHASE_ONE_SOLUTION, bool )
+NOMAD_ATTRIBUTE_ID( USER_CALLS_ENABLED, bool )
+NOMAD_ATTRIBUTE_ID( RANDOM_ALGO_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( RANDOM_ALGO_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( RANDOM_ALGO_DUMMY_FACTOR, size_t )
+NOMAD_ATTRIBUTE_ID( H_NORM, NOMAD::HNormType )
+NOMAD_ATTRIBUTE_ID( H_MIN, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_EXPANSIONINT_LINESEARCH, bool )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_QUAD_MODEL_STRATEGY, NOMAD::DMultiMadsQuadSearchType )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_HV_REFERENCE_POINT, NOMAD::ArrayOfString )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_HV_STALL_ITERATIONS, size_t )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_HV_STALL_TOLERANCE, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_MIDDLEPOINT_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_MIDDLEPOINT_SEARCH_CACHE_MAX, size_t )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_NM_STRATEGY, NOMAD::DMultiMadsNMSearchType )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_SELECT_INCUMBENT_THRESHOLD, size_t )
+NOMAD_ATTRIBUTE_ID( DMULTIMADS_QMS_PRIOR_COMBINE_OBJ, bool )
+NOMAD_ATTRIBUTE_ID( USE_IBEX, bool )
+NOMAD_ATTRIBUTE_ID( SYSTEM_FILE_NAME, std::string )
+NOMAD_ATTRIBUTE_ID( SET_FILE, bool )
+NOMAD_ATTRIBUTE_ID( SET_FILE_NAME, std::string )
+NOMAD_ATTRIBUTE_ID( LH_EVAL, size_t )
+NOMAD_ATTRIBUTE_ID( LH_SEARCH, NOMAD::LHSearchType )
+NOMAD_ATTRIBUTE_ID( CS_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( NM_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( NM_SIMPLEX_INCLUDE_LENGTH, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SIMPLEX_INCLUDE_FACTOR, size_t )
+NOMAD_ATTRIBUTE_ID( NM_DELTA_E, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_DELTA_IC, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_DELTA_OC, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_GAMMA, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_MAX_TRIAL_PTS_NFACTOR, size_t )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_RANK_EPS, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( NM_SEARCH_STOP_ON_SUCCESS, bool )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_NB_VAR_IN_SUBPROBLEM, size_t )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_NB_SUBPROBLEM, size_t )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_ITER_OPPORTUNISTIC, bool )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_ORIGINAL, bool )
+NOMAD_ATTRIBUTE_ID( PSD_MADS_SUBPROBLEM_PERCENT_COVERAGE, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( QP_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( QP_SELECTALGO, size_t )
+NOMAD_ATTRIBUTE_ID( QP_MAXITER, size_t )
+NOMAD_ATTRIBUTE_ID( QP_TOLDISTDX, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_ABSOLUTETOL, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_TOLCOND, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_TOLMESH, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_RELATIVETOL, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_VERBOSE, bool )
+NOMAD_ATTRIBUTE_ID( QP_VERBOSEFULL, bool )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_MU0, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_MUDECREASE, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_ETA0, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_OMEGA0, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_MAXITERINNER, size_t )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_TOLDISTDXINNER, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_MAXSUCCESSIVFAIL, size_t )
+NOMAD_ATTRIBUTE_ID( QP_AUGLAG_SUCCESSRATIO, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QP_SEARCH_MODEL_BOX_SIZE_LIMIT, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_SEARCH_SIMPLE_MADS, bool )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_SEARCH_BOUND_REDUCTION_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_DISPLAY, std::string )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_SEARCH_BOX_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_BOX_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( QUAD_MODEL_SEARCH_FORCE_EB, bool )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_EVAL, bool )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_DISPLAY, std::string )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_DEFINITION, NOMAD::ArrayOfString )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_SEARCH_TRIALS, size_t )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_FORMULATION, NOMAD::SgtelibModelFormulationType )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_FEASIBILITY, NOMAD::SgtelibModelFeasibilityType )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_DIVERSIFICATION, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_SEARCH_EXCLUSION_AREA, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_SEARCH_CANDIDATES_NB, int )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MIN_POINTS_FOR_MODEL, size_t )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MAX_POINTS_FOR_MODEL, size_t )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_SEARCH_FILTER, std::string )
+NOMAD_ATTRIBUTE_ID( SGTELIB_MODEL_RADIUS_FACTOR, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( VNS_MADS_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( VNSMART_MADS_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( VNSMART_MADS_SEARCH_THRESHOLD, int )
+NOMAD_ATTRIBUTE_ID( VNS_MADS_SEARCH, bool )
+NOMAD_ATTRIBUTE_ID( VNS_MADS_SEARCH_TRIGGER, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( VNS_MADS_SEARCH_WITH_SURROGATE, bool )
+NOMAD_ATTRIBUTE_ID( VNS_MADS_SEARCH_MAX_TRIAL_PTS_NFACTOR, size_t )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_DETECTION_RADIUS, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_LIMIT_RATE, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_EXCLUSION_RADIUS, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_REVEALING_POLL_RADIUS, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_REVEALING_POLL_NB_POINTS, size_t )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_HID_CONST, bool )
+NOMAD_ATTRIBUTE_ID( DISCO_MADS_HID_CONST_OUTPUT_VALUE, NOMAD::Double )
+NOMAD_ATTRIBUTE_ID( COOP_MADS_OPTIMIZATION, bool )
+NOMAD_ATTRIBUTE_ID( COOP_MADS_NB_PROBLEM, size_t )
+NOMAD_ATTRIBUTE_ID( COOP_MADS_OPTIMIZATION_CACHE_SEARCH, bool )
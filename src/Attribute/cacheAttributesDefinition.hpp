@@ -1,49 +1,3 @@
-/*---------------------------------------------------------------------------------*/
-/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
-/*                                                                                 */
-/*  NOMAD - Version 4 has been created and developed by                            */
-/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
-/*                 Christophe Tribes           - Polytechnique Montreal            */
-/*                                                                                 */
-/*  The copyright of NOMAD - version 4 is owned by                                 */
-/*                 Charles Audet               - Polytechnique Montreal            */
-/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
-/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
-/*                 Christophe Tribes           - Polytechnique Montreal            */
-/*                                                                                 */
-/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
-/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
-/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
-/*  for Data Valorization)                                                         */
-/*                                                                                 */
-/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
-/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
-/*  and Exxon Mobil.                                                               */
-/*                                                                                 */
-/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
-/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
-/*  Exxon Mobil.                                                                   */
-/*                                                                                 */
-/*  Contact information:                                                           */
-/*    Polytechnique Montreal - GERAD                                               */
-/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
-/*    e-mail: nomad@gerad.ca                                                       */
-/*                                                                                 */
-/*  This program is free software: you can redistribute it and/or modify it        */
-/*  under the terms of the GNU Lesser General Public License as published by       */
-/*  the Free Software Foundation, either version 3 of the License, or (at your     */
-/*  option) any later version.                                                     */
-/*                                                                                 */
-/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
-/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
-/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
-/*  for more details.                                                              */
-/*                                                                                 */
-/*  You should have received a copy of the GNU Lesser General Public License       */
-/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
-/*                                                                                 */
-/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
-/*---------------------------------------------------------------------------------*/
 //////////// THIS FILE MUST BE CREATED BY EXECUTING WriteAttributeDefinitionFile ////////////
 //////////// DO NOT MODIFY THIS FILE MANUALLY ///////////////////////////////////////////////
 
@@ -52,6 +6,10 @@
 
 _definition = {
 { "CACHE_FILE",  "std::string",  "",  " Cache file name ",  " \n  \n . Cache file. If the specified file does not exist, it will be created. \n  \n . Argument: one string. \n  \n . If the string is empty, no cache file will be created. \n  \n . Points already in the cache file will not be reevaluated. \n  \n . Example: CACHE_FILE cache.txt \n  \n . Default: Empty string.\n\n",  "  basic cache file  "  , "false" , "false" , "true" },
-{ "CACHE_SIZE_MAX",  "size_t",  "INF",  " Maximum number of evaluation points to be stored in the cache ",  " \n  \n . The cache will be purged from older points if it reaches this number \n   of evaluation points. \n  \n . Argument: one positive integer (expressed in number of evaluation points). \n  \n . Example: CACHE_SIZE_MAX 10000 \n  \n . Default: INF\n\n",  "  advanced cache  "  , "false" , "false" , "true" } };
+{ "CACHE_FILE_FORMAT",  "std::string",  "TEXT",  " Format of the cache file written ",  " \n  \n . Format used to write the cache file given by CACHE_FILE. \n  \n . Argument: one string in {TEXT, BINARY}. \n  \n . TEXT: One line per point, with the point and its blackbox outputs. \n  \n . BINARY: Fixed-size rows of doubles and status bytes. Faster to read and \n   write, and smaller, for large caches. The points evaluated since the last \n   write are appended to the file. \n  \n . Either format is accepted when the cache file is read. \n  \n . Example: CACHE_FILE_FORMAT BINARY \n  \n . Default: TEXT\n\n",  "  advanced cache file binary text  "  , "false" , "false" , "true" },
+{ "CACHE_SAVE_PERIOD",  "size_t",  "0",  " Number of evaluations between two writes of the cache file ",  " \n  \n . The cache file is written during the run each time this number of points \n   were evaluated. It is always written at the end of the run. \n  \n . Argument: one nonnegative integer. 0: Only write the cache file at the end. \n  \n . Ignored if CACHE_FILE is empty. \n  \n . Best used with CACHE_FILE_FORMAT BINARY, for which only the new points \n   are written. \n  \n . Example: CACHE_SAVE_PERIOD 100 \n  \n . Default: 0\n\n",  "  advanced cache file save period  "  , "false" , "false" , "true" },
+{ "CACHE_SIZE_MAX",  "size_t",  "INF",  " Maximum number of evaluation points to be stored in the cache ",  " \n  \n . The cache will be purged from older points if it reaches this number \n   of evaluation points. \n  \n . Argument: one positive integer (expressed in number of evaluation points). \n  \n . Example: CACHE_SIZE_MAX 10000 \n  \n . Default: INF\n\n",  "  advanced cache  "  , "false" , "false" , "true" },
+{ "CACHE_TYPE",  "std::string",  "SET",  " Type of cache ",  " \n  \n . Data structure used to store the evaluation points. \n  \n . Argument: one string in {SET, SHARDED}. \n  \n . SET: A single set of points protected by one lock. \n  \n . SHARDED: The points are distributed by hash into CACHE_NB_SHARDS sets, \n   each one with a reader-writer lock. Lookups do not block each other and \n   an insertion only locks one shard. To be considered when many threads \n   evaluate inexpensive blackboxes in parallel. \n  \n . Example: CACHE_TYPE SHARDED \n  \n . Default: SET\n\n",  "  advanced cache parallel thread threads lock  "  , "false" , "false" , "true" },
+{ "CACHE_NB_SHARDS",  "size_t",  "16",  " Number of shards of the cache when CACHE_TYPE is SHARDED ",  " \n  \n . Number of sets, each with its own lock, used to store the points \n   when CACHE_TYPE is SHARDED. Ignored otherwise. \n  \n . Argument: one positive integer. \n  \n . Example: CACHE_NB_SHARDS 64 \n  \n . Default: 16\n\n",  "  advanced cache parallel thread threads lock  "  , "false" , "false" , "true" } };
 
 #endif
@@ -1,49 +1,3 @@
-/*---------------------------------------------------------------------------------*/
-/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
-/*                                                                                 */
-/*  NOMAD - Version 4 has been created and developed by                            */
-/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
-/*                 Christophe Tribes           - Polytechnique Montreal            */
-/*                                                                                 */
-/*  The copyright of NOMAD - version 4 is owned by                                 */
-/*                 Charles Audet               - Polytechnique Montreal            */
-/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
-/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
-/*                 Christophe Tribes           - Polytechnique Montreal            */
-/*                                                                                 */
-/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
-/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
-/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
-/*  for Data Valorization)                                                         */
-/*                                                                                 */
-/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
-/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
-/*  and Exxon Mobil.                                                               */
-/*                                                                                 */
-/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
-/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
-/*  Exxon Mobil.                                                                   */
-/*                                                                                 */
-/*  Contact information:                                                           */
-/*    Polytechnique Montreal - GERAD                                               */
-/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
-/*    e-mail: nomad@gerad.ca                                                       */
-/*                                                                                 */
-/*  This program is free software: you can redistribute it and/or modify it        */
-/*  under the terms of the GNU Lesser General Public License as published by       */
-/*  the Free Software Foundation, either version 3 of the License, or (at your     */
-/*  option) any later version.                                                     */
-/*                                                                                 */
-/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
-/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
-/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
-/*  for more details.                                                              */
-/*                                                                                 */
-/*  You should have received a copy of the GNU Lesser General Public License       */
-/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
-/*                                                                                 */
-/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
-/*---------------------------------------------------------------------------------*/
 //////////// THIS FILE MUST BE CREATED BY EXECUTING WriteAttributeDefinitionFile ////////////
 //////////// DO NOT MODIFY THIS FILE MANUALLY ///////////////////////////////////////////////
 
@@ -54,7 +8,6 @@ _definition = {
 { "ASYNCHRONOUS",  "bool",  "true",  " Deprecated from Nomad 3: Not implemented ",  " \n . Default: true\n\n",  "  internal  "  , "false" , "false" , "true" },
 { "BB_INPUT_INCLUDE_SEED",  "bool",  "false",  " Deprecated from Nomad 3: Not implemented ",  " \n . Default: false\n\n",  "  internal  "  , "false" , "false" , "true" },
 { "BB_INPUT_INCLUDE_TAG",  "bool",  "false",  " Deprecated from Nomad 3: Not implemented ",  " \n . Default: false\n\n",  "  internal  "  , "false" , "false" , "true" },
-{ "CACHE_SAVE_PERIOD",  "size_t",  "25",  " Deprecated from Nomad 3: Not implemented ",  " \n . Default: 25\n\n",  "  internal  "  , "false" , "false" , "true" },
 { "CACHE_SEARCH",  "bool",  "false",  " Deprecated from Nomad 3: Not implemented ",  " \n . Default: false\n\n",  "  internal  "  , "false" , "false" , "true" },
 { "CLOSED_BRACE",  "std::string",  "}",  " Deprecated from Nomad 3: Not implemented ",  " \n . Default: }\n\n",  "  internal  "  , "false" , "false" , "true" },
 { "DISABLE",  "NOMAD::ArrayOfString",  "",  " Deprecated. DISABLE MODELS is replaced by QUAD_MODEL_SEARCH false and SGTELIB_MODEL_SEARCH false. DISABLE EVAL_SORT is replaced by EVAL_QUEUE_SORT LEXICOGRAPHICAL.",  " \n . Default: Empty string.\n\n",  "  internal  "  , "false" , "false" , "true" },
@@ -1,49 +1,3 @@
-/*---------------------------------------------------------------------------------*/
-/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
-/*                                                                                 */
-/*  NOMAD - Version 4 has been created and developed by                            */
-/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
-/*                 Christophe Tribes           - Polytechnique Montreal            */
-/*                                                                                 */
-/*  The copyright of NOMAD - version 4 is owned by                                 */
-/*                 Charles Audet               - Polytechnique Montreal            */
-/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
-/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
-/*                 Christophe Tribes           - Polytechnique Montreal            */
-/*                                                                                 */
-/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
-/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
-/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
-/*  for Data Valorization)                                                         */
-/*                                                                                 */
-/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
-/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
-/*  and Exxon Mobil.                                                               */
-/*                                                                                 */
-/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
-/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
-/*  Exxon Mobil.                                                                   */
-/*                                                                                 */
-/*  Contact information:                                                           */
-/*    Polytechnique Montreal - GERAD                                               */
-/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
-/*    e-mail: nomad@gerad.ca                                                       */
-/*                                                                                 */
-/*  This program is free software: you can redistribute it and/or modify it        */
-/*  under the terms of the GNU Lesser General Public License as published by       */
-/*  the Free Software Foundation, either version 3 of the License, or (at your     */
-/*  option) any later version.                                                     */
-/*                                                                                 */
-/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
-/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
-/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
-/*  for more details.                                                              */
-/*                                                                                 */
-/*  You should have received a copy of the GNU Lesser General Public License       */
-/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
-/*                                                                                 */
-/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
-/*---------------------------------------------------------------------------------*/
 //////////// THIS FILE MUST BE CREATED BY EXECUTING WriteAttributeDefinitionFile ////////////
 //////////// DO NOT MODIFY THIS FILE MANUALLY ///////////////////////////////////////////////
 
@@ -53,6 +7,9 @@
 _definition = {
 { "DMULTIMADS_EXPANSIONINT_LINESEARCH",  "bool",  "false",  " DMultiMads Expansion integer linesearch ",  " \n  \n . DMultiMads Expansion integer linesearch. Is only active when the problem \n   possesses integer variables. \n  \n . Argument: one boolean ('yes' or 'no') \n  \n . Example: DMULTIMADS_EXPANSIONINT_LINESEARCH yes \n  \n . Default: false\n\n",  "  advanced multi objective algorithm pareto front  "  , "true" , "true" , "true" },
 { "DMULTIMADS_QUAD_MODEL_STRATEGY",  "NOMAD::DMultiMadsQuadSearchType",  "MULTI",  " Quad Model search strategies for DMultiMads ",  " \n . Quad model search strategy used by DMultiMads to generate trial points. \n  \n . Arguments: Quad model search strategy in: \n     DMS   : uses the Direct MultiSearch strategy proposed for the Direct \n     MultiSearch algorithm. The Quad Model search tries to find new non- \n     dominated points by minimizing subsets of objectives in a local region \n     centered around the current frame center; starting from one objective, \n     until minimizing all objectives at the same time. At each level of \n     combinations, the search checks if it finds a non-dominated solution. \n     Otherwise, it increases the number of objectives considered. In the \n     worst case, this strategy has to solve 2^nobj - 1 subproblems, that \n     can be costly. \n     DOM   : uses the Dominance Move strategy. In this case, the Quad model \n     search tries to minimize a 'dominance move' single-objective function, \n     and explores the objective space towards new non-dominated solutions \n     according to the current set of solutions. \n     MULTI : uses the MultiMads strategy. When the current frame center \n     is an extreme solution of the current set of solutions, i.e., it \n     minimizes one of the objective components, the Quad model search \n     starts an expansion phase: it then tries to minimize further the \n     considering objective component. Otherwise, the Quad model search \n     tries to find new non-dominated solutions in a local region of \n     the objective space defined by the current frame center and some \n     of its 'closest' neighbors. \n  \n . This parameter is active only when QUAD_MODEL_SEARCH is set to TRUE. \n   This is the case by default. \n  \n . Example: DMULTIMADS_QUAD_MODEL_STRATEGY DMS \n  \n . Default: MULTI\n\n",  "  advanced multi objective algorithm pareto front  "  , "true" , "true" , "true" },
+{ "DMULTIMADS_HV_REFERENCE_POINT",  "NOMAD::ArrayOfString",  "",  " Reference point for the DMultiMads hypervolume ",  " \n  \n . Reference point (one value per objective) used to compute the hypervolume \n   of the feasible Pareto front approximation (stats HYPERVOLUME and stopping \n   criterion DMULTIMADS_HV_STALL_ITERATIONS). Only the points that strictly \n   dominate the reference point contribute to the hypervolume. \n  \n . The hypervolume is computed for 2 and 3 objectives. \n  \n . When not provided, the reference point is set from the first feasible \n   points: their nadir point, shifted by 10% of the range of each objective. \n   It is kept for the rest of the optimization. \n  \n . Argument: list of values, one per objective \n  \n . Example: DMULTIMADS_HV_REFERENCE_POINT 10 10 \n  \n . Default: Empty string.\n\n",  "  advanced multi objective algorithm pareto front hypervolume stats  "  , "false" , "false" , "true" },
+{ "DMULTIMADS_HV_STALL_ITERATIONS",  "size_t",  "INF",  " Stop DMultiMads when the hypervolume stalls ",  " \n  \n . DMultiMads stops when the hypervolume of the feasible Pareto front \n   approximation has not improved by more than DMULTIMADS_HV_STALL_TOLERANCE \n   (relative improvement) during this number of consecutive iterations. \n  \n . Only used with 2 or 3 objectives (see DMULTIMADS_HV_REFERENCE_POINT). \n  \n . Argument: one positive integer. \n  \n . Example: DMULTIMADS_HV_STALL_ITERATIONS 100 \n  \n . Default: INF\n\n",  "  advanced multi objective algorithm pareto front hypervolume stop stops stopping criterion criterions  "  , "true" , "true" , "true" },
+{ "DMULTIMADS_HV_STALL_TOLERANCE",  "NOMAD::Double",  "1E-4",  " Relative hypervolume improvement for DMULTIMADS_HV_STALL_ITERATIONS ",  " \n  \n . Minimal relative improvement of the hypervolume for an iteration not to be \n   counted as a stall (see DMULTIMADS_HV_STALL_ITERATIONS). \n  \n . Argument: one non negative real. \n  \n . Example: DMULTIMADS_HV_STALL_TOLERANCE 1E-3 \n  \n . Default: 1E-4\n\n",  "  advanced multi objective algorithm pareto front hypervolume stop stops stopping criterion criterions  "  , "true" , "true" , "true" },
 { "DMULTIMADS_MIDDLEPOINT_SEARCH",  "bool",  "false",  " DMultiMads Middle Point search ",  " \n  \n . DMultiMads Middle Point search. \n  \n . Argument: one boolean ('yes' or 'no') \n  \n . Example: DMULTIMADS_MIDDLEPOINT_SEARCH no \n  \n . Default: false\n\n",  "  advanced multi objective algorithm pareto front  "  , "true" , "true" , "true" },
 { "DMULTIMADS_MIDDLEPOINT_SEARCH_CACHE_MAX",  "size_t",  "50",  " DMultiMads middle point search ",  " \n  \n . Number of times the Middle Point search for DMultiMads is allowed to \n   consult the cache for each objective. When the maximum number of tentatives \n   is reached, no point is generated by the Middle Point search for the current \n   objective. \n  \n . Argument: one positive integer < INF. \n  \n . Example: DMULTIMADS_MIDDLEPOINT_SEARCH_CACHE_MAX 50 \n  \n . Default: 50\n\n",  "  advanced multi objective algorithm pareto front  "  , "true" , "true" , "true" },
 { "DMULTIMADS_NM_STRATEGY",  "NOMAD::DMultiMadsNMSearchType",  "DOM",  " Nelder-Mead search strategies for DMultiMads ",  " \n . Nelder-Mead search strategy used by DMultiMads to generate trial points. \n  \n . Arguments: Nelder-Mead search strategy in: \n     DOM   : uses the Dominance Move strategy. In this case, the NM search \n     tries to minimize a 'dominance move' single-objective function, and \n     explores the objective space towards new non-dominated solutions \n     according to the current set of solutions. \n     MULTI : uses the MultiMads strategy. When the current frame center \n     is an extreme solution of the current set of solutions, i.e., it \n     minimizes one of the objective components, the NM search starts \n     an expansion phase: it then tries to minimize further the \n     considering objective component. Otherwise, the NM search tries to \n     find new non-dominated solutions in a local region of the objective \n     space defined by the current frame center and some of its \n     'closest' neighbors. \n  \n . This parameter is active only when NM_SEARCH is set to TRUE. \n   This is the case by default. \n  \n . Example: DMULTIMADS_NM_STRATEGY MULTI \n  \n . Default: DOM\n\n",  "  advanced multi objective algorithm pareto front  "  , "true" , "true" , "true" },
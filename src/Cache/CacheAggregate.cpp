@@ -0,0 +1,437 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheAggregate.cpp
+ * \brief  Running aggregates over the evaluated points of a cache
+ * \see    CacheAggregate.hpp
+ */
+
+#include "../Cache/CacheAggregate.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+
+NOMAD::CacheAggregate::CacheAggregate(const NOMAD::FHComputeType& computeType, const size_t nbObj)
+  : _computeType(computeType),
+    _nbObj(nbObj),
+    _nbFeas(0),
+    _nbInf(0),
+    _sumF(0.0),
+    _nbF(0),
+    _nbInfNoFront(0),
+    _bestFeas(),
+    _infFront()
+{
+}
+
+
+bool NOMAD::CacheAggregate::isSupported(const NOMAD::FHComputeType& computeType)
+{
+    // f and h must only depend on the blackbox outputs.
+    const auto evalType = computeType.evalType;
+    const auto type = computeType.fhComputeTypeS.computeType;
+    return ((NOMAD::EvalType::BB == evalType || NOMAD::EvalType::SURROGATE == evalType)
+            && (NOMAD::ComputeType::STANDARD == type || NOMAD::ComputeType::PHASE_ONE == type));
+}
+
+
+bool NOMAD::CacheAggregate::isFor(const NOMAD::FHComputeType& computeType) const
+{
+    return (_computeType.evalType == computeType.evalType
+            && _computeType.fhComputeTypeS.computeType == computeType.fhComputeTypeS.computeType
+            && _computeType.fhComputeTypeS.hNormType == computeType.fhComputeTypeS.hNormType);
+}
+
+
+bool NOMAD::CacheAggregate::isAggregated(const NOMAD::EvalPoint& evalPoint)
+{
+    return (NOMAD::EvalStatusType::EVAL_OK == evalPoint.getEvalStatus(NOMAD::EvalType::BB)
+            || NOMAD::EvalStatusType::EVAL_OK == evalPoint.getEvalStatus(NOMAD::EvalType::SURROGATE));
+}
+
+
+void NOMAD::CacheAggregate::add(const NOMAD::EvalPoint& evalPoint)
+{
+    const NOMAD::Eval* eval = evalPoint.getEval(_computeType.evalType);
+    if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+    {
+        return;
+    }
+
+    const auto computeTypeS = _computeType.Short();
+    const NOMAD::Double f = eval->getF(computeTypeS);
+    if (f.isDefined())
+    {
+        _sumF += f.todouble();
+        _nbF++;
+    }
+
+    if (eval->isFeasible(computeTypeS))
+    {
+        _nbFeas++;
+        addBestFeas(evalPoint, *eval);
+    }
+    else
+    {
+        _nbInf++;
+        addInfFront(evalPoint, *eval);
+    }
+}
+
+
+bool NOMAD::CacheAggregate::update(const NOMAD::EvalPoint& before, const NOMAD::EvalPoint& after)
+{
+    const NOMAD::Eval* evalBefore = before.getEval(_computeType.evalType);
+    const NOMAD::Eval* evalAfter = after.getEval(_computeType.evalType);
+    if (nullptr != evalBefore && nullptr != evalAfter
+        && NOMAD::EvalStatusType::EVAL_OK == evalBefore->getEvalStatus()
+        && NOMAD::EvalStatusType::EVAL_OK == evalAfter->getEvalStatus()
+        && evalBefore->getBBO() == evalAfter->getBBO())
+    {
+        // Same f and h. Only keep the updated point (mesh, revealing status, other evals).
+        for (auto& evalPoint : _bestFeas)
+        {
+            if (*evalPoint.getX() == *after.getX())
+            {
+                evalPoint = after;
+            }
+        }
+        for (auto& frontPoint : _infFront)
+        {
+            if (*frontPoint._evalPoint.getX() == *after.getX())
+            {
+                frontPoint._evalPoint = after;
+            }
+        }
+        return true;
+    }
+
+    if (!remove(before))
+    {
+        return false;
+    }
+    add(after);
+
+    return true;
+}
+
+
+void NOMAD::CacheAggregate::processOnAllPoints(void (*func)(NOMAD::EvalPoint&), const int mainThreadNum)
+{
+    auto process = [&](NOMAD::EvalPoint& evalPoint)
+    {
+        if (-1 == mainThreadNum || evalPoint.getThreadAlgo() == mainThreadNum)
+        {
+            func(evalPoint);
+        }
+    };
+    std::for_each(_bestFeas.begin(), _bestFeas.end(), process);
+    for (auto& frontPoint : _infFront)
+    {
+        process(frontPoint._evalPoint);
+    }
+}
+
+
+bool NOMAD::CacheAggregate::remove(const NOMAD::EvalPoint& evalPoint)
+{
+    const NOMAD::Eval* eval = evalPoint.getEval(_computeType.evalType);
+    if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+    {
+        return true;
+    }
+
+    const auto computeTypeS = _computeType.Short();
+    const NOMAD::Double f = eval->getF(computeTypeS);
+    if (f.isDefined())
+    {
+        if (!std::isfinite(f.todouble()))
+        {
+            // The sum is not finite anymore: Cannot remove f from it.
+            return false;
+        }
+        _sumF -= f.todouble();
+        _nbF--;
+    }
+
+    auto isSamePoint = [&evalPoint](const NOMAD::EvalPoint& other)
+    {
+        return (*other.getX() == *evalPoint.getX());
+    };
+
+    if (eval->isFeasible(computeTypeS))
+    {
+        _nbFeas--;
+        auto it = std::find_if(_bestFeas.begin(), _bestFeas.end(), isSamePoint);
+        if (it != _bestFeas.end())
+        {
+            _bestFeas.erase(it);
+            // The next best feasible points are not known.
+            if (_bestFeas.empty() && _nbFeas > 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    _nbInf--;
+    NOMAD::Double frontF, frontH;
+    if (!getFrontFH(*eval, frontF, frontH))
+    {
+        return true;
+    }
+    if (!frontF.isDefined())
+    {
+        _nbInfNoFront--;
+        return true;
+    }
+    auto it = std::find_if(_infFront.begin(), _infFront.end(),
+                           [&isSamePoint](const FrontPoint& frontPoint) { return isSamePoint(frontPoint._evalPoint); });
+    if (it != _infFront.end())
+    {
+        const NOMAD::Double removedF = it->_f;
+        const NOMAD::Double removedH = it->_h;
+        _infFront.erase(it);
+        // If no other point has the same f and h, points that were dominated
+        // by this one may now be on the front.
+        auto sameFH = [&removedF, &removedH](const FrontPoint& frontPoint)
+        {
+            return (frontPoint._f == removedF && frontPoint._h == removedH);
+        };
+        if (std::none_of(_infFront.begin(), _infFront.end(), sameFH))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+size_t NOMAD::CacheAggregate::computeMeanF(NOMAD::Double& mean) const
+{
+    mean.reset();
+    if (_nbF > 0)
+    {
+        mean = _sumF / (double)_nbF;
+    }
+
+    return _nbF;
+}
+
+
+void NOMAD::CacheAggregate::getBestFeas(std::vector<NOMAD::EvalPoint>& evalPointList) const
+{
+    evalPointList = _bestFeas;
+}
+
+
+bool NOMAD::CacheAggregate::getBestInf(std::vector<NOMAD::EvalPoint>& evalPointList, const NOMAD::Double& hMax) const
+{
+    if (1 != _nbObj || _nbInfNoFront > 0)
+    {
+        return false;
+    }
+
+    evalPointList.clear();
+
+    // Points with h <= hMax: [0, end)
+    size_t end = 0;
+    while (end < _infFront.size() && _infFront[end]._h <= hMax)
+    {
+        end++;
+    }
+    if (0 == end)
+    {
+        return true;
+    }
+
+    auto sameFH = [this](const size_t i, const size_t j)
+    {
+        return (_infFront[i]._f == _infFront[j]._f && _infFront[i]._h == _infFront[j]._h);
+    };
+
+    // Least infeasible points first: [0, leastInfEnd).
+    size_t leastInfEnd = 1;
+    while (leastInfEnd < end && sameFH(0, leastInfEnd))
+    {
+        leastInfEnd++;
+    }
+    for (size_t i = 0; i < leastInfEnd; i++)
+    {
+        evalPointList.push_back(_infFront[i]._evalPoint);
+    }
+
+    // Then points with the best f: [bestFBegin, end), if they are not the same.
+    // As in CacheBase::findBestInf(), an infinite f is never the best f.
+    if (!(_infFront[end - 1]._f < NOMAD::INF))
+    {
+        return true;
+    }
+    size_t bestFBegin = end - 1;
+    while (bestFBegin > leastInfEnd && sameFH(bestFBegin - 1, end - 1))
+    {
+        bestFBegin--;
+    }
+    for (size_t i = std::max(bestFBegin, leastInfEnd); i < end; i++)
+    {
+        evalPointList.push_back(_infFront[i]._evalPoint);
+    }
+
+    return true;
+}
+
+
+// Same conditions as findBest() with Eval::compEvalFindBest, feasible points and hMax = 0.
+void NOMAD::CacheAggregate::addBestFeas(const NOMAD::EvalPoint& evalPoint, const NOMAD::Eval& eval)
+{
+    const auto computeTypeS = _computeType.Short();
+    const NOMAD::Double h = eval.getH(computeTypeS);
+    if (!h.isDefined() || h > 0.0)
+    {
+        return;
+    }
+
+    if (_bestFeas.empty())
+    {
+        _bestFeas.push_back(evalPoint);
+        return;
+    }
+
+    const NOMAD::Eval* refEval = _bestFeas[0].getEval(_computeType.evalType);
+    if (eval == *refEval)
+    {
+        _bestFeas.push_back(evalPoint);
+    }
+    else if (NOMAD::Eval::compEvalFindBest(eval, *refEval, computeTypeS))
+    {
+        _bestFeas.clear();
+        _bestFeas.push_back(evalPoint);
+    }
+}
+
+
+// Same conditions as CacheBase::findBestInf().
+bool NOMAD::CacheAggregate::getFrontFH(const NOMAD::Eval& eval, NOMAD::Double& f, NOMAD::Double& h) const
+{
+    const auto computeTypeS = _computeType.Short();
+    h = eval.getH(computeTypeS);
+    if (!h.isDefined() || h == NOMAD::INF)
+    {
+        return false;
+    }
+    if (NOMAD::getNbObj(eval.getBBOutputTypeList()) != _nbObj)
+    {
+        return false;
+    }
+
+    f.reset();
+    const NOMAD::ArrayOfDouble& fs = eval.getFs(computeTypeS);
+    if (1 == _nbObj && 1 == fs.size() && fs[0].isDefined())
+    {
+        f = fs[0];
+    }
+
+    return true;
+}
+
+
+void NOMAD::CacheAggregate::addInfFront(const NOMAD::EvalPoint& evalPoint, const NOMAD::Eval& eval)
+{
+    NOMAD::Double f, h;
+    if (!getFrontFH(eval, f, h))
+    {
+        return;
+    }
+    if (!f.isDefined())
+    {
+        _nbInfNoFront++;
+        return;
+    }
+
+    // The front is ordered by increasing h and decreasing f.
+    // pos: first point with a larger h.
+    size_t pos = 0;
+    while (pos < _infFront.size() && _infFront[pos]._h <= h)
+    {
+        pos++;
+    }
+
+    if (pos > 0)
+    {
+        // Point with the smallest f among the points with a smaller or equal h.
+        const FrontPoint& previous = _infFront[pos - 1];
+        if (previous._f == f && previous._h == h)
+        {
+            // Same f and h as a point of the front: Add it to its group.
+            _infFront.insert(_infFront.begin() + pos, {f, h, evalPoint});
+            return;
+        }
+        if (previous._f <= f)
+        {
+            // Dominated
+            return;
+        }
+    }
+
+    // Remove the points dominated by the new point:
+    // Points with the same h before pos, and points with a larger or equal f after pos.
+    size_t first = pos;
+    while (first > 0 && _infFront[first - 1]._h == h)
+    {
+        first--;
+    }
+    size_t last = pos;
+    while (last < _infFront.size() && _infFront[last]._f >= f)
+    {
+        last++;
+    }
+    _infFront.erase(_infFront.begin() + first, _infFront.begin() + last);
+    _infFront.insert(_infFront.begin() + first, {f, h, evalPoint});
+}
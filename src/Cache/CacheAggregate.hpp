@@ -0,0 +1,177 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheAggregate.hpp
+ * \brief  Running aggregates over the evaluated points of a cache
+ * \see    CacheAggregate.cpp
+ */
+
+#ifndef __NOMAD_4_5_CACHEAGGREGATE__
+#define __NOMAD_4_5_CACHEAGGREGATE__
+
+#include <vector>
+
+#include "../Eval/EvalPoint.hpp"
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Aggregated information on the points of a cache, for one way to compute f and h.
+/**
+ * Kept up to date by the cache when points are inserted or updated, so that
+ * the cache can answer hasFeas(), hasInfeas(), computeMeanF(), findBestFeas()
+ * and findBestInf() without going through all its points:
+ *
+ * - Number of feasible and infeasible points, with eval status EVAL_OK.
+ * - Sum of f over these points, for the mean f.
+ * - Best feasible points: The points that findBest() would find with
+ *   Eval::compEvalFindBest.
+ * - Infeasible front: The infeasible points that are not dominated in (f, h),
+ *   ordered by increasing h. The best infeasible points for any hMax are on
+ *   this front. Only for a single objective.
+ *
+ * Removing a point from the best feasible points or from the front may
+ * require to look at points that are not kept here: In that case, the
+ * aggregate must be rebuilt from the whole cache.
+ *
+ * \note Only the f and h computations that depend on the blackbox outputs
+ * alone (STANDARD and PHASE_ONE) for BB and SURROGATE evals are supported.
+ */
+class CacheAggregate
+{
+private:
+    /// A point of the infeasible front, with its f and h
+    struct FrontPoint
+    {
+        Double      _f;
+        Double      _h;
+        EvalPoint   _evalPoint;
+    };
+
+    FHComputeType           _computeType;   ///< How to compute f and h
+    size_t                  _nbObj;         ///< Number of objectives in BB_OUTPUT_TYPE
+    size_t                  _nbFeas;        ///< Number of feasible points
+    size_t                  _nbInf;         ///< Number of infeasible points
+    double                  _sumF;          ///< Sum of the defined f values
+    size_t                  _nbF;           ///< Number of defined f values
+    size_t                  _nbInfNoFront;  ///< Number of infeasible points that cannot be placed on the front
+    std::vector<EvalPoint>  _bestFeas;      ///< Best feasible points
+    std::vector<FrontPoint> _infFront;      ///< Non dominated infeasible points, by increasing h
+
+public:
+    /// Constructor
+    /**
+     \param computeType     How to compute f and h                      -- \b IN.
+     \param nbObj           Number of objectives in BB_OUTPUT_TYPE       -- \b IN.
+     */
+    CacheAggregate(const FHComputeType& computeType, const size_t nbObj);
+
+    /// Verify if aggregates can be maintained for this way to compute f and h.
+    static bool isSupported(const FHComputeType& computeType);
+
+    /// Verify if this aggregate is for this way to compute f and h.
+    bool isFor(const FHComputeType& computeType) const;
+
+    /// Verify if the point is counted in some aggregate: It has a BB or SURROGATE eval with status EVAL_OK.
+    static bool isAggregated(const EvalPoint& evalPoint);
+
+    /// Add a point, new in cache or just updated.
+    void add(const EvalPoint& evalPoint);
+
+    /// Take into account an update of a point already added.
+    /**
+     \param before      The point before the update     -- \b IN.
+     \param after       The point after the update      -- \b IN.
+     \return            \c false if the aggregate must be rebuilt.
+     */
+    bool update(const EvalPoint& before, const EvalPoint& after);
+
+    /// Call function func() on the points kept, for Evals that were generated by mainThreadNum.
+    /**
+     * Mirrors CacheBase::processOnAllPoints() on the points kept here.
+     * \note func must not modify the BB or SURROGATE evaluations.
+     */
+    void processOnAllPoints(void (*func)(EvalPoint&), const int mainThreadNum);
+
+    bool hasFeas() const { return _nbFeas > 0; }
+    bool hasInfeas() const { return _nbInf > 0; }
+
+    /// Mean of the defined f values. Return the number of these values.
+    size_t computeMeanF(Double& mean) const;
+
+    /// Get the best feasible points, as found by findBest() with Eval::compEvalFindBest.
+    void getBestFeas(std::vector<EvalPoint>& evalPointList) const;
+
+    /// Get the best infeasible points with h <= hMax, as found by CacheBase::findBestInf().
+    /**
+     \return \c false if the front is not available and the points must be found in cache.
+     */
+    bool getBestInf(std::vector<EvalPoint>& evalPointList, const Double& hMax) const;
+
+private:
+
+    /// Remove a point. Return false if the aggregate must be rebuilt.
+    bool remove(const EvalPoint& evalPoint);
+
+    /// Helper for add: feasible point
+    void addBestFeas(const EvalPoint& evalPoint, const Eval& eval);
+
+    /// Helper for add: infeasible point
+    void addInfFront(const EvalPoint& evalPoint, const Eval& eval);
+
+    /// Helper for add and remove: Get f and h of an infeasible point that may be on the front.
+    /**
+     \return \c false if the point is never a best infeasible point.
+     Otherwise, \c f is undefined if the point cannot be placed on the front.
+     */
+    bool getFrontFH(const Eval& eval, Double& f, Double& h) const;
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_CACHEAGGREGATE__
@@ -53,8 +53,18 @@
  */
 
 #include "../Cache/CacheBase.hpp"
+#include "../Cache/CacheFileBinary.hpp"
+#include "../Output/OutputQueue.hpp"
 #include "../Util/fileutils.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <list>
+
+// Init static members
+NOMAD::BBOutputTypeList NOMAD::CacheBase::_bbOutputType = NOMAD::BBOutputTypeList();
+NOMAD::ArrayOfDouble NOMAD::CacheBase::_bbEvalFormat = NOMAD::ArrayOfDouble();
+
 
 // Initialize CacheBase class.
 // To be called by the Constructor.
@@ -68,6 +78,8 @@ void NOMAD::CacheBase::init()
 
     _maxSize  = _cacheParams->getAttributeValue<size_t>("CACHE_SIZE_MAX") ;
     _filename = _cacheParams->getAttributeValue<std::string>("CACHE_FILE");
+    _binaryCacheFile = ("BINARY" == _cacheParams->getAttributeValue<std::string>("CACHE_FILE_FORMAT"));
+    _savePeriod = _cacheParams->getAttributeValue<size_t>("CACHE_SAVE_PERIOD");
     // Verify filename has full path, otherwise, confusion will arise
     if (!_filename.empty() && !NOMAD::isAbsolute(_filename))
     {
@@ -90,3 +102,1150 @@ size_t NOMAD::CacheBase::getAllPoints(std::vector<NOMAD::EvalPoint> &evalPointLi
     return find(isTrue, evalPointList);
 }
 
+
+
+size_t NOMAD::CacheBase::findWithinRadius(const NOMAD::Point& X,
+                                          const NOMAD::Double& radius,
+                                          std::function<bool(const NOMAD::EvalPoint&)> crit,
+                                          std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    auto critRadius = [&](const NOMAD::EvalPoint& evalPoint)
+    {
+        return (X.size() == evalPoint.size()
+                && NOMAD::Point::dist(X, *evalPoint.getX()).todouble() <= radius.todouble()
+                && crit(evalPoint));
+    };
+    return find(critRadius, evalPointList);
+}
+
+
+size_t NOMAD::CacheBase::findKNearest(const NOMAD::Point& X,
+                                      const size_t k,
+                                      std::function<bool(const NOMAD::EvalPoint&)> crit,
+                                      std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    auto critSize = [&](const NOMAD::EvalPoint& evalPoint)
+    {
+        return (X.size() == evalPoint.size() && crit(evalPoint));
+    };
+    find(critSize, evalPointList);
+
+    std::vector<std::pair<double, size_t>> distances;
+    distances.reserve(evalPointList.size());
+    for (size_t i = 0; i < evalPointList.size(); i++)
+    {
+        distances.emplace_back(NOMAD::Point::dist(X, *evalPointList[i].getX()).todouble(), i);
+    }
+    const size_t nbKept = std::min(k, distances.size());
+    std::partial_sort(distances.begin(), distances.begin() + nbKept, distances.end());
+
+    std::vector<NOMAD::EvalPoint> nearest;
+    nearest.reserve(nbKept);
+    for (size_t i = 0; i < nbKept; i++)
+    {
+        nearest.push_back(evalPointList[distances[i].second]);
+    }
+    evalPointList = std::move(nearest);
+
+    return evalPointList.size();
+}
+
+
+void NOMAD::CacheBase::verifyPointComplete(const NOMAD::Point& point) const
+{
+    if (!point.isComplete())
+    {
+        std::string err = "Error: Cache does not support incomplete points.";
+        err += " Got point: " + point.display();
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+}
+
+
+void NOMAD::CacheBase::verifyPointSize(const NOMAD::Point& point) const
+{
+    if (0 != size() && _n != point.size())
+    {
+        std::string err = "Error: Cache method called with a point of size ";
+        err += std::to_string(point.size());
+        err += ": " + point.display();
+        err += ". Cache needs points of size " + std::to_string(_n);
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+}
+
+
+void NOMAD::CacheBase::verifyPointComplete(const NOMAD::EvalPoint& evalPoint) const
+{
+    verifyPointComplete(*(evalPoint.getX()));
+}
+
+
+void NOMAD::CacheBase::verifyPointSize(const NOMAD::EvalPoint& evalPoint) const
+{
+    verifyPointSize(*(evalPoint.getX()));
+}
+
+
+// Return a boolean indicating if we should eval the point after an insertion in cache.
+// If insertion worked, the point was not in the cache before. Return true.
+// If insertion did not work, the point was in the cache before.
+// Depending on its EvalStatus, return true if it should be evaluated again,
+// false otherwise.
+bool NOMAD::CacheBase::toEvalAfterInsert(const NOMAD::EvalPoint& evalPointInCache,
+                                         const NOMAD::EvalPoint& evalPoint,
+                                         const bool inserted,
+                                         const short maxNumberEval,
+                                         const NOMAD::EvalType evalType) const
+{
+    bool canEval = evalPointInCache.toEval(maxNumberEval, evalType);
+    bool doEval = canEval;
+    
+    if (-1 == evalPoint.getTag())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__," Eval point should have its tag set before smart insert.");
+    }
+
+    if (inserted && canEval)
+    {
+        doEval = true;
+    }
+    else if (nullptr == evalPointInCache.getEval(evalType))
+    {
+        // Point already in cache, but not evaluated.
+        // NOTE: We do not know if this point is in the evaluation queue yet, or not.
+        // We do not know here if the evaluation queue is cleared between runs.
+        // If doEval is set to true, the point could be evaluated twice.
+        // If doEval is set to false, there might be cases where it is not evaluated at all.
+
+        // Only warn when in blackbox context.
+        if (NOMAD::EvalType::BB == evalType)
+        {
+
+            // Upate the tag of point already in cache but not evaluated
+            evalPointInCache.setTag(evalPoint.getTag());
+            
+            OUTPUT_INFO_START
+            std::string s = "Point already in cache (but not BB evaluated): ";
+            s += evalPointInCache.display();
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
+            OUTPUT_INFO_END
+
+            // Avoid re-evaluating BB.
+            doEval = canEval;
+        }
+        else if (NOMAD::EvalType::MODEL == evalType)
+        {
+            // It is ok to re-evaluate MODEL points.
+            doEval = true;
+        }
+        else if (NOMAD::EvalType::SURROGATE == evalType)
+        {
+            doEval = canEval;
+        }
+    }
+    else
+    {
+        // Cache hit.
+        doEval = canEval;
+
+        // Only count as cache hit when using Blackbox Eval.
+        if (!inserted && NOMAD::EvalType::BB == evalType)
+        {
+            _nbCacheHits++;
+            OUTPUT_INFO_START
+            std::string s = "Cache hit: ";
+            s += evalPointInCache.display();
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
+            OUTPUT_INFO_END
+        }
+        if (doEval)
+        {
+            std::cout << "Warning: Cache: smartInsert: New evaluation of point found in cache " << evalPointInCache.display() << std::endl;
+        }
+    }
+
+    return doEval;
+}
+
+
+size_t NOMAD::CacheBase::find(const NOMAD::Point& x, std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    verifyPointComplete(x);
+    verifyPointSize(x);
+    evalPointList.clear();
+
+    NOMAD::EvalPoint evalPoint;
+    size_t found = find(x, evalPoint);
+    if (found > 0)
+    {
+        evalPointList.push_back(evalPoint);
+    }
+    return found;
+}
+
+
+size_t NOMAD::CacheBase::find(const NOMAD::Eval &refeval,
+                              std::function<bool(const NOMAD::Eval&, const NOMAD::Eval&, const NOMAD::FHComputeTypeS&)> comp,
+                              std::vector<NOMAD::EvalPoint> &evalPointList,
+                              const NOMAD::FHComputeType& computeType) const
+{
+    evalPointList.clear();
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(computeType.evalType);
+        if (nullptr != eval && comp(*eval, refeval, computeType.Short()))
+        {
+            evalPointList.push_back(evalPoint);
+        }
+    });
+
+    return evalPointList.size();
+}
+
+
+// Get best eval points, using comp()
+size_t NOMAD::CacheBase::findBest(std::function<bool(const NOMAD::Eval&, const NOMAD::Eval&, const NOMAD::FHComputeTypeS&)> comp,
+                                  std::vector<NOMAD::EvalPoint> &evalPointList,
+                                  const bool findFeas,
+                                  const NOMAD::Double& hMax,
+                                  const NOMAD::Point& fixedVariable,
+                                  const NOMAD::FHComputeType& computeType) const
+{
+    evalPointList.clear();
+    NOMAD::Eval refeval;
+
+    auto evalType = computeType.evalType;
+    auto compactComputeType = computeType.Short();
+
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(evalType);
+        if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+        {
+            return;
+        }
+        if (findFeas != eval->isFeasible(compactComputeType))
+        {
+            return;
+        }
+        NOMAD::Double h = eval->getH(compactComputeType);
+        if (! h.isDefined())
+        {
+            return;
+        }
+        // If hMax == INF all infeasible points (PB and EB) are considered. Otherwise, only h <=hMax are considered
+        if ( hMax < NOMAD::INF && h > hMax )
+        {
+            return;
+        }
+        // Must be in the subspace defined by fixedVariable
+        if (!evalPoint.hasFixed(fixedVariable))
+        {
+            return;
+        }
+
+        if (refeval.getEvalStatus()==NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED)
+        {
+            // Found first point
+            refeval = *eval;
+            evalPointList.push_back(evalPoint);
+        }
+        else if (*eval == refeval)
+        {
+            // Found a point with eval == refeval
+            evalPointList.push_back(evalPoint);
+        }
+        else if (comp(*eval, refeval, compactComputeType))
+        {
+            // Found a better point
+            refeval = *eval;
+            // Reset list with new best
+            evalPointList.clear();
+            evalPointList.push_back(evalPoint);
+        }
+    });
+
+    return evalPointList.size();
+}
+
+
+bool NOMAD::CacheBase::hasFeas(const NOMAD::FHComputeType& computeType) const
+{
+    bool ret = false;
+
+    if (queryAggregate(computeType, [&ret](const NOMAD::CacheAggregate& aggregate) { ret = aggregate.hasFeas(); }))
+    {
+        return ret;
+    }
+
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (ret)
+        {
+            return;
+        }
+        const NOMAD::Eval* eval = evalPoint.getEval(computeType.evalType);
+        if (nullptr != eval
+            && NOMAD::EvalStatusType::EVAL_OK == eval->getEvalStatus()
+            && eval->isFeasible(computeType.Short()))
+        {
+            ret = true;
+        }
+    });
+
+    return ret;
+}
+
+
+bool NOMAD::CacheBase::hasInfeas(const NOMAD::FHComputeType& computeType) const
+{
+    bool ret = false;
+
+    if (queryAggregate(computeType, [&ret](const NOMAD::CacheAggregate& aggregate) { ret = aggregate.hasInfeas(); }))
+    {
+        return ret;
+    }
+
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (ret)
+        {
+            return;
+        }
+        const NOMAD::Eval* eval = evalPoint.getEval(computeType.evalType);
+        if (nullptr != eval
+            && NOMAD::EvalStatusType::EVAL_OK == eval->getEvalStatus()
+            && !eval->isFeasible(computeType.Short()))
+        {
+            ret = true;
+        }
+    });
+
+    return ret;
+}
+
+
+size_t NOMAD::CacheBase::find(const NOMAD::Point & X,
+                              std::function<bool(const NOMAD::Point&, const NOMAD::EvalPoint &)> crit,
+                              std::vector<NOMAD::EvalPoint> &evalPointList,
+                              int maxEvalPoints) const
+{
+    verifyPointComplete(X);
+    verifyPointSize(X);
+    evalPointList.clear();
+
+    bool stopWhenMaxFound = (maxEvalPoints > 0);
+    bool errSizeDisplayed = false;  // Error about size to be displayed only once.
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (stopWhenMaxFound && evalPointList.size() >= (size_t)maxEvalPoints)
+        {
+            return;
+        }
+        if (X.size() != evalPoint.size())
+        {
+            if (!errSizeDisplayed)
+            {
+                std::cout << "Warning: Cache: find: Looking for a point of size " << X.size() << " but found cache point of size " << evalPoint.size() << std::endl;
+                errSizeDisplayed = true;
+            }
+            return; // Points are in different dimensions -skip.
+        }
+
+        if (crit(X, evalPoint))
+        {
+            evalPointList.push_back(evalPoint);
+        }
+    });
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheBase::find(std::function<bool(const NOMAD::EvalPoint&)> crit,
+                              std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    evalPointList.clear();
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (crit(evalPoint))
+        {
+            evalPointList.push_back(evalPoint);
+        }
+    });
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheBase::find(std::function<bool(const NOMAD::EvalPoint&)> crit1,
+                              std::function<bool(const NOMAD::EvalPoint&)> crit2,
+                              std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    evalPointList.clear();
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (crit1(evalPoint) && crit2(evalPoint))
+        {
+            evalPointList.push_back(evalPoint);
+        }
+    });
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheBase::findBestFeas(std::vector<NOMAD::EvalPoint> &evalPointList,
+                                      const NOMAD::Point& fixedVariable,
+                                      const NOMAD::FHComputeType & completeComputeType) const
+{
+    evalPointList.clear();
+    auto compactComputeType = completeComputeType.Short();
+    auto computeType = compactComputeType.computeType;
+    auto evalType = completeComputeType.evalType;
+
+    size_t nobj = 0;
+    for (const auto & bbo: getBbOutputType())
+    {
+        if (bbo.isObjective())
+        {
+            nobj += 1;
+        }
+    }
+
+    if (((computeType == NOMAD::ComputeType::STANDARD) && (nobj == 1)) ||
+        ((computeType == NOMAD::ComputeType::DMULTI_COMBINE_F) && (nobj > 1 )) ||
+        computeType == NOMAD::ComputeType::PHASE_ONE ||
+        computeType == NOMAD::ComputeType::UNDEFINED ||
+        computeType == NOMAD::ComputeType::USER      )
+    {
+        if (!fixedVariable.isDefined()
+            && queryAggregate(completeComputeType, [&evalPointList](const NOMAD::CacheAggregate& aggregate) { aggregate.getBestFeas(evalPointList); }))
+        {
+            return evalPointList.size();
+        }
+        findBest(NOMAD::Eval::compEvalFindBest, evalPointList, true, 0,
+                 fixedVariable, completeComputeType);
+        return evalPointList.size();
+    }
+
+
+    std::list<NOMAD::EvalPoint> tmpEvalPointList;
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(evalType);
+        if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+        {
+            return;
+        }
+        if (!eval->isFeasible(compactComputeType))
+        {
+            return;
+        }
+        // Must be in the subspace defined byFixedVariable
+        if (!evalPoint.hasFixed(fixedVariable))
+        {
+            return;
+        }
+        // For robustness, be sure the cache picks up points which
+        // have the same number of objectives
+        size_t nobjEval = 0;
+        for (const auto & bbo: eval->getBBOutputTypeList())
+        {
+            if (bbo.isObjective())
+            {
+                nobjEval += 1;
+            }
+        }
+        if (nobjEval != nobj)
+        {
+            return;
+        }
+
+        // Found first point
+        if (tmpEvalPointList.empty())
+        {
+            tmpEvalPointList.push_back(evalPoint);
+            return;
+        }
+
+        // Two cases:
+        // 1- biobjective: points are ordered by lexicographic order.
+        // Finding and removing dominated points is extremely efficient.
+        //
+        // See Algorithm 2 of
+        //
+        // A. Jaszkiewicz and T. Lust,
+        // "ND-Tree-Based Update: A Fast Algorithm for the Dynamic Nondominance Problem,"
+        // IEEE Transactions on Evolutionary Computation,
+        // vol. 22, no. 5, pp. 778-791, Oct. 2018,
+        // doi: 10.1109/TEVC.2018.2799684.
+        //
+        // One could also simply order the points by lexicographic order with one pass to get
+        // all non dominated ones.
+        //
+        if (nobj == 2)
+        {
+            bool insert = false;
+            auto isBelowf1Eval = [&evalType, &compactComputeType, eval](const NOMAD::EvalPoint& ev)
+            {
+                return ev.getEval(evalType)->getFs(compactComputeType)[0] <= eval->getFs(compactComputeType)[0];
+            };
+            // Find the last element of the list which satisfies the condition
+            auto itPfreverse = std::find_if(tmpEvalPointList.rbegin(), tmpEvalPointList.rend(), isBelowf1Eval);
+            std::list<NOMAD::EvalPoint>::iterator itPfforward;
+
+            if (itPfreverse == tmpEvalPointList.rend())
+            {
+                // In this case, evalPoint has the smallest f1 value of the list
+                // and can be inserted at the beginning.
+                insert = true;
+            }
+            else
+            {
+                // Check that evalPoint is non dominated
+                if (eval->getFs(compactComputeType)[1] < itPfreverse->getFs(completeComputeType)[1])
+                {
+                    insert = true;
+                    // Two subcases
+                    // 1- evalPoint dominates itPfreverse element: will be inserted before
+                    // all (potential) equal elements with itPfreverse values.
+                    if (eval->getFs(compactComputeType)[0] == itPfreverse->getFs(completeComputeType)[0])
+                    {
+                        NOMAD::EvalPoint tmpEvalPoint(*itPfreverse);
+                        const NOMAD::Eval* evalTmp = tmpEvalPoint.getEval(evalType);
+
+                        // Skip all equal elements.
+                        itPfreverse++;
+                        while (itPfreverse != tmpEvalPointList.rend())
+                        {
+                            NOMAD::EvalPoint tmp2EvalPoint(*itPfreverse);
+                            const NOMAD::Eval* evalTmp2 = tmp2EvalPoint.getEval(evalType);
+                            if ((evalTmp->getFs(compactComputeType)[0] != evalTmp2->getFs(compactComputeType)[0]) ||
+                                (evalTmp->getFs(compactComputeType)[1] != evalTmp2->getFs(compactComputeType)[1]))
+                            {
+                                break;
+                            }
+                            itPfreverse++;
+                        }
+                    }
+                    // 2- evalPoint is non dominated: will be inserted after itPfreverse element.
+                }
+                // or equal
+                else if ((eval->getFs(compactComputeType)[0] == itPfreverse->getFs(completeComputeType)[0]) &&
+                         (eval->getFs(compactComputeType)[1] == itPfreverse->getFs(completeComputeType)[1]))
+                {
+                    // evalPoint will be inserted after itPfreverse element
+                    insert = true;
+                }
+            }
+            if (insert)
+            {
+                // Add new evalPoint
+                tmpEvalPointList.insert(itPfreverse.base(), evalPoint);
+
+                // Remove points after evalPoint
+                itPfforward = itPfreverse.base();
+                while (itPfforward != tmpEvalPointList.end())
+                {
+                    // evalj element is dominated.
+                    const NOMAD::Eval* evalj = itPfforward->getEval(evalType);
+                    if (eval->getFs(compactComputeType)[1] <= evalj->getFs(compactComputeType)[1])
+                    {
+                        tmpEvalPointList.erase(itPfforward++);
+                        continue;
+                    }
+                    itPfforward++;
+                }
+            }
+        }
+        // 2- More than two objectives. In this case, no order structure is exploitable.
+        else
+        {
+            bool insert = true;
+            auto itPf = tmpEvalPointList.begin();
+            while (itPf != tmpEvalPointList.end())
+            {
+                auto compFlag = evalPoint.compMO(*itPf, completeComputeType);
+                if (compFlag == NOMAD::CompareType::DOMINATED)
+                {
+                    insert = false;
+                    break;
+                }
+                if (compFlag == NOMAD::CompareType::DOMINATING)
+                {
+                    tmpEvalPointList.erase(itPf++);
+                    continue;
+                }
+                itPf++;
+            }
+            if (insert)
+            {
+                tmpEvalPointList.push_front(evalPoint);
+            }
+        }
+    });
+
+    std::copy(tmpEvalPointList.begin(), tmpEvalPointList.end(), std::back_inserter(evalPointList));
+    return evalPointList.size();
+}
+
+
+// Find best infeasible points with h<hmax:  least infeasible points with smallest f -> index 0 (and above), best f points with smallest h-> last index (and below).
+// All best f points have the same bboutputs. Idem for the least infeasible points.
+size_t NOMAD::CacheBase::findBestInf(std::vector<NOMAD::EvalPoint> &evalPointList,
+                                     const NOMAD::Double& hMax,
+                                     const NOMAD::Point& fixedVariable,
+                                     const NOMAD::FHComputeType& completeComputeType) const
+{
+    evalPointList.clear();
+
+    auto evalType = completeComputeType.evalType;
+    auto compactComputeType = completeComputeType.Short();
+
+    size_t nobj = 0;
+    for (const auto & bbo: getBbOutputType())
+    {
+        if (bbo.isObjective())
+        {
+            nobj += 1;
+        }
+    }
+
+    // Single objective: use the infeasible front, if it is available.
+    if (1 == nobj && !fixedVariable.isDefined())
+    {
+        bool frontAvailable = false;
+        if (queryAggregate(completeComputeType, [&](const NOMAD::CacheAggregate& aggregate)
+            {
+                frontAvailable = aggregate.getBestInf(evalPointList, hMax);
+            })
+            && frontAvailable)
+        {
+            return evalPointList.size();
+        }
+    }
+
+    // Refs values (f and h) for both bestF and leastInf
+    NOMAD::ArrayOfDouble bestFRefFs(nobj,NOMAD::INF);
+    NOMAD::Double bestFRefH(NOMAD::INF);
+    NOMAD::Double leastInfRefH(NOMAD::INF);
+    NOMAD::ArrayOfDouble leastInfRefFs(nobj,NOMAD::INF);
+
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(evalType);
+        if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+        {
+            return;
+        }
+        if (eval->isFeasible(compactComputeType))
+        {
+            return;
+        }
+        NOMAD::Double h = eval->getH(compactComputeType);
+        if (!h.isDefined() || h > hMax || h == NOMAD::INF)
+        {
+            return;
+        }
+        // Must be in the subspace defined byFixedVariable
+        if (!evalPoint.hasFixed(fixedVariable))
+        {
+            return;
+        }
+        // For robustness, be sure the cache picks up points which
+        // have the same number of objectives
+        size_t nobjEval = 0;
+        for (const auto &bbo: eval->getBBOutputTypeList())
+        {
+            if (bbo.isObjective())
+            {
+                nobjEval += 1;
+            }
+        }
+        if (nobjEval != nobj)
+        {
+            return;
+        }
+        NOMAD::ArrayOfDouble fs = eval->getFs(compactComputeType);
+
+        // Two types of best inf but no duplication of points. If leastInf and bestF are the same we put single point in the list (see below in the second step).
+
+        // Better f (still infeasible though)
+        // For multiobjective, compare all objectives in the arrayOfDouble (no dominance).
+        if (fs.isComplete() && fs < bestFRefFs )
+        {
+            bestFRefFs = fs;
+            bestFRefH = h;
+        }
+
+        // lower infeas (do not care about f)
+        if (h < leastInfRefH)
+        {
+            leastInfRefH = h;
+            leastInfRefFs = fs;
+        }
+    });
+
+    // Create the list with bestF (last index and below if multiple point) and leastInf (index 0 and above if multiple points)
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        // Must be eval ok
+        const NOMAD::Eval* eval = evalPoint.getEval(evalType);
+        if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+        {
+            return;
+        }
+        // Must be in the subspace defined byFixedVariable
+        if (!evalPoint.hasFixed(fixedVariable))
+        {
+            return;
+        }
+
+        NOMAD::ArrayOfDouble fs = eval->getFs(compactComputeType);
+        NOMAD::Double h = eval->getH(compactComputeType);
+        if (fs == bestFRefFs && h == bestFRefH)
+        {
+            evalPointList.push_back(evalPoint);
+            return;
+        }
+        if (h == leastInfRefH && fs == leastInfRefFs)
+        {
+            evalPointList.insert(evalPointList.begin(), evalPoint);
+        }
+    });
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheBase::findFilterInf(std::vector<NOMAD::EvalPoint> &evalPointList,
+                                       const NOMAD::Double& hMax,
+                                       const NOMAD::Point& fixedVariable,
+                                       const NOMAD::FHComputeType & completeComputeType) const
+{
+    auto evalType = completeComputeType.evalType;
+    auto compactComputeType = completeComputeType.Short();
+    auto computeType = compactComputeType.computeType;
+
+    evalPointList.clear();
+
+    size_t nobj = 0;
+    for (const auto & bbo: getBbOutputType())
+    {
+        if (bbo.isObjective())
+        {
+            nobj += 1;
+        }
+    }
+
+    // Notion of dominance is not defined for those compute types.
+    // Let's find some best infeasible points with h<hmax: least infeasible point -> index 0 and best f point -> last index
+    if (computeType == NOMAD::ComputeType::PHASE_ONE ||
+        computeType == NOMAD::ComputeType::UNDEFINED ||
+        computeType == NOMAD::ComputeType::USER)
+    {
+        // NB: not the most efficient version... vector->list!!!
+        findBestInf(evalPointList, hMax, fixedVariable, completeComputeType);
+        return evalPointList.size();
+    }
+
+    std::list<NOMAD::EvalPoint> tmpEvalPointList;
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(evalType);
+        if (nullptr == eval || NOMAD::EvalStatusType::EVAL_OK != eval->getEvalStatus())
+        {
+            return;
+        }
+        if (eval->isFeasible(compactComputeType))
+        {
+            return;
+        }
+        NOMAD::Double h = eval->getH(compactComputeType);
+        if (!h.isDefined() || h > hMax || h == NOMAD::INF)
+        {
+            return;
+        }
+        // Must be in the subspace defined byFixedVariable
+        if (!evalPoint.hasFixed(fixedVariable))
+        {
+            return;
+        }
+        // For robustness, be sure the cache picks up points which
+        // have the same number of objectives
+        size_t nobjEval = 0;
+        for (const auto & bbo: eval->getBBOutputTypeList())
+        {
+            if (bbo.isObjective())
+            {
+                nobjEval += 1;
+            }
+        }
+        if (nobjEval != nobj)
+        {
+            return;
+        }
+        // The set of non dominated points is empty, so insert it.
+        if (tmpEvalPointList.empty())
+        {
+            tmpEvalPointList.push_back(evalPoint);
+            return;
+        }
+
+        // Insertion into a non-empty set.
+        bool insert = true;
+        auto itInfPf = tmpEvalPointList.begin();
+        while (itInfPf != tmpEvalPointList.end())
+        {
+            auto compFlag = evalPoint.compMO(*itInfPf, completeComputeType, false);
+            if (compFlag == NOMAD::CompareType::DOMINATED)
+            {
+                insert = false;
+                break;
+            }
+            else if (compFlag == NOMAD::CompareType::DOMINATING)
+            {
+                tmpEvalPointList.erase(itInfPf++);
+                continue;
+            }
+            itInfPf++;
+        }
+        if (insert)
+        {
+            tmpEvalPointList.insert(tmpEvalPointList.begin(), evalPoint);
+        }
+    });
+
+    std::copy(tmpEvalPointList.begin(), tmpEvalPointList.end(), std::back_inserter(evalPointList));
+    return evalPointList.size();
+}
+
+
+// Write cache to file _filename
+// In text format, this function will use operator<< defined below.
+bool NOMAD::CacheBase::write() const
+{
+    OUTPUT_INFO_START
+    std::string s = "Write cache file " + _filename;
+    NOMAD::OutputQueue::Add(s);
+    OUTPUT_INFO_END
+
+    std::lock_guard<std::mutex> lock(_cacheFileMutex);
+
+    // Points updated from now on will be written next time.
+    std::vector<NOMAD::EvalPoint> pointsToWrite;
+    bool appendToFile = false;
+    {
+        std::lock_guard<std::mutex> lockPoints(_pointsToWriteMutex);
+        pointsToWrite.swap(_pointsToWrite);
+        _nbPointsToWrite = 0;
+        appendToFile = _cacheFileUpToDate;
+        _cacheFileUpToDate = _binaryCacheFile;
+    }
+
+    bool fileWritten = false;
+    if (!_binaryCacheFile)
+    {
+        fileWritten = NOMAD::write(*this, _filename);
+    }
+    else if (appendToFile)
+    {
+        // A point updated more than once needs only its last version.
+        NOMAD::EvalPointSet lastUpdates;
+        for (auto it = pointsToWrite.rbegin(); it != pointsToWrite.rend(); ++it)
+        {
+            lastUpdates.insert(*it);
+        }
+        pointsToWrite.assign(lastUpdates.begin(), lastUpdates.end());
+        fileWritten = NOMAD::CacheFileBinary::append(pointsToWrite, getNbCacheHits(), _filename);
+    }
+    if (_binaryCacheFile && !fileWritten)
+    {
+        // First write, or the file could not be appended to: Write all points.
+        fileWritten = NOMAD::CacheFileBinary::write(*this, _filename);
+    }
+
+    if (!fileWritten)
+    {
+        invalidateCacheFile();
+    }
+
+    return fileWritten;
+}
+
+
+bool NOMAD::CacheBase::writeIfSavePeriodReached() const
+{
+    if (0 == _savePeriod || _filename.empty())
+    {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lockPoints(_pointsToWriteMutex);
+        if (_nbPointsToWrite < _savePeriod)
+        {
+            return false;
+        }
+    }
+
+    return write();
+}
+
+
+// Read _filename as written by write(), and add the points to the cache.
+// For a text file, this function will use operator>> defined below.
+bool NOMAD::CacheBase::read()
+{
+    bool fileRead = false;
+    bool binaryFile = false;
+    if (NOMAD::checkReadFile(_filename))
+    {
+        OUTPUT_INFO_START
+        std::string s = "Read cache file " + _filename;
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_NORMAL);
+        OUTPUT_INFO_END
+        binaryFile = NOMAD::CacheFileBinary::isBinaryFile(_filename);
+        fileRead = (binaryFile) ? NOMAD::CacheFileBinary::read(*this, _filename)
+                                : NOMAD::read(*this, _filename);
+    }
+
+    // The points just read are already in the file.
+    std::lock_guard<std::mutex> lockPoints(_pointsToWriteMutex);
+    _pointsToWrite.clear();
+    _nbPointsToWrite = 0;
+    _cacheFileUpToDate = (fileRead && binaryFile && _binaryCacheFile);
+
+    return fileRead;
+}
+
+
+void NOMAD::CacheBase::addPointToWrite(const NOMAD::EvalPoint& evalPoint)
+{
+    if (_filename.empty() || !NOMAD::CacheFileBinary::goodForCacheFile(evalPoint))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lockPoints(_pointsToWriteMutex);
+    _nbPointsToWrite++;
+    // If the file is not up to date, it will be rewritten completely:
+    // no need to keep the point.
+    if (_cacheFileUpToDate)
+    {
+        _pointsToWrite.push_back(evalPoint);
+    }
+}
+
+
+void NOMAD::CacheBase::invalidateCacheFile() const
+{
+    std::lock_guard<std::mutex> lockPoints(_pointsToWriteMutex);
+    _cacheFileUpToDate = false;
+    _pointsToWrite.clear();
+}
+
+
+size_t NOMAD::CacheBase::computeMeanF(NOMAD::Double &mean) const
+{
+    size_t nbElem = 0;
+    mean.reset();
+
+    if (queryAggregate(defaultFHComputeType, [&](const NOMAD::CacheAggregate& aggregate) { nbElem = aggregate.computeMeanF(mean); }))
+    {
+        return nbElem;
+    }
+
+    // Naive way to compute the mean f for all points in the cache.
+    NOMAD::Double total = 0;
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (NOMAD::EvalStatusType::EVAL_OK != evalPoint.getEvalStatus(NOMAD::EvalType::BB))
+        {
+            return;
+        }
+        NOMAD::Double f = evalPoint.getF(defaultFHComputeType);
+        if (f.isDefined())
+        {
+            total += f;
+            nbElem++;
+        }
+    });
+    if (nbElem > 0)
+    {
+        mean = total / (double)nbElem;
+    }
+
+    return nbElem;
+}
+
+
+void NOMAD::CacheBase::addToAggregates(const NOMAD::EvalPoint& evalPoint)
+{
+    if (!NOMAD::CacheAggregate::isAggregated(evalPoint))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_aggregatesMutex);
+    _nbAggregatesChanges++;
+    for (auto& aggregate : _aggregates)
+    {
+        aggregate.add(evalPoint);
+    }
+}
+
+
+void NOMAD::CacheBase::updateAggregates(const NOMAD::EvalPoint& before, const NOMAD::EvalPoint& after)
+{
+    std::lock_guard<std::mutex> lock(_aggregatesMutex);
+    _nbAggregatesChanges++;
+    // An aggregate that cannot take the update into account is rebuilt on next query.
+    _aggregates.erase(std::remove_if(_aggregates.begin(), _aggregates.end(),
+                                     [&](NOMAD::CacheAggregate& aggregate) { return !aggregate.update(before, after); }),
+                      _aggregates.end());
+}
+
+
+void NOMAD::CacheBase::invalidateAggregates()
+{
+    std::lock_guard<std::mutex> lock(_aggregatesMutex);
+    _nbAggregatesChanges++;
+    _aggregates.clear();
+}
+
+
+void NOMAD::CacheBase::processOnAggregates(EvalFunc_t func, const int mainThreadNum)
+{
+    std::lock_guard<std::mutex> lock(_aggregatesMutex);
+    for (auto& aggregate : _aggregates)
+    {
+        aggregate.processOnAllPoints(func, mainThreadNum);
+    }
+}
+
+
+bool NOMAD::CacheBase::queryAggregate(const NOMAD::FHComputeType& computeType,
+                                      const std::function<void(const NOMAD::CacheAggregate&)>& query) const
+{
+    if (!NOMAD::CacheAggregate::isSupported(computeType))
+    {
+        return false;
+    }
+
+    size_t nbChanges = 0;
+    {
+        std::lock_guard<std::mutex> lock(_aggregatesMutex);
+        for (const auto& aggregate : _aggregates)
+        {
+            if (aggregate.isFor(computeType))
+            {
+                query(aggregate);
+                return true;
+            }
+        }
+        nbChanges = _nbAggregatesChanges;
+    }
+
+    // Build the aggregate from the points in cache. The aggregates mutex is
+    // not held while browsing, because insertions update the aggregates
+    // while holding the cache locks.
+    NOMAD::CacheAggregate aggregate(computeType, NOMAD::getNbObj(_bbOutputType));
+    browse([&aggregate](const NOMAD::EvalPoint& evalPoint)
+    {
+        aggregate.add(evalPoint);
+    });
+    query(aggregate);
+
+    // Keep it only if the cache did not change in the meantime.
+    std::lock_guard<std::mutex> lock(_aggregatesMutex);
+    if (nbChanges == _nbAggregatesChanges)
+    {
+        _aggregates.push_back(std::move(aggregate));
+    }
+
+    return true;
+}
+
+
+// Display only EvalPoints that have a BB or SURROGATE eval that is good. Only eval status is checked.
+// This method is used to write points to cache.
+std::ostream& NOMAD::CacheBase::displayPointsWithEval(std::ostream& os) const
+{
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (NOMAD::CacheFileBinary::goodForCacheFile(evalPoint))
+        {
+            os << evalPoint.displayForCache(_bbEvalFormat) << std::endl;
+        }
+    });
+
+    return os;
+}
+
+
+// Display only EvalPoints that have an eval.
+std::ostream& NOMAD::operator<<(std::ostream& os, const NOMAD::CacheBase& cache)
+{
+    os << "CACHE_HITS " << cache.getNbCacheHits() << std::endl;
+    os << "BB_OUTPUT_TYPE " << cache.getBbOutputType() << std::endl;
+    cache.displayPointsWithEval(os);
+
+    return os;
+}
+
+
+// Get these EvalPoints from stream
+std::istream& NOMAD::operator>>(std::istream& is, NOMAD::CacheBase& cache)
+{
+    std::string s;
+    NOMAD::BBOutputTypeList bbOutputTypes;
+
+    is >> s;
+    if ("CACHE_HITS" == s)
+    {
+        size_t cacheHits;
+        is >> cacheHits;
+        cache.setNbCacheHits(cacheHits);
+    }
+    else
+    {
+        // Put back s to istream.
+        for (unsigned i = 0; i < s.size(); i++)
+        {
+            is.unget();
+        }
+    }
+
+    is >> s;
+    if ("BB_OUTPUT_TYPE" == s)
+    {
+        while (is >> s && is.good() && !is.eof())
+        {
+            if (NOMAD::ArrayOfDouble::pStart == s)
+            {
+                is.unget();
+                break;
+            }
+            else
+            {
+                bbOutputTypes.emplace_back(s);
+            }
+        }
+
+        cache.setBBOutputType(bbOutputTypes);
+    }
+
+
+    NOMAD::EvalPoint evalPoint;
+    while (is >> evalPoint && is.good() && !is.eof())
+    {
+        evalPoint.setBBOutputType(bbOutputTypes);
+        evalPoint.updateTag();
+        evalPoint.setEvalIsFromCacheFile(true);
+        cache.insert(evalPoint);
+    }
+
+    return is;
+}
@@ -55,9 +55,12 @@
 #define __NOMAD_4_5_CACHEBASE__
 
 #include <atomic>       // For atomic
+#include <functional>
+#include <mutex>
 #include <vector>
 
 #include "../nomad_platform.hpp"
+#include "../Cache/CacheAggregate.hpp"
 #include "../Eval/EvalPoint.hpp"
 #include "../Param/CacheParameters.hpp"
 
@@ -72,8 +75,17 @@ class CacheSet;
  *
  * The cache itself is implemented in derived classes.
  * It could be a set (CacheSet), an unordered_set (CacheSet with
- * precompiler option USE_UNORDEREDSET), map, multimap,
- * SQL database, etc.
+ * precompiler option USE_UNORDEREDSET), a set of shards (CacheShardedSet),
+ * map, multimap, SQL database, etc.
+ *
+ * The queries that go through all the points (findBest, findBestFeas, etc.)
+ * are implemented here using browse(). A derived class only needs to
+ * provide the storage and browse().
+ *
+ * hasFeas, hasInfeas, computeMeanF, findBestFeas and findBestInf use
+ * running aggregates (CacheAggregate) when possible. A derived class must
+ * keep them up to date using addToAggregates(), updateAggregates() and
+ * invalidateAggregates().
  */
 class CacheBase {
 
@@ -95,11 +107,17 @@ protected:
 
     /// Name of the file to write or read cache to.
     /**
-     The format depends on the cache implementation. This is only the name
+     The format is given by parameter CACHE_FILE_FORMAT. This is only the name
     of the file.
      */
     std::string _filename;
 
+    /// Write the cache file in binary format (CacheFileBinary) instead of text.
+    bool _binaryCacheFile;
+
+    /// Write the cache file each time this number of points were evaluated. 0: No periodic write.
+    size_t _savePeriod;
+
 
     /// Maximum number of points to be stored in the cache.
     /**
@@ -112,6 +130,9 @@ protected:
 
     DLL_EVAL_API static std::unique_ptr<CacheBase> _single; ///< The singleton
 
+    DLL_EVAL_API static BBOutputTypeList _bbOutputType;  ///< Corresponds to parameter BB_OUTPUT_TYPE used for this cache
+    DLL_EVAL_API static ArrayOfDouble    _bbEvalFormat;  ///< Used to write cache correctly
+
     /// Dimension of the points in the cache.
     /**
      * Used for verification only.
@@ -138,9 +159,14 @@ protected:
      \param cacheParams The cache parameters -- \b IN.
      */
     explicit CacheBase(const std::shared_ptr<CacheParameters>& cacheParams)
-      : _cacheParams (cacheParams),
+      : _binaryCacheFile(false),
+        _savePeriod(0),
+        _cacheParams (cacheParams),
         _n(0),
-        _stopWaiting(false)
+        _stopWaiting(false),
+        _cacheFileUpToDate(false),
+        _nbPointsToWrite(0),
+        _nbAggregatesChanges(0)
     {
         init();
     }
@@ -190,28 +216,48 @@ public:
 
     static void resetNbCacheHits() { _nbCacheHits = 0; }
 
-    void setFileName(const std::string &filename) { _filename = filename; }
+    void setFileName(const std::string &filename)
+    {
+        if (filename != _filename)
+        {
+            invalidateCacheFile();
+        }
+        _filename = filename;
+    }
     std::string getFileName() const { return _filename; }
 
     void setMaxSize(const size_t maxSize) { _maxSize = maxSize; }
 
     void setStopWaiting(const bool stopWaiting) { _stopWaiting = stopWaiting; }
 
+    /// Get the list of blackbox output types
+    static BBOutputTypeList getBbOutputType() { return _bbOutputType; }
+
+    /// Set the list of blackbox output type
+    /**
+     \param bbOutputType    The list to use in cache -- \b IN.
+     */
+    static void setBBOutputType(const BBOutputTypeList& bbOutputType)
+    {
+        _bbOutputType = bbOutputType;
+        if (nullptr != _single)
+        {
+            _single->invalidateAggregates();
+        }
+    }
+
     /*---------------*/
     /* Other methods */
     /*---------------*/
 
     /// Compute the mean f.
     /**
-     \param mean  The mean of f -- \b IN.
+     * Mean of f, for the default FHComputeType, over the points with an
+     * evaluation.
+     \param mean  The mean of f -- \b OUT.
      \return      The number of EvalPoints for which f is defined.
      */
-    virtual size_t computeMeanF(Double &mean) const
-    {
-        std::cout << "Warning: computeMeanF is not implemented for this type of cache." << std::endl;
-        mean.reset();
-        return 0;
-    }
+    DLL_EVAL_API virtual size_t computeMeanF(Double &mean) const;
 
     /// Process function func on all EvalPoints in the cache.
     /**
@@ -285,14 +331,14 @@ public:
 
     /// Find all eval points at point x in the cache.
     /**
-     Get all eval points at point x from the cache (pure virtual function).
+     Get all eval points at point x from the cache.
 
      \param x               The point to find in cache             -- \b IN.
      \param evalPointList   The list of eval points found in cache -- \b OUT.
      \return                The number of points found.
      */
-    virtual size_t find(const Point& x,
-                        std::vector<EvalPoint> &evalPointList) const = 0;
+    DLL_EVAL_API virtual size_t find(const Point& x,
+                                     std::vector<EvalPoint> &evalPointList) const;
 
 
     /// Get all eval points for which comp(refeval) returns true.
@@ -303,10 +349,10 @@ public:
      \param computeType   Which type of f, h computation (eval type, compute type and h norm type)  -- \b IN.
      \return                The number of points found.
      */
-    virtual size_t find(const Eval &refeval,
-                        std::function<bool(const Eval&, const Eval&, const FHComputeTypeS&)> comp,
-                        std::vector<EvalPoint> &evalPointList,
-                        const FHComputeType& computeType) const = 0;
+    DLL_EVAL_API virtual size_t find(const Eval &refeval,
+                                     std::function<bool(const Eval&, const Eval&, const FHComputeTypeS&)> comp,
+                                     std::vector<EvalPoint> &evalPointList,
+                                     const FHComputeType& computeType) const;
 
 
     /// Get best eval points, using comp(). Only the points with eval status EVAL_OK are considered.
@@ -319,27 +365,27 @@ public:
      \param computeType   Which type of f, h computation (eval type, compute type and h norm type)  -- \b IN.
      \return                The number of eval points found.
      */
-    virtual size_t findBest(std::function<bool(const Eval&,
-                                               const Eval&,
-                                               const FHComputeTypeS&)> comp,
-                            std::vector<EvalPoint> &evalPointList,
-                            const bool findFeas,
-                            const Double& hMax,
-                            const Point& fixedVariable,
-                            const FHComputeType& computeType) const = 0;
+    DLL_EVAL_API virtual size_t findBest(std::function<bool(const Eval&,
+                                                            const Eval&,
+                                                            const FHComputeTypeS&)> comp,
+                                         std::vector<EvalPoint> &evalPointList,
+                                         const bool findFeas,
+                                         const Double& hMax,
+                                         const Point& fixedVariable,
+                                         const FHComputeType& computeType) const;
 
 
     /// Test if cache contains feasible points.
     /**
       \return \c true if the cache contains at least one feasible point, \c false otherwise.
      */
-    virtual bool hasFeas(const FHComputeType& completeComputeType) const = 0;
+    DLL_EVAL_API virtual bool hasFeas(const FHComputeType& completeComputeType) const;
     
     /// Test if cache contains an infeasible points.
     /**
       \return \c true if the cache contains at least one infeasible point, \c false otherwise.
      */
-    virtual bool hasInfeas(const FHComputeType& completeComputeType) const = 0;
+    DLL_EVAL_API virtual bool hasInfeas(const FHComputeType& completeComputeType) const;
 
 
     /// Get all eval points within a distance of point X.
@@ -350,11 +396,42 @@ public:
      \param maxEvalPoints   The maximum number of points to select              -- \b IN.
      \return                The number of eval points found.
      */
-    virtual size_t find(const Point & X,
-                        std::function<bool(const Point&, const EvalPoint &)> crit,
-                        std::vector<EvalPoint> &evalPointList,
-                        int maxEvalPoints = 0) const = 0;
+    DLL_EVAL_API virtual size_t find(const Point & X,
+                                     std::function<bool(const Point&, const EvalPoint &)> crit,
+                                     std::vector<EvalPoint> &evalPointList,
+                                     int maxEvalPoints = 0) const;
+
+
+
+    /// Get all eval points within a Euclidean distance of point X and verifying a criteria.
+    /**
+     * The default implementation browses the whole cache. Derived classes
+       may use a spatial index.
+     \param X               The point of reference                              -- \b IN.
+     \param radius          Select the points at distance lower than or equal to radius -- \b IN.
+     \param crit            The criteria function                               -- \b IN.
+     \param evalPointList   The eval points found, in cache order               -- \b OUT.
+     \return                The number of eval points found.
+     */
+    DLL_EVAL_API virtual size_t findWithinRadius(const Point& X,
+                                                 const Double& radius,
+                                                 std::function<bool(const EvalPoint&)> crit,
+                                                 std::vector<EvalPoint> &evalPointList) const;
 
+    /// Get the k eval points closest to point X (Euclidean distance) verifying a criteria.
+    /**
+     * The default implementation browses the whole cache. Derived classes
+       may use a spatial index.
+     \param X               The point of reference                              -- \b IN.
+     \param k               The maximum number of points to select              -- \b IN.
+     \param crit            The criteria function                               -- \b IN.
+     \param evalPointList   The eval points found, by increasing distance to X  -- \b OUT.
+     \return                The number of eval points found.
+     */
+    DLL_EVAL_API virtual size_t findKNearest(const Point& X,
+                                             const size_t k,
+                                             std::function<bool(const EvalPoint&)> crit,
+                                             std::vector<EvalPoint> &evalPointList) const;
 
 
     /// Find using criteria.
@@ -365,8 +442,8 @@ public:
      \param evalPointList   The eval points within the prescribed distance of X -- \b OUT.
      \return                The number of eval points found.
      */
-    virtual size_t find(std::function<bool(const EvalPoint&)> crit,
-                        std::vector<EvalPoint> &evalPointList) const = 0;
+    DLL_EVAL_API virtual size_t find(std::function<bool(const EvalPoint&)> crit,
+                                     std::vector<EvalPoint> &evalPointList) const;
 
     /// Browse cache using criteria. The function can have access to remote info using the lambda
     /// function capture by reference.
@@ -384,9 +461,9 @@ public:
      \param evalPointList   The eval points within the prescribed distance of X     -- \b OUT.
      \return                The number of eval points found.
      */
-    virtual size_t find(std::function<bool(const EvalPoint&)> crit1,
-                        std::function<bool(const EvalPoint&)> crit2,
-                        std::vector<EvalPoint> &evalPointList) const = 0;
+    DLL_EVAL_API virtual size_t find(std::function<bool(const EvalPoint&)> crit1,
+                                     std::function<bool(const EvalPoint&)> crit2,
+                                     std::vector<EvalPoint> &evalPointList) const;
 
 
     /// Get all non dominated (or equal) best feasible eval points using dominance criterion
@@ -398,9 +475,9 @@ public:
      \param computeType   Which type of f, h computation (eval type, compute type and h norm type)  -- \b IN.
      \return                The number of eval points found.
      */
-    virtual size_t findBestFeas(std::vector<EvalPoint> &evalPointList,
-                                const Point& fixedVariable = Point(),
-                                const FHComputeType& computeType  = defaultFHComputeType) const = 0;
+    DLL_EVAL_API virtual size_t findBestFeas(std::vector<EvalPoint> &evalPointList,
+                                             const Point& fixedVariable = Point(),
+                                             const FHComputeType& computeType  = defaultFHComputeType) const;
 
 
     /// Find best infeasible points with h<=hmax:
@@ -415,10 +492,10 @@ public:
      \param computeType   Which type of f, h computation (eval type, compute type and h norm type)  -- \b IN.
      \return                The number of eval points found.
      */
-    virtual size_t findBestInf(std::vector<EvalPoint> &evalPointList,
-                               const Double& hMax = INF ,
-                               const Point& fixedVariable = Point(),
-                               const FHComputeType& computeType = defaultFHComputeType) const = 0;
+    DLL_EVAL_API virtual size_t findBestInf(std::vector<EvalPoint> &evalPointList,
+                                            const Double& hMax = INF ,
+                                            const Point& fixedVariable = Point(),
+                                            const FHComputeType& computeType = defaultFHComputeType) const;
 
 
     /// Get all non dominated (or equal) infeasible eval points using dominance criterion
@@ -432,10 +509,10 @@ public:
      \param computeType   Which type of f, h computation (eval type, compute type and h norm type)  -- \b IN.
      \return                The number of eval points found.
      */
-    virtual size_t findFilterInf(std::vector<NOMAD::EvalPoint> &evalPointList,
-                                 const Double& hMax,
-                                 const Point& fixedVariable,
-                                 const FHComputeType& computeType) const = 0;
+    DLL_EVAL_API virtual size_t findFilterInf(std::vector<NOMAD::EvalPoint> &evalPointList,
+                                              const Double& hMax,
+                                              const Point& fixedVariable,
+                                              const FHComputeType& computeType) const;
 
 
     // More find() methods can be added here.
@@ -484,9 +561,14 @@ public:
     /**
      * \brief Write cache to file.
      *
-     * Simple dump.
+     * In text format, simple dump.
+     * In binary format, only the points evaluated since the last write are
+     * appended to the file, as long as the file was written or read by this cache.
      */
-    virtual bool write() const = 0;
+    DLL_EVAL_API virtual bool write() const;
+
+    /// Write cache to file if CACHE_SAVE_PERIOD points were evaluated since the last write.
+    DLL_EVAL_API bool writeIfSavePeriodReached() const;
 
     /**
      * \brief Display all points in cache.
@@ -496,15 +578,137 @@ public:
     virtual std::string displayAll() const { return ""; }
 
     /// Read a cache file and load it.
-    virtual bool read() = 0;
+    /**
+     * The format, text or binary, is detected from the file content.
+     */
+    DLL_EVAL_API virtual bool read();
+
+    /** Display only EvalPoints that have an eval.
+     * This method is used to write the cache file.
+     * \note the EvalPoint's Eval must satisfy method Eval::goodForCacheFile().
+     */
+    DLL_EVAL_API virtual std::ostream& displayPointsWithEval(std::ostream& os) const;
     
     
     /// Move eval points from cache set to cache set for rerun
     virtual void moveEvalPointToCacheForRerun() = 0;
 
+protected:
+    /// Helper function for find and insertion.
+    /**
+     Throw exception if error. Do nothing otherwise.
+
+     \param point       The point to verify  -- \b IN.
+     */
+    void verifyPointComplete(const Point& point) const;
+
+    /// Helper function for find and insertion.
+    /**
+     Throw exception if error. Do nothing otherwise.
+
+     \param point       The point to verify  -- \b IN.
+     */
+    void verifyPointSize(const Point& point) const;
+
+    /// Helper function for find and insertion.
+    /**
+     Throw exception if error. Do nothing otherwise.
+
+     \param evalPoint       The point to verify  -- \b IN.
+     */
+    void verifyPointComplete(const EvalPoint& evalPoint) const;
+
+    /// Helper function for find and insertion.
+    /**
+     Throw exception if error. Do nothing otherwise.
+
+     \param evalPoint       The point to verify  -- \b IN.
+     */
+    void verifyPointSize(const EvalPoint& evalPoint) const;
+
+    /// Helper function for update and insertion, once the point is in cache.
+    /**
+     * Count the point for CACHE_SAVE_PERIOD, and keep a copy of it to be
+     * appended at the next write of a binary cache file.
+     \param evalPoint   The point in cache -- \b IN.
+     */
+    void addPointToWrite(const EvalPoint& evalPoint);
+
+    /// The next write of the cache file will rewrite the whole file.
+    void invalidateCacheFile() const;
+
+    /// Helper function for insertion, once the point is new in cache.
+    void addToAggregates(const EvalPoint& evalPoint);
+
+    /// Helper function for update, once the point in cache is updated.
+    /**
+     \param before      Copy of the point in cache before the update   -- \b IN.
+     \param after       The point in cache after the update            -- \b IN.
+     */
+    void updateAggregates(const EvalPoint& before, const EvalPoint& after);
+
+    /// The aggregates will be rebuilt from the points in cache when needed.
+    /**
+     * To be called when points are removed, or modified without update().
+     */
+    void invalidateAggregates();
+
+    /// Helper for processOnAllPoints: call func on the points kept in the aggregates.
+    /**
+     * func must not modify the BB or SURROGATE evaluations, use
+     * invalidateAggregates() otherwise.
+     */
+    void processOnAggregates(EvalFunc_t func, const int mainThreadNum);
+
+    /// Helper function for smartInsert, once the insertion of evalPoint was tried.
+    /**
+     * The tag of the point in cache may be updated. The number of cache hits is incremented on a cache hit.
+     \param evalPointInCache    The point in cache, just inserted or already there  -- \b IN.
+     \param evalPoint           The point given to smartInsert                      -- \b IN.
+     \param inserted            Flag: the point was not in the cache before         -- \b IN.
+     \param maxNumberEval       The max number of evaluations of the point          -- \b IN.
+     \param evalType            Which eval of the EvalPoint to look at              -- \b IN.
+     \return                    A boolean indicating if we should eval this point.
+     */
+    bool toEvalAfterInsert(const EvalPoint& evalPointInCache,
+                           const EvalPoint& evalPoint,
+                           const bool inserted,
+                           const short maxNumberEval,
+                           const EvalType evalType) const;
 
 private:
 
+    /// Serialize the writes of the cache file
+    mutable std::mutex _cacheFileMutex;
+
+    /// Protect the members below
+    mutable std::mutex _pointsToWriteMutex;
+
+    /// The binary cache file holds all the points of the cache, except _pointsToWrite.
+    mutable bool _cacheFileUpToDate;
+
+    /// Points updated since the last write. Only kept if the binary cache file is up to date.
+    mutable std::vector<EvalPoint> _pointsToWrite;
+
+    /// Number of points updated since the last write. Used for CACHE_SAVE_PERIOD.
+    mutable size_t _nbPointsToWrite;
+
+    /// Protect the aggregates
+    mutable std::mutex _aggregatesMutex;
+
+    /// Running aggregates, built on first query for each supported FHComputeType.
+    mutable std::vector<CacheAggregate> _aggregates;
+
+    /// Incremented on every change of the aggregates, to detect changes while building one.
+    mutable size_t _nbAggregatesChanges;
+
+    /// Run query on the aggregate for computeType, building it if needed.
+    /**
+     \return \c false if the aggregates are not supported for computeType. The query is not run.
+     */
+    bool queryAggregate(const FHComputeType& computeType,
+                        const std::function<void(const CacheAggregate&)>& query) const;
+
     /// Initialize the cache.
     /**
      * The initialization uses the parameters from a private CacheParameters object.
@@ -512,6 +716,12 @@ private:
     void init();
 };
 
+/// Display only EvalPoints that have an eval.
+DLL_EVAL_API std::ostream& operator<<(std::ostream& os, const CacheBase& cache);
+
+/// Get these EvalPoints from stream
+DLL_EVAL_API std::istream& operator>>(std::istream& is, CacheBase& cache);
+
 #include "../nomad_nsend.hpp"
 
 #endif // __NOMAD_4_5_CACHEBASE__
@@ -0,0 +1,585 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheFileBinary.cpp
+ * \brief  Binary format for the cache file
+ * \see    CacheFileBinary.hpp
+ */
+
+#include "../Cache/CacheFileBinary.hpp"
+#include "../Output/OutputQueue.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+const std::string NOMAD::CacheFileBinary::_magic = "NMDCACHE";
+const uint32_t    NOMAD::CacheFileBinary::_version = 1;
+const size_t      NOMAD::CacheFileBinary::_headerFixedSize = 48;
+
+
+// Read-only view of the content of a file.
+// The file is mapped in memory, except on Windows where it is read in a buffer.
+class MappedCacheFile
+{
+private:
+    const char* _data;
+    size_t      _size;
+#ifdef _WIN32
+    std::vector<char> _buffer;
+#else
+    void*       _mapping;
+#endif
+
+public:
+    explicit MappedCacheFile(const std::string& filename)
+      : _data(nullptr),
+        _size(0)
+#ifndef _WIN32
+        , _mapping(MAP_FAILED)
+#endif
+    {
+#ifdef _WIN32
+        std::ifstream fin(filename, std::ios::binary);
+        if (fin.is_open())
+        {
+            _buffer.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+            _data = _buffer.data();
+            _size = _buffer.size();
+        }
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+        struct stat fileStat;
+        if (0 == fstat(fd, &fileStat) && fileStat.st_size > 0)
+        {
+            _mapping = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != _mapping)
+            {
+                _size = fileStat.st_size;
+                _data = static_cast<const char*>(_mapping);
+                // Rows are read once, in order.
+                madvise(_mapping, _size, MADV_SEQUENTIAL);
+            }
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedCacheFile()
+    {
+#ifndef _WIN32
+        if (MAP_FAILED != _mapping)
+        {
+            munmap(_mapping, _size);
+        }
+#endif
+    }
+
+    MappedCacheFile(const MappedCacheFile&) = delete;
+    MappedCacheFile& operator=(const MappedCacheFile&) = delete;
+
+    const char* data() const { return _data; }
+    size_t size() const { return _size; }
+};
+
+
+// Eval types stored in a row, in order.
+static const NOMAD::EvalType rowEvalTypes[2] = { NOMAD::EvalType::BB, NOMAD::EvalType::SURROGATE };
+
+
+template<typename T>
+static void putValue(std::vector<char>& bytes, const size_t offset, const T& value)
+{
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+
+template<typename T>
+static T getValue(const char* bytes, const size_t offset)
+{
+    T value;
+    std::memcpy(&value, bytes + offset, sizeof(T));
+    return value;
+}
+
+
+static size_t roundUpTo8(const size_t size)
+{
+    return (size + 7) / 8 * 8;
+}
+
+
+// Shortest decimal representation that reads back to the same double,
+// to rebuild a raw blackbox output like the one written by the blackbox.
+static std::string shortestString(const double value)
+{
+    std::ostringstream oss;
+    for (int precision = std::numeric_limits<double>::digits10; ; precision++)
+    {
+        oss.str("");
+        oss.precision(precision);
+        oss << value;
+        if (precision >= std::numeric_limits<double>::max_digits10 || std::stod(oss.str()) == value)
+        {
+            break;
+        }
+    }
+    return oss.str();
+}
+
+
+// BBOutputType to byte: type in the lower bits, revealing flag in the upper bit.
+static uint8_t bbOutputTypeToCode(const NOMAD::BBOutputType& bbOutputType)
+{
+    uint8_t code = static_cast<uint8_t>(bbOutputType._type);
+    if (bbOutputType.isRevealing())
+    {
+        code |= 0x80;
+    }
+    return code;
+}
+
+
+static NOMAD::BBOutputType codeToBBOutputType(const uint8_t code)
+{
+    auto type = static_cast<NOMAD::BBOutputType::Type>(code & 0x7F);
+    if (type > NOMAD::BBOutputType::Type::BBO_UNDEFINED)
+    {
+        type = NOMAD::BBOutputType::Type::BBO_UNDEFINED;
+    }
+    return NOMAD::BBOutputType(type, 0 != (code & 0x80));
+}
+
+
+bool NOMAD::CacheFileBinary::goodForCacheFile(const NOMAD::EvalPoint& evalPoint)
+{
+    for (const auto evalType : rowEvalTypes)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(evalType);
+        if (nullptr != eval && eval->goodForCacheFile())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+size_t NOMAD::CacheFileBinary::headerSize(const size_t m)
+{
+    return roundUpTo8(_headerFixedSize + m);
+}
+
+
+size_t NOMAD::CacheFileBinary::rowSize(const size_t n, const size_t m)
+{
+    // Coordinates and outputs, then 2 numbers of outputs and 2 status bytes, padded.
+    return sizeof(double) * (n + 2 * m) + roundUpTo8(2 * sizeof(uint32_t) + 2 * sizeof(uint8_t));
+}
+
+
+NOMAD::CacheFileBinary::Header NOMAD::CacheFileBinary::makeHeader(const NOMAD::BBOutputTypeList& bbOutputType)
+{
+    Header header;
+    header._version     = _version;
+    header._headerSize  = static_cast<uint32_t>(headerSize(bbOutputType.size()));
+    header._n           = 0;
+    header._m           = bbOutputType.size();
+    header._nbRows      = 0;
+    header._nbCacheHits = 0;
+    for (const auto& bbot : bbOutputType)
+    {
+        header._bbOutputTypeCodes.push_back(bbOutputTypeToCode(bbot));
+    }
+    return header;
+}
+
+
+std::vector<char> NOMAD::CacheFileBinary::encodeHeader(const Header& header)
+{
+    std::vector<char> bytes(header._headerSize, 0);
+    std::memcpy(bytes.data(), _magic.data(), _magic.size());
+    putValue(bytes, 8,  header._version);
+    putValue(bytes, 12, header._headerSize);
+    putValue(bytes, 16, header._n);
+    putValue(bytes, 24, header._m);
+    putValue(bytes, 32, header._nbRows);
+    putValue(bytes, 40, header._nbCacheHits);
+    std::copy(header._bbOutputTypeCodes.begin(), header._bbOutputTypeCodes.end(), bytes.begin() + _headerFixedSize);
+    return bytes;
+}
+
+
+bool NOMAD::CacheFileBinary::decodeHeader(const char* data, const size_t size, Header& header)
+{
+    if (size < _headerFixedSize || 0 != std::memcmp(data, _magic.data(), _magic.size()))
+    {
+        return false;
+    }
+    header._version     = getValue<uint32_t>(data, 8);
+    header._headerSize  = getValue<uint32_t>(data, 12);
+    header._n           = getValue<uint64_t>(data, 16);
+    header._m           = getValue<uint64_t>(data, 24);
+    header._nbRows      = getValue<uint64_t>(data, 32);
+    header._nbCacheHits = getValue<uint64_t>(data, 40);
+    if (_version != header._version
+        || headerSize(header._m) != header._headerSize
+        || size < header._headerSize)
+    {
+        return false;
+    }
+    header._bbOutputTypeCodes.assign(data + _headerFixedSize, data + _headerFixedSize + header._m);
+
+    return true;
+}
+
+
+void NOMAD::CacheFileBinary::encodeRow(const NOMAD::EvalPoint& evalPoint, const size_t m, std::vector<char>& row)
+{
+    const size_t n = evalPoint.size();
+    const double undefined = std::numeric_limits<double>::quiet_NaN();
+
+    row.assign(rowSize(n, m), 0);
+    size_t offset = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const NOMAD::Double& xi = evalPoint[i];
+        putValue(row, offset, xi.isDefined() ? xi.todouble() : undefined);
+        offset += sizeof(double);
+    }
+
+    uint32_t nbOutputs[2] = { 0, 0 };
+    uint8_t evalStatus[2];
+    for (size_t k = 0; k < 2; k++)
+    {
+        const NOMAD::Eval* eval = evalPoint.getEval(rowEvalTypes[k]);
+        evalStatus[k] = static_cast<uint8_t>((nullptr == eval) ? NOMAD::EvalStatusType::EVAL_NOT_STARTED
+                                                               : eval->getEvalStatus());
+        if (nullptr != eval)
+        {
+            const NOMAD::BBOutput bbo = eval->getBBOutput();
+            const NOMAD::ArrayOfDouble& outputs = bbo.getBBOAsArrayOfDouble();
+            // Outputs beyond BB_OUTPUT_TYPE cannot be stored.
+            nbOutputs[k] = static_cast<uint32_t>(std::min(outputs.size(), m));
+            for (size_t j = 0; j < nbOutputs[k]; j++)
+            {
+                putValue(row, offset + j * sizeof(double), outputs[j].isDefined() ? outputs[j].todouble() : undefined);
+            }
+        }
+        for (size_t j = nbOutputs[k]; j < m; j++)
+        {
+            putValue(row, offset + j * sizeof(double), undefined);
+        }
+        offset += m * sizeof(double);
+    }
+
+    putValue(row, offset, nbOutputs[0]);
+    putValue(row, offset + 4, nbOutputs[1]);
+    putValue(row, offset + 8, evalStatus[0]);
+    putValue(row, offset + 9, evalStatus[1]);
+}
+
+
+NOMAD::EvalPoint NOMAD::CacheFileBinary::decodeRow(const char* row, const size_t n, const size_t m)
+{
+    NOMAD::Point x(n);
+    size_t offset = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const double xi = getValue<double>(row, offset);
+        if (!std::isnan(xi))
+        {
+            x[i] = xi;
+        }
+        offset += sizeof(double);
+    }
+    NOMAD::EvalPoint evalPoint(x);
+
+    const size_t tailOffset = offset + 2 * m * sizeof(double);
+    std::ostringstream oss;
+    for (size_t k = 0; k < 2; k++)
+    {
+        const size_t nbOutputs = getValue<uint32_t>(row, tailOffset + 4 * k);
+        const uint8_t status = getValue<uint8_t>(row, tailOffset + 8 + k);
+        if (status >= static_cast<uint8_t>(NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED)
+            || static_cast<uint8_t>(NOMAD::EvalStatusType::EVAL_NOT_STARTED) == status)
+        {
+            // No evaluation performed
+            continue;
+        }
+
+        // Rebuild the raw blackbox output.
+        oss.str("");
+        for (size_t j = 0; j < std::min(nbOutputs, m); j++)
+        {
+            const double value = getValue<double>(row, offset + (k * m + j) * sizeof(double));
+            if (j > 0)
+            {
+                oss << " ";
+            }
+            if (std::isnan(value))
+            {
+                oss << NOMAD::DEFAULT_UNDEF_STR;
+            }
+            else if (std::isinf(value))
+            {
+                oss << ((value < 0) ? "-" : "") << NOMAD::DEFAULT_INF_STR;
+            }
+            else
+            {
+                oss << shortestString(value);
+            }
+        }
+
+        // Never use model eval in cache file
+        evalPoint.setEvalStatus(static_cast<NOMAD::EvalStatusType>(status), rowEvalTypes[k]);
+        evalPoint.setBBO(oss.str(), NOMAD::BBOutputTypeList(), rowEvalTypes[k]);
+
+        // For now, set numEval to 1 if Eval exists, as for the text format.
+        evalPoint.setNumberBBEval(1);
+    }
+
+    return evalPoint;
+}
+
+
+bool NOMAD::CacheFileBinary::isBinaryFile(const std::string& filename)
+{
+    std::ifstream fin(filename, std::ios::binary);
+    std::string start(_magic.size(), '\0');
+    fin.read(&start[0], start.size());
+
+    return (fin.good() && _magic == start);
+}
+
+
+bool NOMAD::CacheFileBinary::write(const NOMAD::CacheBase& cache, const std::string& filename)
+{
+    std::ofstream fout(filename, std::ios::binary | std::ios::trunc);
+    if (fout.fail())
+    {
+        std::cerr << "Warning: could not write binary cache file " << filename << std::endl;
+        return false;
+    }
+
+    // The header is written again once the rows are known.
+    Header header = makeHeader(NOMAD::CacheBase::getBbOutputType());
+    std::vector<char> bytes = encodeHeader(header);
+    fout.write(bytes.data(), bytes.size());
+
+    cache.browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        if (goodForCacheFile(evalPoint))
+        {
+            header._n = evalPoint.size();
+            encodeRow(evalPoint, header._m, bytes);
+            fout.write(bytes.data(), bytes.size());
+            header._nbRows++;
+        }
+    });
+
+    header._nbCacheHits = NOMAD::CacheBase::getNbCacheHits();
+    bytes = encodeHeader(header);
+    fout.seekp(0);
+    fout.write(bytes.data(), bytes.size());
+    fout.close();
+
+    return !fout.fail();
+}
+
+
+bool NOMAD::CacheFileBinary::append(const std::vector<NOMAD::EvalPoint>& evalPointList,
+                                    const size_t nbCacheHits,
+                                    const std::string& filename)
+{
+    std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    // Read the header
+    std::vector<char> bytes(_headerFixedSize);
+    file.read(bytes.data(), bytes.size());
+    if (!file.good() || 0 != std::memcmp(bytes.data(), _magic.data(), _magic.size()))
+    {
+        return false;
+    }
+    bytes.resize(headerSize(getValue<uint64_t>(bytes.data(), 24)));
+    file.read(bytes.data() + _headerFixedSize, bytes.size() - _headerFixedSize);
+    Header header;
+    if (!file.good() || !decodeHeader(bytes.data(), bytes.size(), header))
+    {
+        return false;
+    }
+
+    // The file must hold the same kind of points.
+    if (makeHeader(NOMAD::CacheBase::getBbOutputType())._bbOutputTypeCodes != header._bbOutputTypeCodes)
+    {
+        return false;
+    }
+    for (const auto& evalPoint : evalPointList)
+    {
+        if (0 == header._nbRows && 0 == header._n)
+        {
+            header._n = evalPoint.size();
+        }
+        else if (header._n != evalPoint.size())
+        {
+            return false;
+        }
+    }
+
+    const size_t rowBytes = rowSize(header._n, header._m);
+    const size_t endOfRows = header._headerSize + header._nbRows * rowBytes;
+    file.seekg(0, std::ios::end);
+    if (static_cast<size_t>(file.tellg()) < endOfRows)
+    {
+        return false;
+    }
+
+    // Write after the last complete row, then update the header.
+    file.seekp(endOfRows);
+    for (const auto& evalPoint : evalPointList)
+    {
+        encodeRow(evalPoint, header._m, bytes);
+        file.write(bytes.data(), bytes.size());
+    }
+    file.flush();
+
+    header._nbRows += evalPointList.size();
+    header._nbCacheHits = nbCacheHits;
+    bytes = encodeHeader(header);
+    file.seekp(0);
+    file.write(bytes.data(), bytes.size());
+    file.close();
+
+    return !file.fail();
+}
+
+
+bool NOMAD::CacheFileBinary::read(NOMAD::CacheBase& cache, const std::string& filename)
+{
+    MappedCacheFile file(filename);
+    if (nullptr == file.data())
+    {
+        return false;
+    }
+
+    Header header;
+    if (!decodeHeader(file.data(), file.size(), header))
+    {
+        std::string err = "Error: " + filename + " is not a binary cache file of version " + std::to_string(_version);
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    const size_t n = header._n;
+    const size_t m = header._m;
+    const size_t rowBytes = rowSize(n, m);
+    size_t nbRows = header._nbRows;
+    const size_t nbRowsInFile = (file.size() - header._headerSize) / rowBytes;
+    if (nbRowsInFile < nbRows)
+    {
+        std::string s = "Warning: binary cache file " + filename + " is truncated. Reading " + std::to_string(nbRowsInFile);
+        s += " points out of " + std::to_string(nbRows);
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_WARNING);
+        nbRows = nbRowsInFile;
+    }
+
+    NOMAD::BBOutputTypeList bbOutputType;
+    for (const auto code : header._bbOutputTypeCodes)
+    {
+        bbOutputType.push_back(codeToBBOutputType(code));
+    }
+    cache.setNbCacheHits(header._nbCacheHits);
+    cache.setBBOutputType(bbOutputType);
+
+    NOMAD::EvalPoint evalPointFound;
+    const char* row = file.data() + header._headerSize;
+    for (size_t r = 0; r < nbRows; r++, row += rowBytes)
+    {
+        NOMAD::EvalPoint evalPoint = decodeRow(row, n, m);
+        evalPoint.setBBOutputType(bbOutputType);
+        evalPoint.setEvalIsFromCacheFile(true);
+
+        if (0 == cache.find(evalPoint, evalPointFound, NOMAD::EvalType::UNDEFINED, false))
+        {
+            evalPoint.updateTag();
+            cache.insert(evalPoint);
+        }
+        else
+        {
+            // The point was written again after an update: The last row is kept.
+            for (const auto evalType : rowEvalTypes)
+            {
+                if (nullptr != evalPoint.getEval(evalType))
+                {
+                    cache.update(evalPoint, evalType);
+                }
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,171 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheFileBinary.hpp
+ * \brief  Binary format for the cache file
+ * \see    CacheFileBinary.cpp
+ */
+
+#ifndef __NOMAD_4_5_CACHEFILEBINARY__
+#define __NOMAD_4_5_CACHEFILEBINARY__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../Cache/CacheBase.hpp"
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Read and write the cache file in binary format.
+/**
+ * Used when parameter CACHE_FILE_FORMAT is BINARY. The file is a fixed-width
+ * header followed by fixed-width rows, one per point:
+ *
+ * - Header: magic string, format version, header size, dimension n, number
+ *   of blackbox outputs m, number of rows, number of cache hits, then one byte
+ *   per BB_OUTPUT_TYPE. Padded to a multiple of 8 bytes.
+ * - Row: the n coordinates, the m outputs of the BB eval and the m outputs of
+ *   the SURROGATE eval (NaN when undefined), then for each of these evals the
+ *   number of outputs (32 bits) and the eval status (8 bits). Padded to a
+ *   multiple of 8 bytes.
+ *
+ * Numbers are stored in the byte order of the machine.
+ *
+ * Rows are only appended. When the evaluation of a point is updated after
+ * it was written, a new row is appended: The last row of a point is the one
+ * that is kept when the file is read. The number of rows in the header is
+ * updated after the rows are written, so an interrupted write leaves
+ * a valid file.
+ *
+ * \note The outputs are stored as doubles: When read, the raw blackbox
+ * output of the eval is rebuilt from these values.
+ */
+class CacheFileBinary
+{
+public:
+    /// Verify if the file starts like a binary cache file.
+    DLL_EVAL_API static bool isBinaryFile(const std::string& filename);
+
+    /// Write all the points of the cache that have a good eval for the cache file.
+    /**
+     * The file is overwritten.
+     \param cache       The cache to write                   -- \b IN.
+     \param filename    The name of the file                 -- \b IN.
+     \return            \c true if the file was written.
+     */
+    DLL_EVAL_API static bool write(const CacheBase& cache, const std::string& filename);
+
+    /// Append points at the end of a binary cache file.
+    /**
+     * The file must exist, and have the same dimension and blackbox output types.
+     \param evalPointList   The points to append                     -- \b IN.
+     \param nbCacheHits     The number of cache hits, for the header -- \b IN.
+     \param filename        The name of the file                     -- \b IN.
+     \return                \c true if the points were appended, \c false if the file could not be used.
+     */
+    DLL_EVAL_API static bool append(const std::vector<EvalPoint>& evalPointList,
+                                    const size_t nbCacheHits,
+                                    const std::string& filename);
+
+    /// Read a binary cache file and add its points to the cache.
+    /**
+     * The file is memory-mapped when the platform supports it.
+     \param cache       The cache to fill                    -- \b IN/OUT.
+     \param filename    The name of the file                 -- \b IN.
+     \return            \c true if the file was read.
+     */
+    DLL_EVAL_API static bool read(CacheBase& cache, const std::string& filename);
+
+    /// Verify if the point has an eval to keep in the cache file.
+    DLL_EVAL_API static bool goodForCacheFile(const EvalPoint& evalPoint);
+
+private:
+
+    /// Fields of the header, in the order they are written.
+    struct Header
+    {
+        uint32_t _version;
+        uint32_t _headerSize;
+        uint64_t _n;
+        uint64_t _m;
+        uint64_t _nbRows;
+        uint64_t _nbCacheHits;
+        std::vector<uint8_t> _bbOutputTypeCodes;
+    };
+
+    static const std::string _magic;                ///< First bytes of the file
+    static const uint32_t    _version;              ///< Version of the format
+    static const size_t      _headerFixedSize;      ///< Size of the header, without the BB_OUTPUT_TYPE codes and padding
+
+    /// Size of the header for m blackbox outputs
+    static size_t headerSize(const size_t m);
+
+    /// Size of a row for points of dimension n and m blackbox outputs
+    static size_t rowSize(const size_t n, const size_t m);
+
+    /// Make the header for these blackbox output types
+    static Header makeHeader(const BBOutputTypeList& bbOutputType);
+
+    /// Header to bytes
+    static std::vector<char> encodeHeader(const Header& header);
+
+    /// Bytes to header. Return false if the bytes are not a header of a supported version.
+    static bool decodeHeader(const char* data, const size_t size, Header& header);
+
+    /// Fill the row buffer with a point
+    static void encodeRow(const EvalPoint& evalPoint, const size_t m, std::vector<char>& row);
+
+    /// Make a point from a row
+    static EvalPoint decodeRow(const char* row, const size_t n, const size_t m);
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_CACHEFILEBINARY__
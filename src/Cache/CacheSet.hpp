@@ -59,6 +59,7 @@
 #include <omp.h>
 #endif  // _OPENMP
 #include "../Cache/CacheBase.hpp"
+#include "../Cache/SpatialIndex.hpp"
 #include "../Eval/EvalPoint.hpp"
 
 #include "../nomad_platform.hpp"
@@ -78,12 +79,11 @@ private:
     static omp_lock_t  _cacheLock;
 #endif // _OPENMP
 
-    static BBOutputTypeList    _bbOutputType;  ///< Corresponds to parameter BB_OUTPUT_TYPE used for this cache
-    static ArrayOfDouble       _bbEvalFormat;  ///< Used to write cache correctly
-
     EvalPointSet _cache;  ///< The set of points that constitutes the cache.
     EvalPointSet _cacheForRerun;  ///< The set of points that constitutes the cache used for rerun only (empty if not in rerun mode). Filled with points from a cache file. Used for evaluation, not for "cache hit". 
 
+    SpatialIndex _spatialIndex;   ///< k-d tree on the points of _cache, for radius and nearest-neighbour queries. Protected by _cacheLock.
+
     
 
     /// Constructor
@@ -119,14 +119,8 @@ public:
                             const BBOutputTypeList& bbOutputType,
                             const ArrayOfDouble& bbEvalFormat = ArrayOfDouble());
 
-    /// Get the list of blackbox output types
-    static BBOutputTypeList getBbOutputType() { return _bbOutputType; }
-
-    /// Set the list of blackbox output type
-    /**
-     \param bbOutputType    The list to use in cache -- \b IN.
-     */
-    static void setBBOutputType(const BBOutputTypeList& bbOutputType) { _bbOutputType = bbOutputType; }
+    // The queries implemented in CacheBase using browse().
+    using CacheBase::find;
 
     /// Add a new EvalPoint to the cache
     /**
@@ -174,92 +168,35 @@ public:
                      const short maxNumberEval,
                      EvalType evalType ) override;
 
-    /// Get eval point at point x from the cache and return it in a list.
-    /**
-     \param x                The point to find                              -- \b IN.
-     \param evalPointList    The eval point corresponding to x in a list    -- \b OUT.
-     \return                 1 if found, 0 otherwise
-     */
-    size_t find(const Point& x,
-                std::vector<EvalPoint> &evalPointList) const override;
-
-    /**
-     * \brief Get all eval points for which comp(refeval) returns true.
-     *
-     * All eval points for which eval is inferior to refeval.
-
-     \param refeval                The point to find                                              -- \b IN.
-     \param comp                       The comparison function                                        -- \b IN.
-     \param evalPointList   The eval points that verify comp()==true returned in a list    -- \b OUT.
-     \param computeType   Which type of computation (eval type, compute type and h norm type)  -- \b IN.
-     \return                 The number of eval points found.
-     */
-    size_t find(const Eval &refeval,
-                std::function<bool(const Eval&, const Eval&, const FHComputeTypeS&)> comp,
-                std::vector<EvalPoint> &evalPointList,
-                const FHComputeType& computeType) const override;
-
-    
-
-    /**
-     * \brief Get best eval points, using comp().
-     *
-     * Only the points with eval status EVAL_OK are considered.
-     \param comp                        The comparison function                                    -- \b IN.
-     \param evalPointList    The best eval points that verify comp()==true in a list    -- \b OUT.
-     \param findFeas               Flag to find feasible points                               -- \b IN.
-     \param hMax                        Maximum acceptable value for h, when findFeas is false     -- \b IN.
-     \param fixedVariable    Searching for a subproblem defined by this point -- \b IN.
-     \param computeType   Which type of computation (eval type, compute type and h norm type)  -- \b IN.
-     \return                 The number of eval points found.
-     */
-    virtual size_t findBest(std::function<bool(const Eval&, const Eval&,const FHComputeTypeS&)> comp,
-                            std::vector<EvalPoint> &evalPointList,
-                            const bool findFeas,
-                            const Double& hMax,
-                            const Point& fixedVariable,
-                            const FHComputeType& computeType) const override;
-
-
-    /// Test if cache contains a feasible point.
-    /**
-     \param computeType   Which type of computation (eval type, compute type and h norm type)  -- \b IN.
-     \return \c true if the cache contains at least one feasible point, \c false otherwise.
-     */
-    bool hasFeas(const FHComputeType & computeType) const override;
-    
-    /// Test if cache contains an infeasible point.
-    /**
-     \return \c true if the cache contains at least one infeasible point, \c false otherwise.
-     */
-    bool hasInfeas(const FHComputeType & computeType) const override;
-
-
-    /// Get all eval points verifying a criterion function with respect to point X. The criterion function can be a measure of distance to X.
+    /// Get all eval points within a Euclidean distance of point X and verifying a criteria.
     /**
-
-     \param X                               The point of reference                              -- \b IN.
-     \param crit                        The criterion function                              -- \b IN.
-     \param evalPointList    The eval points within the prescribed distance of X -- \b OUT.
-     \param maxEvalPoints    The maximum number of points to select              -- \b IN.
-     \return                 The number of eval points found.
+     * Uses the spatial index: the cost depends on the number of points
+       close to X, not on the size of the cache.
+     \param X               The point of reference                              -- \b IN.
+     \param radius          Select the points at distance lower than or equal to radius -- \b IN.
+     \param crit            The criteria function                               -- \b IN.
+     \param evalPointList   The eval points found, in cache order               -- \b OUT.
+     \return                The number of eval points found.
      */
-    virtual size_t find(const Point & X,
-                        std::function<bool(const Point&, const EvalPoint &)> crit,
-                        std::vector<EvalPoint> &evalPointList,
-                        int maxEvalPoints = 0) const override;
+    size_t findWithinRadius(const Point& X,
+                            const Double& radius,
+                            std::function<bool(const EvalPoint&)> crit,
+                            std::vector<EvalPoint> &evalPointList) const override;
 
-    /// \brief Find using custom criteria.
+    /// Get the k eval points closest to point X (Euclidean distance) verifying a criteria.
     /**
-     All the points for which crit() return true are put in evalPointList.
-
-     \param crit                        The criteria function                               -- \b IN.
-     \param evalPointList    The eval points within verifying the criteria -- \b OUT.
-     \return                 The number of eval points found.
+     * Uses the spatial index.
+     \param X               The point of reference                              -- \b IN.
+     \param k               The maximum number of points to select              -- \b IN.
+     \param crit            The criteria function                               -- \b IN.
+     \param evalPointList   The eval points found, by increasing distance to X  -- \b OUT.
+     \return                The number of eval points found.
      */
-    virtual size_t find(std::function<bool(const EvalPoint&)> crit,
+    size_t findKNearest(const Point& X,
+                        const size_t k,
+                        std::function<bool(const EvalPoint&)> crit,
                         std::vector<EvalPoint> &evalPointList) const override;
-    
+
     /// Browse cache using criteria. The function can have access to remote info using the lambda
     /// function capture by reference.
     /**
@@ -267,70 +204,6 @@ public:
     */
     virtual void browse(std::function<void(const EvalPoint&)> crit) const override;
 
-
-    /// \brief Find using custom criteria  and distance to a point.
-    /**
-     All the points for which the two crit() functions return true are put in evalPointList.
-
-     \param crit1                      The first criteria function                                    -- \b IN.
-     \param crit2                      The second criteria function                               -- \b IN.
-     \param evalPointList    The eval points verifying the criteria -- \b OUT.
-     \return                 The number of eval points found.
-     */
-    virtual size_t find(std::function<bool(const EvalPoint&)> crit1,
-                        std::function<bool(const EvalPoint&)> crit2,
-                        std::vector<EvalPoint> &evalPointList) const override;
-
-
-    /// Get all non dominated (or equal) best feasible eval points using dominance criterion
-    /// Used for multiobjective optimization
-    /// NB: To use with precaution, computationally costly (n log n for two objectives).
-    /**
-     \param evalPointList   The best non dominated feasible eval points in a list  -- \b OUT.
-     \param fixedVariable   Searching for a subproblem defined by this point -- \b IN.
-     \param computeType   Which type of computation (eval type, compute type and h norm type)  -- \b IN.
-     \return                The number of eval points found.
-     */
-    virtual size_t findBestFeas(std::vector<EvalPoint> &evalPointList,
-                                const Point& fixedVariable = Point(),
-                                const FHComputeType & computeType = defaultFHComputeType) const override;
-
-
-    /// Find best infeasible points with h<=hmax:
-    ///  -> index 0 and above if duplicates, least infeasible point with smallest f
-    ///  -> last index and below if duplicates, best f with smallest h
-    /// All best f points have the same blackbox outputs. Idem for the least infeasible points.
-    /// Works also for multiobjective optimization
-    /**
-     \param evalPointList   The best non dominated feasible eval points in a list  -- \b OUT.
-     \param fixedVariable   Searching for a subproblem defined by this point -- \b IN.
-     \param hMax            Select a point if h <= hMax                                                 -- \b IN.
-     \param computeType   Which type of computation (eval type, compute type and h norm type)  -- \b IN.
-     \return                The number of eval points found.
-     */
-    virtual size_t findBestInf(std::vector<EvalPoint> &evalPointList,
-                               const Double& hMax = INF,
-                               const Point& fixedVariable = Point(),
-                               const FHComputeType & computeType = defaultFHComputeType) const override;
-
-
-    /// Get all non dominated (or equal) infeasible eval points using dominance criterion
-    /// Works for single and multiobjective optimization
-    /// NB: To use with precaution, computationally costly (O(n^2 m) where n is the number
-    /// of points in the cache and m the number of objectives)
-    /**
-     \param evalPointList   The non dominated infeasible eval points  -- \b OUT.
-     \param fixedVariable   Searching for a subproblem defined by this point -- \b IN.
-     \param hMax            Select a point if h <= hMax                                                 -- \b IN.
-     \param computeType   Which type of computation (eval type, compute type and h norm type)  -- \b IN.
-     \return                The number of eval points found.
-     */
-    virtual size_t findFilterInf(std::vector<NOMAD::EvalPoint> &evalPointList,
-                                 const Double& hMax,
-                                 const Point& fixedVariable,
-                                 const FHComputeType & computeType) const override;
-
-
     /// \brief Update EvalPoint in cache.
     /**
      * Look for Point and update the Eval part.
@@ -357,28 +230,9 @@ public:
      */
     void purge() override;
 
-    /// Write cache to file _filename.
-    bool write() const override;
-
-    /// Read file given by _filename.
-    bool read() override;
-
     /// Display all points in cache.
     std::string displayAll() const override;
 
-    /** Display only EvalPoints that have an eval.
-     * This method is used to write the cache file.
-     * \note the EvalPoint's Eval must satisfy method Eval::goodForCacheFile().
-     */
-    std::ostream& displayPointsWithEval(std::ostream& os) const;
-
-    /// Compute the mean f.
-    /**
-     \param mean       The eval point to update -- \b OUT.
-     \return        The number of EvalPoints for which f is defined.
-     */
-    size_t computeMeanF(Double &mean) const override;
-
     /// Call function func() on all EvalPoint in cache for Evals that were generated by mainThreadNum.
     void processOnAllPoints(void (*func)(EvalPoint&), const int mainThreadNum = -1) override;
 
@@ -394,45 +248,14 @@ private:
     /// Private function for internal use by destructor.
     void destroy();
 
-    /// Helper function for find and insertion.
-    /**
-     Throw exception if error. Do nothing otherwise.
-
-     \param point       The point to verify  -- \b IN.
-     */
-    void verifyPointComplete(const Point& point) const;
-
-    /// Helper function for find and insertion.
+    /// Compute the mean f by going through the cache. The cache lock must be held.
     /**
-     Throw exception if error. Do nothing otherwise.
-
-     \param point       The point to verify  -- \b IN.
-     */
-    void verifyPointSize(const Point& point) const;
-
-    /// Helper function for find and insertion.
-    /**
-     Throw exception if error. Do nothing otherwise.
-
-     \param evalPoint       The point to verify  -- \b IN.
-     */
-    void verifyPointComplete(const EvalPoint& evalPoint) const;
-
-    /// Helper function for find and insertion.
-    /**
-     Throw exception if error. Do nothing otherwise.
-
-     \param evalPoint       The point to verify  -- \b IN.
+     \param mean       The mean of f -- \b OUT.
+     \return        The number of EvalPoints for which f is defined.
      */
-    void verifyPointSize(const EvalPoint& evalPoint) const;
+    size_t computeMeanFInCache(Double &mean) const;
 };
 
-/// Display only EvalPoints that have an eval.
-DLL_EVAL_API std::ostream& operator<<(std::ostream& os, const CacheSet& cache);
-
-/// Get these EvalPoints from stream
-DLL_EVAL_API std::istream& operator>>(std::istream& is, CacheSet& cache);
-
 #include "../nomad_nsend.hpp"
 
 #endif // __NOMAD_4_5_CACHESET__
@@ -0,0 +1,613 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   CacheShardedSet.cpp
+ \brief  Implementation of Cache derived from CacheBase, using sets distributed in shards (implementation)
+ \see    CacheShardedSet.hpp
+ */
+#include "../Cache/CacheShardedSet.hpp"
+#include "../Output/OutputQueue.hpp"
+#include "../Util/MicroSleep.hpp"
+#include "../Util/Profiler.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+
+
+// Initialize CacheShardedSet class.
+// To be called by the Constructor.
+void NOMAD::CacheShardedSet::init()
+{
+    if (_cacheParams->toBeChecked())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "CacheParameters::checkAndComply() needs to be called before constructing a CacheShardedSet.");
+    }
+
+    const size_t nbShards = std::max(_cacheParams->getAttributeValue<size_t>("CACHE_NB_SHARDS"), (size_t)1);
+    _shards.reserve(nbShards);
+    for (size_t i = 0; i < nbShards; i++)
+    {
+        _shards.push_back(std::unique_ptr<Shard>(new Shard()));
+    }
+}
+
+
+// Terminate CacheShardedSet class.
+// To be called by the Destructor.
+void NOMAD::CacheShardedSet::destroy()
+{
+    // No need to lock, assuming there is only one cache and
+    // that now it is the end of the run, and we are calling its destructor.
+    _shards.clear();
+    _nbPoints = 0;
+}
+
+
+void NOMAD::CacheShardedSet::setInstance(const std::shared_ptr<NOMAD::CacheParameters>& cacheParams,
+                                         const NOMAD::BBOutputTypeList& bbOutputType,
+                                         const NOMAD::ArrayOfDouble& bbEvalFormat)
+{
+#ifdef _OPENMP
+    #pragma omp critical(initCacheLock)
+    {
+#endif // _OPENMP
+        if (nullptr == _single)
+        {
+            _single = std::unique_ptr<NOMAD::CacheShardedSet>(new CacheShardedSet(cacheParams));
+        }
+        else if (_single->size() != 0)
+        {
+            std::string err = "Cache is not empty while calling NOMAD::CacheShardedSet::setInstance more than ONCE. Need to reset the cache." ;
+            throw NOMAD::Exception(__FILE__, __LINE__, err);
+        }
+#ifdef _OPENMP
+    }   // end of critical section
+#endif // _OPENMP
+
+    _bbOutputType = bbOutputType;
+    _bbEvalFormat = bbEvalFormat;
+
+    // As long as the cache file exists, it is read.
+    getInstance()->read();
+}
+
+
+NOMAD::CacheShardedSet::Shard& NOMAD::CacheShardedSet::getShard(const NOMAD::Point& x) const
+{
+    // Hash the truncated coordinates: EvalPointCompare compares them.
+    // Adding 0.0 maps -0.0 to 0.0.
+    std::hash<double> hashDouble;
+    size_t hashKey = x.size();
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        hashKey ^= hashDouble(x[i].trunk() + 0.0) + 0x9e3779b9 + (hashKey << 6) + (hashKey >> 2);
+    }
+
+    return *_shards[hashKey % _shards.size()];
+}
+
+
+// Add a new eval point to the cache.
+// Return true if insertion worked, false if not (EvalPoint was already there).
+bool NOMAD::CacheShardedSet::insert(const NOMAD::EvalPoint &evalPoint)
+{
+    NOMAD::EvalPoint evalPointFound;
+    // Return true if point is not found: Expecting it to be inserted.
+    bool inserted = (0 == find(evalPoint, evalPointFound));
+    // Ignore smartInsert's return value
+    smartInsert(evalPoint, NOMAD::INF_SHORT, NOMAD::EvalType::BB);
+
+    return inserted;
+}
+
+
+// Get EvalPoint evalPoint at Point x from the cache
+// Returns the number of EvalPoints found
+size_t NOMAD::CacheShardedSet::find(const NOMAD::Point& x, NOMAD::EvalPoint &evalPoint,
+                                    const NOMAD::EvalType evalType,
+                                    bool waitIfNotYetAvailable ) const
+{
+    NOMAD_PROFILE_SCOPE("CacheShardedSet::find");
+    const NOMAD::EvalPoint key(x);
+    Shard& shard = getShard(x);
+
+    std::shared_lock<std::shared_mutex> lock(shard._mutex);
+    auto it = shard._points.find(key);
+    if (it == shard._points.end())
+    {
+        return 0;
+    }
+#ifdef _OPENMP
+    // Wait for evaluation:
+    // If using OpenMP, the EvalPoint may be updated by another thread.
+    // Otherwise, do not wait.
+    if (waitIfNotYetAvailable && NOMAD::EvalType::UNDEFINED != evalType)
+    {
+        auto evalStatus = it->getEvalStatus(evalType);
+        if (NOMAD::EvalStatusType::EVAL_IN_PROGRESS == evalStatus)
+        {
+            OUTPUT_INFO_START
+            std::string s = "Start waiting for point ";
+            s += x.display() + " to complete.";
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
+            OUTPUT_INFO_END
+        }
+        while (!_stopWaiting
+               && (NOMAD::EvalStatusType::EVAL_IN_PROGRESS == evalStatus
+                   || NOMAD::EvalStatusType::EVAL_NOT_STARTED == evalStatus
+                   || NOMAD::EvalStatusType::EVAL_STATUS_UNDEFINED == evalStatus))
+        {
+            // Release the shard while waiting, so that the point can be updated.
+            lock.unlock();
+            usleep(10);
+            lock.lock();
+            it = shard._points.find(key);
+            if (it == shard._points.end())
+            {
+                // The point was removed from the cache meanwhile.
+                return 0;
+            }
+            evalStatus = it->getEvalStatus(evalType);
+        }
+        if (_stopWaiting && NOMAD::EvalStatusType::EVAL_IN_PROGRESS == evalStatus)
+        {
+            OUTPUT_INFO_START
+            std::string s = "Force stop waiting for point ";
+            s += x.display() + " to complete.";
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_INFO);
+            OUTPUT_INFO_END
+        }
+    }
+#endif // _OPENMP
+    evalPoint = *it;
+
+    return 1;
+}
+
+
+// Get EvalPoint evalPoint at Point x from the cache for rerun.
+bool NOMAD::CacheShardedSet::findInCacheForRerun(const NOMAD::Point& x, NOMAD::EvalPoint &evalPoint) const
+{
+    std::shared_lock<std::shared_mutex> lock(_cacheForRerunMutex);
+    auto it = _cacheForRerun.find(NOMAD::EvalPoint(x));
+    if (it != _cacheForRerun.end())
+    {
+        evalPoint = *it;
+        return true;
+    }
+    return false;
+}
+
+
+// Insert evalPoint in cache.
+// Return a boolean indicating if we should eval this point.
+bool NOMAD::CacheShardedSet::smartInsert(const NOMAD::EvalPoint &evalPoint,
+                                         short maxNumberEval,
+                                         NOMAD::EvalType evalType)
+{
+    NOMAD_PROFILE_SCOPE("CacheShardedSet::smartInsert");
+    verifyPointComplete(evalPoint);
+    verifyPointSize(evalPoint);
+
+    // First insert sets n (even if insert fails)
+    if (0 == _nbPoints)
+    {
+        _n = evalPoint.size();
+    }
+
+    Shard& shard = getShard(*evalPoint.getX());
+
+    // The point in cache may be modified by toEvalAfterInsert (tag):
+    // keep the exclusive lock.
+    std::unique_lock<std::shared_mutex> lock(shard._mutex);
+    auto ret = shard._points.insert(evalPoint);
+    if (ret.second)
+    {
+        shard._spatialIndex.insert(&*ret.first);
+        _nbPoints++;
+        addPointToWrite(*ret.first);
+        addToAggregates(*ret.first);
+    }
+
+    return toEvalAfterInsert(*ret.first, evalPoint, ret.second, maxNumberEval, evalType);
+}
+
+
+size_t NOMAD::CacheShardedSet::findWithinRadius(const NOMAD::Point& X,
+                                                const NOMAD::Double& radius,
+                                                std::function<bool(const NOMAD::EvalPoint&)> crit,
+                                                std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    NOMAD_PROFILE_SCOPE("CacheShardedSet::findWithinRadius");
+    verifyPointComplete(X);
+    verifyPointSize(X);
+    evalPointList.clear();
+    if (!radius.isDefined())
+    {
+        return 0;
+    }
+
+    std::vector<const NOMAD::EvalPoint*> found;
+    for (const auto& shard : _shards)
+    {
+        std::shared_lock<std::shared_mutex> lock(shard->_mutex);
+        found.clear();
+        shard->_spatialIndex.findWithinRadius(X, radius.todouble(), crit, found);
+        for (const auto evalPoint : found)
+        {
+            evalPointList.push_back(*evalPoint);
+        }
+    }
+
+    // Return the points in the same order as CacheSet.
+    std::sort(evalPointList.begin(), evalPointList.end(), NOMAD::EvalPointCompare());
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::CacheShardedSet::findKNearest(const NOMAD::Point& X,
+                                            const size_t k,
+                                            std::function<bool(const NOMAD::EvalPoint&)> crit,
+                                            std::vector<NOMAD::EvalPoint> &evalPointList) const
+{
+    NOMAD_PROFILE_SCOPE("CacheShardedSet::findKNearest");
+    verifyPointComplete(X);
+    verifyPointSize(X);
+    evalPointList.clear();
+
+    // The k nearest points are among the k nearest points of each shard.
+    std::vector<const NOMAD::EvalPoint*> found;
+    std::vector<NOMAD::EvalPoint> candidates;
+    for (const auto& shard : _shards)
+    {
+        std::shared_lock<std::shared_mutex> lock(shard->_mutex);
+        found.clear();
+        shard->_spatialIndex.findKNearest(X, k, crit, found);
+        for (const auto evalPoint : found)
+        {
+            candidates.push_back(*evalPoint);
+        }
+    }
+
+    std::vector<std::pair<double, size_t>> distances;
+    distances.reserve(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        distances.emplace_back(NOMAD::Point::dist(X, *candidates[i].getX()).todouble(), i);
+    }
+    // Ties are broken by EvalPointCompare, as in CacheSet.
+    const size_t nbKept = std::min(k, distances.size());
+    std::partial_sort(distances.begin(), distances.begin() + nbKept, distances.end(),
+                      [&candidates](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b)
+                      {
+                          if (a.first != b.first)
+                          {
+                              return a.first < b.first;
+                          }
+                          return NOMAD::EvalPointCompare()(candidates[a.second], candidates[b.second]);
+                      });
+
+    evalPointList.reserve(nbKept);
+    for (size_t i = 0; i < nbKept; i++)
+    {
+        evalPointList.push_back(candidates[distances[i].second]);
+    }
+
+    return evalPointList.size();
+}
+
+
+void NOMAD::CacheShardedSet::browse(std::function<void(const NOMAD::EvalPoint&)> crit) const
+{
+    for (const auto& shard : _shards)
+    {
+        std::shared_lock<std::shared_mutex> lock(shard->_mutex);
+        for (const auto& evalPoint : shard->_points)
+        {
+            crit(evalPoint);
+        }
+    }
+}
+
+
+// Update EvalPoint in cache.
+// Look for Point and update the Eval part.
+// If the point is not found, it is a serious issue.
+// Don't throw an exception, to avoid a crash, but write a warning.
+// Returns true if update succeeded, false if there was an error.
+bool NOMAD::CacheShardedSet::update(const NOMAD::EvalPoint& evalPoint, NOMAD::EvalType  evalType, const NOMAD::MeshBasePtr mesh)
+{
+    if (nullptr == evalPoint.getEval(evalType))
+    {
+        // Cannot update to a null Eval. Warn the user.
+        std::string err = "Warning: CacheShardedSet: Update: Cannot update to a NULL Eval for Point ";
+        err += evalPoint.displayAll();
+        std::cout << err << std::endl;
+        return false;
+    }
+
+    Shard& shard = getShard(*evalPoint.getX());
+    std::unique_lock<std::shared_mutex> lock(shard._mutex);
+    auto it = shard._points.find(evalPoint);
+    if (it == shard._points.end())
+    {
+        std::string err = "Warning: CacheShardedSet: Update: Did not find EvalPoint to update in cache: " + evalPoint.displayAll();
+        std::cout << err << std::endl;
+        NOMAD::OutputQueue::Add(err, NOMAD::OutputLevel::LEVEL_WARNING);
+        return false;
+    }
+
+    // Update EvalPoint in cache directly.
+    // Since we are not changing the Point part, which is the only part
+    // used for sorting and hashing, the cache remains coherent.
+    auto cacheEvalPoint = const_cast<NOMAD::EvalPoint*>(&*it);
+    const NOMAD::EvalPoint evalPointBefore(*cacheEvalPoint);
+    cacheEvalPoint->setEval(*evalPoint.getEval(evalType), evalType);
+    if (NOMAD::EvalType::BB == evalType)
+    {
+        cacheEvalPoint->setNumberBBEval(evalPoint.getNumberBBEval());
+    }
+    if (nullptr != mesh)
+    {
+        cacheEvalPoint->setMesh(mesh);
+    }
+
+    // Update revealing status of the point (DiscoMads algorithm)
+    cacheEvalPoint->setRevealingStatus(evalPoint.getRevealingStatus());
+
+    // Update user fail eval check flag of the point (DiscoMads algorithm)
+    cacheEvalPoint->setUserFailEvalCheck(evalPoint.getUserFailEvalCheck());
+
+    addPointToWrite(*cacheEvalPoint);
+    updateAggregates(evalPointBefore, *cacheEvalPoint);
+
+    return true;
+}
+
+
+// Empty the cache and reset number of cache hits
+bool NOMAD::CacheShardedSet::clear()
+{
+    for (const auto& shard : _shards)
+    {
+        std::unique_lock<std::shared_mutex> lock(shard->_mutex);
+        _nbPoints -= shard->_points.size();
+        shard->_points.clear();
+        shard->_spatialIndex.clear();
+    }
+    invalidateAggregates();
+
+    // Note: We might not want to reset - in that case, remove this line.
+    resetNbCacheHits();
+
+    // Reset size of points in cache
+    _n = 0;
+
+    invalidateCacheFile();
+
+    return true;
+}
+
+
+// Clear all quad and sgtelib model evaluations from the cache
+void NOMAD::CacheShardedSet::clearModelEval(const int mainThreadNum)
+{
+    processOnAllPoints(NOMAD::EvalPoint::clearModelEval, mainThreadNum);
+}
+
+
+// Purge the cache for space.
+// Same strategy as CacheSet::purge(): keep the EvalPoints which have an f
+// under the mean f. If this does not remove anything, remove half the
+// points of each shard.
+// Each shard is purged under its own lock: the other shards remain available.
+void NOMAD::CacheShardedSet::purge()
+{
+    std::cout << "Warning: Calling Cache purge. Size is " << size() << " max is " << _maxSize << ". Some points will be removed from the cache." << std::endl;
+    if ( _maxSize== NOMAD::INF_SIZE_T || size() < _maxSize)
+    {
+        // Do nothing
+        return;
+    }
+    size_t nbRemovedLast = 1;
+
+    auto isUnderMeanF = [](const NOMAD::EvalPoint& evalPoint, const NOMAD::Double& meanF)
+    {
+        if (NOMAD::EvalStatusType::EVAL_OK != evalPoint.getEvalStatus(NOMAD::EvalType::BB))
+        {
+            return false;
+        }
+        const NOMAD::Double f = evalPoint.getF(defaultFHComputeType);
+        return (f.isDefined() && f < meanF);
+    };
+
+    while (size() >= _maxSize)
+    {
+        NOMAD::Double meanF;
+        size_t nbElemWithF = computeMeanF(meanF);
+
+        size_t nbKept = 0;
+        if (nbElemWithF > 0 && nbRemovedLast > 0)
+        {
+            browse([&](const NOMAD::EvalPoint& evalPoint)
+            {
+                if (isUnderMeanF(evalPoint, meanF))
+                {
+                    nbKept++;
+                }
+            });
+        }
+
+        // If no point is under the mean, set nbRemovedLast to 0 and
+        // remove arbitrary half the elements of each shard.
+        if (0 == nbKept)
+        {
+            nbRemovedLast = 0;
+        }
+
+        const size_t sizeBefore = size();
+        for (const auto& shard : _shards)
+        {
+            std::unique_lock<std::shared_mutex> lock(shard->_mutex);
+            const size_t nbToKeep = shard->_points.size() / 2;
+            size_t i = 0;
+            for (auto it = shard->_points.begin(); it != shard->_points.end(); i++)
+            {
+                bool keep = (nbRemovedLast > 0) ? isUnderMeanF(*it, meanF) : (i < nbToKeep);
+                if (keep)
+                {
+                    ++it;
+                }
+                else
+                {
+                    shard->_spatialIndex.remove(&*it);
+                    it = shard->_points.erase(it);
+                    _nbPoints--;
+                }
+            }
+        }
+        invalidateAggregates();
+        if (nbRemovedLast > 0)
+        {
+            nbRemovedLast = sizeBefore - size();
+        }
+    }
+}
+
+
+// Call function func on all points generated by mainThreadNum
+void NOMAD::CacheShardedSet::processOnAllPoints(void (*func)(NOMAD::EvalPoint&), const int mainThreadNum)
+{
+    for (const auto& shard : _shards)
+    {
+        std::unique_lock<std::shared_mutex> lock(shard->_mutex);
+        for (const auto& it : shard->_points)
+        {
+            auto evalPoint = const_cast<NOMAD::EvalPoint*>(&it);
+            if (   -1 == mainThreadNum
+                || evalPoint->getThreadAlgo() == mainThreadNum)
+            {
+                func(*evalPoint);
+            }
+        }
+    }
+    if (NOMAD::EvalPoint::clearModelEval == func)
+    {
+        processOnAggregates(func, mainThreadNum);
+    }
+    else
+    {
+        invalidateAggregates();
+    }
+}
+
+
+void NOMAD::CacheShardedSet::deleteModelEvalOnly(const int mainThreadNum)
+{
+    for (const auto& shard : _shards)
+    {
+        std::unique_lock<std::shared_mutex> lock(shard->_mutex);
+        for (auto it = shard->_points.begin(); it != shard->_points.end();)
+        {
+            bool foundOtherEval = (mainThreadNum != it->getThreadAlgo());
+            for (size_t i = 0; (i < (size_t)NOMAD::EvalType::LAST && !foundOtherEval); i++)
+            {
+                auto evalType = NOMAD::EvalType(i);
+                if (NOMAD::EvalType::MODEL != evalType && nullptr != it->getEval(evalType))
+                {
+                    foundOtherEval = true;
+                }
+            }
+            if (foundOtherEval)
+            {
+                it++;
+            }
+            else
+            {
+                // Only MODEL evaluation, or no evaluation, for this point.
+                shard->_spatialIndex.remove(&*it);
+                it = shard->_points.erase(it);
+                _nbPoints--;
+            }
+        }
+    }
+}
+
+
+// Display all points in cache
+// Useful mostly for debugging purposes
+std::string NOMAD::CacheShardedSet::displayAll() const
+{
+    std::string retStr;
+    browse([&](const NOMAD::EvalPoint& evalPoint)
+    {
+        retStr += evalPoint.displayAll() + "\n";
+    });
+
+    return retStr;
+}
+
+
+void NOMAD::CacheShardedSet::moveEvalPointToCacheForRerun()
+{
+    std::unique_lock<std::shared_mutex> rerunLock(_cacheForRerunMutex);
+    _cacheForRerun.clear();
+    for (const auto& shard : _shards)
+    {
+        std::unique_lock<std::shared_mutex> lock(shard->_mutex);
+        _cacheForRerun.insert(shard->_points.begin(), shard->_points.end());
+        _nbPoints -= shard->_points.size();
+        shard->_points.clear();
+        shard->_spatialIndex.clear();
+    }
+    invalidateAggregates();
+
+    // The points will be written again once they are evaluated.
+    invalidateCacheFile();
+}
@@ -0,0 +1,270 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   CacheShardedSet.hpp
+ * \brief  Implementation of Cache derived from CacheBase, using sets distributed in shards.
+ * \see    CacheShardedSet.cpp
+ */
+
+#ifndef __NOMAD_4_5_CACHESHARDEDSET__
+#define __NOMAD_4_5_CACHESHARDEDSET__
+
+#include <memory>
+#include <shared_mutex>
+
+#include "../Cache/CacheBase.hpp"
+#include "../Cache/SpatialIndex.hpp"
+#include "../Eval/EvalPoint.hpp"
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Class implementing the abstract class \b CacheBase with shards.
+/**
+ * The points are distributed by hash into CACHE_NB_SHARDS sets. Each set
+ * has its own reader-writer lock: lookups (find, browse, findBest, etc.)
+ * take shared locks and never block each other; insertions and updates
+ * take the exclusive lock of a single shard.
+ *
+ * Use parameter CACHE_TYPE SHARDED to select this cache. Compared to
+ * CacheSet, the queries that go through the whole cache return the points
+ * shard by shard instead of in the global order of EvalPointCompare.
+ */
+class DLL_EVAL_API CacheShardedSet : public CacheBase {
+
+private:
+
+    /// A subset of the points of the cache, with its own lock.
+    struct Shard
+    {
+        EvalPointSet                _points;        ///< The points of this shard.
+        SpatialIndex                _spatialIndex;  ///< k-d tree on _points, for radius and nearest-neighbour queries.
+        mutable std::shared_mutex   _mutex;         ///< Shared for lookups, exclusive for modifications.
+    };
+
+    std::vector<std::unique_ptr<Shard>> _shards;    ///< The shards. Their number is set at construction.
+    std::atomic<size_t> _nbPoints;                  ///< Number of points in all the shards.
+
+    EvalPointSet _cacheForRerun;  ///< The set of points that constitutes the cache used for rerun only (empty if not in rerun mode). Filled with points from a cache file. Used for evaluation, not for "cache hit".
+    mutable std::shared_mutex _cacheForRerunMutex;  ///< Lock for _cacheForRerun.
+
+
+    /// Constructor
+    /**
+     \param cacheParams     The parameters for cache -- \b IN.
+     */
+    explicit CacheShardedSet(const std::shared_ptr<CacheParameters>& cacheParams)
+      : CacheBase(cacheParams),
+        _shards(),
+        _nbPoints(0)
+    {
+        init();
+    }
+
+
+public:
+    /*---------------*/
+    /* Class Methods */
+    /*---------------*/
+
+    /// Destructor
+    virtual ~CacheShardedSet()
+    {
+        destroy();
+    }
+
+    /// Set the singleton (done once)
+    /**
+     \param cacheParams     The cache parameters -- \b IN.
+     \param bbOutputType    List of the blackbox output type -- \b IN.
+     \param bbEvalFormat    Format to write cache correctly -- \b IN.
+     */
+    static void setInstance(const std::shared_ptr<CacheParameters>& cacheParams,
+                            const BBOutputTypeList& bbOutputType,
+                            const ArrayOfDouble& bbEvalFormat = ArrayOfDouble());
+
+    // The queries implemented in CacheBase using browse().
+    using CacheBase::find;
+
+    /// Get the number of shards.
+    size_t getNbShards() const { return _shards.size(); }
+
+    /// Add a new EvalPoint to the cache
+    /**
+     \param evalPoint   The eval point to insert in the cache     -- \b IN.
+     \return            \c true if the insertion succeeded and \c false if the EvalPoint was already in the cache.
+     */
+    bool insert(const EvalPoint &evalPoint) override;
+
+    /// Get eval point at point x from the cache (there can be only one).
+    /**
+     * Only the shard of x is locked, in shared mode.
+     \param x           The point to find                   -- \b IN.
+     \param evalPoint   The copy of the data in cache       -- \b OUT.
+     \param evalType    If not UNDEFINED, wait for the point to be evaluated for this EvalType. -- \b IN.
+     \param waitIfNotYetAvailable    Flag to control if we wait for the point to have an evaluation for this evaltype. -- \b IN.
+     \return            An integer: 1 if found, 0 otherwise
+     */
+    size_t find(const Point & x, EvalPoint &evalPoint,
+                const EvalType evalType = EvalType::UNDEFINED,
+                bool waitIfNotYetAvailable = true ) const override;
+
+    /// Get eval point at point x from the cache for rerun (there can be only one).
+    /**
+     \param x           The point to find                   -- \b IN.
+     \param evalPoint   The returned eval point that matches x  -- \b IN/OUT.
+     \return true if the evalPoint  found in cache for rerun, false otherwise.
+     */
+    bool findInCacheForRerun(const Point & x,
+                             NOMAD::EvalPoint &evalPoint ) const override;
+
+    /// Insert evalPoint in cache.
+    /**
+     * Only the shard of evalPoint is locked, in exclusive mode.
+     \param evalPoint       The point to insert                         -- \b IN.
+     \param maxNumberEval   The max number of evaluations of the point  -- \b IN.
+     \param evalType        Which eval of the EvalPoint to look at -- \b IN.
+     \return                A boolean indicating if we should eval this point.
+     */
+    bool smartInsert(const EvalPoint &evalPoint,
+                     const short maxNumberEval,
+                     EvalType evalType ) override;
+
+    /// Get all eval points within a Euclidean distance of point X and verifying a criteria.
+    /**
+     * Uses the spatial index of each shard.
+     \param X               The point of reference                              -- \b IN.
+     \param radius          Select the points at distance lower than or equal to radius -- \b IN.
+     \param crit            The criteria function                               -- \b IN.
+     \param evalPointList   The eval points found, in EvalPointCompare order    -- \b OUT.
+     \return                The number of eval points found.
+     */
+    size_t findWithinRadius(const Point& X,
+                            const Double& radius,
+                            std::function<bool(const EvalPoint&)> crit,
+                            std::vector<EvalPoint> &evalPointList) const override;
+
+    /// Get the k eval points closest to point X (Euclidean distance) verifying a criteria.
+    /**
+     * Uses the spatial index of each shard.
+     \param X               The point of reference                              -- \b IN.
+     \param k               The maximum number of points to select              -- \b IN.
+     \param crit            The criteria function                               -- \b IN.
+     \param evalPointList   The eval points found, by increasing distance to X  -- \b OUT.
+     \return                The number of eval points found.
+     */
+    size_t findKNearest(const Point& X,
+                        const size_t k,
+                        std::function<bool(const EvalPoint&)> crit,
+                        std::vector<EvalPoint> &evalPointList) const override;
+
+    /// Browse cache using criteria. The function can have access to remote info using the lambda
+    /// function capture by reference.
+    /**
+     * The shards are browsed one after the other, each one under a shared lock.
+     * The function must not modify the cache.
+    \param crit            The criteria function                               -- \b IN.
+    */
+    void browse(std::function<void(const EvalPoint&)> crit) const override;
+
+    /// \brief Update EvalPoint in cache.
+    /**
+     * Look for Point and update the Eval part.
+     * Only the shard of evalPoint is locked, in exclusive mode.
+
+     \param evalPoint       The eval point to update  -- \b IN.
+     \param evalType         Which eval of the EvalPoint to look at -- \b IN.
+     \param mesh                  Update the eval point with a mesh -- \b IN.
+     \return            A boolean indicating if update succeeded (\c true), \c false if there was an error.
+     */
+    bool update(const EvalPoint& evalPoint, EvalType  evalType, const MeshBasePtr mesh) override;
+
+    /// Return number of eval points in the cache.
+    size_t size() const override { return _nbPoints; }
+
+    /// Empty the cache.
+    bool clear() override;
+
+    /// Clear all model (sgtelib) evaluations from the cache
+    void clearModelEval(const int mainThreadNum) override;
+
+    /** Purge the cache to get under CACHE_SIZE_MAX.
+     */
+    void purge() override;
+
+    /// Display all points in cache.
+    std::string displayAll() const override;
+
+    /// Call function func() on all EvalPoint in cache for Evals that were generated by mainThreadNum.
+    void processOnAllPoints(void (*func)(EvalPoint&), const int mainThreadNum = -1) override;
+
+    void deleteModelEvalOnly(const int mainThreadNum) override;
+
+    /// Move eval points from cache set to cache set for rerun
+    void moveEvalPointToCacheForRerun() override;
+
+private:
+    /// Private initialization function for internal use by constructor.
+    void init();
+
+    /// Private function for internal use by destructor.
+    void destroy();
+
+    /// Get the shard where point x is (or would be) stored.
+    /**
+     * Points that are equal for EvalPointCompare have the same truncated
+       coordinates, hence the same shard.
+     \param x       The point -- \b IN.
+     \return        The shard of x.
+     */
+    Shard& getShard(const Point& x) const;
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_CACHESHARDEDSET__
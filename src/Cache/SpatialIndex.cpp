@@ -0,0 +1,414 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   SpatialIndex.cpp
+ \brief  k-d tree over the points of a cache (implementation)
+ \see    SpatialIndex.hpp
+ */
+#include "../Cache/SpatialIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+
+std::vector<double> NOMAD::SpatialIndex::toDoubles(const NOMAD::Point& X) const
+{
+    std::vector<double> x(X.size());
+    for (size_t i = 0; i < X.size(); i++)
+    {
+        x[i] = X[i].todouble();
+    }
+    return x;
+}
+
+
+double NOMAD::SpatialIndex::squaredDist(const std::vector<double>& x, const size_t nodeIndex) const
+{
+    const double* y = _coords.data() + nodeIndex * _n;
+    double d2 = 0.0;
+    for (size_t i = 0; i < _n; i++)
+    {
+        const double diff = x[i] - y[i];
+        d2 += diff * diff;
+    }
+    return d2;
+}
+
+
+// Maximum ratio of the size of a child subtree over the size of its parent
+// subtree before the parent is considered unbalanced.
+static const double SCAPEGOAT_ALPHA = 0.7;
+
+
+void NOMAD::SpatialIndex::insert(const NOMAD::EvalPoint* evalPoint)
+{
+    const NOMAD::Point& X = *(evalPoint->getX());
+    if (_nodes.empty())
+    {
+        _n = X.size();
+    }
+    else if (X.size() != _n)
+    {
+        std::string err = "SpatialIndex: cannot insert a point of size " + std::to_string(X.size());
+        err += " in an index of dimension " + std::to_string(_n);
+        throw NOMAD::Exception(__FILE__, __LINE__, err);
+    }
+
+    const size_t newIndex = _nodes.size();
+    for (size_t i = 0; i < _n; i++)
+    {
+        _coords.push_back(X[i].todouble());
+    }
+    _nodes.push_back({evalPoint, 0, -1, -1, 1, false});
+    _nodeIndex[evalPoint] = newIndex;
+
+    if (-1 == _root)
+    {
+        _root = static_cast<int>(newIndex);
+        return;
+    }
+
+    // Descend the tree to find the parent of the new node.
+    std::vector<int> path;
+    int current = _root;
+    while (-1 != current)
+    {
+        path.push_back(current);
+        Node& node = _nodes[current];
+        node._subtreeSize++;
+        const size_t d = node._splitDim;
+        const bool goLeft = (_coords[newIndex * _n + d] < _coords[current * _n + d]);
+        int& child = goLeft ? node._left : node._right;
+        if (-1 == child)
+        {
+            child = static_cast<int>(newIndex);
+            break;
+        }
+        current = child;
+    }
+    const size_t depth = path.size();
+    _nodes[newIndex]._splitDim = (0 == _n) ? 0 : depth % _n;
+
+    // Too deep: find the scapegoat, the deepest ancestor for which a child
+    // subtree holds more than alpha of its nodes, and rebuild it balanced.
+    const double maxDepth = std::log(static_cast<double>(_nodes.size())) / std::log(1.0 / SCAPEGOAT_ALPHA);
+    if (static_cast<double>(depth) <= maxDepth + 1.0)
+    {
+        return;
+    }
+    size_t childSize = 1;
+    for (size_t i = path.size(); i > 0; i--)
+    {
+        const int ancestor = path[i - 1];
+        const size_t ancestorSize = _nodes[ancestor]._subtreeSize;
+        if (static_cast<double>(childSize) > SCAPEGOAT_ALPHA * static_cast<double>(ancestorSize))
+        {
+            const int newRoot = rebuildSubtree(ancestor, i - 1);
+            if (1 == i)
+            {
+                _root = newRoot;
+            }
+            else
+            {
+                Node& parent = _nodes[path[i - 2]];
+                if (parent._left == ancestor)
+                {
+                    parent._left = newRoot;
+                }
+                else
+                {
+                    parent._right = newRoot;
+                }
+            }
+            break;
+        }
+        childSize = ancestorSize;
+    }
+}
+
+
+void NOMAD::SpatialIndex::remove(const NOMAD::EvalPoint* evalPoint)
+{
+    auto it = _nodeIndex.find(evalPoint);
+    if (it == _nodeIndex.end())
+    {
+        return;
+    }
+    _nodes[it->second]._removed = true;
+    _nodes[it->second]._evalPoint = nullptr;
+    _nodeIndex.erase(it);
+    _nbRemoved++;
+
+    if (0 == size())
+    {
+        clear();
+    }
+    else if (_nbRemoved > size())
+    {
+        rebuild();
+    }
+}
+
+
+void NOMAD::SpatialIndex::clear()
+{
+    _nodes.clear();
+    _coords.clear();
+    _nodeIndex.clear();
+    _root = -1;
+    _nbRemoved = 0;
+}
+
+
+void NOMAD::SpatialIndex::rebuild()
+{
+    // Compact nodes and coordinates, dropping removed nodes.
+    std::vector<Node> nodes;
+    std::vector<double> coords;
+    nodes.reserve(size());
+    coords.reserve(size() * _n);
+    _nodeIndex.clear();
+    for (size_t i = 0; i < _nodes.size(); i++)
+    {
+        if (_nodes[i]._removed)
+        {
+            continue;
+        }
+        _nodeIndex[_nodes[i]._evalPoint] = nodes.size();
+        nodes.push_back({_nodes[i]._evalPoint, 0, -1, -1, 1, false});
+        coords.insert(coords.end(), _coords.begin() + i * _n, _coords.begin() + (i + 1) * _n);
+    }
+    _nodes = std::move(nodes);
+    _coords = std::move(coords);
+    _nbRemoved = 0;
+
+    std::vector<size_t> nodeIndices(_nodes.size());
+    for (size_t i = 0; i < nodeIndices.size(); i++)
+    {
+        nodeIndices[i] = i;
+    }
+    _root = buildBalanced(nodeIndices, 0, nodeIndices.size(), 0);
+}
+
+
+int NOMAD::SpatialIndex::rebuildSubtree(const int subtreeRoot, const size_t depth)
+{
+    std::vector<size_t> nodeIndices;
+    nodeIndices.reserve(_nodes[subtreeRoot]._subtreeSize);
+    std::vector<int> stack(1, subtreeRoot);
+    while (!stack.empty())
+    {
+        const int current = stack.back();
+        stack.pop_back();
+        nodeIndices.push_back(static_cast<size_t>(current));
+        if (-1 != _nodes[current]._left)
+        {
+            stack.push_back(_nodes[current]._left);
+        }
+        if (-1 != _nodes[current]._right)
+        {
+            stack.push_back(_nodes[current]._right);
+        }
+    }
+    return buildBalanced(nodeIndices, 0, nodeIndices.size(), depth);
+}
+
+
+int NOMAD::SpatialIndex::buildBalanced(std::vector<size_t>& nodeIndices,
+                                       const size_t begin,
+                                       const size_t end,
+                                       const size_t depth)
+{
+    if (begin >= end)
+    {
+        return -1;
+    }
+
+    const size_t d = (0 == _n) ? 0 : depth % _n;
+    size_t mid = begin + (end - begin) / 2;
+    std::nth_element(nodeIndices.begin() + begin,
+                     nodeIndices.begin() + mid,
+                     nodeIndices.begin() + end,
+                     [&](const size_t a, const size_t b)
+                     { return _coords[a * _n + d] < _coords[b * _n + d]; });
+
+    // insert() sends equal coordinates to the right: the median must be the
+    // first of its equal values.
+    const double splitValue = _coords[nodeIndices[mid] * _n + d];
+    auto firstEqual = std::partition(nodeIndices.begin() + begin,
+                                     nodeIndices.begin() + mid,
+                                     [&](const size_t a) { return _coords[a * _n + d] < splitValue; });
+    if (firstEqual != nodeIndices.begin() + mid)
+    {
+        std::iter_swap(firstEqual, nodeIndices.begin() + mid);
+        mid = static_cast<size_t>(firstEqual - nodeIndices.begin());
+    }
+
+    const size_t nodeIndex = nodeIndices[mid];
+    const int left  = buildBalanced(nodeIndices, begin, mid, depth + 1);
+    const int right = buildBalanced(nodeIndices, mid + 1, end, depth + 1);
+    Node& node = _nodes[nodeIndex];
+    node._splitDim = d;
+    node._left  = left;
+    node._right = right;
+    node._subtreeSize = end - begin;
+
+    return static_cast<int>(nodeIndex);
+}
+
+
+size_t NOMAD::SpatialIndex::findWithinRadius(const NOMAD::Point& X,
+                                             const double radius,
+                                             const std::function<bool(const NOMAD::EvalPoint&)>& crit,
+                                             std::vector<const NOMAD::EvalPoint*>& evalPointList) const
+{
+    evalPointList.clear();
+    if (-1 == _root || X.size() != _n || radius < 0.0)
+    {
+        return 0;
+    }
+
+    const std::vector<double> x = toDoubles(X);
+    const double radius2 = radius * radius;
+
+    std::vector<int> stack;
+    stack.push_back(_root);
+    while (!stack.empty())
+    {
+        const int current = stack.back();
+        stack.pop_back();
+        const Node& node = _nodes[current];
+
+        if (!node._removed && squaredDist(x, current) <= radius2 && crit(*node._evalPoint))
+        {
+            evalPointList.push_back(node._evalPoint);
+        }
+
+        const double diff = x[node._splitDim] - _coords[current * _n + node._splitDim];
+        if (-1 != node._left && diff <= radius)
+        {
+            stack.push_back(node._left);
+        }
+        if (-1 != node._right && -diff <= radius)
+        {
+            stack.push_back(node._right);
+        }
+    }
+
+    return evalPointList.size();
+}
+
+
+size_t NOMAD::SpatialIndex::findKNearest(const NOMAD::Point& X,
+                                         const size_t k,
+                                         const std::function<bool(const NOMAD::EvalPoint&)>& crit,
+                                         std::vector<const NOMAD::EvalPoint*>& evalPointList) const
+{
+    evalPointList.clear();
+    if (-1 == _root || X.size() != _n || 0 == k)
+    {
+        return 0;
+    }
+
+    const std::vector<double> x = toDoubles(X);
+
+    // Max-heap of the best candidates found so far: the worst one is on top.
+    typedef std::pair<double, size_t> Candidate;
+    std::priority_queue<Candidate> best;
+
+    // Stack of subtrees to visit, with a lower bound on the squared distance
+    // from x to any point of the subtree.
+    std::vector<std::pair<int, double>> stack;
+    stack.emplace_back(_root, 0.0);
+    while (!stack.empty())
+    {
+        const int current = stack.back().first;
+        const double lowerBound = stack.back().second;
+        stack.pop_back();
+        if (best.size() == k && lowerBound > best.top().first)
+        {
+            continue;
+        }
+        const Node& node = _nodes[current];
+
+        if (!node._removed)
+        {
+            const double d2 = squaredDist(x, current);
+            if ((best.size() < k || d2 < best.top().first) && crit(*node._evalPoint))
+            {
+                best.emplace(d2, static_cast<size_t>(current));
+                if (best.size() > k)
+                {
+                    best.pop();
+                }
+            }
+        }
+
+        const double diff = x[node._splitDim] - _coords[current * _n + node._splitDim];
+        const int nearChild = (diff < 0.0) ? node._left : node._right;
+        const int farChild  = (diff < 0.0) ? node._right : node._left;
+        // Far child pushed first so that the near child is visited first.
+        if (-1 != farChild)
+        {
+            stack.emplace_back(farChild, std::max(lowerBound, diff * diff));
+        }
+        if (-1 != nearChild)
+        {
+            stack.emplace_back(nearChild, lowerBound);
+        }
+    }
+
+    evalPointList.resize(best.size());
+    for (size_t i = best.size(); i > 0; i--)
+    {
+        evalPointList[i - 1] = _nodes[best.top().second]._evalPoint;
+        best.pop();
+    }
+
+    return evalPointList.size();
+}
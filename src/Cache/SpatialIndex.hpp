@@ -0,0 +1,176 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   SpatialIndex.hpp
+ * \brief  k-d tree over the points of a cache, for radius and nearest-neighbour queries.
+ * \see    SpatialIndex.cpp
+ */
+
+#ifndef __NOMAD_4_5_SPATIALINDEX__
+#define __NOMAD_4_5_SPATIALINDEX__
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "../Eval/EvalPoint.hpp"
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Spatial index over eval points stored in a cache.
+/**
+ * Dynamic k-d tree. The index does not own the eval points: it keeps
+ * pointers to elements of a node-based container (the cache set) and a
+ * contiguous copy of their coordinates. The owner is responsible for
+ * calling insert() / remove() when the container changes, and for
+ * thread safety (the index is not locked).
+ *
+ * Insertion descends the tree. When a node gets too deep, the smallest
+ * unbalanced subtree containing it is rebuilt (scapegoat strategy), so the
+ * depth stays O(log N) even when points are inserted in sorted order, which
+ * is common for line searches and polls around an incumbent. Removal marks
+ * the node as removed; the whole tree is compacted and rebuilt when more
+ * than half of the nodes are marked removed.
+ *
+ * Distances are Euclidean, consistent with Point::dist().
+ */
+class DLL_EVAL_API SpatialIndex
+{
+private:
+
+    /// Node of the k-d tree
+    struct Node
+    {
+        const EvalPoint* _evalPoint;    ///< Eval point in the cache (not owned)
+        size_t           _splitDim;     ///< Coordinate used to split at this node
+        int              _left;         ///< Index of left child (-1 if none)
+        int              _right;        ///< Index of right child (-1 if none)
+        size_t           _subtreeSize;  ///< Number of nodes in the subtree, removed nodes included
+        bool             _removed;      ///< Node kept for tree structure only
+    };
+
+    size_t              _n;         ///< Dimension of the points
+    std::vector<Node>   _nodes;     ///< Nodes of the tree
+    std::vector<double> _coords;    ///< Coordinates of the nodes, _n values per node
+    int                 _root;      ///< Index of the root node (-1 if empty)
+    size_t              _nbRemoved; ///< Number of nodes marked removed
+
+    /// Node index of each eval point, used for removal
+    std::unordered_map<const EvalPoint*, size_t> _nodeIndex;
+
+public:
+    /// Constructor
+    explicit SpatialIndex()
+      : _n(0),
+        _root(-1),
+        _nbRemoved(0)
+    {}
+
+    /// Number of eval points in the index.
+    size_t size() const { return _nodes.size() - _nbRemoved; }
+
+    /// Insert an eval point. The point must be complete.
+    void insert(const EvalPoint* evalPoint);
+
+    /// Remove an eval point. Do nothing if the eval point is not in the index.
+    void remove(const EvalPoint* evalPoint);
+
+    /// Remove all eval points.
+    void clear();
+
+    /// Find all eval points at a distance lower than or equal to radius of X and verifying crit.
+    /**
+     \param X               The point of reference                          -- \b IN.
+     \param radius          The radius of the ball centered on X            -- \b IN.
+     \param crit            The criteria function                           -- \b IN.
+     \param evalPointList   The eval points found, in no particular order   -- \b OUT.
+     \return                The number of eval points found.
+     */
+    size_t findWithinRadius(const Point& X,
+                            const double radius,
+                            const std::function<bool(const EvalPoint&)>& crit,
+                            std::vector<const EvalPoint*>& evalPointList) const;
+
+    /// Find the k eval points closest to X that verify crit.
+    /**
+     \param X               The point of reference                          -- \b IN.
+     \param k               The maximum number of eval points to find       -- \b IN.
+     \param crit            The criteria function                           -- \b IN.
+     \param evalPointList   The eval points found, by increasing distance   -- \b OUT.
+     \return                The number of eval points found.
+     */
+    size_t findKNearest(const Point& X,
+                        const size_t k,
+                        const std::function<bool(const EvalPoint&)>& crit,
+                        std::vector<const EvalPoint*>& evalPointList) const;
+
+private:
+
+    /// Squared Euclidean distance between X and the point of a node.
+    double squaredDist(const std::vector<double>& x, const size_t nodeIndex) const;
+
+    /// Compact the nodes not marked removed and rebuild a balanced tree.
+    void rebuild();
+
+    /// Rebuild the subtree rooted at a node, balanced. Return the new subtree root.
+    int rebuildSubtree(const int subtreeRoot, const size_t depth);
+
+    /// Build a balanced subtree on nodeIndices[begin, end). Return the subtree root.
+    int buildBalanced(std::vector<size_t>& nodeIndices,
+                      const size_t begin,
+                      const size_t end,
+                      const size_t depth);
+
+    /// Convert a point into a vector of double.
+    std::vector<double> toDoubles(const Point& X) const;
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_SPATIALINDEX__
@@ -0,0 +1,279 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   BBExeServer.cpp
+ \brief  Blackbox executable kept running to evaluate blocks of points
+ \see    BBExeServer.hpp
+ */
+
+#include "../Eval/BBExeServer.hpp"
+#include "../Util/Exception.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+namespace {
+    // Executables are started one at a time: A socket must not be
+    // inherited by an executable started at the same time.
+    std::mutex startMutex;
+
+    // Time given to an executable to stop after its standard input is closed.
+    const std::chrono::milliseconds stopDelay(1000);
+}
+#endif
+
+
+NOMAD::BBExeServer::BBExeServer(const std::string& cmd)
+  : _cmd(cmd),
+    _pid(-1),
+    _fd(-1),
+    _buffer()
+{
+}
+
+
+NOMAD::BBExeServer::~BBExeServer()
+{
+    stop();
+}
+
+
+bool NOMAD::BBExeServer::evalBlock(const std::vector<std::string>& inputs,
+                                   std::vector<std::string>& outputs)
+{
+    outputs.clear();
+
+    if (!isRunning() && !start())
+    {
+        return false;
+    }
+
+    std::string data;
+    for (const auto& input : inputs)
+    {
+        data += input + "\n";
+    }
+    // An empty line ends the block.
+    data += "\n";
+
+    bool ok = sendAll(data);
+    while (ok && outputs.size() < inputs.size())
+    {
+        std::string line;
+        ok = readLine(line);
+        if (ok)
+        {
+            outputs.push_back(line);
+        }
+    }
+
+    if (!ok)
+    {
+        stop();
+    }
+
+    return ok;
+}
+
+
+#ifndef _WIN32
+bool NOMAD::BBExeServer::start()
+{
+    std::lock_guard<std::mutex> lock(startMutex);
+
+    int sv[2];
+    if (0 != socketpair(AF_UNIX, SOCK_STREAM, 0, sv))
+    {
+        return false;
+    }
+    // Only the executable started here may keep its end of the socket.
+    fcntl(sv[0], F_SETFD, FD_CLOEXEC);
+    fcntl(sv[1], F_SETFD, FD_CLOEXEC);
+
+    // Prepare everything before fork(): Only async-signal-safe calls in the child.
+    const char* cmd = _cmd.c_str();
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(sv[0]);
+        close(sv[1]);
+        return false;
+    }
+    if (0 == pid)
+    {
+        // Child: The socket becomes the standard input and output. dup2 clears FD_CLOEXEC.
+        dup2(sv[1], STDIN_FILENO);
+        dup2(sv[1], STDOUT_FILENO);
+        execl("/bin/sh", "sh", "-c", cmd, (char*)nullptr);
+        _exit(127);
+    }
+
+    close(sv[1]);
+    _pid = pid;
+    _fd = sv[0];
+    _buffer.clear();
+
+    return true;
+}
+
+
+void NOMAD::BBExeServer::stop()
+{
+    if (!isRunning())
+    {
+        return;
+    }
+
+    // End of input: The executable should stop.
+    shutdown(_fd, SHUT_WR);
+    close(_fd);
+    _fd = -1;
+
+    auto stopTime = std::chrono::steady_clock::now() + stopDelay;
+    while (0 == waitpid(_pid, nullptr, WNOHANG))
+    {
+        if (std::chrono::steady_clock::now() > stopTime)
+        {
+            kill(_pid, SIGKILL);
+            waitpid(_pid, nullptr, 0);
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    _pid = -1;
+    _buffer.clear();
+}
+
+
+bool NOMAD::BBExeServer::sendAll(const std::string& data)
+{
+    size_t nbSent = 0;
+    while (nbSent < data.size())
+    {
+#ifdef MSG_NOSIGNAL
+        ssize_t n = send(_fd, data.data() + nbSent, data.size() - nbSent, MSG_NOSIGNAL);
+#else
+        ssize_t n = send(_fd, data.data() + nbSent, data.size() - nbSent, 0);
+#endif
+        if (n < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        nbSent += static_cast<size_t>(n);
+    }
+
+    return true;
+}
+
+
+bool NOMAD::BBExeServer::readLine(std::string& line)
+{
+    size_t pos = _buffer.find('\n');
+    while (std::string::npos == pos)
+    {
+        char chunk[4096];
+        ssize_t n = recv(_fd, chunk, sizeof(chunk), 0);
+        if (n < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            // The executable stopped.
+            return false;
+        }
+        _buffer.append(chunk, static_cast<size_t>(n));
+        pos = _buffer.find('\n');
+    }
+
+    line = _buffer.substr(0, pos);
+    _buffer.erase(0, pos + 1);
+
+    return true;
+}
+
+#else // _WIN32
+
+bool NOMAD::BBExeServer::start()
+{
+    throw NOMAD::Exception(__FILE__, __LINE__, "BBExeServer: Blackbox server is not available on Windows.");
+}
+
+
+void NOMAD::BBExeServer::stop()
+{
+}
+
+
+bool NOMAD::BBExeServer::sendAll(const std::string& NOMAD_UNUSED(data))
+{
+    return false;
+}
+
+
+bool NOMAD::BBExeServer::readLine(std::string& NOMAD_UNUSED(line))
+{
+    return false;
+}
+
+#endif // _WIN32
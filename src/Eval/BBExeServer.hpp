@@ -0,0 +1,131 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   BBExeServer.hpp
+ \brief  Blackbox executable kept running to evaluate blocks of points
+ \see    BBExeServer.cpp
+ */
+
+#ifndef __NOMAD_4_5_BBEXESERVER__
+#define __NOMAD_4_5_BBEXESERVER__
+
+#include <string>
+#include <vector>
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Blackbox executable kept running between evaluations (parameter BB_EXE_SERVER).
+/**
+ * The executable is started once, without input file name. It is
+ * connected to NOMAD by its standard input and standard output.
+ *
+ * For each block, NOMAD writes the points to evaluate on the standard input
+ * of the executable, one point per line, followed by an empty line. The
+ * executable must answer on its standard output with one line of outputs per
+ * point, in the same order and the same format as in batch mode.
+ *
+ * The executable is stopped by closing its standard input. If the
+ * executable stops during a block, it is started again for the next block.
+ *
+ * \note Only available on POSIX systems.
+ */
+class BBExeServer
+{
+private:
+    const std::string   _cmd;       ///< Command to start the executable
+    int                 _pid;       ///< Process id of the executable, -1 if not running
+    int                 _fd;        ///< Socket connected to the standard input and output of the executable
+    std::string         _buffer;    ///< Outputs received but not yet read
+
+public:
+    /// Constructor. The executable is not started.
+    /**
+     \param cmd     The command to start the executable, as given by BB_EXE -- \b IN.
+     */
+    explicit BBExeServer(const std::string& cmd);
+
+    /// Destructor. Stop the executable.
+    virtual ~BBExeServer();
+
+    /// Copy constructor not available
+    BBExeServer(const BBExeServer&) = delete;
+
+    /// Operator= not available
+    BBExeServer& operator=(const BBExeServer&) = delete;
+
+    bool isRunning() const { return (_pid > 0); }
+
+    /// Evaluate a block. Start the executable if needed.
+    /**
+     \param inputs      The points to evaluate, one line each                  -- \b IN.
+     \param outputs     The outputs of the executable, one line per point      -- \b OUT.
+     \return            \c true if all outputs were received. Otherwise,
+                        the executable is stopped and outputs holds the
+                        outputs received before the failure.
+     */
+    bool evalBlock(const std::vector<std::string>& inputs,
+                   std::vector<std::string>& outputs);
+
+    /// Stop the executable, if it is running.
+    void stop();
+
+private:
+    /// Start the executable. Return \c false if it could not be started.
+    bool start();
+
+    /// Helper for evalBlock(): Send all the data. Return \c false on failure.
+    bool sendAll(const std::string& data);
+
+    /// Helper for evalBlock(): Read one line, without its end-of-line. Return \c false on failure.
+    bool readLine(std::string& line);
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_BBEXESERVER__
@@ -157,13 +157,10 @@ NOMAD::Double NOMAD::BBOutput::getObjective(const NOMAD::BBOutputTypeList &bbOut
 
     if (_evalOk && !bbOutputType.empty() && checkSizeMatch(bbOutputType))
     {
-        for (size_t i = 0; i < _BBO.size(); i++)
+        const auto& objIndices = NOMAD::getBBOutputTypeIndices(bbOutputType).objIndices;
+        if (!objIndices.empty())
         {
-            if (bbOutputType[i].isObjective())
-            {
-                obj = _BBO[i];
-                break;
-            }
+            obj = _BBO[objIndices[0]];
         }
     }
     return obj;
@@ -175,14 +172,11 @@ NOMAD::ArrayOfDouble NOMAD::BBOutput::getObjectives(const NOMAD::BBOutputTypeLis
 
     if (_evalOk && !bbOutputType.empty() && checkSizeMatch(bbOutputType))
     {
-        for (size_t i = 0; i < _BBO.size(); i++)
+        const auto& objIndices = NOMAD::getBBOutputTypeIndices(bbOutputType).objIndices;
+        objectives.reset(objIndices.size());
+        for (size_t k = 0; k < objIndices.size(); k++)
         {
-            if (bbOutputType[i].isObjective())
-            {
-                size_t objSize = objectives.size();
-                objectives.resize(objSize + 1);
-                objectives[objSize] = _BBO[i];
-            }
+            objectives[k] = _BBO[objIndices[k]];
         }
     }
 
@@ -196,14 +190,11 @@ NOMAD::ArrayOfDouble NOMAD::BBOutput::getConstraints(const NOMAD::BBOutputTypeLi
 
     if (_evalOk && !bbOutputType.empty() && checkSizeMatch(bbOutputType))
     {
-        for (size_t i = 0; i < _BBO.size(); i++)
+        const auto& constraintIndices = NOMAD::getBBOutputTypeIndices(bbOutputType).constraintIndices;
+        constraints.reset(constraintIndices.size());
+        for (size_t k = 0; k < constraintIndices.size(); k++)
         {
-            if ( bbOutputType[i].isConstraint())
-            {
-                size_t constrSize = constraints.size();
-                constraints.resize(constrSize + 1);
-                constraints[constrSize] = _BBO[i];
-            }
+            constraints[k] = _BBO[constraintIndices[k]];
         }
     }
 
@@ -235,6 +235,20 @@ public:
      * \return A string describing the barrier
      */
     virtual std::vector<std::string> display(const size_t max = INF_SIZE_T) const =0;
+
+    /// Hypervolume of the feasible points (multi-objective barriers).
+    /**
+     * Used for stats display (HYPERVOLUME).
+     \return The hypervolume, or an undefined value if the barrier does not compute it.
+     */
+    virtual Double getHypervolume() const { return Double(); }
+
+    /// Spacing of the feasible points (multi-objective barriers).
+    /**
+     * Used for stats display (SPACING).
+     \return The spacing, or an undefined value if the barrier does not compute it.
+     */
+    virtual Double getSpacing() const { return Double(); }
     
     
     bool findPoint(const Point & point, EvalPoint & foundEvalPoint) const;
@@ -56,6 +56,17 @@
 #include "../Eval/Eval.hpp"
 #include "../Type/EvalType.hpp"
 
+// States of the memoized f and h values
+static const unsigned char FH_MEMO_EMPTY     = 0;
+static const unsigned char FH_MEMO_BUSY      = 1;   // Being written by a thread
+static const unsigned char FH_MEMO_DEFINED   = 2;
+static const unsigned char FH_MEMO_UNDEFINED = 3;
+
+// Slots of the memoized f and h values
+static const size_t FH_MEMO_F_STANDARD  = 0;
+static const size_t FH_MEMO_H_STANDARD  = 1;    // + (size_t)HNormType
+static const size_t FH_MEMO_F_PHASE_ONE = 4;    // + (size_t)HNormType
+
 
 /*---------------------------------------------------------------------*/
 /*                            Constructor 1                            */
@@ -69,6 +80,7 @@ NOMAD::Eval::Eval()
     _bbOutputComplete(false)
 {
     _moInfo = std::make_unique<MOInfo>();
+    clearFHMemo();
 }
 
 
@@ -94,6 +106,7 @@ NOMAD::Eval::Eval(const std::shared_ptr<NOMAD::EvalParameters>& params,
         _evalStatus = NOMAD::EvalStatusType::EVAL_FAILED;
     }
     _moInfo = std::make_unique<MOInfo>();
+    clearFHMemo();
 }
 
 
@@ -108,6 +121,7 @@ NOMAD::Eval::Eval(const NOMAD::Eval &eval)
     _bbOutputComplete(eval._bbOutputComplete)
 {
     _moInfo = std::make_unique<NOMAD::MOInfo>(*eval._moInfo);
+    copyFHMemo(eval);
 }
 
 /*-----------------------------------------------------------*/
@@ -126,6 +140,7 @@ NOMAD::Eval& NOMAD::Eval::operator=(const NOMAD::Eval& eval)
 
     // Deep copy
     _moInfo = std::make_unique<NOMAD::MOInfo>(*eval._moInfo);
+    copyFHMemo(eval);
 
     return *this;
 }
@@ -178,7 +193,7 @@ bool NOMAD::Eval::goodForCacheFile() const
 
 
 /*------------------------------------*/
-/*      Get f. Always recomputed.     */
+/*                Get f               */
 /*------------------------------------*/
 NOMAD::Double NOMAD::Eval::getF(const NOMAD::FHComputeTypeS& fhComputeType) const
 {
@@ -191,7 +206,11 @@ NOMAD::Double NOMAD::Eval::getF(const NOMAD::FHComputeTypeS& fhComputeType) cons
     switch (fhComputeType.computeType)
     {
         case NOMAD::ComputeType::STANDARD:
-            f = _bbOutput.getObjective(_bbOutputTypeList);
+            if (!getFHMemo(FH_MEMO_F_STANDARD, f))
+            {
+                f = _bbOutput.getObjective(_bbOutputTypeList);
+                setFHMemo(FH_MEMO_F_STANDARD, f);
+            }
             break;
         case NOMAD::ComputeType::DMULTI_COMBINE_F:
             if (_moInfo->fvalues.isEmpty())
@@ -205,7 +224,11 @@ NOMAD::Double NOMAD::Eval::getF(const NOMAD::FHComputeTypeS& fhComputeType) cons
             f = _moInfo->combineFValue;
             break;
         case NOMAD::ComputeType::PHASE_ONE:
-            f = computeFPhaseOne(fhComputeType.hNormType);
+            if (!getFHMemo(FH_MEMO_F_PHASE_ONE + (size_t)fhComputeType.hNormType, f))
+            {
+                f = computeFPhaseOne(fhComputeType.hNormType);
+                setFHMemo(FH_MEMO_F_PHASE_ONE + (size_t)fhComputeType.hNormType, f);
+            }
             break;
         case NOMAD::ComputeType::USER:
             f = fhComputeType.singleObjectiveCompute(_bbOutputTypeList, _bbOutput);
@@ -265,7 +288,7 @@ const NOMAD::ArrayOfDouble& NOMAD::Eval::getFs(const NOMAD::FHComputeTypeS& fhCo
 
 
 /*-------------------------------------*/
-/*      Get h. Always recomputed.      */
+/*                Get h                */
 /*-------------------------------------*/
 NOMAD::Double NOMAD::Eval::getH(const NOMAD::FHComputeTypeS& fhComputeType) const
 {
@@ -279,7 +302,11 @@ NOMAD::Double NOMAD::Eval::getH(const NOMAD::FHComputeTypeS& fhComputeType) cons
     {
         case NOMAD::ComputeType::STANDARD:
         case NOMAD::ComputeType::DMULTI_COMBINE_F:
-            h = computeHStandard(fhComputeType.hNormType);
+            if (!getFHMemo(FH_MEMO_H_STANDARD + (size_t)fhComputeType.hNormType, h))
+            {
+                h = computeHStandard(fhComputeType.hNormType);
+                setFHMemo(FH_MEMO_H_STANDARD + (size_t)fhComputeType.hNormType, h);
+            }
             break;
         case NOMAD::ComputeType::PHASE_ONE:
             h = 0.0;
@@ -297,60 +324,51 @@ NOMAD::Double NOMAD::Eval::getH(const NOMAD::FHComputeTypeS& fhComputeType) cons
 
 NOMAD::Double NOMAD::Eval::computeHStandard(NOMAD::HNormType hNormType) const
 {
-    NOMAD::Double h = 0.0;
+    // Only the constraints are visited, and h is accumulated on plain
+    // doubles. The comparisons with epsilon are those of Double, so the
+    // value is the same as with Double operations.
+    const double eps = NOMAD::Double::getEpsilon();
+    const NOMAD::ArrayOfDouble& bboArray = _bbOutput.getBBOAsArrayOfDouble();
+    const auto& constraintIndices = NOMAD::getBBOutputTypeIndices(_bbOutputTypeList).constraintIndices;
+
+    double h = 0.0;
     bool hPos = false;
-
-    const NOMAD::ArrayOfDouble bboArray = _bbOutput.getBBOAsArrayOfDouble();
-    size_t bboIndex = 0;
-    for (const auto & bbOutputType : _bbOutputTypeList)
+    for (const size_t i : constraintIndices)
     {
-        const NOMAD::Double& bboI = bboArray[bboIndex];
-        bboIndex++;
-        if (!bbOutputType.isConstraint())
+        const NOMAD::Double& bboI = bboArray[i];
+        if (!bboI.isDefined())
         {
-            continue;
+            return NOMAD::Double();    // h is undefined
         }
-        else if (!bboI.isDefined())
-        {
-            h = NOMAD::Double();    // h is undefined
-            break;
-        }
-        else if (bboI > 0.0)
+
+        const double c = bboI.todouble();
+        if (c > eps)    // bboI > 0.0
         {
             hPos = true;
-            NOMAD::Double hTemp = 0.0;
-            if (bbOutputType == NOMAD::BBOutputType::Type::EB)
+            if (_bbOutputTypeList[i] == NOMAD::BBOutputType::Type::EB)
             {
-                hTemp = NOMAD::INF;
+                // Violated Extreme Barrier constraint
+                return NOMAD::INF;
             }
-            else if (bbOutputType == NOMAD::BBOutputType::Type::PB || bbOutputType == NOMAD::BBOutputType::Type::RPB )
-            {
-                switch (hNormType)
-                {
-                    case NOMAD::HNormType::L2:
-                        hTemp = bboI * bboI;
-                        break;
-                    case NOMAD::HNormType::L1:
-                        hTemp = bboI;
-                        break;
-                    case NOMAD::HNormType::Linf:
-                        if ( bboI > h )
-                            h = bboI;
-                        break;
-                    default:
-                        break;
-                }
 
-            }
-
-            // Violated Extreme Barrier constraint:
-            // Set h to infinity and break.
-            if (NOMAD::INF == hTemp)
+            // PB or RPB constraint
+            switch (hNormType)
             {
-                h = NOMAD::INF;
-                break;
+                case NOMAD::HNormType::L2:
+                    h += c * c;
+                    break;
+                case NOMAD::HNormType::L1:
+                    h += c;
+                    break;
+                case NOMAD::HNormType::Linf:
+                    if (c > h + eps)    // bboI > h
+                    {
+                        h = c;
+                    }
+                    break;
+                default:
+                    break;
             }
-            h += hTemp;
         }
     }
 
@@ -358,9 +376,9 @@ NOMAD::Double NOMAD::Eval::computeHStandard(NOMAD::HNormType hNormType) const
     // to at least epsilon so that the Eval is recognized as infeasible.
     // Catch cases such as constraint violated by 1e-8, which gives h = 1e-16
     // which is considered as 0.
-    if (hPos && h.isDefined() && (0 == h))
+    if (hPos && fabs(h) < eps)    // 0 == h
     {
-        h = NOMAD::Double::getEpsilon();
+        h = eps;
     }
 
     return h;
@@ -370,18 +388,17 @@ NOMAD::Double NOMAD::Eval::computeHStandard(NOMAD::HNormType hNormType) const
 NOMAD::Double NOMAD::Eval::computeFPhaseOne( NOMAD::HNormType hNormType) const
 {
     NOMAD::Double f ;
-    const NOMAD::ArrayOfDouble bboArray = _bbOutput.getBBOAsArrayOfDouble();
+    const NOMAD::ArrayOfDouble& bboArray = _bbOutput.getBBOAsArrayOfDouble();
+    const auto& constraintIndices = NOMAD::getBBOutputTypeIndices(_bbOutputTypeList).constraintIndices;
     bool fPos = false;
 
     if (NOMAD::EvalStatusType::EVAL_OK == _evalStatus)
     {
         f=0.0;
-        size_t bboIndex = 0;
-        for (const auto & bbOutputType : _bbOutputTypeList)
+        for (const size_t i : constraintIndices)
         {
-            const NOMAD::Double& bboI = bboArray[bboIndex];
-            bboIndex++;
-            if (bbOutputType != NOMAD::BBOutputType::Type::EB)
+            const NOMAD::Double& bboI = bboArray[i];
+            if (_bbOutputTypeList[i] != NOMAD::BBOutputType::Type::EB)
             {
                 continue;
             }
@@ -436,6 +453,7 @@ void NOMAD::Eval::setBBO(const std::string &bbo,
     _bbOutput = NOMAD::BBOutput(bbo, evalOk);
     _bbOutputTypeList = bbOutputTypeList;
     _moInfo = std::make_unique<NOMAD::MOInfo>();
+    clearFHMemo();
 
     // Revealed constraint are not set by evaluator. They are updated later by a callback.
     // Need to set a default value to pass the following tests.
@@ -476,9 +494,77 @@ void NOMAD::Eval::updateForRevealedConstraints()
         // Update RPB constraint with a feasible default value.
         _bbOutput = NOMAD::BBOutput(_bbOutput.getBBO()+" -1.0", _bbOutput.getEvalOk());
         _bbOutputComplete = _bbOutput.isComplete(_bbOutputTypeList);
+        clearFHMemo();
+    }
+
+
+}
+
+
+/*---------------------------------------*/
+/*        Memoized f and h values        */
+/*---------------------------------------*/
+bool NOMAD::Eval::getFHMemo(size_t slot, NOMAD::Double& value) const
+{
+    const unsigned char state = _fhMemoState[slot].load(std::memory_order_acquire);
+    if (FH_MEMO_DEFINED == state)
+    {
+        value = _fhMemoValue[slot];
+        return true;
+    }
+    if (FH_MEMO_UNDEFINED == state)
+    {
+        value = NOMAD::Double();
+        return true;
     }
 
+    return false;
+}
+
 
+void NOMAD::Eval::setFHMemo(size_t slot, const NOMAD::Double& value) const
+{
+    // Only the thread that takes the slot writes the value. The other ones
+    // keep the value they computed.
+    unsigned char expected = FH_MEMO_EMPTY;
+    if (_fhMemoState[slot].compare_exchange_strong(expected, FH_MEMO_BUSY, std::memory_order_acquire))
+    {
+        if (value.isDefined())
+        {
+            _fhMemoValue[slot] = value.todouble();
+            _fhMemoState[slot].store(FH_MEMO_DEFINED, std::memory_order_release);
+        }
+        else
+        {
+            _fhMemoState[slot].store(FH_MEMO_UNDEFINED, std::memory_order_release);
+        }
+    }
+}
+
+
+void NOMAD::Eval::clearFHMemo()
+{
+    for (size_t slot = 0; slot < NB_FH_MEMO; slot++)
+    {
+        _fhMemoState[slot].store(FH_MEMO_EMPTY, std::memory_order_relaxed);
+        _fhMemoValue[slot] = 0.0;
+    }
+}
+
+
+void NOMAD::Eval::copyFHMemo(const NOMAD::Eval& eval)
+{
+    for (size_t slot = 0; slot < NB_FH_MEMO; slot++)
+    {
+        unsigned char state = eval._fhMemoState[slot].load(std::memory_order_acquire);
+        if (FH_MEMO_BUSY == state)
+        {
+            // Not ready. It will be computed again if needed.
+            state = FH_MEMO_EMPTY;
+        }
+        _fhMemoValue[slot] = eval._fhMemoValue[slot];
+        _fhMemoState[slot].store(state, std::memory_order_relaxed);
+    }
 }
 
 
@@ -55,12 +55,14 @@
 #ifndef __NOMAD_4_5_EVAL__
 #define __NOMAD_4_5_EVAL__
 
+#include <atomic>
 #include <functional>   // For std::function
 
 #include "../Eval/BBOutput.hpp"
 #include "../Param/EvalParameters.hpp"
 #include "../Type/ComputeType.hpp"
 #include "../Type/CompareType.hpp"
+#include "../Util/MemoryPool.hpp"
 
 #include "../nomad_nsbegin.hpp"
 
@@ -98,6 +100,10 @@ struct MOInfo
     ArrayOfDouble fvalues;
     ArrayOfDouble intermediateVal;
     Double combineFValue;
+
+    /// One MOInfo is created with each Eval. Reuse their memory.
+    static void* operator new(size_t size) { return MemoryPool::allocate(size); }
+    static void operator delete(void* p, size_t size) { MemoryPool::deallocate(p, size); }
 };
 
 
@@ -114,6 +120,21 @@ private:
     BBOutputTypeList _bbOutputTypeList; ///< List of output types: OBJ, PB, EB etc.
     bool _bbOutputComplete;             ///< All bbo outputs have a valid value for functions (OBJ, PB and EB).
     std::unique_ptr<MOInfo> _moInfo; ///< Multiobjective information; precomputed to have more performance
+
+    /// Memoized f and h values, for the compute types that depend only on the blackbox outputs.
+    /**
+     * Slot 0: f STANDARD. Slots 1 to 3: h STANDARD, for each HNormType.
+       Slots 4 to 6: f PHASE_ONE, for each HNormType.
+     * The barriers, the success computations and the queue comparators ask
+       for f and h of the same Eval many times. They are computed once,
+       and cleared when the blackbox outputs or their types change.
+     * The state of a slot is atomic, so that an Eval of the cache can be
+       read by many threads: the value is written by the single thread that
+       takes the slot, and read only once the slot is marked computed.
+     */
+    static const size_t NB_FH_MEMO = 7;
+    mutable std::atomic<unsigned char> _fhMemoState[NB_FH_MEMO]; ///< FH_MEMO_EMPTY, FH_MEMO_BUSY, FH_MEMO_DEFINED or FH_MEMO_UNDEFINED
+    mutable double _fhMemoValue[NB_FH_MEMO];                      ///< Values, valid when the state is FH_MEMO_DEFINED
     
 public:
 
@@ -149,11 +170,16 @@ public:
     // Needed to avoid valgrind memory leak warnings.
     virtual ~Eval() {}
 
+    /// Evals are created and destroyed with the trial points. Reuse their memory.
+    static void* operator new(size_t size) { return MemoryPool::allocate(size); }
+    static void operator delete(void* p, size_t size) { MemoryPool::deallocate(p, size); }
+
     /*---------*/
     /* Get/Set */
     /*---------*/
 
-    // f and h are always recomputed.
+    // f and h are computed once for the STANDARD, DMULTI_COMBINE_F and
+    // PHASE_ONE compute types, and always recomputed for the USER compute type.
     Double getF(const NOMAD::FHComputeTypeS& fhComputeType) const;
     const ArrayOfDouble& getFs(const NOMAD::FHComputeTypeS& fhComputeType) const;
     Double getH(const NOMAD::FHComputeTypeS& fhComputeType) const;
@@ -172,6 +198,7 @@ public:
     {
         _bbOutputTypeList = bbOutputTypeList;
         _bbOutputComplete = _bbOutput.isComplete(bbOutputTypeList);
+        clearFHMemo();
     }
 
     std::string getBBO() const { return _bbOutput.getBBO(); }
@@ -322,6 +349,12 @@ private:
     /// Helpers for getF() and getH()
     Double computeHStandard( NOMAD::HNormType hNormType) const;
     Double computeFPhaseOne( NOMAD::HNormType hNormType) const;
+
+    /// Helpers for the memoized f and h values
+    bool getFHMemo(size_t slot, Double& value) const;
+    void setFHMemo(size_t slot, const Double& value) const;
+    void clearFHMemo();
+    void copyFHMemo(const Eval& eval);
     
 
     
@@ -648,7 +648,7 @@ std::shared_ptr<NOMAD::EvalPoint> NOMAD::EvalPoint::getPointFrom(const NOMAD::Po
     auto pointFrom = _pointFrom;
     if (nullptr != pointFrom)
     {
-        pointFrom = std::make_shared<NOMAD::EvalPoint>(pointFrom->projectPointToSubspace(fixedVariable));
+        pointFrom = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(pointFrom->projectPointToSubspace(fixedVariable));
     }
 
     return pointFrom;
@@ -661,7 +661,7 @@ void NOMAD::EvalPoint::setPointFrom(const std::shared_ptr<NOMAD::EvalPoint>& poi
     if (pointFromFull->size() < fixedVariable.size())
     {
         // pointFrom must always be in full dimension. Convert if needed.
-        pointFromFull = std::make_shared<NOMAD::EvalPoint>(pointFromFull->makeFullSpacePointFromFixed(fixedVariable));
+        pointFromFull = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(pointFromFull->makeFullSpacePointFromFixed(fixedVariable));
     }
 
     _pointFrom = pointFromFull;
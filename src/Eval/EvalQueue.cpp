@@ -0,0 +1,200 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include "../Eval/EvalQueue.hpp"
+#include "../Util/MicroSleep.hpp"
+#include "../Util/Profiler.hpp"
+
+
+NOMAD::EvalQueue::EvalQueue()
+  : _points(),
+    _blocks(nullptr),
+    _blockIndices(),
+    _nbBlocksAvailable(0),
+    _nbStolenRunning(0)
+{
+#ifdef _OPENMP
+    omp_init_lock(&_pointsLock);
+    omp_init_lock(&_blocksLock);
+#endif // _OPENMP
+}
+
+
+NOMAD::EvalQueue::~EvalQueue()
+{
+#ifdef _OPENMP
+    omp_destroy_lock(&_blocksLock);
+    omp_destroy_lock(&_pointsLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::EvalQueue::lockPoints() const
+{
+#ifdef _OPENMP
+    NOMAD_PROFILE_SCOPE("EvalQueue::lockPoints");
+    omp_set_lock(&_pointsLock);
+#endif // _OPENMP
+}
+
+
+void NOMAD::EvalQueue::unlockPoints() const
+{
+#ifdef _OPENMP
+    omp_unset_lock(&_pointsLock);
+#endif // _OPENMP
+}
+
+
+bool NOMAD::EvalQueue::testLockPoints() const
+{
+#ifdef _OPENMP
+    return (0 != omp_test_lock(&_pointsLock));
+#else
+    return false;
+#endif // _OPENMP
+}
+
+
+void NOMAD::EvalQueue::openBlocks(std::vector<NOMAD::BlockForEval>& blocks)
+{
+#ifdef _OPENMP
+    omp_set_lock(&_blocksLock);
+#endif // _OPENMP
+    _blocks = &blocks;
+    _blockIndices.clear();
+    for (size_t k = 0; k < blocks.size(); k++)
+    {
+        _blockIndices.push_back(k);
+    }
+    _nbBlocksAvailable = _blockIndices.size();
+#ifdef _OPENMP
+    omp_unset_lock(&_blocksLock);
+#endif // _OPENMP
+}
+
+
+bool NOMAD::EvalQueue::popFrontBlock(size_t& k)
+{
+    bool success = false;
+#ifdef _OPENMP
+    {
+        NOMAD_PROFILE_SCOPE("EvalQueue::lockBlocks");
+        omp_set_lock(&_blocksLock);
+    }
+#endif // _OPENMP
+    if (!_blockIndices.empty())
+    {
+        k = _blockIndices.front();
+        _blockIndices.pop_front();
+        _nbBlocksAvailable = _blockIndices.size();
+        success = true;
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&_blocksLock);
+#endif // _OPENMP
+
+    return success;
+}
+
+
+NOMAD::BlockForEval* NOMAD::EvalQueue::stealBackBlock()
+{
+    NOMAD::BlockForEval* block = nullptr;
+
+    // Lock-free early out: most of the time, there is nothing to steal.
+    if (!hasBlocksToSteal())
+    {
+        return block;
+    }
+
+#ifdef _OPENMP
+    {
+        NOMAD_PROFILE_SCOPE("EvalQueue::lockBlocks");
+        omp_set_lock(&_blocksLock);
+    }
+#endif // _OPENMP
+    if (nullptr != _blocks && !_blockIndices.empty())
+    {
+        block = &(*_blocks)[_blockIndices.back()];
+        _blockIndices.pop_back();
+        _nbBlocksAvailable = _blockIndices.size();
+        // Incremented under the lock, so that closeBlocks() cannot miss it.
+        _nbStolenRunning++;
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&_blocksLock);
+#endif // _OPENMP
+
+    return block;
+}
+
+
+void NOMAD::EvalQueue::releaseStolenBlock()
+{
+    _nbStolenRunning--;
+}
+
+
+void NOMAD::EvalQueue::closeBlocks()
+{
+#ifdef _OPENMP
+    omp_set_lock(&_blocksLock);
+#endif // _OPENMP
+    _blocks = nullptr;
+    _blockIndices.clear();
+    _nbBlocksAvailable = 0;
+#ifdef _OPENMP
+    omp_unset_lock(&_blocksLock);
+#endif // _OPENMP
+
+    // The blocks belong to the main thread. Wait for the thieves to be done with them.
+    while (_nbStolenRunning > 0)
+    {
+        usleep(10);
+    }
+}
@@ -0,0 +1,159 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   EvalQueue.hpp
+ \brief  Evaluation queue of a main thread, with a deque of blocks that can be stolen.
+ \see    EvalQueue.cpp
+ */
+
+#ifndef __NOMAD_4_5_EVALQUEUE__
+#define __NOMAD_4_5_EVALQUEUE__
+
+#include "../Eval/EvalQueuePoint.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif  // _OPENMP
+#include <atomic>
+#include <deque>
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// \brief Evaluation queue of a single main thread.
+/**
+ * Each main thread of EvaluatorControl has its own EvalQueue, so that main
+   threads generating points never wait on each other.
+ * The points waiting for evaluation are kept in a vector. They are sorted
+   using ComparePriority by EvaluatorControl::unlockQueue(): the point
+   with the highest priority is at the end. The points lock is held from
+   EvaluatorControl::lockQueue() to EvaluatorControl::unlockQueue(), and
+   while blocks are popped.
+ * When the main thread runs its evaluations, the blocks it popped are
+   published in a deque. The workers of the main thread take blocks at the
+   front (highest priority first). Idle workers of other main threads may
+   steal blocks at the back. Thieves first look at an atomic counter, so
+   empty deques are skipped without taking a lock.
+ */
+class DLL_EVAL_API EvalQueue
+{
+private:
+    std::vector<EvalQueuePointPtr> _points;     ///< Points waiting for evaluation
+
+    std::vector<BlockForEval>*  _blocks;        ///< Blocks of the run in progress. nullptr when the main thread is not running.
+    std::deque<size_t>          _blockIndices;  ///< Indices in _blocks of the blocks not yet taken
+    std::atomic<size_t>         _nbBlocksAvailable; ///< Size of _blockIndices, readable without lock
+    std::atomic<size_t>         _nbStolenRunning;   ///< Number of stolen blocks still in evaluation
+
+#ifdef _OPENMP
+    mutable omp_lock_t _pointsLock;    ///< To lock the points
+    mutable omp_lock_t _blocksLock;    ///< To lock the deque of blocks
+#endif // _OPENMP
+
+public:
+    /// Constructor
+    explicit EvalQueue();
+
+    /// Destructor
+    virtual ~EvalQueue();
+
+    /// No copy: the locks cannot be shared.
+    EvalQueue(const EvalQueue&) = delete;
+    EvalQueue& operator=(const EvalQueue&) = delete;
+
+    /// Access to the points waiting for evaluation. The points lock must be held to modify them.
+    std::vector<EvalQueuePointPtr>& getPoints() { return _points; }
+    const std::vector<EvalQueuePointPtr>& getPoints() const { return _points; }
+
+    /// Lock the points.
+    void lockPoints() const;
+
+    /// Unlock the points.
+    void unlockPoints() const;
+
+    /// Try to lock the points.
+    /**
+     \return \c true if the points were not locked. They are now locked by the caller.
+     */
+    bool testLockPoints() const;
+
+    /// Publish the blocks of a run, in decreasing order of priority.
+    void openBlocks(std::vector<BlockForEval>& blocks);
+
+    /// Take the block with the highest priority. Called by the workers of the owner main thread.
+    /**
+     \param k   Index of the block taken in the vector given to openBlocks() -- \b OUT.
+     \return    \c true if a block was taken.
+     */
+    bool popFrontBlock(size_t& k);
+
+    /// Take the block with the lowest priority. Called by idle workers of other main threads.
+    /**
+     * On success, the block must be given back with releaseStolenBlock(),
+       whether it was evaluated or not.
+     \return    The block stolen, \c nullptr if there is none.
+     */
+    BlockForEval* stealBackBlock();
+
+    /// Done with a block obtained by stealBackBlock().
+    void releaseStolenBlock();
+
+    /// Does the deque seem to have blocks to steal? No lock is taken.
+    bool hasBlocksToSteal() const { return _nbBlocksAvailable > 0; }
+
+    /// Stop publishing the blocks and wait until all stolen blocks are released.
+    /**
+     * The blocks not taken remain in the vector given to openBlocks().
+     */
+    void closeBlocks();
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_EVALQUEUE__
@@ -44,11 +44,15 @@
 /*                                                                                 */
 /*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
 /*---------------------------------------------------------------------------------*/
+#include "../Eval/BBExeServer.hpp"
 #include "../Eval/Evaluator.hpp"
 #include "../Output/OutputQueue.hpp"
 #include "../Util/fileutils.hpp"
+#include "../Util/Profiler.hpp"
 #include <cstdio>  // For popen
 #include <fstream>  // For ofstream
+#include <map>
+#include <mutex>
 #ifndef _WIN32
 #include <unistd.h> // for getpid
 #else
@@ -64,6 +68,11 @@ std::vector<std::string> _tmpFiles = std::vector<std::string>();
 std::vector<std::string> _tmpOutFilesWithoutRedirection = std::vector<std::string>();
 std::vector<std::string> _tmpLogFilesWithoutRedirection = std::vector<std::string>();
 size_t _tmpFilesForParEval = 1;  // number of tmp files for parallel eval. Total number depends on number of main threads.
+thread_local int _evalMainThreadNum = -1;  // main thread running the evaluations of this thread. -1: main thread of the points.
+
+// Blackbox executables kept running (BB_EXE_SERVER). One for each executable and each tmp file index.
+std::map<std::pair<std::string, size_t>, std::unique_ptr<NOMAD::BBExeServer>> _bbExeServers;
+std::mutex _bbExeServersMutex;
 
 
 // Initialize static var
@@ -73,7 +82,11 @@ namespace {
     // the cleanup of temporary files at program shutdown needs to remain with this
     // translation unit to guarantee the correct destruction order
     struct TmpFilesCleanup {
-        ~TmpFilesCleanup() { NOMAD::Evaluator::removeTmpFiles(); }
+        ~TmpFilesCleanup()
+        {
+            NOMAD::Evaluator::stopBBExeServers();
+            NOMAD::Evaluator::removeTmpFiles();
+        }
     } _TmpFilesCleanup;
 }
 
@@ -87,6 +100,7 @@ NOMAD::Evaluator::Evaluator(
                     const NOMAD::EvalXDefined evalXDefined)
   : _evalParams(evalParams),
     _evalXDefined(evalXDefined),
+    _bbExeServer(false),
     _evalType(evalType),
     _bbOutputTypeList(_evalParams->getAttributeValue<NOMAD::BBOutputTypeList>("BB_OUTPUT_TYPE")),
     _bbEvalFormat(_evalParams->getAttributeValue<NOMAD::ArrayOfDouble>("BB_EVAL_FORMAT"))
@@ -100,6 +114,7 @@ void NOMAD::Evaluator::init()
     if (EvalXDefined::USE_BB_EVAL == _evalXDefined)
     {
         _bbRedirection = _evalParams->getAttributeValue<bool>("BB_REDIRECTION");
+        _bbExeServer = _evalParams->getAttributeValue<bool>("BB_EXE_SERVER");
         switch (_evalType)
         {
             case NOMAD::EvalType::BB:
@@ -183,6 +198,12 @@ void NOMAD::Evaluator::initializeTmpFiles(const std::string& tmpDir, const int &
 
 
 
+void NOMAD::Evaluator::setEvalMainThreadNum(const int mainThreadNum)
+{
+    _evalMainThreadNum = mainThreadNum;
+}
+
+
 void NOMAD::Evaluator::removeTmpFiles()
 {
     // Remove all temporary files, so that they do not linger around.
@@ -203,6 +224,14 @@ void NOMAD::Evaluator::removeTmpFiles()
 }
 
 
+void NOMAD::Evaluator::stopBBExeServers()
+{
+    std::lock_guard<std::mutex> lock(_bbExeServersMutex);
+    // The destructors stop the executables.
+    _bbExeServers.clear();
+}
+
+
 // Default eval_x: System call to a black box that was provided
 // via parameter BB_EXE and set through Evaluator::setBBExe().
 bool NOMAD::Evaluator::eval_x(NOMAD::EvalPoint &x,
@@ -227,7 +256,7 @@ bool NOMAD::Evaluator::eval_x(NOMAD::EvalPoint &x,
 
     // Create a block of one point and evaluate it.
     NOMAD::Block block;
-    std::shared_ptr<NOMAD::EvalPoint> epp = std::make_shared<NOMAD::EvalPoint>(x);
+    std::shared_ptr<NOMAD::EvalPoint> epp = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(x);
     block.push_back(epp);
 
     std::vector<bool> countEvalVector(1, countEval);
@@ -342,6 +371,7 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
                                                const NOMAD::Double &hMax,
                                                std::vector<bool> &countEval) const
 {
+    NOMAD_PROFILE_SCOPE("Evaluator::evalXBBExe");
     std::vector<bool> evalOk(block.size(), false);
 
     // At this point, we are for sure in batch mode.
@@ -354,7 +384,9 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 
-    const int mainThreadNum = block[0]->getThreadAlgo();
+    // The block may come from the queue of another main thread (EVAL_QUEUE_STEAL).
+    // Use the tmp files of the main thread running this evaluation.
+    const int mainThreadNum = (_evalMainThreadNum >= 0) ? _evalMainThreadNum : block[0]->getThreadAlgo();
 
     const size_t indexTmpFile = mainThreadNum*_tmpFilesForParEval + NOMAD::getThreadNum();
 
@@ -365,6 +397,13 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
         // Ugly early return
         return evalOk;
     }
+
+    if (_bbExeServer)
+    {
+        // No tmp file: the points are sent to the executable kept running for this index.
+        return evalXBBExeServer(block, indexTmpFile, countEval);
+    }
+
     const std::string& tmpfile = _tmpFiles[indexTmpFile];
     std::string tmpoutfile, tmplogfile;
     if (! _bbRedirection)
@@ -375,40 +414,42 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
 
 
 
-    // System command
-    std::ofstream xfile;
-    // Open xfile and clear it (trunc)
-    xfile.open(tmpfile.c_str(), std::ofstream::trunc);
-    if (xfile.fail())
+    bool flagHasEvalInProgress = false;
     {
-        for (auto& it : block)
+        NOMAD_PROFILE_SCOPE("Evaluator::writeInputFile");
+        std::ofstream xfile;
+        // Open xfile and clear it (trunc)
+        xfile.open(tmpfile.c_str(), std::ofstream::trunc);
+        if (xfile.fail())
         {
-            it->setEvalStatus(NOMAD::EvalStatusType::EVAL_ERROR, _evalType);
-            std::cout << "Error writing point " << it->display() << " to temporary file \"" << tmpfile << "\"" << std::endl;
+            for (auto& it : block)
+            {
+                it->setEvalStatus(NOMAD::EvalStatusType::EVAL_ERROR, _evalType);
+                std::cout << "Error writing point " << it->display() << " to temporary file \"" << tmpfile << "\"" << std::endl;
+            }
+            // Ugly early return
+            return evalOk;
         }
-        // Ugly early return
-        return evalOk;
-    }
 
-    bool flagHasEvalInProgress = false;
-    for (auto& it : block)
-    {
-        const std::shared_ptr<NOMAD::EvalPoint>& x = it;
-        for (size_t i = 0; i < x->size(); i++)
+        for (auto& it : block)
         {
-            if ( x->getEvalStatus(_evalType) == NOMAD::EvalStatusType::EVAL_IN_PROGRESS)
+            const std::shared_ptr<NOMAD::EvalPoint>& x = it;
+            for (size_t i = 0; i < x->size(); i++)
             {
-                if (i != 0)
+                if ( x->getEvalStatus(_evalType) == NOMAD::EvalStatusType::EVAL_IN_PROGRESS)
                 {
-                    xfile << " ";
+                    if (i != 0)
+                    {
+                        xfile << " ";
+                    }
+                    xfile << (*x)[i].display(static_cast<int>(_bbEvalFormat[i].todouble()));
+                    flagHasEvalInProgress = true;
                 }
-                xfile << (*x)[i].display(static_cast<int>(_bbEvalFormat[i].todouble()));
-                flagHasEvalInProgress = true;
             }
+            xfile << std::endl;
         }
-        xfile << std::endl;
+        xfile.close();
     }
-    xfile.close();
 
     // No need to launch bb command in that case.
     if (!flagHasEvalInProgress)
@@ -628,3 +669,99 @@ std::vector<bool> NOMAD::Evaluator::evalXBBExe(NOMAD::Block &block,
 
     return evalOk;
 }
+
+
+// Same as the batch evaluation with redirection, without starting the
+// blackbox executable: it is kept running and the points are streamed to it.
+std::vector<bool> NOMAD::Evaluator::evalXBBExeServer(NOMAD::Block &block,
+                                                     const size_t indexTmpFile,
+                                                     std::vector<bool> &countEval) const
+{
+    NOMAD_PROFILE_SCOPE("Evaluator::evalXBBExeServer");
+    std::vector<bool> evalOk(block.size(), false);
+
+    // Only EVAL_IN_PROGRESS points are sent.
+    // EVAL_WAIT points are not evaluated.
+    std::vector<std::string> inputs;
+    std::vector<size_t> indices;
+    for (size_t index = 0; index < block.size(); index++)
+    {
+        const std::shared_ptr<NOMAD::EvalPoint>& x = block[index];
+        if (x->getEvalStatus(_evalType) != NOMAD::EvalStatusType::EVAL_IN_PROGRESS)
+        {
+            continue;
+        }
+        std::string input;
+        for (size_t i = 0; i < x->size(); i++)
+        {
+            if (i != 0)
+            {
+                input += " ";
+            }
+            input += (*x)[i].display(static_cast<int>(_bbEvalFormat[i].todouble()));
+        }
+        inputs.push_back(input);
+        indices.push_back(index);
+    }
+
+    // No need to send anything in that case.
+    if (inputs.empty())
+    {
+        std::fill(countEval.begin(), countEval.end(), false); // no eval should be counted
+        return std::vector<bool>(countEval.size(),true); // no eval is ok
+    }
+
+    NOMAD::BBExeServer* server = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_bbExeServersMutex);
+        auto& serverPtr = _bbExeServers[std::make_pair(_bbExe, indexTmpFile)];
+        if (nullptr == serverPtr)
+        {
+            serverPtr = std::make_unique<NOMAD::BBExeServer>(_bbExe);
+        }
+        // Only this thread uses this tmp file index.
+        server = serverPtr.get();
+    }
+
+    std::string s;
+    OUTPUT_DEBUG_START
+    s = "Blackbox server: " + _bbExe + ". Send " + std::to_string(inputs.size()) + " points.";
+    NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUGDEBUG);
+    OUTPUT_DEBUG_END
+
+    std::vector<std::string> outputs;
+    if (!server->evalBlock(inputs, outputs))
+    {
+        s = "Warning: Blackbox server " + _bbExe + " stopped or could not be started. It will be started again for the next evaluation.";
+        NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_WARNING);
+    }
+
+    for (size_t k = 0; k < indices.size(); k++)
+    {
+        const size_t index = indices[k];
+        const std::shared_ptr<NOMAD::EvalPoint>& x = block[index];
+
+        if (k >= outputs.size())
+        {
+            // Something went wrong with the evaluation.
+            // Point could be re-submitted.
+            x->setEvalStatus(NOMAD::EvalStatusType::EVAL_ERROR, _evalType);
+            s = "Warning: Evaluation error with point " + x->display();
+            s += ": no output from blackbox server. Let's count eval anyway.";
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_WARNING);
+            countEval[index] = true;
+            continue;
+        }
+
+        // Process blackbox output
+        x->setBBO(outputs[k], _bbOutputTypeList, _evalType);
+        auto bbOutput = x->getEval(_evalType)->getBBOutput();
+
+        evalOk[index] = bbOutput.getEvalOk();
+        countEval[index] = bbOutput.getCountEval(_bbOutputTypeList);
+
+        x->setEvalStatus(evalOk[index] ? NOMAD::EvalStatusType::EVAL_OK : NOMAD::EvalStatusType::EVAL_FAILED, _evalType);
+    }
+
+    return evalOk;
+}
@@ -102,6 +102,9 @@ private:
      */
     
     std::string    _bbExe;
+
+    /// Keep the executable running between evaluations (parameter BB_EXE_SERVER).
+    bool           _bbExeServer;
     
     static bool   _bbRedirection;
     
@@ -125,9 +128,19 @@ public:
     /// Initialize one tmp file by thread
     static void initializeTmpFiles(const std::string& tmpDir, const int & nbThreadsForParallelEval);
 
+    /// Set the main thread running the evaluations of the calling thread.
+    /**
+     * Selects the tmp files used by this thread. Needed when the thread evaluates
+       a block generated by another main thread. -1 means the main thread of the points.
+     */
+    static void setEvalMainThreadNum(const int mainThreadNum);
+
     /// Delete tmp files when we are done
     static void removeTmpFiles();
 
+    /// Stop the blackbox executables kept running (parameter BB_EXE_SERVER)
+    static void stopBBExeServers();
+
     /*---------*/
     /* Get/Set */
     /*---------*/
@@ -186,6 +199,11 @@ private:
     virtual std::vector<bool> evalXBBExe(Block &block,
                                          const Double &hMax,
                                          std::vector<bool> &countEval) const;
+
+    /// Helper for evalXBBExe(): Evaluate using the executable kept running for this tmp file index.
+    std::vector<bool> evalXBBExeServer(Block &block,
+                                       const size_t indexTmpFile,
+                                       std::vector<bool> &countEval) const;
 };
 
 typedef std::shared_ptr<Evaluator> EvaluatorPtr;
@@ -55,6 +55,7 @@
 #include "../Util/AllStopReasons.hpp"
 #include "../Util/Clock.hpp"
 #include "../Util/MicroSleep.hpp"
+#include "../Util/Profiler.hpp"
 
 /*-----------------------------------*/
 /*   static members initialization   */
@@ -187,12 +188,9 @@ void NOMAD::EvaluatorControl::runEvalCallback<NOMAD::CallbackType::POST_EVAL_UPD
 // To be called by the Constructor.
 void NOMAD::EvaluatorControl::init()
 {
-#ifdef _OPENMP
-    omp_init_lock(&_evalQueueLock);
-#endif // _OPENMP
-
     _mainThreads.clear();
     _mainThreadInfo.clear();
+    _evalQueues.clear();
 
     if (nullptr == _evalContGlobalParams)
     {
@@ -209,6 +207,7 @@ void NOMAD::EvaluatorControl::init()
     _maxModelEval = _evalContGlobalParams->getTypeAttribute<size_t>("MODEL_MAX_EVAL");
     _useCacheFileForRerun = _evalContGlobalParams->getTypeAttribute<bool>("USE_CACHE_FILE_FOR_RERUN");
     _nbThreadsForParallelEval = _evalContGlobalParams->getTypeAttribute<int>("NB_THREADS_PARALLEL_EVAL");
+    _evalQueueSteal = _evalContGlobalParams->getTypeAttribute<bool>("EVAL_QUEUE_STEAL");
 
     // Add the first main thread (#0). More main threads may be added later
     addMainThread(0, _evalContParams);
@@ -220,7 +219,7 @@ void NOMAD::EvaluatorControl::init()
 // To be called by the Destructor.
 void NOMAD::EvaluatorControl::destroy()
 {
-    if (!_evalPointQueue.empty())
+    if (getQueueSize(-1) > 0)
     {
         // Show warnings and debug info.
         // Do not scare the user if display degree is medium or low.
@@ -261,10 +260,6 @@ void NOMAD::EvaluatorControl::destroy()
     // Reset callbacks as they are static attributes, useful for successive runs (also done in EVCInterface::resetCallbacks)
     // NB: valid only because we consider a unique Evaluator in a run
     resetCallbacks();
-
-#ifdef _OPENMP
-    omp_destroy_lock(&_evalQueueLock);
-#endif // _OPENMP
 }
 
 bool NOMAD::EvaluatorControl::hasEvaluator(NOMAD::EvalType evalType) const
@@ -312,6 +307,9 @@ void NOMAD::EvaluatorControl::addMainThread(const int threadNum,
         // make it work was using this convulated formulation.
         _mainThreadInfo.emplace(std::piecewise_construct, std::forward_as_tuple(threadNum), std::forward_as_tuple(std::move(evalContParamsU)));
 
+        // Each main thread has its own evaluation queue.
+        _evalQueues.emplace(threadNum, std::make_unique<NOMAD::EvalQueue>());
+
         // Main thread added. Create tmp files. For each main thread we may have several threads for parallel eval. Each one has its own tmp file.
         NOMAD::Evaluator::initializeTmpFiles(_evalContGlobalParams->getAttributeValue<std::string>("TMP_DIR"), _nbThreadsForParallelEval->getValue());
 
@@ -338,6 +336,19 @@ NOMAD::EvcMainThreadInfo& NOMAD::EvaluatorControl::getMainThreadInfo(const int t
 }
 
 
+NOMAD::EvalQueue& NOMAD::EvaluatorControl::getEvalQueue(const int mainThreadNum) const
+{
+    auto it = _evalQueues.find(mainThreadNum);
+    if (_evalQueues.end() == it)
+    {
+        std::string s = "EvaluatorControl: No evaluation queue for main thread " + NOMAD::itos(mainThreadNum);
+        throw NOMAD::Exception(__FILE__,__LINE__,s);
+    }
+
+    return *(it->second);
+}
+
+
 size_t NOMAD::EvaluatorControl::getModelEval(const int mainThreadNum) const
 {
     return getMainThreadInfo(mainThreadNum).getModelEval();
@@ -417,7 +428,12 @@ size_t NOMAD::EvaluatorControl::getQueueSize(const int mainThreadNum) const
 {
     if (-1 == mainThreadNum)
     {
-        return _evalPointQueue.size();
+        size_t queueSize = 0;
+        for (const auto& evalQueue : _evalQueues)
+        {
+            queueSize += evalQueue.second->getPoints().size();
+        }
+        return queueSize;
     }
 
     return getMainThreadInfo(mainThreadNum).getNbPointsInQueue();
@@ -703,8 +719,10 @@ void NOMAD::EvaluatorControl::lockQueue()
         err += ", which is not a main thread.";
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
+    // Only the queue of this main thread is locked: the other main threads
+    // may add points to their own queue at the same time.
     // Note: The queue could be already locked, ex. by popBlock.
-    omp_set_lock(&_evalQueueLock);
+    getEvalQueue(threadNum).lockPoints();
 #endif // _OPENMP
 }
 
@@ -722,13 +740,16 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 
+    auto& evalQueue = getEvalQueue(threadNum);
+    auto& evalPointQueue = evalQueue.getPoints();
+
 #ifdef _OPENMP
     // 2- Verify the queue was already locked. The lock should have been set by lockQueue().
-    if (omp_test_lock(&_evalQueueLock))
+    if (evalQueue.testLockPoints())
     {
         // Queue was not locked. Queue is now locked.
         std::string err = "Error: trying to unlock a queue that was not locked.";
-        omp_unset_lock(&_evalQueueLock);
+        evalQueue.unlockPoints();
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 #endif // _OPENMP
@@ -736,9 +757,9 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
     // The EvalQueuePoints are added randomly.
     // Sort the queue, using sorting algorithm, if doSort is true (default).
     // In non-opportunistic context, it is useless to sort.
-    if (doSort && getOpportunisticEval(threadNum) && getQueueSize(-1) > 1)
+    if (doSort && getOpportunisticEval(threadNum) && evalPointQueue.size() > 1)
     {
-        sort(_evalPointQueue,false);
+        sort(evalPointQueue,false);
     }
 
     if (0 == keepN)
@@ -751,7 +772,7 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
     if (keepN < INF_SIZE_T && keepN < getQueueSize(threadNum))
     {
         // Number of removable points
-        const size_t nbPoints = std::count_if(_evalPointQueue.begin(), _evalPointQueue.end(),
+        const size_t nbPoints = std::count_if(evalPointQueue.begin(), evalPointQueue.end(),
                                 [this, threadNum, removeStepType](const std::shared_ptr<NOMAD::EvalQueuePoint>& evalQueuePoint)
                                 {
                                     return canErase(evalQueuePoint, threadNum, removeStepType);
@@ -762,8 +783,8 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
             size_t nbErasablePoints = 0;
 
             // Find iterator where the removal must end.
-            auto itEraseEnd = _evalPointQueue.begin();
-            for (; (nbErasablePoints < nbPointsToErase && itEraseEnd < _evalPointQueue.end()); ++itEraseEnd)
+            auto itEraseEnd = evalPointQueue.begin();
+            for (; (nbErasablePoints < nbPointsToErase && itEraseEnd < evalPointQueue.end()); ++itEraseEnd)
             {
                 if (canErase((*itEraseEnd), threadNum, removeStepType))
                 {
@@ -772,7 +793,7 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
             }
 
             // Remove from begin to end, because the points with the highest priority are at the end.
-            auto itEraseBegin = std::remove_if(_evalPointQueue.begin(),
+            auto itEraseBegin = std::remove_if(evalPointQueue.begin(),
                                  itEraseEnd,
                                  [this, threadNum, removeStepType](const NOMAD::EvalQueuePointPtr& evalQueuePoint)
                                 {
@@ -786,14 +807,14 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
                                         return false;
                                     }
                                 });
-            _evalPointQueue.erase(itEraseBegin, itEraseEnd);
+            evalPointQueue.erase(itEraseBegin, itEraseEnd);
 
             OUTPUT_DEBUG_START
             std::string s = "Removing " + NOMAD::itos(nbErasablePoints) + " points from evaluation queue";
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
             s = "Evaluation queue after clean-up:";
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-            for (auto it = _evalPointQueue.rbegin(); it != _evalPointQueue.rend(); ++it)
+            for (auto it = evalPointQueue.rbegin(); it != evalPointQueue.rend(); ++it)
             {
                 const auto& evalPoint = (*it);
                 s = "\t" + evalPoint->display();
@@ -805,7 +826,7 @@ void NOMAD::EvaluatorControl::unlockQueue(bool doSort, const size_t keepN, const
 
     // Now, unlock the queue.
 #ifdef _OPENMP
-    omp_unset_lock(&_evalQueueLock);
+    evalQueue.unlockPoints();
 #endif // _OPENMP
 }
 
@@ -830,17 +851,22 @@ bool NOMAD::EvaluatorControl::addToQueue(const NOMAD::EvalQueuePointPtr& evalQue
         err += evalQueuePoint->getX()->NOMAD::Point::display();
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
+    // The point goes in the queue of the main thread that generated it.
+    const int mainThreadNum = evalQueuePoint->getThreadAlgo();
+    auto& evalQueue = getEvalQueue(mainThreadNum);
+    auto& evalPointQueue = evalQueue.getPoints();
+
 #ifdef _OPENMP
     // Thread-safety necessary here.
     // Ensure we will keep adding points until we ask to eval the queue, using run().
     // I.e. Ensure the queue is already locked.
-    if (omp_test_lock(&_evalQueueLock))
+    if (evalQueue.testLockPoints())
     {
         std::string err = "Error: trying to add an element to a queue that was not locked.";
         // Unlock queue before throwing exception.
         // If we are in this section, it means that the queue was locked by
-        // the call to omp_test_lock().
-        omp_unset_lock(&_evalQueueLock);
+        // the call to testLockPoints().
+        evalQueue.unlockPoints();
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 #endif // _OPENMP
@@ -852,7 +878,6 @@ bool NOMAD::EvaluatorControl::addToQueue(const NOMAD::EvalQueuePointPtr& evalQue
 
     NOMAD::EvalPoint foundEvalPoint;
     auto evalType = evalQueuePoint->getEvalType();
-    const int mainThreadNum = evalQueuePoint->getThreadAlgo();
 
     // Do not add eval queue point if no evaluator can evaluate this eval type
     // This can happen when calling Mads::Suggest. Some points need to be evaluated by a model (sort, n+1 quad), but BB eval point do not need to be evaluated (a fake BB evaluator is used). This is problematic when popping eval points.
@@ -863,7 +888,7 @@ bool NOMAD::EvaluatorControl::addToQueue(const NOMAD::EvalQueuePointPtr& evalQue
     }
 
     bool useCache = getUseCache(mainThreadNum);
-    if (std::find_if(_evalPointQueue.begin(), _evalPointQueue.end(), [evalQueuePoint](NOMAD::EvalQueuePointPtr& eqp){ return (*eqp == *evalQueuePoint); }) != _evalPointQueue.end())
+    if (std::find_if(evalPointQueue.begin(), evalPointQueue.end(), [evalQueuePoint](NOMAD::EvalQueuePointPtr& eqp){ return (*eqp == *evalQueuePoint); }) != evalPointQueue.end())
     {
         // Point is already in queue, do not insert it again.
         OUTPUT_DEBUG_START
@@ -883,8 +908,8 @@ bool NOMAD::EvaluatorControl::addToQueue(const NOMAD::EvalQueuePointPtr& evalQue
     }
     else
     {
-        auto it = _evalPointQueue.insert(_evalPointQueue.begin(), evalQueuePoint);
-        pointInserted = !(it == _evalPointQueue.end());
+        auto it = evalPointQueue.insert(evalPointQueue.begin(), evalQueuePoint);
+        pointInserted = !(it == evalPointQueue.end());
         if (pointInserted)
         {
             getMainThreadInfo(mainThreadNum).incNbPointsInQueue();
@@ -901,24 +926,16 @@ bool NOMAD::EvaluatorControl::popEvalPointForMainThread(NOMAD::EvalQueuePointPtr
 {
     bool success = false;
 
-    if (!_evalPointQueue.empty())
+    // The queue of a main thread only holds points generated by this main thread.
+    auto& evalPointQueue = getEvalQueue(mainThreadNum).getPoints();
+    if (!evalPointQueue.empty())
     {
-        // Find the first EvalPoint from the end that is from mainThreadNum
-        for (int i = static_cast<int>(_evalPointQueue.size())-1; i >= 0; i--)
-        {
-            // Use an eval queue point of the given main thread num.
-            if (_evalPointQueue[i]->getThreadAlgo() != mainThreadNum)
-            {
-                continue;
-            }
+        // The point with the highest priority is at the end.
+        evalQueuePoint = std::move(evalPointQueue.back());
+        evalPointQueue.pop_back();
 
-            evalQueuePoint = std::move(_evalPointQueue[i]);
-            _evalPointQueue.erase(_evalPointQueue.begin()+i);
-
-            getMainThreadInfo(mainThreadNum).decNbPointsInQueue();
-            success = true;
-            break;
-        }
+        getMainThreadInfo(mainThreadNum).decNbPointsInQueue();
+        success = true;
     }
 
     return success;
@@ -957,11 +974,10 @@ bool NOMAD::EvaluatorControl::popBlockForMainThread(NOMAD::BlockForEval &block,
     // Note: The queue lock ensures that blocks are filled as much as possible.
     // Otherwise, we could have 2 threads getting half-filled blocks instead
     // of one thread with a full block and one with no blocks.
-#ifdef _OPENMP
-    omp_set_lock(&_evalQueueLock);
-#endif // _OPENMP
+    auto& evalQueue = getEvalQueue(mainThreadNum);
+    evalQueue.lockPoints();
 
-    while (_evalPointQueue.size() > 0 && block.size() < blockSize && popWorks)
+    while (evalQueue.getPoints().size() > 0 && block.size() < blockSize && popWorks)
     {
         NOMAD::EvalQueuePointPtr evalQueuePoint;
         popWorks = popEvalPointForMainThread(evalQueuePoint, mainThreadNum);
@@ -977,9 +993,7 @@ bool NOMAD::EvaluatorControl::popBlockForMainThread(NOMAD::BlockForEval &block,
             success = true;
         }
     }
-#ifdef _OPENMP
-    omp_unset_lock(&_evalQueueLock);
-#endif
+    evalQueue.unlockPoints();
 
     return success;
 }
@@ -1079,7 +1093,7 @@ void NOMAD::EvaluatorControl::sort(std::vector<EvalQueuePointPtr> & evalPointsPt
         NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
         s = "Evaluation points before sort:";
         NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-        // Display in reverse order: as the _evalPointQueue is popped,
+        // Display in reverse order: as the queue is popped,
         // the first point being evaluated is at the end of the queue.
         // We want to show the first point to be evaluated first.
         for (auto it = evalPointsPtrToSort.rbegin(); it != evalPointsPtrToSort.rend(); ++it)
@@ -1112,15 +1126,22 @@ bool NOMAD::EvaluatorControl::checkModelEvals() const
     // Return false if a single eval queue point has no model evaluation information
     bool valid_eval = true;
 
-    for (const auto & eqp : _evalPointQueue)
+    for (const auto & evalQueue : _evalQueues)
     {
-        if (nullptr == eqp->getEval(EvalType::MODEL) )
+        for (const auto & eqp : evalQueue.second->getPoints())
+        {
+            if (nullptr == eqp->getEval(EvalType::MODEL) )
+            {
+                OUTPUT_DEBUG_START
+                std::string s = "    Main thread: " + std::to_string(eqp->getThreadAlgo()) + " Model eval missing for: " + eqp->displayAll(NOMAD::defaultFHComputeTypeS);
+                NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+                OUTPUT_DEBUG_END
+                valid_eval = false;
+                break;
+            }
+        }
+        if (!valid_eval)
         {
-            OUTPUT_DEBUG_START
-            std::string s = "    Main thread: " + std::to_string(eqp->getThreadAlgo()) + " Model eval missing for: " + eqp->displayAll(NOMAD::defaultFHComputeTypeS);
-            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-            OUTPUT_DEBUG_END
-            valid_eval = false;
             break;
         }
     }
@@ -1153,55 +1174,35 @@ size_t NOMAD::EvaluatorControl::clearQueue(const int mainThreadNum, const bool s
 {
     size_t nbPointsErased = 0;
 
-#ifdef _OPENMP
-    omp_set_lock(&_evalQueueLock);
-#endif // _OPENMP
-
-    if (-1 == mainThreadNum)
+    for (const auto& mt : _mainThreads)
     {
-        nbPointsErased = _evalPointQueue.size();
-        _evalPointQueue.clear();
-        for (auto mt : _mainThreads)
+        if (-1 != mainThreadNum && mt != mainThreadNum)
         {
-            getMainThreadInfo(mt).resetNbPointsInQueue();
+            continue;
         }
-    }
-    else
-    {
-        nbPointsErased = std::count_if(_evalPointQueue.begin(), _evalPointQueue.end(),
-                                [mainThreadNum](const std::shared_ptr<NOMAD::EvalQueuePoint>& evalQueuePoint)
-                                {
-                                    return mainThreadNum == evalQueuePoint->getThreadAlgo();
-                                });
 
-        auto it = std::remove_if(_evalPointQueue.begin(),
-                                 _evalPointQueue.end(),
-                                 [mainThreadNum, showDebug](const NOMAD::EvalQueuePointPtr& evalQueuePoint)
-                                {
-                                    if (mainThreadNum == evalQueuePoint->getThreadAlgo())
-                                    {
-                                        OUTPUT_DEBUG_START
-                                        if (showDebug)
-                                        {
-                                            std::string s = "Delete point from queue: ";
-                                            s += evalQueuePoint->display();
-                                            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-                                        }
-                                        OUTPUT_DEBUG_END
-                                        return true;
-                                    }
-                                    else
-                                    {
-                                        return false;
-                                    }
-                                });
-        _evalPointQueue.erase(it, _evalPointQueue.end());
-        getMainThreadInfo(mainThreadNum).resetNbPointsInQueue();
-    }
+        auto& evalQueue = getEvalQueue(mt);
+        auto& evalPointQueue = evalQueue.getPoints();
+        evalQueue.lockPoints();
 
-#ifdef _OPENMP
-    omp_unset_lock(&_evalQueueLock);
-#endif // _OPENMP
+        OUTPUT_DEBUG_START
+        if (showDebug)
+        {
+            for (const auto& evalQueuePoint : evalPointQueue)
+            {
+                std::string s = "Delete point from queue: ";
+                s += evalQueuePoint->display();
+                NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+            }
+        }
+        OUTPUT_DEBUG_END
+
+        nbPointsErased += evalPointQueue.size();
+        evalPointQueue.clear();
+        getMainThreadInfo(mt).resetNbPointsInQueue();
+
+        evalQueue.unlockPoints();
+    }
 
     return nbPointsErased;
 }
@@ -1320,156 +1321,86 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
     OUTPUT_DEBUG_START
     std::string s = "After blocks generation: ";
     s += NOMAD::itos(allBlocks.size()) + " blocks";
-    s += ", max block size is " + NOMAD::itos(allBlocks[0].size());
-    if (_evalPointQueue.size() > 0)
+    if (!allBlocks.empty())
     {
-        s += ", eval queue still contains " + NOMAD::itos(_evalPointQueue.size()) + " points.";
+        s += ", max block size is " + NOMAD::itos(allBlocks[0].size());
+    }
+    if (getQueueSize(mainThreadNum) > 0)
+    {
+        s += ", eval queue still contains " + NOMAD::itos(getQueueSize(mainThreadNum)) + " points.";
     }
     NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
     OUTPUT_DEBUG_END
 
-    int k=0;
+    // Publish the blocks. The evaluation threads of this main thread take them
+    // by order of priority. Idle evaluation threads of other main threads may
+    // steal the blocks of lowest priority.
+    auto& evalQueue = getEvalQueue(mainThreadNum);
+    evalQueue.openBlocks(allBlocks);
+
+    // Help other main threads at most as much as the work done for this main thread,
+    // so that this main thread is not kept away from its algorithm for too long.
+    const bool evalQueueSteal = _evalQueueSteal->getValue() && _mainThreads.size() > 1;
+    const size_t maxNbStolenBlocks = std::max<size_t>(allBlocks.size(), 1);
+    std::atomic<size_t> nbStolenBlocks(0);
+
     // conditionForStop is true if we are in a main thread and stopMainEval() returns true.
     // conditionForStop is true in any thread if reachedMaxEval() returns true; otherwise, it is always false.
 #ifdef _OPENMP
     const size_t t = _nbThreadsForParallelEval->getValue();
-#pragma omp parallel for num_threads(t) default(none) shared(conditionForStop,mainThreadNum,allBlocks) private(k) schedule(static,1)
+#pragma omp parallel num_threads(t) default(none) shared(conditionForStop,mainThreadNum,allBlocks,evalQueue,evalQueueSteal,maxNbStolenBlocks,nbStolenBlocks)
 #endif
-    for (k=0 ; k < allBlocks.size(); k++)
     {
-        // Check for stop conditions
-        conditionForStop = conditionForStop || stopMainEval(mainThreadNum, true /*true: display info if stop*/ );
-
-        // If we reached max eval, we also stop (valid for all threads).
-        conditionForStop = conditionForStop || reachedMaxEval();
+        // Stolen blocks are evaluated using the tmp files of this main thread.
+        NOMAD::Evaluator::setEvalMainThreadNum(mainThreadNum);
 
-        if (conditionForStop)
-        {
-#ifdef _OPENMP
-#pragma omp flush (conditionForStop)
-#else
-            break; // Can only break when no omp parallel for.
-#endif
-        }
-        else
+        size_t k = 0;
+        bool keepEvaluating = true;
+        while (keepEvaluating)
         {
+            // Check for stop conditions
+            conditionForStop = conditionForStop || stopMainEval(mainThreadNum, true /*true: display info if stop*/ );
 
-            bool evalBlockOk = evalBlock(allBlocks[k]);
+            // If we reached max eval, we also stop (valid for all threads).
+            conditionForStop = conditionForStop || reachedMaxEval();
 
-            // Update SuccessType
-            // success is a member of EvcMainThreadInfo and so it can be shared between secondary threads.
+            if (conditionForStop)
+            {
 #ifdef _OPENMP
-#pragma omp critical(updateSuccessType)
-#endif // _OPENMP
+#pragma omp flush (conditionForStop)
+#endif
+                keepEvaluating = false;
+            }
+            else if (evalQueue.popFrontBlock(k))
             {
-                if (evalBlockOk)
-                {
-                    for (auto it = allBlocks[k].begin(); it < allBlocks[k].end(); it++)
-                    {
-                        NOMAD::EvalQueuePointPtr evalQueuePoint = (*it);
-                        const int mainThreadNum = evalQueuePoint->getThreadAlgo();
-
-                        // User callback
-                        // Note: should be done before accessing success type as this may be modified in the callback (e.g. in DiscoMads)
-                        bool customOpportunisticEvalStop = false, customOpportunisticIterStop = false;
-                        runEvalCallback<NOMAD::CallbackType::EVAL_OPPORTUNISTIC_CHECK>(evalQueuePoint,customOpportunisticEvalStop,customOpportunisticIterStop);
-
-                        const NOMAD::SuccessType success = evalQueuePoint->getSuccess();
-
-                        // Update success type for return
-                        if (success > getSuccessType(mainThreadNum))
-                        {
-                            setSuccessType(mainThreadNum, success);
-                        }
-
-                        if (   NOMAD::SuccessType::FULL_SUCCESS == success
-                            && evalTypeAsBB(evalQueuePoint->getEvalType(), mainThreadNum))
-                        {
-                            //PhaseOne full success
-                            if (evalQueuePoint->getGenByPhaseOne())
-                            {
-                                _nbPhaseOneSuccess++;
-                            }
-
-                            if (!evalQueuePoint->getRelativeSuccess())
-                            {
-                                _indexBestInfeasEval = getBbEval();
-                            }
-
-                        }
-                        if (evalQueuePoint->getRelativeSuccess())
-                        {
-                            _nbRelativeSuccess++;
-                            _indexSuccBlockEval = getBlockEval();
-                            _indexBestFeasEval = getBbEval();
-                        }
-
-                        // Output in history (always) and solution (FULL_SUCCESS only)
-                        addDirectToFileInfo(evalQueuePoint);
-
-                        // Opportunism on full success only (default opportunism only)
-                        // See below when a callback is added for checking custom opportunistic criterion
-                        if (!_customOpportunisticOnlyCheck && getOpportunisticEval(mainThreadNum) && getSuccessType(mainThreadNum) >= NOMAD::SuccessType::FULL_SUCCESS)
-                        {
-                            setStopReason(mainThreadNum, NOMAD::EvalMainThreadStopType::OPPORTUNISTIC_SUCCESS);
-                        }
-
-                        // Stop reason for OPPORTUNISTIC_SUCCESS must be shadowed by
-                        // CUSTOM_OPPORTUNISTIC_EVAL_STOP OR
-                        // CUSTOM_OPPORTUNISTIC_ITER_STOP
-                        // Both cannot be true to have a clear decision what to do (eval stop or iter stop). The flags are automatically checked after the callback.
-
-                        // Associate custom opportunistic eval stop to main thread
-                        // Testing for success is done later to decide if we do the next step of the iteration.
-                        if (customOpportunisticEvalStop)
-                        {
-                            setStopReason(mainThreadNum, NOMAD::EvalMainThreadStopType::CUSTOM_OPPORTUNISTIC_EVAL_STOP);
-                        }
-
-                        // Associate custom opportunistic stop to mainThread
-                        if (customOpportunisticIterStop)
-                        {
-                            setStopReason(mainThreadNum, NOMAD::EvalMainThreadStopType::CUSTOM_OPPORTUNISTIC_ITER_STOP);
-                        }
-                    }
-                }
-                else
-                {
-                    // EvalBlock not ok
-                    // Let's try to write block points into file
-                    for (auto it = allBlocks[k].begin(); it < allBlocks[k].end(); it++)
-                    {
-                        NOMAD::EvalQueuePointPtr evalQueuePoint = (*it);
-                        // Output in history (always)
-                        addDirectToFileInfo(evalQueuePoint);
-
-                    }
-                }
-
-                // Cannot modify _succesStats outside critical
-                addStatsInfo(allBlocks[k]);
-
-                // Decrement main thread info counter separately as each eval point of a block
-                // maybe come from a different algo.
-                for (size_t i = 0; i < allBlocks[k].size(); i++)
-                {
-                    getMainThreadInfo(allBlocks[k][i]->getThreadAlgo()).decCurrentlyRunning();
-                }
-
-            }   // End critical(updateSuccessType)
-
-            // Clear the block.
-            allBlocks[k].clear();
+                bool evalBlockOk = evalBlock(allBlocks[k]);
+                processEvaluatedBlock(allBlocks[k], evalBlockOk);
+            }
+            else if (evalQueueSteal && nbStolenBlocks++ < maxNbStolenBlocks)
+            {
+                // No more blocks for this main thread. Help the other main threads.
+                keepEvaluating = stealAndEvalBlock(mainThreadNum);
+            }
+            else
+            {
+                keepEvaluating = false;
+            }
         }
 
+        NOMAD::Evaluator::setEvalMainThreadNum(-1);
     }
-    // End of for loop: Exit for this main thread.
+    // End of parallel evaluation: Exit for this main thread.
+
+    // The blocks not evaluated stay in allBlocks.
+    // Wait until the blocks stolen by other main threads are evaluated.
+    evalQueue.closeBlocks();
 
 
     // Put back the unevaluated points into the queue.
     // When a point is popped into a block for evaluation it is removed from the queue.
     // When evaluations in a block are done, block is cleared.
     // Let's do the reverse.
+    auto& evalPointQueue = evalQueue.getPoints();
     for (size_t k=0; k < allBlocks.size(); k++)
     {
         // Each point in the block is put back in the queue.
@@ -1477,22 +1408,18 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
         {
 
             // Find if a point in a block is not in the queue. If not, test if the point was evaluated.
-            auto it = std::find(_evalPointQueue.begin(), _evalPointQueue.end(), *itB);
-            if (it == _evalPointQueue.end())
+            auto it = std::find(evalPointQueue.begin(), evalPointQueue.end(), *itB);
+            if (it == evalPointQueue.end())
             {
                 // Point was not evaluated. Put it back in the queue.
-#ifdef _OPENMP
-    omp_set_lock(&_evalQueueLock);
-#endif // _OPENMP
-                _evalPointQueue.push_back(*itB);
-#ifdef _OPENMP
-    omp_unset_lock(&_evalQueueLock);
-#endif // _OPENMP
+                evalQueue.lockPoints();
+                evalPointQueue.push_back(*itB);
+                evalQueue.unlockPoints();
                 getMainThreadInfo(mainThreadNum).incNbPointsInQueue();
                 OUTPUT_DEBUG_START
                 std::string s = "Point put back in queue (not evaluated): " + (*itB)->display();
                 NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
-                s = "Queue size: " + std::to_string(_evalPointQueue.size());
+                s = "Queue size: " + std::to_string(evalPointQueue.size());
                 NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
                 OUTPUT_DEBUG_END
             }
@@ -1553,11 +1480,173 @@ NOMAD::SuccessType NOMAD::EvaluatorControl::run()
     NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
     OUTPUT_DEBUG_END
     NOMAD::OutputQueue::Flush();
+    // The history and stats of the evaluated points are in their files when run() returns.
+    NOMAD::OutputWriter::Flush();
 
     return getSuccessType(mainThreadNum);
 }
 
 
+void NOMAD::EvaluatorControl::processEvaluatedBlock(NOMAD::BlockForEval& block, const bool evalBlockOk)
+{
+    // Update SuccessType
+    // success is a member of EvcMainThreadInfo and so it can be shared between secondary threads.
+#ifdef _OPENMP
+#pragma omp critical(updateSuccessType)
+#endif // _OPENMP
+    {
+        if (evalBlockOk)
+        {
+            for (auto it = block.begin(); it < block.end(); it++)
+            {
+                NOMAD::EvalQueuePointPtr evalQueuePoint = (*it);
+                const int mainThreadNum = evalQueuePoint->getThreadAlgo();
+
+                // User callback
+                // Note: should be done before accessing success type as this may be modified in the callback (e.g. in DiscoMads)
+                bool customOpportunisticEvalStop = false, customOpportunisticIterStop = false;
+                runEvalCallback<NOMAD::CallbackType::EVAL_OPPORTUNISTIC_CHECK>(evalQueuePoint,customOpportunisticEvalStop,customOpportunisticIterStop);
+
+                const NOMAD::SuccessType success = evalQueuePoint->getSuccess();
+
+                // Update success type for return
+                if (success > getSuccessType(mainThreadNum))
+                {
+                    setSuccessType(mainThreadNum, success);
+                }
+
+                if (   NOMAD::SuccessType::FULL_SUCCESS == success
+                    && evalTypeAsBB(evalQueuePoint->getEvalType(), mainThreadNum))
+                {
+                    //PhaseOne full success
+                    if (evalQueuePoint->getGenByPhaseOne())
+                    {
+                        _nbPhaseOneSuccess++;
+                    }
+
+                    if (!evalQueuePoint->getRelativeSuccess())
+                    {
+                        _indexBestInfeasEval = getBbEval();
+                    }
+
+                }
+                if (evalQueuePoint->getRelativeSuccess())
+                {
+                    _nbRelativeSuccess++;
+                    _indexSuccBlockEval = getBlockEval();
+                    _indexBestFeasEval = getBbEval();
+                }
+
+                // Output in history (always) and solution (FULL_SUCCESS only)
+                addDirectToFileInfo(evalQueuePoint);
+
+                // Opportunism on full success only (default opportunism only)
+                // See below when a callback is added for checking custom opportunistic criterion
+                if (!_customOpportunisticOnlyCheck && getOpportunisticEval(mainThreadNum) && getSuccessType(mainThreadNum) >= NOMAD::SuccessType::FULL_SUCCESS)
+                {
+                    setStopReason(mainThreadNum, NOMAD::EvalMainThreadStopType::OPPORTUNISTIC_SUCCESS);
+                }
+
+                // Stop reason for OPPORTUNISTIC_SUCCESS must be shadowed by
+                // CUSTOM_OPPORTUNISTIC_EVAL_STOP OR
+                // CUSTOM_OPPORTUNISTIC_ITER_STOP
+                // Both cannot be true to have a clear decision what to do (eval stop or iter stop). The flags are automatically checked after the callback.
+
+                // Associate custom opportunistic eval stop to main thread
+                // Testing for success is done later to decide if we do the next step of the iteration.
+                if (customOpportunisticEvalStop)
+                {
+                    setStopReason(mainThreadNum, NOMAD::EvalMainThreadStopType::CUSTOM_OPPORTUNISTIC_EVAL_STOP);
+                }
+
+                // Associate custom opportunistic stop to mainThread
+                if (customOpportunisticIterStop)
+                {
+                    setStopReason(mainThreadNum, NOMAD::EvalMainThreadStopType::CUSTOM_OPPORTUNISTIC_ITER_STOP);
+                }
+            }
+        }
+        else
+        {
+            // EvalBlock not ok
+            // Let's try to write block points into file
+            for (auto it = block.begin(); it < block.end(); it++)
+            {
+                NOMAD::EvalQueuePointPtr evalQueuePoint = (*it);
+                // Output in history (always)
+                addDirectToFileInfo(evalQueuePoint);
+
+            }
+        }
+
+        // Cannot modify _succesStats outside critical
+        addStatsInfo(block);
+
+        // Decrement main thread info counter separately as each eval point of a block
+        // maybe come from a different algo.
+        for (size_t i = 0; i < block.size(); i++)
+        {
+            getMainThreadInfo(block[i]->getThreadAlgo()).decCurrentlyRunning();
+        }
+
+    }   // End critical(updateSuccessType)
+
+    // Clear the block.
+    block.clear();
+}
+
+
+bool NOMAD::EvaluatorControl::stealAndEvalBlock(const int mainThreadNum)
+{
+    // Visit the other main threads, starting with the next one, so that the
+    // idle threads do not all steal from the same main thread.
+    auto itStart = _evalQueues.upper_bound(mainThreadNum);
+    for (size_t i = 0; i < _evalQueues.size(); i++, itStart++)
+    {
+        if (_evalQueues.end() == itStart)
+        {
+            itStart = _evalQueues.begin();
+        }
+        const int otherMainThreadNum = itStart->first;
+        auto& otherEvalQueue = *(itStart->second);
+        if (mainThreadNum == otherMainThreadNum || !otherEvalQueue.hasBlocksToSteal())
+        {
+            continue;
+        }
+
+        NOMAD::BlockForEval* block = otherEvalQueue.stealBackBlock();
+        if (nullptr == block)
+        {
+            continue;
+        }
+
+        // Evaluate only if the budget allows it. Otherwise, the block remains
+        // in the other main thread and its points are put back in its queue.
+        bool evalDone = false;
+        if (!stopMainEval(otherMainThreadNum, false) && !reachedMaxEval())
+        {
+            OUTPUT_DEBUG_START
+            std::string s = "Main thread " + NOMAD::itos(mainThreadNum) + " evaluates a block of ";
+            s += NOMAD::itos(block->size()) + " points from main thread " + NOMAD::itos(otherMainThreadNum);
+            NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
+            OUTPUT_DEBUG_END
+
+            bool evalBlockOk = evalBlock(*block);
+            processEvaluatedBlock(*block, evalBlockOk);
+            evalDone = true;
+        }
+        otherEvalQueue.releaseStolenBlock();
+
+        if (evalDone)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
 void NOMAD::EvaluatorControl::stop()
 {
     std::string s;
@@ -1773,19 +1862,20 @@ bool NOMAD::EvaluatorControl::reachedMaxStepEval(const int mainThreadNum) const
 void NOMAD::EvaluatorControl::debugDisplayQueue() const
 {
 #ifdef _OPENMP
-    omp_set_lock(&_evalQueueLock);
     #pragma omp critical(displayQueue)
 #endif // _OPENMP
     {
-        std::cout << "Evaluation Queue" << (_evalPointQueue.empty() ? " is empty." : ":") << std::endl;
-        for (const auto& eqp : _evalPointQueue)
+        std::cout << "Evaluation Queue" << (0 == getQueueSize(-1) ? " is empty." : ":") << std::endl;
+        for (const auto& evalQueue : _evalQueues)
         {
-            std::cout << "    Main thread: " << eqp->getThreadAlgo() << " EvalType: " << eqp->getEvalType() << " " << eqp->displayAll(NOMAD::defaultFHComputeTypeS) << std::endl;
+            evalQueue.second->lockPoints();
+            for (const auto& eqp : evalQueue.second->getPoints())
+            {
+                std::cout << "    Main thread: " << eqp->getThreadAlgo() << " EvalType: " << eqp->getEvalType() << " " << eqp->displayAll(NOMAD::defaultFHComputeTypeS) << std::endl;
+            }
+            evalQueue.second->unlockPoints();
         }
     }
-#ifdef _OPENMP
-    omp_unset_lock(&_evalQueueLock);
-#endif // _OPENMP
 }
 
 
@@ -1824,18 +1914,33 @@ void NOMAD::EvaluatorControl::addDirectToFileInfo(const NOMAD::EvalQueuePointPtr
     bool writeInSolutionFile = (   evalQueuePoint->getSuccess() == SuccessType::FULL_SUCCESS
                                 && evalQueuePoint->isFeasible(defaultFHComputeType));
 
-    // Evaluation info for output
-    NOMAD::StatsInfo info;
+    // Binary history: write the values as they are, without formatting.
+    const bool historyBinary = NOMAD::OutputDirectToFile::getInstance()->isHistoryBinary();
+    if (historyBinary)
+    {
+        const NOMAD::Eval* eval = evalQueuePoint->getEval(NOMAD::EvalType::BB);
+        NOMAD::OutputDirectToFile::getInstance()->writeHistoryRecord(*(evalQueuePoint->getX()),
+                                                                     (nullptr != eval) ? eval->getBBOutput().getBBOAsArrayOfDouble() : NOMAD::ArrayOfDouble(),
+                                                                     static_cast<int>(evalQueuePoint->getEvalStatus(NOMAD::EvalType::BB)),
+                                                                     NOMAD::getThreadNum());
+    }
+
+    if (!historyBinary || writeInSolutionFile)
+    {
+        // Evaluation info for output
+        NOMAD::StatsInfo info;
 
-    info.setBBO(evalQueuePoint->getBBO(NOMAD::EvalType::BB));
-    info.setSol(*(evalQueuePoint->getX()));
+        info.setBBO(evalQueuePoint->getBBO(NOMAD::EvalType::BB));
+        info.setSol(*(evalQueuePoint->getX()));
 
-    NOMAD::OutputDirectToFile::Write(info, writeInSolutionFile);
+        NOMAD::OutputDirectToFile::Write(info, writeInSolutionFile, !historyBinary);
+    }
 
 
     // What follows is used only if multiple best feasible points have been obtained.
     // This is the case for Multiobjective pb.
-    auto barrier = getBarrier();
+    // Note: this may run on an evaluation thread; use the main thread of the point.
+    auto barrier = getBarrier(evalQueuePoint->getThreadAlgo());
 
     if (writeInSolutionFile && nullptr != barrier)
     {
@@ -1934,6 +2039,13 @@ void NOMAD::EvaluatorControl::addStatsInfo(const NOMAD::BlockForEval& block)
         stats->setTag(evalQueuePoint->getTag());
         stats->setComment(evalQueuePoint->getComment());
         stats->setGenStep(NOMAD::StepTypeListToString(evalQueuePoint->getGenSteps()));
+        // Pareto front indicators (multi-objective barriers only).
+        const auto barrier = getBarrier(mainThreadNum);
+        if (nullptr != barrier)
+        {
+            stats->setHypervolume(barrier->getHypervolume());
+            stats->setSpacing(barrier->getSpacing());
+        }
 
         std::string s = "Evaluated point: " + evalQueuePoint->displayAll(NOMAD::defaultFHComputeTypeS);
         NOMAD::OutputInfo outputInfo("EvaluatorControl", s, NOMAD::OutputLevel::LEVEL_STATS);
@@ -2162,6 +2274,12 @@ bool NOMAD::EvaluatorControl::evalBlock(NOMAD::BlockForEval& blockForEval)
 
     }
 
+    // Save the cache file periodically (parameter CACHE_SAVE_PERIOD).
+    if (getUseCache(mainThreadNum))
+    {
+        NOMAD::CacheBase::getInstance()->writeIfSavePeriodReached();
+    }
+
     size_t nbEvalOk = nbEvalOkFromCache + std::count(evalOk.begin(), evalOk.end(), true);
 
     return (nbEvalOk > 0);
@@ -2277,7 +2395,7 @@ bool NOMAD::EvaluatorControl::evalSinglePoint(NOMAD::EvalPoint &evalPoint,
 
     // Create a block of one point and evaluate it.
     NOMAD::Block block;
-    std::shared_ptr<NOMAD::EvalPoint> epp = std::make_shared<NOMAD::EvalPoint>(evalPoint);
+    std::shared_ptr<NOMAD::EvalPoint> epp = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint);
     block.push_back(epp);
     std::vector<bool> vectorEvalOk = evalBlockOfPoints(block, *getMainThreadInfo(mainThreadNum).getCurrentEvaluator(), hMax);
     size_t nbEvalOk = std::count(vectorEvalOk.begin(), vectorEvalOk.end(), true);
@@ -2351,18 +2469,8 @@ std::vector<bool> NOMAD::EvaluatorControl::evalBlockOfPoints(
         std::string startMsg = "Start evaluation of block of " + NOMAD::itos(block.size()) + " points.";
         evalInfo.addMsg(startMsg);
         OUTPUT_INFO_END
-#ifdef TIME_STATS
-        double evalStartTime = NOMAD::Clock::getCPUTime();
-#endif // TIME_STATS
+        NOMAD_PROFILE_SCOPE("EvaluatorControl::evalBlock");
         evalOk = evaluator.eval_block(block, hMax, countEval);
-#ifdef TIME_STATS
-#ifdef _OPENMP
-#pragma omp critical(computeEvalTime)
-#endif // _OPENMP
-        {
-            _evalTime += NOMAD::Clock::getCPUTime() - evalStartTime;
-        }
-#endif // TIME_STATS
     }
     catch (std::exception &e)
     {
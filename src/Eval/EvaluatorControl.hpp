@@ -58,6 +58,7 @@
 #include "../Eval/BarrierBase.hpp"
 #include "../Eval/SuccessStats.hpp"
 #include "../Eval/ComparePriority.hpp"
+#include "../Eval/EvalQueue.hpp"
 #include "../Eval/EvalQueuePoint.hpp"
 #include "../Eval/EvcMainThreadInfo.hpp"
 #include "../Param/EvaluatorControlGlobalParameters.hpp"
@@ -166,22 +167,19 @@ private:
 
     mutable std::map<int, EvcMainThreadInfo> _mainThreadInfo;  ///< Info about main threads
 
-    /// The queue of points to be evaluated.
+    /// The queues of points to be evaluated, one for each main thread.
     /**
-     * The queue is implemented as a vector. Points are added at the end of
+     * Each queue is implemented as a vector. Points are added at the beginning of
       the queue. Points are sorted using ComparePriority which is called
       in unlockQueue() when the user is done adding points to the queue. \n
-     * Sorting the queue can also be done by providing another function.
+     * Sorting the queue can also be done by providing another function. \n
+     * The blocks popped from a queue during run() may be stolen by idle
+      evaluation threads of other main threads. See EvalQueue.
      */
-    std::vector<EvalQueuePointPtr> _evalPointQueue;
+    std::map<int, std::unique_ptr<EvalQueue>> _evalQueues;
 
     static std::shared_ptr<ComparePriorityMethod>  _userCompMethod;    ///< User-implemented comparison method to sort points before evaluation
 
-#ifdef _OPENMP
-    /// To lock the queue
-    mutable omp_lock_t _evalQueueLock;
-#endif // _OPENMP
-
     /// The number of blackbox evaluations performed
     /**
      \remark
@@ -292,6 +290,7 @@ private:
     SPAttribute<size_t>  _maxBBEval, _maxSurrogateEval, _maxEval, _maxBlockEval;
     SPAttribute<bool> _useCacheFileForRerun; ///< Flag to use cache file for evaluation during rerun.
     SPAttribute<int> _nbThreadsForParallelEval; ///< The number of threads for parallel run evaluations. Parallel eval available only when OpenMP is available.
+    SPAttribute<bool> _evalQueueSteal; ///< Flag to let idle evaluation threads take blocks from other main threads.
 
 
     // Default callback function. Does nothing.
@@ -324,10 +323,6 @@ private:
     // Flag to indicate if callback for eval fail check has been set by user
     static bool _cbFailEvalCheckIsDefault;
 
-#ifdef TIME_STATS
-    double _evalTime;  ///< Total time spent running evaluations
-#endif // TIME_STATS
-
 public:
     /**
     Set the callbacks to defaultEvalCB.
@@ -354,10 +349,7 @@ public:
         _evalContParams(evalContParams),
         _mainThreads(),
         _mainThreadInfo(),
-        _evalPointQueue(),
-#ifdef _OPENMP
-        _evalQueueLock(),
-#endif // _OPENMP
+        _evalQueues(),
         _bbEval(0),
         _bbEvalFromCacheForRerun(0),
         _bbEvalNotOk(0),
@@ -375,9 +367,6 @@ public:
         _nbPhaseOneSuccess(0),
         _nbRevealingIter(0),
         _allDoneWithEval(false)
-#ifdef TIME_STATS
-        ,_evalTime(0.0)
-#endif // TIME_STATS
     {
         init();
     }
@@ -395,10 +384,7 @@ public:
         _evalContParams(evalContParams),
         _mainThreads(),
         _mainThreadInfo(),
-        _evalPointQueue(),
-#ifdef _OPENMP
-        _evalQueueLock(),
-#endif // _OPENMP
+        _evalQueues(),
         _bbEval(0),
         _bbEvalFromCacheForRerun(0),
         _bbEvalNotOk(0),
@@ -416,9 +402,6 @@ public:
         _nbPhaseOneSuccess(0),
         _nbRevealingIter(0),
         _allDoneWithEval(false)
-#ifdef TIME_STATS
-        ,_evalTime(0.0)
-#endif // TIME_STATS
     {
         init();
         addEvaluator(evaluator);
@@ -517,11 +500,6 @@ public:
     size_t getNbRevealingIter() const {return  _nbRevealingIter; }
     void incrementNbRevealingIter();
 
-#ifdef TIME_STATS
-    /// Get the total time spend in Evaluator
-    double getEvalTime() const { return _evalTime; }
-#endif // TIME_STATS
-
     size_t getQueueSize(const int mainThreadNum = -1) const;
 
     bool getDoneWithEval(const int mainThreadNum) const;
@@ -681,6 +659,24 @@ public:
      */
     bool evalBlock(BlockForEval& block);
 
+    /// Process the results of a block evaluated by evalBlock().
+    /**
+     Update success types, stop reasons, stats and file outputs of the main
+     threads that generated the points. Then, clear the block.
+    \param block         The block of points evaluated -- \b IN/OUT.
+    \param evalBlockOk   The value returned by evalBlock() -- \b IN.
+     */
+    void processEvaluatedBlock(BlockForEval& block, const bool evalBlockOk);
+
+    /// Take a block from the queue of another main thread and evaluate it.
+    /**
+     Called by idle evaluation threads of \c mainThreadNum.
+     The block is evaluated only if the evaluation budget allows it.
+    \param mainThreadNum   The main thread of the idle evaluation thread -- \b IN.
+    \return                \c true if a block was stolen.
+     */
+    bool stealAndEvalBlock(const int mainThreadNum);
+
     /// Evaluates a single point.
     /**
      * Creates a block with a single point and evaluates it using EvaluatorControl::evalBlockOfPoints(). \n
@@ -825,6 +821,9 @@ private:
     /// History and Solution file output
     void addDirectToFileInfo(const EvalQueuePointPtr& evalQueuePoint) const;
 
+    /// Get the queue of a main thread
+    EvalQueue& getEvalQueue(const int mainThreadNum) const;
+
     /// Helper for sort
     std::shared_ptr<NOMAD::OrderByDirection> makeCompMethodOrderByDirection(const FHComputeType & computeType) const ;
 
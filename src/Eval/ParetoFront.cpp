@@ -0,0 +1,485 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   ParetoFront.cpp
+ * \brief  Dominance queries, updates and quality indicators on a lexicographically ordered Pareto front (implementation)
+ * \see    ParetoFront.hpp
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "../Eval/ParetoFront.hpp"
+#include "../Util/Exception.hpp"
+
+namespace {
+    typedef std::vector<std::pair<double, double>> Staircase;
+
+    // Area dominated by the 2D points of a staircase (first coordinate
+    // increasing, second one decreasing) and bounded by (xMax, yMax).
+    // Points that do not strictly dominate (xMax, yMax) are ignored.
+    double staircaseArea(const Staircase& points, const double xMax, const double yMax)
+    {
+        double area = 0.0;
+        const std::pair<double, double>* previous = nullptr;
+        for (const auto & point : points)
+        {
+            if (point.first >= xMax || point.second >= yMax)
+            {
+                continue;
+            }
+            if (nullptr != previous)
+            {
+                area += (point.first - previous->first) * (yMax - previous->second);
+            }
+            previous = &point;
+        }
+        if (nullptr != previous)
+        {
+            area += (xMax - previous->first) * (yMax - previous->second);
+        }
+        return area;
+    }
+
+    // Area gained by adding (x, y) to a staircase. yUpper is the second
+    // coordinate of the point before (x, y) (or the reference), xUpper is the
+    // first coordinate of the first point after the dominated ones (or the
+    // reference) and dominated are the points removed by (x, y).
+    double staircaseImprovement(const double x, const double y,
+                                const double xUpper, const double yUpper,
+                                const Staircase& dominated)
+    {
+        if (x >= xUpper || y >= yUpper)
+        {
+            return 0.0;
+        }
+        return (xUpper - x) * (yUpper - y) - staircaseArea(dominated, xUpper, yUpper);
+    }
+}
+
+
+bool NOMAD::ParetoFront::lexicographicalLess(const NOMAD::ArrayOfDouble& f1,
+                                             const NOMAD::ArrayOfDouble& f2)
+{
+    const size_t n = std::min(f1.size(), f2.size());
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double v1 = f1[i].todouble();
+        const double v2 = f2[i].todouble();
+        if (v1 < v2)
+        {
+            return true;
+        }
+        if (v2 < v1)
+        {
+            return false;
+        }
+    }
+    return (f1.size() < f2.size());
+}
+
+
+bool NOMAD::ParetoFront::dominates(const NOMAD::ArrayOfDouble& f1,
+                                   const NOMAD::ArrayOfDouble& f2)
+{
+    bool isBetter = false;
+    for (size_t i = 0; i < f1.size(); ++i)
+    {
+        const double v1 = f1[i].todouble();
+        const double v2 = f2[i].todouble();
+        if (v2 < v1)
+        {
+            return false;
+        }
+        if (v1 < v2)
+        {
+            isBetter = true;
+        }
+    }
+    return isBetter;
+}
+
+
+void NOMAD::ParetoFront::sort(std::vector<NOMAD::EvalPointPtr>& front) const
+{
+    std::sort(front.begin(), front.end(),
+              [this](const NOMAD::EvalPointPtr& evalPoint1, const NOMAD::EvalPointPtr& evalPoint2)->bool
+              {
+                  return lexicographicalLess(evalPoint1->getFs(_computeType), evalPoint2->getFs(_computeType));
+              });
+}
+
+
+NOMAD::ParetoFront::Comparison NOMAD::ParetoFront::compare(const std::vector<NOMAD::EvalPointPtr>& front,
+                                                           const NOMAD::ArrayOfDouble& f) const
+{
+    Comparison comparison;
+    comparison.compFlag = NOMAD::CompareType::INDIFFERENT;
+    comparison.dominatingInd = 0;
+
+    // Range of the points with objectives equal to f.
+    // The points before are lexicographically smaller than f, the points after are greater.
+    const auto itBegin = std::lower_bound(front.begin(), front.end(), f,
+                                          [this](const NOMAD::EvalPointPtr& evalPoint, const NOMAD::ArrayOfDouble& fs)->bool
+                                          {
+                                              return lexicographicalLess(evalPoint->getFs(_computeType), fs);
+                                          });
+    const auto itEnd = std::upper_bound(itBegin, front.end(), f,
+                                        [this](const NOMAD::ArrayOfDouble& fs, const NOMAD::EvalPointPtr& evalPoint)->bool
+                                        {
+                                            return lexicographicalLess(fs, evalPoint->getFs(_computeType));
+                                        });
+    comparison.equalBegin = std::distance(front.begin(), itBegin);
+    comparison.equalEnd = std::distance(front.begin(), itEnd);
+
+    if (2 == f.size())
+    {
+        // The second objective decreases along the front. The point just before
+        // f has the smallest second objective among the points before f.
+        if (comparison.equalBegin > 0)
+        {
+            const size_t ind = comparison.equalBegin - 1;
+            if (front[ind]->getFs(_computeType)[1].todouble() <= f[1].todouble())
+            {
+                comparison.compFlag = NOMAD::CompareType::DOMINATED;
+                comparison.dominatingInd = ind;
+                return comparison;
+            }
+        }
+        if (comparison.equalEnd > comparison.equalBegin)
+        {
+            comparison.compFlag = NOMAD::CompareType::EQUAL;
+            return comparison;
+        }
+        // The points after f with a second objective not better than f are dominated.
+        for (size_t ind = comparison.equalEnd; ind < front.size(); ++ind)
+        {
+            if (front[ind]->getFs(_computeType)[1].todouble() < f[1].todouble())
+            {
+                break;
+            }
+            comparison.dominatedInd.push_back(ind);
+        }
+    }
+    else
+    {
+        for (size_t ind = 0; ind < comparison.equalBegin; ++ind)
+        {
+            if (dominates(front[ind]->getFs(_computeType), f))
+            {
+                comparison.compFlag = NOMAD::CompareType::DOMINATED;
+                comparison.dominatingInd = ind;
+                return comparison;
+            }
+        }
+        if (comparison.equalEnd > comparison.equalBegin)
+        {
+            comparison.compFlag = NOMAD::CompareType::EQUAL;
+            return comparison;
+        }
+        for (size_t ind = comparison.equalEnd; ind < front.size(); ++ind)
+        {
+            if (dominates(f, front[ind]->getFs(_computeType)))
+            {
+                comparison.dominatedInd.push_back(ind);
+            }
+        }
+    }
+
+    if (!comparison.dominatedInd.empty())
+    {
+        comparison.compFlag = NOMAD::CompareType::DOMINATING;
+    }
+    return comparison;
+}
+
+
+void NOMAD::ParetoFront::insert(std::vector<NOMAD::EvalPointPtr>& front,
+                                const NOMAD::EvalPointPtr& evalPoint,
+                                const Comparison& comparison) const
+{
+    if (NOMAD::CompareType::DOMINATED == comparison.compFlag)
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "ParetoFront: cannot insert a dominated point");
+    }
+
+    // Remove the dominated points. They are all after the insertion index.
+    if (!comparison.dominatedInd.empty())
+    {
+        size_t k = 0;
+        size_t newSize = comparison.dominatedInd[0];
+        for (size_t ind = comparison.dominatedInd[0]; ind < front.size(); ++ind)
+        {
+            if (k < comparison.dominatedInd.size() && comparison.dominatedInd[k] == ind)
+            {
+                ++k;
+                continue;
+            }
+            front[newSize++] = std::move(front[ind]);
+        }
+        front.resize(newSize);
+    }
+
+    front.insert(front.begin() + comparison.equalEnd, evalPoint);
+}
+
+
+NOMAD::CompareType NOMAD::ParetoFront::compareAndInsert(std::vector<NOMAD::EvalPointPtr>& front,
+                                                        const NOMAD::EvalPointPtr& evalPoint) const
+{
+    const auto comparison = compare(front, evalPoint->getFs(_computeType));
+    if (NOMAD::CompareType::DOMINATED != comparison.compFlag)
+    {
+        insert(front, evalPoint, comparison);
+    }
+    return comparison.compFlag;
+}
+
+
+NOMAD::Double NOMAD::ParetoFront::hypervolume(const std::vector<NOMAD::EvalPointPtr>& front,
+                                              const NOMAD::ArrayOfDouble& ref) const
+{
+    const size_t nobj = ref.size();
+    if (nobj < 2 || nobj > 3 || !ref.isComplete())
+    {
+        return NOMAD::Double();
+    }
+
+    // Objective vectors that strictly dominate the reference point.
+    std::vector<std::vector<double>> points;
+    points.reserve(front.size());
+    for (const auto & evalPoint : front)
+    {
+        const auto& fs = evalPoint->getFs(_computeType);
+        if (fs.size() != nobj)
+        {
+            throw NOMAD::Exception(__FILE__, __LINE__, "ParetoFront: reference point and objectives have different sizes");
+        }
+        std::vector<double> f(nobj);
+        bool inside = true;
+        for (size_t i = 0; i < nobj && inside; ++i)
+        {
+            f[i] = fs[i].todouble();
+            inside = (f[i] < ref[i].todouble());
+        }
+        if (inside)
+        {
+            points.push_back(std::move(f));
+        }
+    }
+
+    if (2 == nobj)
+    {
+        // The front order is kept by the selection.
+        Staircase staircase;
+        staircase.reserve(points.size());
+        for (const auto & f : points)
+        {
+            staircase.emplace_back(f[0], f[1]);
+        }
+        return staircaseArea(staircase, ref[0].todouble(), ref[1].todouble());
+    }
+
+    // Dimension sweep on the third objective. The 2D front of the points
+    // already swept is a staircase sorted on the first objective, and its
+    // area is updated on each insertion.
+    std::sort(points.begin(), points.end(),
+              [](const std::vector<double>& f1, const std::vector<double>& f2)->bool
+              {
+                  return f1[2] < f2[2];
+              });
+    const double r0 = ref[0].todouble();
+    const double r1 = ref[1].todouble();
+    const double r2 = ref[2].todouble();
+
+    std::map<double, double> sweepFront;
+    Staircase dominated;
+    double area = 0.0;
+    double volume = 0.0;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        const double x = points[i][0];
+        const double y = points[i][1];
+
+        auto it = sweepFront.lower_bound(x);
+        const bool hasPrevious = (it != sweepFront.begin());
+        const double yUpper = hasPrevious ? std::prev(it)->second : r1;
+        const bool isDominated = (yUpper <= y)
+                                 || (it != sweepFront.end() && it->first == x && it->second <= y);
+        if (!isDominated)
+        {
+            dominated.clear();
+            while (it != sweepFront.end() && it->second >= y)
+            {
+                dominated.push_back(*it);
+                it = sweepFront.erase(it);
+            }
+            const double xUpper = (it != sweepFront.end()) ? it->first : r0;
+            area += staircaseImprovement(x, y, xUpper, yUpper, dominated);
+            sweepFront.emplace_hint(it, x, y);
+        }
+
+        const double zNext = (i + 1 < points.size()) ? points[i+1][2] : r2;
+        volume += area * (zNext - points[i][2]);
+    }
+
+    return volume;
+}
+
+
+NOMAD::Double NOMAD::ParetoFront::hypervolumeImprovement(const std::vector<NOMAD::EvalPointPtr>& front,
+                                                         const NOMAD::ArrayOfDouble& f,
+                                                         const Comparison& comparison,
+                                                         const NOMAD::ArrayOfDouble& ref) const
+{
+    if (2 != f.size() || 2 != ref.size())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "ParetoFront: hypervolume improvement is only available for 2 objectives");
+    }
+    if (NOMAD::CompareType::DOMINATED == comparison.compFlag
+        || NOMAD::CompareType::EQUAL == comparison.compFlag)
+    {
+        return 0.0;
+    }
+
+    // With 2 objectives, the dominated points follow f in the front, and the
+    // points before and after them bound the region gained by f.
+    double yUpper = ref[1].todouble();
+    if (comparison.equalBegin > 0)
+    {
+        yUpper = std::min(yUpper, front[comparison.equalBegin - 1]->getFs(_computeType)[1].todouble());
+    }
+    double xUpper = ref[0].todouble();
+    const size_t nextInd = comparison.equalEnd + comparison.dominatedInd.size();
+    if (nextInd < front.size())
+    {
+        xUpper = std::min(xUpper, front[nextInd]->getFs(_computeType)[0].todouble());
+    }
+
+    Staircase dominated;
+    dominated.reserve(comparison.dominatedInd.size());
+    for (const auto ind : comparison.dominatedInd)
+    {
+        const auto& fs = front[ind]->getFs(_computeType);
+        dominated.emplace_back(fs[0].todouble(), fs[1].todouble());
+    }
+
+    return staircaseImprovement(f[0].todouble(), f[1].todouble(), xUpper, yUpper, dominated);
+}
+
+
+NOMAD::Double NOMAD::ParetoFront::spacing(const std::vector<NOMAD::EvalPointPtr>& front) const
+{
+    const size_t nbPoints = front.size();
+    if (nbPoints < 2)
+    {
+        return NOMAD::Double();
+    }
+
+    // Objective vectors, contiguous.
+    const size_t nobj = front[0]->getFs(_computeType).size();
+    std::vector<double> fs(nbPoints * nobj);
+    for (size_t i = 0; i < nbPoints; ++i)
+    {
+        const auto& f = front[i]->getFs(_computeType);
+        for (size_t k = 0; k < nobj; ++k)
+        {
+            fs[i * nobj + k] = f[k].todouble();
+        }
+    }
+
+    auto l1Distance = [&fs, nobj](const size_t i, const size_t j)->double
+    {
+        double dist = 0.0;
+        for (size_t k = 0; k < nobj; ++k)
+        {
+            dist += std::fabs(fs[i * nobj + k] - fs[j * nobj + k]);
+        }
+        return dist;
+    };
+
+    // Distance of each point to its nearest neighbor.
+    std::vector<double> minDist(nbPoints, std::numeric_limits<double>::infinity());
+    if (2 == nobj)
+    {
+        // Along a 2 objectives front, the L1 distance increases with the
+        // distance in the order: the nearest neighbors are adjacent.
+        for (size_t i = 0; i + 1 < nbPoints; ++i)
+        {
+            const double dist = l1Distance(i, i + 1);
+            minDist[i] = std::min(minDist[i], dist);
+            minDist[i + 1] = dist;
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < nbPoints; ++i)
+        {
+            for (size_t j = i + 1; j < nbPoints; ++j)
+            {
+                const double dist = l1Distance(i, j);
+                minDist[i] = std::min(minDist[i], dist);
+                minDist[j] = std::min(minDist[j], dist);
+            }
+        }
+    }
+
+    double meanDist = 0.0;
+    for (const auto dist : minDist)
+    {
+        meanDist += dist;
+    }
+    meanDist /= static_cast<double>(nbPoints);
+
+    double sumSquares = 0.0;
+    for (const auto dist : minDist)
+    {
+        sumSquares += (dist - meanDist) * (dist - meanDist);
+    }
+    return std::sqrt(sumSquares / static_cast<double>(nbPoints - 1));
+}
@@ -0,0 +1,192 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ * \file   ParetoFront.hpp
+ * \brief  Dominance queries, updates and quality indicators on a lexicographically ordered Pareto front.
+ * \see    ParetoFront.cpp
+ */
+
+#ifndef __NOMAD_4_5_PARETOFRONT__
+#define __NOMAD_4_5_PARETOFRONT__
+
+#include <vector>
+
+#include "../Eval/EvalPoint.hpp"
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Dominance queries on a Pareto front approximation.
+/**
+ * The front is a vector of feasible eval points that do not dominate each
+ * other (points with equal objective vectors are allowed), ordered
+ * lexicographically on their objective vectors. The order is on the raw
+ * double values, as the dominance of Eval::compMO, so that the points that
+ * dominate an objective vector f are before f in the front and the points
+ * dominated by f are after f.
+ *
+ * With two objectives, the first objective increases and the second one
+ * decreases along the front. Finding if f is dominated is a binary search,
+ * and the points dominated by f are contiguous: a comparison costs
+ * O(log N + K), with K the number of dominated points.
+ *
+ * With more objectives, the position of f is found by binary search, then
+ * the points before f are only tested for dominating f, and the points after
+ * f for being dominated by f. This halves the tests of a pairwise comparison.
+ *
+ * The front is owned by the caller (see DMultiMadsBarrier, which keeps its
+ * feasible points in this order).
+ *
+ * The hypervolume and spacing indicators of the front are also provided.
+ * The hypervolume is the measure of the objective space dominated by the
+ * front and bounded by a reference point. With two objectives, it is a sweep
+ * along the ordered front, and the improvement brought by a new point is
+ * obtained from its comparison with the front, so that it can be maintained
+ * incrementally. With three objectives, it is computed by the dimension-sweep
+ * algorithm of Fonseca, Paquete and Lopez-Ibanez, in O(N log N).
+ */
+class DLL_EVAL_API ParetoFront
+{
+public:
+    /// Result of the comparison of an objective vector f with the front.
+    struct Comparison
+    {
+        CompareType         compFlag;       ///< DOMINATED, EQUAL, DOMINATING or INDIFFERENT, for f over the front
+        size_t              dominatingInd;  ///< Index of a point dominating f, when compFlag is DOMINATED
+        size_t              equalBegin;     ///< Range [equalBegin, equalEnd) of the points with objectives equal to f.
+        size_t              equalEnd;       ///< A point with objectives f is inserted at equalEnd.
+        std::vector<size_t> dominatedInd;   ///< Indices of the points dominated by f, in increasing order
+    };
+
+private:
+    FHComputeType _computeType;
+
+public:
+
+    /// Constructor
+    explicit ParetoFront(const FHComputeType& computeType)
+      : _computeType(computeType)
+    {}
+
+    /// Lexicographic order on raw double values.
+    static bool lexicographicalLess(const ArrayOfDouble& f1, const ArrayOfDouble& f2);
+
+    /// Sort points lexicographically on their objective vectors.
+    void sort(std::vector<EvalPointPtr>& front) const;
+
+    /// Compare an objective vector with the front.
+    /**
+     \param front   The front, ordered lexicographically -- \b IN.
+     \param f       The objective vector -- \b IN.
+     \return        The comparison of f over the front.
+     */
+    Comparison compare(const std::vector<EvalPointPtr>& front,
+                       const ArrayOfDouble& f) const;
+
+    /// Insert a point in the front and remove the points it dominates.
+    /**
+     \param front       The front, ordered lexicographically -- \b IN/OUT.
+     \param evalPoint   The point to insert -- \b IN.
+     \param comparison  The result of compare() for the point objectives. The front must not have changed since -- \b IN.
+     */
+    void insert(std::vector<EvalPointPtr>& front,
+                const EvalPointPtr& evalPoint,
+                const Comparison& comparison) const;
+
+    /// Compare the point with the front and insert it if it is not dominated.
+    /**
+     \return    The comparison flag of the point over the front.
+     */
+    CompareType compareAndInsert(std::vector<EvalPointPtr>& front,
+                                 const EvalPointPtr& evalPoint) const;
+
+    /// Hypervolume of the front.
+    /**
+     Only the points that strictly dominate the reference point contribute.
+     \param front   The front, ordered lexicographically -- \b IN.
+     \param ref     The reference point -- \b IN.
+     \return        The hypervolume. Undefined with more than 3 objectives.
+     */
+    Double hypervolume(const std::vector<EvalPointPtr>& front,
+                       const ArrayOfDouble& ref) const;
+
+    /// Hypervolume improvement of the front if a point is inserted (2 objectives only).
+    /**
+     The cost is O(K), with K the number of points dominated by f.
+     \param front       The front, ordered lexicographically -- \b IN.
+     \param f           The objective vector of the point to insert -- \b IN.
+     \param comparison  The result of compare() for f -- \b IN.
+     \param ref         The reference point -- \b IN.
+     \return            The hypervolume added by the insertion. Zero if f is dominated or equal to a point of the front.
+     */
+    Double hypervolumeImprovement(const std::vector<EvalPointPtr>& front,
+                                  const ArrayOfDouble& f,
+                                  const Comparison& comparison,
+                                  const ArrayOfDouble& ref) const;
+
+    /// Spacing of the front (Schott).
+    /**
+     Standard deviation of the L1 distances of each point to its nearest
+     neighbor in the front. Zero for uniformly spread points. The cost is
+     O(N) with 2 objectives (the nearest neighbors are adjacent in the front)
+     and O(N^2) otherwise.
+     \param front   The front, ordered lexicographically -- \b IN.
+     \return        The spacing. Undefined with less than 2 points.
+     */
+    Double spacing(const std::vector<EvalPointPtr>& front) const;
+
+private:
+    /// True if f1 <= f2 component-wise, with at least one strict inequality.
+    static bool dominates(const ArrayOfDouble& f1, const ArrayOfDouble& f2);
+
+};
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_PARETOFRONT__
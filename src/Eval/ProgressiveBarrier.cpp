@@ -80,7 +80,7 @@ void NOMAD::ProgressiveBarrier::init(const NOMAD::Point& fixedVariable,
         {
             for (const auto &evalPoint : cachePoints)
             {
-                NOMAD::EvalPointPtr evalPointSub = std::make_shared<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariable));
+                NOMAD::EvalPointPtr evalPointSub = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariable));
                 _xFeas.push_back(evalPointSub);
             }
             _incumbentsAndHMaxUpToDate = false;
@@ -92,7 +92,7 @@ void NOMAD::ProgressiveBarrier::init(const NOMAD::Point& fixedVariable,
                 // Points in progressive barrier must have h < INF.
                 if (evalPoint.getH(_computeType) < NOMAD::INF)
                 {
-                    NOMAD::EvalPointPtr evalPointSub = std::make_shared<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariable));
+                    NOMAD::EvalPointPtr evalPointSub = NOMAD::makeSharedFromPool<NOMAD::EvalPoint>( evalPoint.makeSubSpacePointFromFixed(fixedVariable));
                     _xInf.push_back(evalPointSub);
                 }
             }
@@ -267,7 +267,7 @@ bool NOMAD::ProgressiveBarrier::updateWithPoints(const std::vector<NOMAD::EvalPo
             s = "Point inserted in feasible barrier: " + evalPoint.display();
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
             OUTPUT_DEBUG_END
-            _xFeas.push_back(std::make_shared<NOMAD::EvalPoint>(evalPoint));
+            _xFeas.push_back(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint));
             updatedFeas = true;
 
         }
@@ -329,7 +329,7 @@ bool NOMAD::ProgressiveBarrier::updateWithPoints(const std::vector<NOMAD::EvalPo
             }
 
             updatedInf = true;
-            _xInf.push_back(std::make_shared<NOMAD::EvalPoint>(evalPoint));
+            _xInf.push_back(NOMAD::makeSharedFromPool<NOMAD::EvalPoint>(evalPoint));
             OUTPUT_DEBUG_START
             s = "Add in barrier xInf: " + evalPoint.display();
             NOMAD::OutputQueue::Add(s, NOMAD::OutputLevel::LEVEL_DEBUG);
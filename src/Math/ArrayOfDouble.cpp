@@ -52,6 +52,8 @@
  \see    ArrayOfDouble.hpp
  */
 #include "../Math/ArrayOfDouble.hpp"
+#include "../Util/MemoryPool.hpp"
+#include <new>      // For placement new
 #include <algorithm>
 #include <iomanip>  // For std::setprecision, std::setw
 
@@ -92,7 +94,7 @@ NOMAD::ArrayOfDouble::ArrayOfDouble(size_t n, const NOMAD::Double& d)
 {
     if (_n > 0)
     {
-        _array = new NOMAD::Double [_n];
+        _array = allocateArray(_n);
         if (d.isDefined())
         {
             std::fill (_array, _array + _n, d);
@@ -110,7 +112,7 @@ NOMAD::ArrayOfDouble::ArrayOfDouble(const std::vector<double> & v)
 {
     if (_n > 0)
     {
-        _array = new NOMAD::Double[_n];
+        _array = allocateArray(_n);
         for (size_t k = 0; k < _n; k++)
         {
             _array[k] = v[k];
@@ -132,7 +134,7 @@ NOMAD::ArrayOfDouble::ArrayOfDouble(const NOMAD::ArrayOfDouble &coord)
 {
     if (_n > 0)
     {
-        NOMAD::Double       * array1 =  _array = new NOMAD::Double [_n];
+        NOMAD::Double       * array1 =  _array = allocateArray(_n);
         const NOMAD::Double * array2 = coord._array;
         for (size_t k = 0; k < _n; ++k, ++array1, ++array2)
         {
@@ -147,7 +149,38 @@ NOMAD::ArrayOfDouble::ArrayOfDouble(const NOMAD::ArrayOfDouble &coord)
 /*-----------------------------------------------*/
 NOMAD::ArrayOfDouble::~ArrayOfDouble ()
 {
-    delete [] _array;
+    freeArray(_array, _n);
+}
+
+
+/*-----------------------------------------------------------*/
+/*  Allocation of the values, in the MemoryPool: the arrays  */
+/*  of the trial points all have the same size, and are      */
+/*  created and destroyed at each iteration.                 */
+/*-----------------------------------------------------------*/
+NOMAD::Double* NOMAD::ArrayOfDouble::allocateArray(size_t n)
+{
+    auto array = static_cast<NOMAD::Double*>(NOMAD::MemoryPool::allocate(n * sizeof(NOMAD::Double)));
+    for (size_t k = 0; k < n; ++k)
+    {
+        new (array + k) NOMAD::Double();
+    }
+
+    return array;
+}
+
+
+void NOMAD::ArrayOfDouble::freeArray(NOMAD::Double* array, size_t n)
+{
+    if (nullptr == array)
+    {
+        return;
+    }
+    for (size_t k = 0; k < n; ++k)
+    {
+        array[k].~Double();
+    }
+    NOMAD::MemoryPool::deallocate(array, n * sizeof(NOMAD::Double));
 }
 
 
@@ -159,15 +192,15 @@ void NOMAD::ArrayOfDouble::reset (size_t n, const NOMAD::Double &d)
 {
     if (n == 0)
     {
+        freeArray(_array, _n);
         _n = 0;
-        delete [] _array;
         _array = nullptr;
     }
     else
     {
+        freeArray(_array, _n);
         _n = n;
-        delete [] _array;
-        _array = new NOMAD::Double [_n];
+        _array = allocateArray(_n);
 
         if (d.isDefined())
         {
@@ -190,13 +223,13 @@ void NOMAD::ArrayOfDouble::resize(size_t n, const NOMAD::Double &d)
 
     if (n == 0)
     {
+        freeArray(_array, _n);
         _n = 0;
-        delete [] _array;
         _array = nullptr;
         return;
     }
 
-    auto newArray = new NOMAD::Double[n];
+    auto newArray = allocateArray(n);
     if (_array)
     {
         size_t min = ( n < _n ) ? n : _n;
@@ -213,7 +246,7 @@ void NOMAD::ArrayOfDouble::resize(size_t n, const NOMAD::Double &d)
             std::fill(newArray + min, newArray + n, d);
         }
 
-        delete [] _array;
+        freeArray(_array, _n);
     }
     _array  = newArray;
     _n      = n;
@@ -508,10 +541,17 @@ NOMAD::Double NOMAD::ArrayOfDouble::max() const
 /*----------------------------------------------------------*/
 const NOMAD::ArrayOfDouble & NOMAD::ArrayOfDouble::operator *= ( const NOMAD::Double & d )
 {
+    if (_n > 0 && !d.isDefined())
+    {
+        throw NOMAD::Double::NotDefined(__FILE__, __LINE__, "x *= d: d not defined");
+    }
+    verifyComplete(*this, "x *= d");
+
+    const double s = d._value;
     NOMAD::Double * p = _array;
     for (size_t k = 0 ; k < _n ; ++k , ++p)
     {
-        *p *= d;
+        p->_value *= s;
     }
 
     return *this;
@@ -541,6 +581,8 @@ NOMAD::ArrayOfDouble NOMAD::ArrayOfDouble::operator+(const NOMAD::ArrayOfDouble&
     {
         throw NOMAD::Exception(__FILE__,__LINE__, "x + y: x.size != y.size" );
     }
+    verifyComplete(p, "x + y");
+
     NOMAD::ArrayOfDouble          tmp ( _n );
     NOMAD::Double       * p1 = tmp._array;
     const NOMAD::Double * p2 =     _array;
@@ -548,7 +590,8 @@ NOMAD::ArrayOfDouble NOMAD::ArrayOfDouble::operator+(const NOMAD::ArrayOfDouble&
 
     for (size_t k = 0 ; k < _n ; ++k , ++p1 , ++p2 , ++p3)
     {
-        *p1 = *p2 + *p3;
+        p1->_value   = p2->_value + p3->_value;
+        p1->_defined = true;
     }
 
     return tmp;
@@ -564,6 +607,8 @@ NOMAD::ArrayOfDouble NOMAD::ArrayOfDouble::operator-(const NOMAD::ArrayOfDouble&
     {
         throw NOMAD::Exception(__FILE__,__LINE__, "x - y: x.size != y.size" );
     }
+    verifyComplete(p, "x - y");
+
     NOMAD::ArrayOfDouble          tmp ( _n );
     NOMAD::Double       * p1 = tmp._array;
     const NOMAD::Double * p2 =     _array;
@@ -571,7 +616,8 @@ NOMAD::ArrayOfDouble NOMAD::ArrayOfDouble::operator-(const NOMAD::ArrayOfDouble&
 
     for (size_t k = 0 ; k < _n ; ++k , ++p1 , ++p2 , ++p3)
     {
-        *p1 = *p2 - *p3;
+        p1->_value   = p2->_value - p3->_value;
+        p1->_defined = true;
     }
 
     return tmp;
@@ -632,11 +678,11 @@ NOMAD::ArrayOfDouble& NOMAD::ArrayOfDouble::operator= (const NOMAD::ArrayOfDoubl
 
     if (_n != arrayOfDouble._n)
     {
-        delete [] _array;
+        freeArray(_array, _n);
         _n = arrayOfDouble._n;
         if (_n > 0)
         {
-            _array = new NOMAD::Double [_n];
+            _array = allocateArray(_n);
         }
         else
         {
@@ -703,9 +749,9 @@ void NOMAD::ArrayOfDouble::set(size_t n, const NOMAD::Double *a)
 
     if (_n != n)
     {
-        delete [] _array;
+        freeArray(_array, _n);
         _n      = n;
-        _array = new NOMAD::Double [_n];
+        _array = allocateArray(_n);
     }
 
     NOMAD::Double* array = _array;
@@ -828,11 +874,13 @@ bool NOMAD::ArrayOfDouble::operator== (const NOMAD::ArrayOfDouble &arrayOfDouble
         return false;
     }
 
+    const double eps = NOMAD::Double::getEpsilon();
     const NOMAD::Double * array1 = _array;
     const NOMAD::Double * array2 = arrayOfDouble._array;
     for (size_t k = 0; k < _n; ++k, ++array1, ++array2)
     {
-        if (!array1->isDefined() || !array2->isDefined() || *array1 != *array2)
+        if (!array1->_defined || !array2->_defined
+            || !(fabs(array1->_value - array2->_value) < eps))
         {
             return false;
         }
@@ -883,20 +931,25 @@ void NOMAD::ArrayOfDouble::compare(const NOMAD::ArrayOfDouble& arrayOfDouble,
 {
     verifySizesMatch(_n, arrayOfDouble._n, __FILE__, __LINE__);
 
+    const double eps = NOMAD::Double::getEpsilon();
+    const NOMAD::Double * array1 = _array;
+    const NOMAD::Double * array2 = arrayOfDouble._array;
+
     isInferior = true;
     isStrictlyInferior = false;
-    for (size_t i = 0; isInferior && i < _n; i++)
+    for (size_t i = 0; isInferior && i < _n; ++i, ++array1, ++array2)
     {
-        if (!_array[i].isDefined() || !arrayOfDouble[i].isDefined())
+        if (!array1->_defined || !array2->_defined)
         {
             throw NOMAD::Exception(__FILE__, __LINE__,
                                    "ArrayOfDouble comparison operator: Undefined value in array");
         }
-        if (_array[i] < arrayOfDouble[i])
+        // Same epsilon-aware comparisons as Double::operator< and Double::operator>.
+        if (array1->_value < array2->_value - eps)
         {
             isStrictlyInferior = true;
         }
-        else if (_array[i] > arrayOfDouble[i])
+        else if (array1->_value > array2->_value + eps)
         {
             isInferior = false;
         }
@@ -905,6 +958,50 @@ void NOMAD::ArrayOfDouble::compare(const NOMAD::ArrayOfDouble& arrayOfDouble,
 }
 
 
+/*-------------------------------------------------------------------*/
+/* Helper functions on the raw values of complete arrays of the same */
+/* size. The caller verifies the sizes and the definedness.          */
+/*-------------------------------------------------------------------*/
+double NOMAD::ArrayOfDouble::dotValues(const NOMAD::ArrayOfDouble& aod) const
+{
+    const NOMAD::Double * array1 = _array;
+    const NOMAD::Double * array2 = aod._array;
+    double dot = 0.0;
+    for (size_t k = 0; k < _n; ++k, ++array1, ++array2)
+    {
+        dot += array1->_value * array2->_value;
+    }
+
+    return dot;
+}
+
+
+double NOMAD::ArrayOfDouble::squaredDistValues(const NOMAD::ArrayOfDouble& aod) const
+{
+    const NOMAD::Double * array1 = _array;
+    const NOMAD::Double * array2 = aod._array;
+    double sqDist = 0.0;
+    for (size_t k = 0; k < _n; ++k, ++array1, ++array2)
+    {
+        const double diff = array2->_value - array1->_value;
+        sqDist += diff * diff;
+    }
+
+    return sqDist;
+}
+
+
+void NOMAD::ArrayOfDouble::verifyComplete(const NOMAD::ArrayOfDouble& aod,
+                                          const std::string& opStr) const
+{
+    // Empty arrays are not complete, but there is nothing to compute.
+    if (_n > 0 && (!isComplete() || !aod.isComplete()))
+    {
+        throw NOMAD::Double::NotDefined(__FILE__, __LINE__, opStr + ": undefined value in array");
+    }
+}
+
+
 /*---------------------------------------------------------------------------------*/
 /* Comparison function 'lexicographical_tmp': it is used to sort objective vectors */
 /* into the barrier                                                                */
@@ -330,6 +330,12 @@ public:
 protected:
     //
 
+    /// Allocate an array of n undefined values.
+    static Double* allocateArray(size_t n);
+
+    /// Free an array given by allocateArray().
+    static void freeArray(Double* array, size_t n);
+
     /// Helper function to verify that n1 == n2
     void verifySizesMatch(size_t n1, size_t n2, const std::string& filename, size_t linenum) const;
 
@@ -343,6 +349,24 @@ protected:
                  bool &isInf,
                  bool &isStrictInf) const;
 
+    /// Helper functions working on the raw values of two arrays.
+    /**
+     * The arrays must be of the same size and complete: the caller verifies
+       it once, using isComplete(), and the loops then run on plain doubles,
+       without any check nor temporary Double.
+     * The sums are accumulated in the order of the indices, so the results
+       are exactly those of the loops on Double.
+     */
+    double dotValues(const ArrayOfDouble& aod) const;
+    double squaredDistValues(const ArrayOfDouble& aod) const;
+
+    /// Throw a Double::NotDefined exception if an array is not complete.
+    /**
+     \param aod       Other array of the operation -- \b IN.
+     \param opStr     Operation, for the error message -- \b IN.
+     */
+    void verifyComplete(const ArrayOfDouble& aod, const std::string& opStr) const;
+
 };
 
 
@@ -89,14 +89,9 @@ const NOMAD::Direction& NOMAD::Direction::operator-=(const Direction& dir1)
 /*------------------------------------------------------*/
 NOMAD::Double NOMAD::Direction::squaredL2Norm() const
 {
-    NOMAD::Double sqL2 = 0;
+    verifyComplete(*this, "squaredL2Norm");
 
-    for (size_t i = 0; i < size(); i++)
-    {
-        sqL2 += _array[i] * _array[i];
-    }
-
-    return sqL2;
+    return dotValues(*this);
 }
 
 
@@ -143,8 +138,6 @@ NOMAD::Double NOMAD::Direction::infiniteNorm() const
 NOMAD::Double NOMAD::Direction::dotProduct(const NOMAD::Direction& dir1,
                                            const NOMAD::Direction& dir2)
 {
-    NOMAD::Double dot = 0.0;
-
     size_t size = dir1.size();
     if (size != dir2.size())
     {
@@ -154,12 +147,9 @@ NOMAD::Double NOMAD::Direction::dotProduct(const NOMAD::Direction& dir1,
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 
-    for (size_t i = 0; i < size; i++)
-    {
-        dot += dir1[i] * dir2[i];
-    }
+    dir1.verifyComplete(dir2, "Dot product");
 
-    return dot;
+    return dir1.dotValues(dir2);
 }
 
 
@@ -81,6 +81,9 @@
         static std::string _infStr;     ///< Infinity string.
         static std::string _undefStr;   ///< Undefined value string.
 
+        /// The kernels of ArrayOfDouble work directly on the values, once their definedness is verified.
+        friend class ArrayOfDouble;
+
     public:
 
         /*-------------------------------------------------------------------*/
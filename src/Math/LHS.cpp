@@ -54,6 +54,7 @@
 
 
 // Constructor
+// Bounds are completed and verified by SpaceFillingDesign.
 NOMAD::LHS::LHS(const size_t n,
                 const size_t p,
                 const NOMAD::ArrayOfDouble& lowerBound,
@@ -61,83 +62,66 @@ NOMAD::LHS::LHS(const size_t n,
                 const NOMAD::Point& frameCenter,
                 const NOMAD::ArrayOfDouble& deltaFrameSize,
                 const NOMAD::Double& scaleFactor)
-:   _n(n),
-    _p(p),
-    _lowerBound(lowerBound),
-    _upperBound(upperBound)
+:   NOMAD::SpaceFillingDesign(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor),
+    _Pi()
 {
-    // Update undefined values of lower and upper bounds to use values based
-    // on deltaFrameSize.
-    // Based on the code in NOMAD 3, but slightly different.
-    // Do not use INF values for bounds, that will generate points with huge
-    // values. It is not elegant.
-    if (frameCenter.isComplete() && deltaFrameSize.isComplete() && scaleFactor.isDefined())
-    {
-        for (size_t i = 0; i < n; i++)
-        {
-            if (!_lowerBound[i].isDefined())
-            {
-                _lowerBound[i] = frameCenter[i] - 10.0 * deltaFrameSize[i] * scaleFactor;
-            }
-            if (!_upperBound[i].isDefined())
-            {
-                _upperBound[i] = frameCenter[i] + 10.0 * deltaFrameSize[i] * scaleFactor;
-            }
-        }
-    }
-
-    if (!_lowerBound.isComplete())
-    {
-        std::string s = "LHS Lower bound needs to be completely defined. Values given: ";
-        s += lowerBound.display();
-        throw NOMAD::Exception(__FILE__, __LINE__, s);
-    }
-    if (!_upperBound.isComplete())
-    {
-        std::string s = "LHS Upper bound needs to be completely defined. Values given: ";
-        s += upperBound.display();
-        throw NOMAD::Exception(__FILE__, __LINE__, s);
-    }
 }
 
 
 // Do the sample
-// Audet & Hare Algorithm 3.9 Latin Hypercube Sampling
 std::vector<NOMAD::Point> NOMAD::LHS::Sample() const
 {
     std::vector<NOMAD::Point> samplepoints;
+    samplepoints.reserve(_p);
 
+    NOMAD::LHS lhs(_n, _p, _lowerBound, _upperBound);
+    while (lhs.hasNext())
+    {
+        samplepoints.push_back(lhs.next());
+    }
+
+    return samplepoints;
+}
+
+
+// Audet & Hare Algorithm 3.9 Latin Hypercube Sampling
+NOMAD::Point NOMAD::LHS::nextImp()
+{
     // 0 - Initialization
     // Let Pi be a n x p matrix in which each of its n rows
     // is a random permutation of the vector (1, 2, .., p).
     //
-    std::vector<std::vector<size_t>> Pi;
-    for (size_t i = 0; i < _n; i++)
+    if (_Pi.empty())
     {
-        std::vector<size_t> v = Permutation(_p);
-        Pi.push_back(v);
+        computePermutations();
     }
 
-    // 1 - Sample construction
-    for (size_t j = 0; j < _p; j++)
+    // 1 - Sample construction: point j of the sample
+    const size_t j = _nbGenerated;
+    const NOMAD::Double pdouble( (double)_p );
+    NOMAD::Point point(_n);
+    for (size_t i = 0; i < _n; i++)
     {
-        NOMAD::Point point(_n);
-        for (size_t i = 0; i < _n; i++)
-        {
-            NOMAD::Double r_ij = RNG::rand(0,1);
-            NOMAD::Double l_i = _lowerBound[i];
-            NOMAD::Double Pi_ij( (double)Pi[i][j] );
-            NOMAD::Double pdouble( (double)_p );
-            NOMAD::Double u_i( _upperBound[i] );
-
-            NOMAD::Double x_ij = l_i + (Pi_ij - r_ij) / pdouble * (u_i - l_i);
-            point[i] = x_ij;
+        NOMAD::Double r_ij = RNG::rand(0,1);
+        const NOMAD::Double& l_i = _lowerBound[i];
+        NOMAD::Double Pi_ij( (double)_Pi[i][j] );
+        const NOMAD::Double& u_i = _upperBound[i];
 
-        }
-        samplepoints.push_back(point);
+        point[i] = l_i + (Pi_ij - r_ij) / pdouble * (u_i - l_i);
     }
 
-    return samplepoints;
+    return point;
+}
+
+
+void NOMAD::LHS::computePermutations()
+{
+    _Pi.clear();
+    _Pi.reserve(_n);
+    for (size_t i = 0; i < _n; i++)
+    {
+        _Pi.push_back(Permutation(_p));
+    }
 }
 
 
@@ -156,3 +140,96 @@ std::vector<size_t> NOMAD::LHS::Permutation(const size_t p)
 
     return v;
 }
+
+
+namespace {
+
+    // Term of the phi_p criterion for a squared distance d2 between two points, with p = 20.
+    // The levels are integers, so d2 >= 1 for distinct points and the terms do not overflow.
+    inline double phiTerm(const double d2)
+    {
+        const double t = 1.0 / d2;
+        const double t2 = t * t;
+        const double t4 = t2 * t2;
+        return t4 * t4 * t2;   // d^-20
+    }
+
+    // Budget of the optimization, in number of distance updates.
+    const size_t MAXIMIN_LHS_MAX_UPDATES = 50000000;
+
+}
+
+
+// Morris and Mitchell (1995), with the incremental distance update of
+// Jin, Chen and Sudjianto (2005).
+void NOMAD::MaximinLHS::computePermutations()
+{
+    NOMAD::LHS::computePermutations();
+
+    const size_t p = _p;
+    if (p < 3 || _n < 2 || p > MAX_NB_POINTS)
+    {
+        // Nothing to optimize (a single permutation, or too few points),
+        // or too many points: keep the random LHS.
+        return;
+    }
+
+    // Squared distances between points, in number of levels.
+    std::vector<double> d2(p * p, 0.0);
+    for (size_t a = 0; a < p; a++)
+    {
+        for (size_t b = a + 1; b < p; b++)
+        {
+            double s = 0.0;
+            for (size_t i = 0; i < _n; i++)
+            {
+                const double diff = (double)_Pi[i][a] - (double)_Pi[i][b];
+                s += diff * diff;
+            }
+            d2[a * p + b] = d2[b * p + a] = s;
+        }
+    }
+
+    // Random exchanges. Each trial costs 2p distance updates.
+    const size_t nbTrials = std::min(20 * _n * p, MAXIMIN_LHS_MAX_UPDATES / (2 * p));
+    std::vector<double> newD2a(p), newD2b(p);
+    for (size_t trial = 0; trial < nbTrials; trial++)
+    {
+        const size_t i = NOMAD::RNG::rand() % _n;
+        const size_t a = NOMAD::RNG::rand() % p;
+        const size_t b = (a + 1 + NOMAD::RNG::rand() % (p - 1)) % p;
+        const double la = (double)_Pi[i][a];
+        const double lb = (double)_Pi[i][b];
+
+        // Variation of the criterion if the levels of a and b are exchanged
+        // in coordinate i. The distance between a and b does not change.
+        double delta = 0.0;
+        for (size_t k = 0; k < p; k++)
+        {
+            if (k == a || k == b)
+            {
+                continue;
+            }
+            const double lk = (double)_Pi[i][k];
+            const double change = (lb - lk) * (lb - lk) - (la - lk) * (la - lk);
+            newD2a[k] = d2[a * p + k] + change;
+            newD2b[k] = d2[b * p + k] - change;
+            delta += phiTerm(newD2a[k]) - phiTerm(d2[a * p + k])
+                   + phiTerm(newD2b[k]) - phiTerm(d2[b * p + k]);
+        }
+
+        if (delta < 0.0)
+        {
+            std::swap(_Pi[i][a], _Pi[i][b]);
+            for (size_t k = 0; k < p; k++)
+            {
+                if (k == a || k == b)
+                {
+                    continue;
+                }
+                d2[a * p + k] = d2[k * p + a] = newD2a[k];
+                d2[b * p + k] = d2[k * p + b] = newD2b[k];
+            }
+        }
+    }
+}
@@ -49,7 +49,7 @@
 #define __NOMAD_4_5_LHS__
 
 #include <vector>
-#include "../Math/Point.hpp"
+#include "../Math/SpaceFillingDesign.hpp"
 using namespace std;
 
 #include "../nomad_nsbegin.hpp"
@@ -66,13 +66,11 @@ using namespace std;
  * Output:
  *  p points of dimension n, distributed in the l x u hyper-rectangle of R^n
  */
-class DLL_UTIL_API LHS
+class DLL_UTIL_API LHS : public SpaceFillingDesign
 {
-private:
-    size_t _n;  ///< dimension
-    size_t _p;  ///< number of samples
-    ArrayOfDouble    _lowerBound; ///< lower bounds
-    ArrayOfDouble    _upperBound; ///< upper bounds
+protected:
+    /// n x p matrix in which each row is a random permutation of (1, 2, .., p). Computed by the first call to next().
+    std::vector<std::vector<size_t>> _Pi;
 
 public:
     /// Constructor
@@ -93,32 +91,9 @@ public:
                  const NOMAD::ArrayOfDouble& deltaFrameSize = NOMAD::ArrayOfDouble(),
                  const NOMAD::Double& scaleFactor = NOMAD::Double());
 
-    /// Get lower bound
-    /**
-     \return Lower bound as \c ArrayOfDouble.
-     */
-    ArrayOfDouble getLowerBound() const                  { return _lowerBound; }
-
-    /// Set lower bound
-    /**
-     \param lowerBound  An \c ArrayOfDouble for lower bound -- \b IN.
-     */
-    void setLowerBound(const ArrayOfDouble& lowerBound)   { _lowerBound = lowerBound; }
-
-    /// Get upper bound
-    /**
-     \return Upper bound as \c ArrayOfDouble.
-     */
-    ArrayOfDouble    getUpperBound(void) const           { return _upperBound; }
-
-    /// Set upper bound
-    /**
-     \param upperBound  An \c ArrayOfDouble for upper bound -- \b IN.
-     */
-    void setUpperBound(const ArrayOfDouble& upperBound)   { _upperBound = upperBound; }
-
     /// Do the sampling
     /**
+     The points are those of a new sample. This LHS is not modified.
      \return A vector \c Points.
      */
     std::vector<Point> Sample() const;
@@ -129,6 +104,46 @@ public:
      \return    Vector of positive integers
      */
     static std::vector<size_t> Permutation(const size_t p);
+
+protected:
+    /// Generate the next point of the sample
+    Point nextImp() override;
+
+    /// Compute the permutations _Pi
+    virtual void computePermutations();
+};
+
+
+/// \brief Maximin Latin Hypercube Sampling class.
+/**
+ A random Latin hypercube is improved by exchanging the levels of two points
+ in one coordinate. An exchange is kept when it decreases the phi_p criterion
+ of Morris and Mitchell, a smooth version of the maximin distance criterion.
+ Only the distances to the two exchanged points change: they are updated
+ incrementally in O(p).
+
+ Designs of more than MAX_NB_POINTS points are not optimized, because the
+ p x p matrix of squared distances would be too large.
+ */
+class DLL_UTIL_API MaximinLHS : public LHS
+{
+public:
+    static const size_t MAX_NB_POINTS = 2000; ///< Larger designs are not optimized
+
+    /// Constructor. Same arguments as LHS.
+    explicit MaximinLHS(const size_t n,
+                        const size_t p,
+                        const ArrayOfDouble& lowerBound,
+                        const ArrayOfDouble& upperBound,
+                        const NOMAD::Point& frameCenter = NOMAD::Point(),
+                        const NOMAD::ArrayOfDouble& deltaFrameSize = NOMAD::ArrayOfDouble(),
+                        const NOMAD::Double& scaleFactor = NOMAD::Double())
+      : LHS(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor)
+    {}
+
+protected:
+    /// Compute random permutations, then optimize them
+    void computePermutations() override;
 };
 
 #include "../nomad_nsend.hpp"
@@ -0,0 +1,360 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include "../Math/LowDiscrepancySequence.hpp"
+#include "../Math/RNG.hpp"
+#include "../Util/Exception.hpp"
+
+#include <limits>
+
+
+namespace {
+
+    // Multiplication of two polynomials over GF(2) modulo poly, of degree deg.
+    uint64_t gf2MulMod(uint64_t a, uint64_t b, const uint64_t poly, const size_t deg)
+    {
+        const uint64_t high = (uint64_t)1 << deg;
+        uint64_t result = 0;
+        while (b > 0)
+        {
+            if (b & 1)
+            {
+                result ^= a;
+            }
+            b >>= 1;
+            a <<= 1;
+            if (a & high)
+            {
+                a ^= poly;
+            }
+        }
+        return result;
+    }
+
+    uint64_t gf2PowMod(uint64_t a, uint64_t e, const uint64_t poly, const size_t deg)
+    {
+        uint64_t result = 1;
+        while (e > 0)
+        {
+            if (e & 1)
+            {
+                result = gf2MulMod(result, a, poly, deg);
+            }
+            a = gf2MulMod(a, a, poly, deg);
+            e >>= 1;
+        }
+        return result;
+    }
+
+    // A polynomial of degree deg is primitive if x has order 2^deg - 1
+    // in GF(2)[x] / poly.
+    bool isPrimitive(const uint64_t poly, const size_t deg, const std::vector<uint64_t>& primeFactors)
+    {
+        const uint64_t order = ((uint64_t)1 << deg) - 1;
+        uint64_t x = 2;
+        if (x & ((uint64_t)1 << deg))
+        {
+            x ^= poly;
+        }
+        if (gf2PowMod(x, order, poly, deg) != 1)
+        {
+            return false;
+        }
+        for (const auto q : primeFactors)
+        {
+            if (gf2PowMod(x, order / q, poly, deg) == 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<uint64_t> primeFactors(uint64_t m)
+    {
+        std::vector<uint64_t> factors;
+        for (uint64_t q = 2; q * q <= m; q++)
+        {
+            if (m % q == 0)
+            {
+                factors.push_back(q);
+                while (m % q == 0)
+                {
+                    m /= q;
+                }
+            }
+        }
+        if (m > 1)
+        {
+            factors.push_back(m);
+        }
+        return factors;
+    }
+
+    uint32_t parity(uint32_t v)
+    {
+        v ^= v >> 16;
+        v ^= v >> 8;
+        v ^= v >> 4;
+        v ^= v >> 2;
+        v ^= v >> 1;
+        return v & 1;
+    }
+
+}
+
+
+/*----------------------------------------*/
+/*              Sobol sequence            */
+/*----------------------------------------*/
+NOMAD::SobolSequence::SobolSequence(const size_t n,
+                                    const size_t p,
+                                    const NOMAD::ArrayOfDouble& lowerBound,
+                                    const NOMAD::ArrayOfDouble& upperBound,
+                                    const NOMAD::Point& frameCenter,
+                                    const NOMAD::ArrayOfDouble& deltaFrameSize,
+                                    const NOMAD::Double& scaleFactor)
+:   NOMAD::SpaceFillingDesign(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor),
+    _directions(),
+    _x()
+{
+    if (p > std::numeric_limits<uint32_t>::max())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Sobol sequence: the number of points must be less than 2^32.");
+    }
+    init();
+}
+
+
+void NOMAD::SobolSequence::init()
+{
+    _directions.assign(_n * NB_BITS, 0);
+    _x.assign(_n, 0);
+
+    // Primitive polynomials for coordinates 1 to n-1, as (polynomial, degree).
+    // Bit deg and bit 0 are set. Bit deg-j holds coefficient a_j.
+    std::vector<std::pair<uint64_t, size_t>> polynomials;
+    for (size_t deg = 1; polynomials.size() + 1 < _n; deg++)
+    {
+        if (deg > NB_BITS)
+        {
+            throw NOMAD::Exception(__FILE__, __LINE__, "Sobol sequence: dimension too large.");
+        }
+        const auto factors = primeFactors(((uint64_t)1 << deg) - 1);
+        for (uint64_t poly = ((uint64_t)1 << deg) | 1; poly < ((uint64_t)1 << (deg + 1)) && polynomials.size() + 1 < _n; poly += 2)
+        {
+            if (isPrimitive(poly, deg, factors))
+            {
+                polynomials.push_back(std::make_pair(poly, deg));
+            }
+        }
+    }
+
+    for (size_t i = 0; i < _n; i++)
+    {
+        uint32_t* v = &_directions[i * NB_BITS];    // v[k-1] is direction number k
+        if (0 == i)
+        {
+            // van der Corput
+            for (size_t k = 1; k <= NB_BITS; k++)
+            {
+                v[k-1] = (uint32_t)1 << (NB_BITS - k);
+            }
+        }
+        else
+        {
+            const uint64_t poly = polynomials[i-1].first;
+            const size_t s = polynomials[i-1].second;
+            for (size_t k = 1; k <= NB_BITS; k++)
+            {
+                if (k <= s)
+                {
+                    // Random odd m_k < 2^k
+                    const uint32_t mk = ((NOMAD::RNG::rand() % ((uint32_t)1 << (k-1))) << 1) | 1;
+                    v[k-1] = mk << (NB_BITS - k);
+                }
+                else
+                {
+                    // Bratley and Fox recurrence
+                    uint32_t vk = v[k-s-1] ^ (v[k-s-1] >> s);
+                    for (size_t j = 1; j < s; j++)
+                    {
+                        if ((poly >> (s - j)) & 1)
+                        {
+                            vk ^= v[k-j-1];
+                        }
+                    }
+                    v[k-1] = vk;
+                }
+            }
+        }
+
+        // Linear matrix scrambling: digit r of the scrambled numbers is digit r
+        // plus a random combination of the previous digits.
+        uint32_t rows[NB_BITS];
+        for (size_t r = 0; r < NB_BITS; r++)
+        {
+            const uint32_t previousDigits = (0 == r) ? 0 : ~(((uint32_t)1 << (NB_BITS - r)) - 1);
+            rows[r] = (NOMAD::RNG::rand() & previousDigits) | ((uint32_t)1 << (NB_BITS - 1 - r));
+        }
+        for (size_t k = 0; k < NB_BITS; k++)
+        {
+            uint32_t scrambled = 0;
+            for (size_t r = 0; r < NB_BITS; r++)
+            {
+                scrambled |= parity(rows[r] & v[k]) << (NB_BITS - 1 - r);
+            }
+            v[k] = scrambled;
+        }
+
+        // Random digital shift of the first point
+        _x[i] = NOMAD::RNG::rand();
+    }
+}
+
+
+NOMAD::Point NOMAD::SobolSequence::nextImp()
+{
+    // Current point, in the middle of its cell of width 2^-NB_BITS.
+    std::vector<double> t(_n);
+    const double scale = 1.0 / 4294967296.0;
+    for (size_t i = 0; i < _n; i++)
+    {
+        t[i] = ((double)_x[i] + 0.5) * scale;
+    }
+
+    // Gray code update: the next point differs by the direction number of
+    // the lowest zero bit of the current index.
+    uint32_t index = (uint32_t)_nbGenerated;
+    size_t c = 0;
+    while (index & 1)
+    {
+        index >>= 1;
+        c++;
+    }
+    if (c < NB_BITS)
+    {
+        for (size_t i = 0; i < _n; i++)
+        {
+            _x[i] ^= _directions[i * NB_BITS + c];
+        }
+    }
+
+    return scaleToBounds(t);
+}
+
+
+/*----------------------------------------*/
+/*             Halton sequence            */
+/*----------------------------------------*/
+NOMAD::HaltonSequence::HaltonSequence(const size_t n,
+                                      const size_t p,
+                                      const NOMAD::ArrayOfDouble& lowerBound,
+                                      const NOMAD::ArrayOfDouble& upperBound,
+                                      const NOMAD::Point& frameCenter,
+                                      const NOMAD::ArrayOfDouble& deltaFrameSize,
+                                      const NOMAD::Double& scaleFactor)
+:   NOMAD::SpaceFillingDesign(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor),
+    _bases(),
+    _multipliers()
+{
+    init();
+}
+
+
+void NOMAD::HaltonSequence::init()
+{
+    _bases.reserve(_n);
+    _multipliers.reserve(_n);
+    for (uint64_t candidate = 2; _bases.size() < _n; candidate++)
+    {
+        bool isPrime = true;
+        for (const auto b : _bases)
+        {
+            if (b * b > candidate)
+            {
+                break;
+            }
+            if (candidate % b == 0)
+            {
+                isPrime = false;
+                break;
+            }
+        }
+        if (isPrime)
+        {
+            _bases.push_back(candidate);
+            // Base 2 has a single nonzero digit: no scrambling possible.
+            _multipliers.push_back(1 + NOMAD::RNG::rand() % (candidate - 1));
+        }
+    }
+}
+
+
+NOMAD::Point NOMAD::HaltonSequence::nextImp()
+{
+    // Skip index 0, which is the lower corner for all coordinates.
+    const uint64_t index = _nbGenerated + 1;
+
+    std::vector<double> t(_n);
+    for (size_t i = 0; i < _n; i++)
+    {
+        const uint64_t b = _bases[i];
+        const double invBase = 1.0 / (double)b;
+        double factor = invBase;
+        double value = 0.0;
+        for (uint64_t k = index; k > 0; k /= b)
+        {
+            const uint64_t digit = (_multipliers[i] * (k % b)) % b;
+            value += (double)digit * factor;
+            factor *= invBase;
+        }
+        t[i] = value;
+    }
+
+    return scaleToBounds(t);
+}
@@ -0,0 +1,138 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   LowDiscrepancySequence.hpp
+ \brief  Scrambled Sobol and Halton sequences
+ \see    LowDiscrepancySequence.cpp
+ */
+
+#ifndef __NOMAD_4_5_LOW_DISCREPANCY_SEQUENCE__
+#define __NOMAD_4_5_LOW_DISCREPANCY_SEQUENCE__
+
+#include <cstdint>
+#include <vector>
+#include "../Math/SpaceFillingDesign.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// \brief Scrambled Sobol sequence.
+/**
+ The first coordinate uses the van der Corput sequence in base 2. The other
+ coordinates use primitive polynomials over GF(2), enumerated by increasing
+ degree, with random odd initial direction numbers. The direction numbers are
+ scrambled by a random linear matrix (Matousek) and the points by a random
+ digital shift.
+
+ The points are generated in Gray code order: each point costs O(n), and only
+ the current point is stored.
+ */
+class DLL_UTIL_API SobolSequence : public SpaceFillingDesign
+{
+private:
+    static const size_t NB_BITS = 32;   ///< Number of bits of the direction numbers
+
+    std::vector<uint32_t> _directions;  ///< n x NB_BITS scrambled direction numbers
+    std::vector<uint32_t> _x;           ///< Current point, as integers in [0, 2^NB_BITS)
+
+public:
+    /// Constructor. Same arguments as SpaceFillingDesign.
+    explicit SobolSequence(const size_t n,
+                           const size_t p,
+                           const ArrayOfDouble& lowerBound,
+                           const ArrayOfDouble& upperBound,
+                           const NOMAD::Point& frameCenter = NOMAD::Point(),
+                           const NOMAD::ArrayOfDouble& deltaFrameSize = NOMAD::ArrayOfDouble(),
+                           const NOMAD::Double& scaleFactor = NOMAD::Double());
+
+protected:
+    /// Generate the next point of the sequence
+    Point nextImp() override;
+
+private:
+    /// Compute the scrambled direction numbers and the shifted first point
+    void init();
+};
+
+
+/// \brief Scrambled Halton sequence.
+/**
+ Coordinate i is the radical inverse of the point index in the i-th prime
+ base. Each coordinate permutes its digits by a random multiplier
+ (d -> a d mod b), which breaks the correlations between coordinates with large
+ bases. The point of index 0 (the lower corner) is skipped.
+
+ Each point costs O(n log(p)), and only the bases and multipliers are stored.
+ */
+class DLL_UTIL_API HaltonSequence : public SpaceFillingDesign
+{
+private:
+    std::vector<uint64_t> _bases;       ///< First n prime numbers
+    std::vector<uint64_t> _multipliers; ///< Digit scrambling multipliers, in [1, base-1]
+
+public:
+    /// Constructor. Same arguments as SpaceFillingDesign.
+    explicit HaltonSequence(const size_t n,
+                            const size_t p,
+                            const ArrayOfDouble& lowerBound,
+                            const ArrayOfDouble& upperBound,
+                            const NOMAD::Point& frameCenter = NOMAD::Point(),
+                            const NOMAD::ArrayOfDouble& deltaFrameSize = NOMAD::ArrayOfDouble(),
+                            const NOMAD::Double& scaleFactor = NOMAD::Double());
+
+protected:
+    /// Generate the next point of the sequence
+    Point nextImp() override;
+
+private:
+    /// Compute the bases and draw the multipliers
+    void init();
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_LOW_DISCREPANCY_SEQUENCE__
@@ -173,8 +173,14 @@ NOMAD::Point NOMAD::Point::operator+(const NOMAD::Direction& dir) const
 /*---------------------------------------*/
 NOMAD::Double NOMAD::Point::dist(const NOMAD::Point& X, const NOMAD::Point& Y)
 {
-    NOMAD::Direction V = vectorize(X,Y);
-    return V.norm();
+    if (X.size() != Y.size())
+    {
+        throw NOMAD::Exception (__FILE__, __LINE__, "Cannot compute the distance between 2 points of different dimensions");
+    }
+    X.verifyComplete(Y, "Distance");
+
+    // Same value as vectorize(X,Y).norm(), without the temporary Direction.
+    return sqrt(X.squaredDistValues(Y));
 }
 
 
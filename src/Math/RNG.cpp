@@ -53,7 +53,9 @@
  */
 
 #include "../Math/RNG.hpp"
+#include "../Util/utils.hpp"    // for getThreadNum()
 #include <cmath>
+#include <sstream>
 
 #ifdef _MSC_VER
 #include <io.h>
@@ -74,6 +76,79 @@ uint32_t NOMAD::RNG::_x = x_def;
 uint32_t NOMAD::RNG::_y = y_def;
 uint32_t NOMAD::RNG::_z = z_def;
 
+bool NOMAD::RNG::_streamsEnabled = false;
+uint32_t NOMAD::RNG::_streamBase = 0;
+uint32_t NOMAD::RNG::_streamGeneration = 0;
+
+
+namespace {
+
+    // Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11)
+    const uint32_t PHILOX_M0 = 0xD2511F53;
+    const uint32_t PHILOX_M1 = 0xCD9E8D57;
+    const uint32_t PHILOX_W0 = 0x9E3779B9;
+    const uint32_t PHILOX_W1 = 0xBB67AE85;
+
+    void philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4])
+    {
+        uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+        uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; round++)
+        {
+            const uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+            const uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+            c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+            c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+            c1 = (uint32_t)p1;
+            c3 = (uint32_t)p0;
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+
+    /// Stream of the calling thread: key is (seed, thread), counter is (block, base, stream index).
+    struct RNGStream
+    {
+        uint32_t generation = 0;    ///< Generation of the streams when this stream was set
+        uint32_t key[2] = {0, 0};
+        uint64_t index = 0;
+        uint32_t block = 0;         ///< Next block of 4 draws
+        uint32_t buffer[4] = {0, 0, 0, 0};
+        int pos = 4;                ///< Next draw in buffer. 4 means buffer is exhausted.
+
+        void refill(uint32_t base)
+        {
+            const uint32_t counter[4] = { block++, base, (uint32_t)index, (uint32_t)(index >> 32) };
+            philox4x32(counter, key, buffer);
+            pos = 0;
+        }
+    };
+
+    thread_local RNGStream threadStream;
+
+    void setThreadStream(uint32_t generation, int seed, uint64_t index, uint32_t block, int pos, uint32_t base)
+    {
+        threadStream.generation = generation;
+        threadStream.key[0] = (uint32_t)seed;
+        threadStream.key[1] = (uint32_t)NOMAD::getThreadNum();
+        threadStream.index = index;
+        threadStream.block = block;
+        threadStream.pos = 4;
+        if (pos < 4 && block > 0)
+        {
+            // Regenerate the partially used block.
+            threadStream.block = block - 1;
+            threadStream.refill(base);
+            threadStream.pos = pos;
+        }
+    }
+
+}
+
 void NOMAD::RNG::setSeed(int s)
 {
 #ifdef _OPENMP
@@ -130,12 +205,23 @@ void NOMAD::RNG::reset()
         // Set the random number generator to its state for the given seed
         for (int i = 0; i < _s; i++)
         {
-            NOMAD::RNG::rand();
+            xorshiftRand();
         }
     }
 }
 
 uint32_t NOMAD::RNG::rand()
+{
+    if (_streamsEnabled)
+    {
+        return streamRand();
+    }
+
+    return xorshiftRand();
+}
+
+
+uint32_t NOMAD::RNG::xorshiftRand()
 {
     // http://madrabbit.org/~ray/code/xorshf96.c //period 2^96-1
 #ifdef _OPENMP
@@ -156,6 +242,96 @@ uint32_t NOMAD::RNG::rand()
     return _z;
 }
 
+/*----------------------------------------*/
+/*          counter-based streams         */
+/*----------------------------------------*/
+void NOMAD::RNG::setStreamsEnabled(bool streamsEnabled)
+{
+    _streamsEnabled = streamsEnabled;
+}
+
+
+void NOMAD::RNG::openStreams()
+{
+    if (!_streamsEnabled)
+    {
+        return;
+    }
+
+    // Draw the base from the xorshift state, which is not used otherwise
+    // while streams are enabled. Successive runs (e.g. PyNomad suggest and
+    // observe) get different streams, following the private values.
+    _streamBase = xorshiftRand();
+
+    // Threads will restart from their stream 0.
+    _streamGeneration++;
+}
+
+
+void NOMAD::RNG::selectStream(uint64_t streamIndex)
+{
+    setThreadStream(_streamGeneration, _s, streamIndex, 0, 4, _streamBase);
+}
+
+
+uint32_t NOMAD::RNG::streamRand()
+{
+    if (threadStream.generation != _streamGeneration)
+    {
+        selectStream(0);
+    }
+    if (threadStream.pos >= 4)
+    {
+        threadStream.refill(_streamBase);
+    }
+
+    return threadStream.buffer[threadStream.pos++];
+}
+
+
+std::string NOMAD::RNG::getPrivateSeedAsString()
+{
+    std::string privateSeeds = std::to_string(_x) + " " + std::to_string(_y) + " " + std::to_string(_z);
+    if (_streamsEnabled)
+    {
+        if (threadStream.generation != _streamGeneration)
+        {
+            selectStream(0);
+        }
+        privateSeeds += " " + std::to_string(_streamBase)
+                      + " " + std::to_string(threadStream.index)
+                      + " " + std::to_string(threadStream.block)
+                      + " " + std::to_string(threadStream.pos);
+    }
+    return privateSeeds;
+}
+
+
+void NOMAD::RNG::setPrivateSeedAsString(const std::string &private_seeds)
+{
+    std::istringstream ss(private_seeds);
+    uint32_t x, y, z;
+    if (!(ss >> x >> y >> z))
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__,
+                               "NOMAD::RNG::setPrivateSeedAsString(): invalid private seeds \"" + private_seeds + "\"");
+    }
+    setPrivateSeed(x, y, z);
+
+    // Optional stream values
+    uint32_t base, block;
+    uint64_t index;
+    int pos;
+    // Ignored when streams are not enabled.
+    if (_streamsEnabled && ss >> base >> index >> block >> pos)
+    {
+        _streamBase = base;
+        _streamGeneration++;
+        setThreadStream(_streamGeneration, _s, index, block, pos, _streamBase);
+    }
+}
+
+
 /*----------------------------------------*/
 /*          normal random generators       */
 /*----------------------------------------*/
@@ -168,12 +168,6 @@ public:
         z = _z;
     }
 
-    /// Get private values. Used by PyNomad to obtain RNG state.
-    static string getPrivateSeedAsString()
-    {
-        return std::to_string(_x) + " " + std::to_string(_y) + " " + std::to_string(_z);
-    }
-
     /// Reset seed to given values.
     /**
      Used by PyNomad to set back RNG in a known state.
@@ -190,30 +184,43 @@ public:
         }
     }
 
+    /// Get private values. Used by PyNomad to obtain RNG state.
+    /**
+     When RNG streams are enabled, the state of the stream of the calling thread is appended to the private values.
+     */
+    DLL_UTIL_API static string getPrivateSeedAsString();
+
     /// Reset seed to given values provided as a single string.
     /**
-     Used to set back RNG in a known state.
+     Used to set back RNG in a known state. When streams are enabled, the optional stream values appended by getPrivateSeedAsString() are restored for the calling thread.
+     */
+    DLL_UTIL_API static void setPrivateSeedAsString(const std::string &private_seeds);
+
+    /// Enable or disable the counter-based RNG streams.
+    /**
+     With streams enabled, rand() draws from a stream private to the calling thread instead of the shared xorshift state. The streams are generated by a Philox4x32-10 counter-based generator keyed on the seed and the thread number. No state is shared between threads, so parallel runs do not depend on thread interleaving.
      */
-    static void setPrivateSeedAsString(const std::string &private_seeds)
+    DLL_UTIL_API static void setStreamsEnabled(bool streamsEnabled);
+
+    /// Return true if random numbers are drawn from the counter-based streams.
+    static bool areStreamsEnabled()
     {
-        istringstream ss(private_seeds);
-        uint32_t ps;
-        ss >> ps;
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            if (ps <= UINT32_MAX)
-                _x = ps;
-            ss >> ps;
-            if (ps <= UINT32_MAX)
-                _y = ps;
-            ss >> ps;
-            if (ps <= UINT32_MAX)
-                _z = ps;
-        }
+        return _streamsEnabled;
     }
 
+    /// Open a new family of streams.
+    /**
+     Called when a run starts. The base of the streams is drawn from the xorshift state, so it follows the seed and the private values. Must be called outside parallel regions. Does nothing if streams are not enabled.
+     */
+    DLL_UTIL_API static void openStreams();
+
+    /// Select the stream of the calling thread.
+    /**
+     The draws restart from the beginning of the stream. Selecting the same stream index on the same thread produces the same draws.
+     \param streamIndex     The stream index, typically derived from iteration numbers -- \b IN.
+     */
+    DLL_UTIL_API static void selectStream(uint64_t streamIndex);
+
 private:
     DLL_UTIL_API static uint32_t x_def, y_def, z_def; ///< Initial values for the random number generator
     DLL_UTIL_API static uint32_t _x, _y, _z;          ///< Current values for the random number generator
@@ -221,6 +228,16 @@ private:
     DLL_UTIL_API static int _s;
     
     DLL_UTIL_API static bool _seedSetsXDef;
+
+    DLL_UTIL_API static bool _streamsEnabled;      ///< Draw from the counter-based streams
+    DLL_UTIL_API static uint32_t _streamBase;      ///< Base of the streams, drawn when opening the streams
+    DLL_UTIL_API static uint32_t _streamGeneration; ///< Incremented when the streams are reopened
+
+    /// Draw from the shared xorshift state
+    static result_type xorshiftRand();
+
+    /// Draw from the stream of the calling thread
+    static result_type streamRand();
 };
 
 #include "../nomad_nsend.hpp"
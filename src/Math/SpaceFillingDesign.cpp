@@ -0,0 +1,153 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include "../Math/LHS.hpp"
+#include "../Math/LowDiscrepancySequence.hpp"
+#include "../Math/SpaceFillingDesign.hpp"
+#include "../Util/Exception.hpp"
+
+
+// Constructor
+NOMAD::SpaceFillingDesign::SpaceFillingDesign(const size_t n,
+                                              const size_t p,
+                                              const NOMAD::ArrayOfDouble& lowerBound,
+                                              const NOMAD::ArrayOfDouble& upperBound,
+                                              const NOMAD::Point& frameCenter,
+                                              const NOMAD::ArrayOfDouble& deltaFrameSize,
+                                              const NOMAD::Double& scaleFactor)
+:   _n(n),
+    _p(p),
+    _lowerBound(lowerBound),
+    _upperBound(upperBound),
+    _nbGenerated(0)
+{
+    // Update undefined values of lower and upper bounds to use values based
+    // on deltaFrameSize.
+    // Based on the code in NOMAD 3, but slightly different.
+    // Do not use INF values for bounds, that will generate points with huge
+    // values. It is not elegant.
+    if (frameCenter.isComplete() && deltaFrameSize.isComplete() && scaleFactor.isDefined())
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            if (!_lowerBound[i].isDefined())
+            {
+                _lowerBound[i] = frameCenter[i] - 10.0 * deltaFrameSize[i] * scaleFactor;
+            }
+            if (!_upperBound[i].isDefined())
+            {
+                _upperBound[i] = frameCenter[i] + 10.0 * deltaFrameSize[i] * scaleFactor;
+            }
+        }
+    }
+
+    if (!_lowerBound.isComplete())
+    {
+        std::string s = "LHS Lower bound needs to be completely defined. Values given: ";
+        s += lowerBound.display();
+        throw NOMAD::Exception(__FILE__, __LINE__, s);
+    }
+    if (!_upperBound.isComplete())
+    {
+        std::string s = "LHS Upper bound needs to be completely defined. Values given: ";
+        s += upperBound.display();
+        throw NOMAD::Exception(__FILE__, __LINE__, s);
+    }
+}
+
+
+std::shared_ptr<NOMAD::SpaceFillingDesign> NOMAD::SpaceFillingDesign::create(const NOMAD::LHDesignType designType,
+                                                                             const size_t n,
+                                                                             const size_t p,
+                                                                             const NOMAD::ArrayOfDouble& lowerBound,
+                                                                             const NOMAD::ArrayOfDouble& upperBound,
+                                                                             const NOMAD::Point& frameCenter,
+                                                                             const NOMAD::ArrayOfDouble& deltaFrameSize,
+                                                                             const NOMAD::Double& scaleFactor)
+{
+    switch (designType)
+    {
+        case NOMAD::LHDesignType::LHS:
+            return std::make_shared<NOMAD::LHS>(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor);
+        case NOMAD::LHDesignType::MAXIMIN_LHS:
+            return std::make_shared<NOMAD::MaximinLHS>(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor);
+        case NOMAD::LHDesignType::SOBOL:
+            return std::make_shared<NOMAD::SobolSequence>(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor);
+        case NOMAD::LHDesignType::HALTON:
+            return std::make_shared<NOMAD::HaltonSequence>(n, p, lowerBound, upperBound, frameCenter, deltaFrameSize, scaleFactor);
+        default:
+            throw NOMAD::Exception(__FILE__, __LINE__, "Unknown space-filling design: " + NOMAD::lhDesignTypeToString(designType));
+    }
+}
+
+
+NOMAD::Point NOMAD::SpaceFillingDesign::next()
+{
+    if (!hasNext())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "All the " + std::to_string(_p) + " points of the design have been generated.");
+    }
+
+    NOMAD::Point point = nextImp();
+    _nbGenerated++;
+
+    return point;
+}
+
+
+NOMAD::Point NOMAD::SpaceFillingDesign::scaleToBounds(const std::vector<double>& t) const
+{
+    NOMAD::Point point(_n);
+    for (size_t i = 0; i < _n; i++)
+    {
+        const double l_i = _lowerBound[i].todouble();
+        const double u_i = _upperBound[i].todouble();
+        point[i] = l_i + t[i] * (u_i - l_i);
+    }
+
+    return point;
+}
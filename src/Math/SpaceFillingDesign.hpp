@@ -0,0 +1,167 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   SpaceFillingDesign.hpp
+ \brief  Base class for space-filling designs of experiments
+ \see    SpaceFillingDesign.cpp
+ */
+
+#ifndef __NOMAD_4_5_SPACE_FILLING_DESIGN__
+#define __NOMAD_4_5_SPACE_FILLING_DESIGN__
+
+#include <memory>
+#include <vector>
+#include "../Math/Point.hpp"
+#include "../Type/LHSearchType.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+
+/// \brief Base class for space-filling designs.
+/**
+ * Input:
+ *  n dimension
+ *  p number of desired samples
+ *  lowerBound and upperBound of type ArrayOfDouble indicating lower and upper bounds. Must be completely defined, or completed using a frame center.
+ *
+ * Output:
+ *  p points of dimension n, distributed in the l x u hyper-rectangle of R^n.
+ *  The points are streamed: they are generated one at a time by next(), so
+ *  that a large design does not have to be stored.
+ */
+class DLL_UTIL_API SpaceFillingDesign
+{
+protected:
+    size_t _n;  ///< dimension
+    size_t _p;  ///< number of samples
+    ArrayOfDouble    _lowerBound; ///< lower bounds
+    ArrayOfDouble    _upperBound; ///< upper bounds
+    size_t _nbGenerated;    ///< number of points generated by next()
+
+public:
+    /// Constructor
+    /**
+     \param n               Dimension -- \b IN.
+     \param p               Number of samples -- \b IN.
+     \param lowerBound      Lower bounds -- \b IN.
+     \param upperBound      Upper bounds -- \b IN.
+     \param frameCenter     Frame center to use if bounds are not supplied  -- \b IN.
+     \param deltaFrameSize  Used if bounds are not supplied -- \b IN.
+     \param scaleFactor     Used if bounds are not supplied  -- \b IN.
+     */
+    explicit SpaceFillingDesign(const size_t n,
+                                const size_t p,
+                                const ArrayOfDouble& lowerBound,
+                                const ArrayOfDouble& upperBound,
+                                const NOMAD::Point& frameCenter = NOMAD::Point(),
+                                const NOMAD::ArrayOfDouble& deltaFrameSize = NOMAD::ArrayOfDouble(),
+                                const NOMAD::Double& scaleFactor = NOMAD::Double());
+
+    /// Destructor
+    virtual ~SpaceFillingDesign() {}
+
+    /// Create a design of the given type. Same arguments as the constructor.
+    static std::shared_ptr<SpaceFillingDesign> create(const LHDesignType designType,
+                                                      const size_t n,
+                                                      const size_t p,
+                                                      const ArrayOfDouble& lowerBound,
+                                                      const ArrayOfDouble& upperBound,
+                                                      const NOMAD::Point& frameCenter = NOMAD::Point(),
+                                                      const NOMAD::ArrayOfDouble& deltaFrameSize = NOMAD::ArrayOfDouble(),
+                                                      const NOMAD::Double& scaleFactor = NOMAD::Double());
+
+    /// Get lower bound
+    /**
+     \return Lower bound as \c ArrayOfDouble.
+     */
+    ArrayOfDouble getLowerBound() const                  { return _lowerBound; }
+
+    /// Set lower bound
+    /**
+     \param lowerBound  An \c ArrayOfDouble for lower bound -- \b IN.
+     */
+    void setLowerBound(const ArrayOfDouble& lowerBound)   { _lowerBound = lowerBound; }
+
+    /// Get upper bound
+    /**
+     \return Upper bound as \c ArrayOfDouble.
+     */
+    ArrayOfDouble    getUpperBound(void) const           { return _upperBound; }
+
+    /// Set upper bound
+    /**
+     \param upperBound  An \c ArrayOfDouble for upper bound -- \b IN.
+     */
+    void setUpperBound(const ArrayOfDouble& upperBound)   { _upperBound = upperBound; }
+
+    /// Number of points of the design
+    size_t getNbPoints() const { return _p; }
+
+    /// Test if there are points left to generate
+    bool hasNext() const { return _nbGenerated < _p; }
+
+    /// Generate the next point of the design
+    /**
+     \return The next point, in the l x u hyper-rectangle.
+     */
+    Point next();
+
+protected:
+    /// Implementation of next(), specific to each design
+    virtual Point nextImp() = 0;
+
+    /// Map a point of [0,1]^n to the l x u hyper-rectangle
+    /**
+     \param t   Coordinates in [0,1] -- \b IN.
+     \return    The point l + t (u - l).
+     */
+    Point scaleToBounds(const std::vector<double>& t) const;
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_SPACE_FILLING_DESIGN__
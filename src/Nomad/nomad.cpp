@@ -128,6 +128,20 @@ int main (int argc, char ** argv)
             {
                 TheMainStep->displayCSVDoc ( );
             }
+            // Display a binary history file as text if option '-bh' has been specified
+            else if ((option == "-BH" || option == "-BINHISTORY" || option == "--BINHISTORY") && 3 == argc)
+            {
+                try
+                {
+                    TheMainStep->displayBinaryHistory(argv[2]);
+                }
+                catch (NOMAD::Exception &e)
+                {
+                    error = "ERROR: ";
+                    error += e.what();
+                    std::cerr << std::endl << error << std::endl << std::endl;
+                }
+            }
             else
             {
                 NOMAD::OutputQueue::getInstance()->setDisplayDegree(1);
@@ -0,0 +1,233 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   BinaryHistory.cpp
+ \brief  Binary history file: format and reader (implementation)
+ \see    BinaryHistory.hpp
+ */
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "../Output/BinaryHistory.hpp"
+#include "../Util/Exception.hpp"
+
+const char      NOMAD::BinaryHistory::magic[8] = {'N', 'O', 'M', 'A', 'D', 'H', 'S', 'T'};
+const uint32_t  NOMAD::BinaryHistory::version = 1;
+const uint32_t  NOMAD::BinaryHistory::byteOrderMark = 0x01020304;
+
+namespace
+{
+    template <typename T>
+    void appendValue(std::string& out, const T value)
+    {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    T readValue(const char*& p)
+    {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return value;
+    }
+}
+
+
+std::string NOMAD::BinaryHistory::formatHeader(size_t n, const NOMAD::BBOutputTypeList& bbOutputType)
+{
+    const std::string types = NOMAD::BBOutputTypeListToString(bbOutputType);
+
+    std::string header(magic, sizeof(magic));
+    appendValue<uint32_t>(header, version);
+    appendValue<uint32_t>(header, byteOrderMark);
+    appendValue<uint32_t>(header, static_cast<uint32_t>(n));
+    appendValue<uint32_t>(header, static_cast<uint32_t>(bbOutputType.size()));
+    appendValue<uint32_t>(header, static_cast<uint32_t>(types.size()));
+    header += types;
+
+    return header;
+}
+
+
+void NOMAD::BinaryHistory::appendRecord(std::string& out,
+                                        const NOMAD::ArrayOfDouble& x,
+                                        const NOMAD::ArrayOfDouble& bbo,
+                                        size_t m,
+                                        int evalStatus,
+                                        int threadNum,
+                                        double time)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    out.reserve(out.size() + recordSize(x.size(), m));
+
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        appendValue<double>(out, x[i].isDefined() ? x[i].todouble() : nan);
+    }
+    for (size_t i = 0; i < m; i++)
+    {
+        appendValue<double>(out, (i < bbo.size() && bbo[i].isDefined()) ? bbo[i].todouble() : nan);
+    }
+    appendValue<int32_t>(out, static_cast<int32_t>(evalStatus));
+    appendValue<int32_t>(out, static_cast<int32_t>(threadNum));
+    appendValue<double>(out, time);
+}
+
+
+NOMAD::BinaryHistoryReader::BinaryHistoryReader(const std::string& fileName)
+  : _in(fileName.c_str(), std::ios::in | std::ios::binary),
+    _n(0),
+    _m(0),
+    _bbOutputType(),
+    _buffer()
+{
+    if (_in.fail())
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "BinaryHistoryReader: could not open file " + fileName);
+    }
+
+    char header[sizeof(NOMAD::BinaryHistory::magic) + 5 * sizeof(uint32_t)];
+    _in.read(header, sizeof(header));
+    if (_in.gcount() != static_cast<std::streamsize>(sizeof(header))
+        || 0 != std::memcmp(header, NOMAD::BinaryHistory::magic, sizeof(NOMAD::BinaryHistory::magic)))
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "BinaryHistoryReader: " + fileName + " is not a binary history file");
+    }
+
+    const char* p = header + sizeof(NOMAD::BinaryHistory::magic);
+    const auto fileVersion = readValue<uint32_t>(p);
+    const auto byteOrderMark = readValue<uint32_t>(p);
+    if (NOMAD::BinaryHistory::version != fileVersion)
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "BinaryHistoryReader: unsupported version " + std::to_string(fileVersion) + " of binary history file " + fileName);
+    }
+    if (NOMAD::BinaryHistory::byteOrderMark != byteOrderMark)
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "BinaryHistoryReader: binary history file " + fileName + " was written with another byte order");
+    }
+    _n = readValue<uint32_t>(p);
+    _m = readValue<uint32_t>(p);
+    const auto typesLength = readValue<uint32_t>(p);
+
+    _bbOutputType.resize(typesLength);
+    _in.read(&_bbOutputType[0], typesLength);
+    if (_in.gcount() != static_cast<std::streamsize>(typesLength))
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "BinaryHistoryReader: truncated header in binary history file " + fileName);
+    }
+
+    _buffer.resize(NOMAD::BinaryHistory::recordSize(_n, _m));
+}
+
+
+bool NOMAD::BinaryHistoryReader::next(NOMAD::BinaryHistoryRecord& record)
+{
+    _in.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+    if (_in.gcount() != static_cast<std::streamsize>(_buffer.size()))
+    {
+        return false;
+    }
+
+    const char* p = _buffer.data();
+    record.x.resize(_n);
+    std::memcpy(record.x.data(), p, _n * sizeof(double));
+    p += _n * sizeof(double);
+    record.bbo.resize(_m);
+    std::memcpy(record.bbo.data(), p, _m * sizeof(double));
+    p += _m * sizeof(double);
+    record.evalStatus = readValue<int32_t>(p);
+    record.threadNum = readValue<int32_t>(p);
+    record.time = readValue<double>(p);
+
+    return true;
+}
+
+
+size_t NOMAD::BinaryHistoryReader::readColumns(std::vector<double>& x,
+                                               std::vector<double>& bbo,
+                                               std::vector<int>& evalStatus,
+                                               std::vector<int>& threadNum,
+                                               std::vector<double>& time)
+{
+    // Read many records at once.
+    const size_t recordSize = _buffer.size();
+    const size_t nbRecordsPerChunk = std::max<size_t>(1, (1 << 22) / recordSize);
+    std::vector<char> chunk(nbRecordsPerChunk * recordSize);
+
+    size_t nbRecords = 0;
+    while (true)
+    {
+        _in.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        const size_t nbRead = static_cast<size_t>(_in.gcount()) / recordSize;
+
+        const char* p = chunk.data();
+        for (size_t k = 0; k < nbRead; k++)
+        {
+            const size_t xSize = x.size();
+            x.resize(xSize + _n);
+            std::memcpy(x.data() + xSize, p, _n * sizeof(double));
+            p += _n * sizeof(double);
+            const size_t bboSize = bbo.size();
+            bbo.resize(bboSize + _m);
+            std::memcpy(bbo.data() + bboSize, p, _m * sizeof(double));
+            p += _m * sizeof(double);
+            evalStatus.push_back(readValue<int32_t>(p));
+            threadNum.push_back(readValue<int32_t>(p));
+            time.push_back(readValue<double>(p));
+        }
+        nbRecords += nbRead;
+
+        if (nbRead < nbRecordsPerChunk)
+        {
+            break;
+        }
+    }
+
+    return nbRecords;
+}
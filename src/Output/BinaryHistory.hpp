@@ -0,0 +1,171 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   BinaryHistory.hpp
+ \brief  Binary history file: format and reader.
+ \see    BinaryHistory.cpp
+ */
+
+#ifndef __NOMAD_4_5_BINARYHISTORY__
+#define __NOMAD_4_5_BINARYHISTORY__
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../Math/ArrayOfDouble.hpp"
+#include "../Type/BBOutputType.hpp"
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Format of the binary history file (parameter HISTORY_FILE_BINARY).
+/**
+ The values are written in the byte order of the machine. \n
+ Header:
+ * 8 characters \c NOMADHST,
+ * 32-bit unsigned integers: the version, the byte order mark \c 0x01020304,
+   the dimension \c n, the number of blackbox outputs \c m, and the length
+   of the blackbox output types string,
+ * the blackbox output types string, ex. \c "OBJ PB PB".
+
+ Then one record per evaluation, all of the same size:
+ * \c n doubles: the point,
+ * \c m doubles: the blackbox outputs. Undefined or missing outputs are NaN,
+ * 32-bit integers: the evaluation status (value of EvalStatusType) and the
+   number of the thread that did the evaluation,
+ * one double: the wall-clock time in seconds since the history file was opened.
+ */
+class DLL_UTIL_API BinaryHistory
+{
+public:
+    static const char           magic[8];
+    static const uint32_t       version;
+    static const uint32_t       byteOrderMark;
+
+    /// Header of a history file with points of dimension \c n and the given outputs.
+    static std::string formatHeader(size_t n, const BBOutputTypeList& bbOutputType);
+
+    /// Size in bytes of a record.
+    static size_t recordSize(size_t n, size_t m) { return (n + m + 1) * sizeof(double) + 2 * sizeof(int32_t); }
+
+    /// Append a record to \c out.
+    /**
+     \param out         The buffer -- \b IN/OUT.
+     \param x           The point, of dimension \c n -- \b IN.
+     \param bbo         The blackbox outputs. Missing outputs are written as NaN -- \b IN.
+     \param m           The number of blackbox outputs in the header -- \b IN.
+     \param evalStatus  The evaluation status -- \b IN.
+     \param threadNum   The evaluation thread -- \b IN.
+     \param time        The time of the evaluation -- \b IN.
+     */
+    static void appendRecord(std::string& out,
+                             const ArrayOfDouble& x,
+                             const ArrayOfDouble& bbo,
+                             size_t m,
+                             int evalStatus,
+                             int threadNum,
+                             double time);
+};
+
+
+/// One record of a binary history file.
+struct DLL_UTIL_API BinaryHistoryRecord
+{
+    std::vector<double> x;
+    std::vector<double> bbo;
+    int                 evalStatus = 0;
+    int                 threadNum = 0;
+    double              time = 0.0;
+};
+
+
+/// Sequential reader of a binary history file.
+/**
+ The header is read by the constructor. The records are read one at a time
+ with next(), or all at once, column by column, with readColumns().
+ An incomplete last record (interrupted run) is ignored.
+ */
+class DLL_UTIL_API BinaryHistoryReader
+{
+private:
+    std::ifstream       _in;
+    size_t              _n;
+    size_t              _m;
+    std::string         _bbOutputType;
+    std::vector<char>   _buffer;    ///< One record
+
+public:
+    /// Constructor. Open the file and read the header. Throws if the file is not a binary history file.
+    explicit BinaryHistoryReader(const std::string& fileName);
+
+    size_t getN() const { return _n; }
+    size_t getM() const { return _m; }
+    /// The blackbox output types, as in parameter BB_OUTPUT_TYPE.
+    const std::string& getBBOutputType() const { return _bbOutputType; }
+
+    /// Read the next record. Return \c false at the end of the file.
+    bool next(BinaryHistoryRecord& record);
+
+    /// Read the remaining records.
+    /**
+     The points and the blackbox outputs are appended row by row: \c x gets
+     \c n values per record and \c bbo gets \c m values per record.
+     \return The number of records read.
+     */
+    size_t readColumns(std::vector<double>& x,
+                       std::vector<double>& bbo,
+                       std::vector<int>& evalStatus,
+                       std::vector<int>& threadNum,
+                       std::vector<double>& time);
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_BINARYHISTORY__
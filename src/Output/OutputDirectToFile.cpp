@@ -60,10 +60,14 @@ bool NOMAD::OutputDirectToFile::_hasBeenInitialized = false;
 
 // Private constructor
 NOMAD::OutputDirectToFile::OutputDirectToFile()
-  : _outputSize(0),
+  : _writer(NOMAD::OutputWriter::getInstance()),
+    _outputSize(0),
     _outputFileFormat(DisplayStatsTypeList("SOL BBO")),
     _solutionFile(),
     _historyFile(),
+    _historyBinary(false),
+    _bbOutputTypeSize(0),
+    _historyStartTime(),
     _enabledSolutionFile(true)
 {
 }
@@ -72,6 +76,8 @@ NOMAD::OutputDirectToFile::OutputDirectToFile()
 // Destructor
 NOMAD::OutputDirectToFile::~OutputDirectToFile()
 {
+    // Write pending history lines before closing.
+    _writer->flush();
 
 #ifdef _OPENMP
     omp_destroy_lock(&_s_output_lock);
@@ -110,7 +116,8 @@ std::unique_ptr<NOMAD::OutputDirectToFile>& NOMAD::OutputDirectToFile::getInstan
 }
 
 // Initialize output parameters.
-void NOMAD::OutputDirectToFile::init(const std::shared_ptr<NOMAD::DisplayParameters>& params)
+void NOMAD::OutputDirectToFile::init(const std::shared_ptr<NOMAD::DisplayParameters>& params,
+                                     const NOMAD::BBOutputTypeList& bbOutputType)
 {
 
     if (nullptr == params)
@@ -129,8 +136,10 @@ void NOMAD::OutputDirectToFile::init(const std::shared_ptr<NOMAD::DisplayParamet
     _historyFile = historyFileTmp;
     _solutionFile = params->getAttributeValue<std::string>("SOLUTION_FILE");
     _outputSize = params->getAttributeValue<NOMAD::ArrayOfDouble>("SOL_FORMAT").size();
+    _historyBinary = params->getAttributeValue<bool>("HISTORY_FILE_BINARY");
+    _bbOutputTypeSize = bbOutputType.size();
 
-    initHistoryFile();
+    initHistoryFile(bbOutputType);
 
     _hasBeenInitialized = true;
 }
@@ -141,17 +150,32 @@ bool NOMAD::OutputDirectToFile::goodToWrite() const
     return ( !_historyFile.empty() || !_solutionFile.empty());
 }
 
-void NOMAD::OutputDirectToFile::initHistoryFile()
+void NOMAD::OutputDirectToFile::initHistoryFile(const NOMAD::BBOutputTypeList& bbOutputType)
 {
     if (!_historyFile.empty())
     {
+        // Write pending history lines before closing.
+        _writer->flush();
+
         // Open history file and clear it (trunc)
         _historyStream.close();
-        _historyStream.open(_historyFile.c_str(), std::ofstream::out | std::ios::trunc);
+        if (_historyBinary)
+        {
+            _historyStream.open(_historyFile.c_str(), std::ofstream::out | std::ios::trunc | std::ios::binary);
+        }
+        else
+        {
+            _historyStream.open(_historyFile.c_str(), std::ofstream::out | std::ios::trunc);
+        }
         if (_historyStream.fail())
         {
             std::cout << "Warning: could not open history file " << _historyFile << std::endl;
         }
+        if (_historyBinary)
+        {
+            _writer->push(_historyStream, NOMAD::BinaryHistory::formatHeader(_outputSize, bbOutputType));
+            _historyStartTime = std::chrono::steady_clock::now();
+        }
         _historyStream.setf(std::ios::fixed);
         // Set full precision on history file.
         _historyStream.precision(NOMAD::DISPLAY_PRECISION_FULL);
@@ -172,22 +196,26 @@ void NOMAD::OutputDirectToFile::write(const NOMAD::StatsInfo &info, bool writeIn
         throw NOMAD::Exception(__FILE__, __LINE__, "OutputDirectToFile: output size is null");
     }
 
-#ifdef _OPENMP
-    // Lock queue before writing in file
-    omp_set_lock(&_s_output_lock);
-#endif
-
     NOMAD::ArrayOfDouble solFormatStats(_outputSize, NOMAD::DISPLAY_PRECISION_FULL);
 
-    // Add information in history file.
-    if (writeInHistoryFile)
+    // Format outside of any lock
+    std::string line = info.display(_outputFileFormat, solFormatStats, 0, 0, false, false);
+    line += '\n';
+
+    // Add information in history file. The writer keeps the order of the lines.
+    // A binary history file is written by writeHistoryRecord.
+    if (writeInHistoryFile && !_historyFile.empty() && !_historyBinary)
     {
-        _historyStream << info.display(_outputFileFormat, solFormatStats, 0, 0, false, false) << std::endl;
+        _writer->push(_historyStream, line);
     }
 
     // Add information in solution file
     if (writeInSolutionFile && _enabledSolutionFile && !_solutionFile.empty())
     {
+#ifdef _OPENMP
+        // Lock before writing in file
+        omp_set_lock(&_s_output_lock);
+#endif
         // Open solution file and clear it if needed
         _solutionStream.close();
         
@@ -207,15 +235,29 @@ void NOMAD::OutputDirectToFile::write(const NOMAD::StatsInfo &info, bool writeIn
         // Set full precision on solution file.
         _solutionStream.precision(NOMAD::DISPLAY_PRECISION_FULL);
 
-        _solutionStream << info.display(_outputFileFormat, solFormatStats, 0, 0, false, false) << std::endl;
+        _solutionStream << line;
         _solutionStream.close();
-    }
-
 #ifdef _OPENMP
-    omp_unset_lock(&_s_output_lock);
+        omp_unset_lock(&_s_output_lock);
 #endif // _OPENMP
+    }
 
 }
 
 
+void NOMAD::OutputDirectToFile::writeHistoryRecord(const NOMAD::ArrayOfDouble& x,
+                                                   const NOMAD::ArrayOfDouble& bbo,
+                                                   int evalStatus,
+                                                   int threadNum)
+{
+    if (!isHistoryBinary())
+    {
+        return;
+    }
 
+    const std::chrono::duration<double> time = std::chrono::steady_clock::now() - _historyStartTime;
+
+    std::string record;
+    NOMAD::BinaryHistory::appendRecord(record, x, bbo, _bbOutputTypeSize, evalStatus, threadNum, time.count());
+    _writer->push(_historyStream, std::move(record));
+}
@@ -47,13 +47,16 @@
 #ifndef __NOMAD_4_5_OUTPUTDIRECTTOFILE__
 #define __NOMAD_4_5_OUTPUTDIRECTTOFILE__
 
+#include <chrono>
 #include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif // _OPENMP
 
 #include "../Param/DisplayParameters.hpp"
+#include "../Output/BinaryHistory.hpp"
 #include "../Output/OutputInfo.hpp"
+#include "../Output/OutputWriter.hpp"
 #include "../Output/StatsInfo.hpp"
 
 #include "../nomad_platform.hpp"
@@ -63,6 +66,8 @@
 /**
  The output is a singleton. Some info can be written into files. \n
  The format of output is fixed. The parameters (DisplayParameters) are attributes of the class provided by calling OutputDirectToFile::initParameters. New files to receive output must be  registered in this function.\n
+ The lines of the history file are formatted by the calling thread and written by the OutputWriter. The solution file is written right away.\n
+ With parameter HISTORY_FILE_BINARY, the history file is written in the BinaryHistory format by OutputDirectToFile::writeHistoryRecord instead of OutputDirectToFile::write.\n
  */
 class DLL_UTIL_API OutputDirectToFile
 {
@@ -78,7 +83,12 @@ public:
     static std::unique_ptr<OutputDirectToFile>& getInstance();
 
     /// Initialization of file names using display parameters
-    void init(const std::shared_ptr<DisplayParameters>& params);
+    /**
+     \param params        The display parameters -- \b IN.
+     \param bbOutputType  The blackbox output types, for the header of a binary history file -- \b IN.
+     */
+    void init(const std::shared_ptr<DisplayParameters>& params,
+              const BBOutputTypeList& bbOutputType = BBOutputTypeList());
 
     /// When history and/or solution files are active, write info in solution and history file according to the flags
     void write(const StatsInfo& outInfo, bool writeInSolutionFile, bool writeInHistoryFile=true, bool appendInSolutionFile = false);
@@ -88,6 +98,18 @@ public:
         getInstance()->write(outInfo,writeInSolutionFile,writeInHistoryFile,appendInSolutionFile);
     }
 
+    /// Is the history file written in binary format
+    bool isHistoryBinary() const { return _historyBinary && !_historyFile.empty(); }
+
+    /// Write one evaluation in the binary history file.
+    /**
+     \param x           The point -- \b IN.
+     \param bbo         The blackbox outputs -- \b IN.
+     \param evalStatus  The evaluation status -- \b IN.
+     \param threadNum   The evaluation thread -- \b IN.
+     */
+    void writeHistoryRecord(const ArrayOfDouble& x, const ArrayOfDouble& bbo, int evalStatus, int threadNum);
+
     /// Good to write in history and/or solution files when the file names have been defined.
     bool goodToWrite() const;
     static bool GoodToWrite()
@@ -115,7 +137,7 @@ public:
 
 private:
 #ifdef _OPENMP
-    // Acquire lock before write.
+    // Acquire lock before writing in the solution file.
     // NOTE It does not seem relevant for the lock to be static,
     // because OutputDirectToFile is a singleton anyway. If staticity causes problems,
     // we could remove the static keyword.
@@ -123,7 +145,9 @@ private:
 #endif // _OPENMP
 
     /// Helper for init
-    void initHistoryFile();
+    void initHistoryFile(const BBOutputTypeList& bbOutputType);
+
+    std::shared_ptr<OutputWriter>   _writer;    ///< Background writer of the history file. Kept alive until the history file is closed.
 
     static bool        _hasBeenInitialized;    ///< Flag for initialization (initialization cannot be performed more than once).
 
@@ -144,6 +168,10 @@ private:
     std::string                     _historyFile;
     std::ofstream                   _historyStream;
 
+    bool                            _historyBinary;         ///< History file in BinaryHistory format
+    size_t                          _bbOutputTypeSize;      ///< Number of blackbox outputs in a binary history record
+    std::chrono::steady_clock::time_point _historyStartTime; ///< Origin of the times in the binary history file
+
     /// Even if solution file is provided we can temporarily disable solution file (PhaseOne)
     bool                            _enabledSolutionFile;
 
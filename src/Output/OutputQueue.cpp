@@ -46,12 +46,14 @@
 /*---------------------------------------------------------------------------------*/
 
 #include <fstream>
+#include <sstream>
 #include "../Output/OutputQueue.hpp"
 #include "../Util/Exception.hpp"
 
 // Static members initialization
 #ifdef _OPENMP
 omp_lock_t NOMAD::OutputQueue::_s_queue_lock;
+omp_lock_t NOMAD::OutputQueue::_s_flush_lock;
 #endif // _OPENMP
 
 std::unique_ptr<NOMAD::OutputQueue> NOMAD::OutputQueue::_single(nullptr);
@@ -62,6 +64,7 @@ bool NOMAD::OutputQueue::_hasBeenInitialized = false;
 NOMAD::OutputQueue::OutputQueue()
   : _queue(),
     _params(),
+    _writer(NOMAD::OutputWriter::getInstance()),
     _statsFile(),
     _statsWritten(false),
     _totalEval(0),
@@ -90,10 +93,12 @@ NOMAD::OutputQueue::~OutputQueue()
     }
 #ifdef _OPENMP
     omp_destroy_lock(&_s_queue_lock);
+    omp_destroy_lock(&_s_flush_lock);
 #endif // _OPENMP
     // Close stats file
     if (!_statsFile.empty())
     {
+        _writer->flush();
         if (!_statsWritten)
         {
             _statsStream << "no feasible solution has been found after " << NOMAD::itos(_totalEval) << " evaluations" << std::endl;
@@ -110,6 +115,7 @@ void NOMAD::OutputQueue::reset()
     // Close stats file
     if (!_statsFile.empty())
     {
+        _writer->flush();
         if (!_statsWritten)
         {
             _statsStream << "no feasible solution has been found after " << NOMAD::itos(_totalEval) << " evaluations" << std::endl;
@@ -133,6 +139,7 @@ std::unique_ptr<NOMAD::OutputQueue>& NOMAD::OutputQueue::getInstance()
         {
 #ifdef _OPENMP
             omp_init_lock(&_s_queue_lock);
+            omp_init_lock(&_s_flush_lock);
 #endif // _OPENMP
             _single = std::unique_ptr<OutputQueue> (new OutputQueue());
         }
@@ -294,46 +301,67 @@ void NOMAD::OutputQueue::flush()
     }
 
 #ifdef _OPENMP
-    // Lock queue before flush
+    // One flush at a time, so that the information is output in the queue order.
+    omp_set_lock(&_s_flush_lock);
+    // Take the content of the queue, and release the queue right away:
+    // other threads can add to the queue while this content is formatted.
     omp_set_lock(&_s_queue_lock);
 #endif // _OPENMP
+    std::vector<NOMAD::OutputInfo> queue;
+    queue.swap(_queue);
+#ifdef _OPENMP
+    omp_unset_lock(&_s_queue_lock);
+#endif // _OPENMP
 
-    // Info goes to Standard output
-    for (auto & out_it : _queue)
+    // Info goes to Standard output, in a single write.
+    std::ostringstream out;
+    try
+    {
+        for (const auto & out_it : queue)
+        {
+            flushBlock(out_it, out);
+        }
+    }
+    catch (...)
     {
-        flushBlock(out_it);
+        std::cout << out.str() << std::flush;
+#ifdef _OPENMP
+        omp_unset_lock(&_s_flush_lock);
+#endif // _OPENMP
+        throw;
     }
-    _queue.clear();
+    std::cout << out.str() << std::flush;
+
 #ifdef _OPENMP
-    omp_unset_lock(&_s_queue_lock);
+    omp_unset_lock(&_s_flush_lock);
 #endif // _OPENMP
 
 }
 
 
-void NOMAD::OutputQueue::startBlock()
+void NOMAD::OutputQueue::startBlock(std::ostream& out) const
 {
-    std::cout << " " << _blockStart;
+    out << " " << _blockStart;
 }
 
 
-void NOMAD::OutputQueue::endBlock()
+void NOMAD::OutputQueue::endBlock(std::ostream& out) const
 {
-    std::cout << _blockEnd << " ";
+    out << _blockEnd << " ";
 }
 
 
-void NOMAD::OutputQueue::indent(int level)
+void NOMAD::OutputQueue::indent(int level, std::ostream& out) const
 {
     // Indent each line by level.
     for (int i = 0; i < level; i++)
     {
-        std::cout << "    ";
+        out << "    ";
     }
 }
 
 
-void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo)
+void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo, std::ostream& out)
 {
     // Output one line for each string in the vector msg.
 
@@ -351,7 +379,7 @@ void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo)
     const NOMAD::ArrayOfString& msg = outputInfo.getMsg();
     if (outputLevel == NOMAD::OutputLevel::LEVEL_STATS)
     {
-        flushStatsToStdout(statsInfo);
+        flushStatsToStdout(statsInfo, out);
     }
 
     else
@@ -361,9 +389,6 @@ void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo)
             _indentLevel--;
             if (_indentLevel < 0)
             {
-    #ifdef _OPENMP
-                omp_unset_lock(&_s_queue_lock);
-    #endif // _OPENMP
                 throw NOMAD::Exception(__FILE__, __LINE__, "OutputQueue has more block ends than block starts.");
             }
         }
@@ -373,19 +398,19 @@ void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo)
         {
             for (size_t i = 0; i < msg.size(); i++)
             {
-                indent(_indentLevel);
+                indent(_indentLevel, out);
                 if (outputInfo.isBlockEnd())
                 {
-                    endBlock();
+                    endBlock(out);
                 }
 
-                std::cout << msg[i];
+                out << msg[i];
 
                 if (outputInfo.isBlockStart())
                 {
-                    startBlock();
+                    startBlock(out);
                 }
-                std::cout << std::endl;
+                out << '\n';
             }
         }
         else
@@ -394,8 +419,8 @@ void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo)
             // This display is not sophisticated.
             if (_indentLevel == (int)_maxStepLevel + 1)
             {
-                indent(_indentLevel);
-                std::cout << "........................................" << std::endl;
+                indent(_indentLevel, out);
+                out << "........................................\n";
             }
         }
 
@@ -410,7 +435,7 @@ void NOMAD::OutputQueue::flushBlock(const NOMAD::OutputInfo &outputInfo)
 }
 
 
-void NOMAD::OutputQueue::flushStatsToStdout(const NOMAD::StatsInfo *statsInfo)
+void NOMAD::OutputQueue::flushStatsToStdout(const NOMAD::StatsInfo *statsInfo, std::ostream& out)
 {
     // Early out
     if (nullptr == statsInfo)
@@ -476,9 +501,9 @@ void NOMAD::OutputQueue::flushStatsToStdout(const NOMAD::StatsInfo *statsInfo)
         {
             if (_statsLineCount > 0)
             {
-                std::cout << std::endl;
+                out << '\n';
             }
-            std::cout << statsInfo->displayHeader(displayStatsFormat, solFormat, _objWidth) << std::endl;
+            out << statsInfo->displayHeader(displayStatsFormat, solFormat, _objWidth) << '\n';
         }
 
         // To standard output
@@ -486,7 +511,7 @@ void NOMAD::OutputQueue::flushStatsToStdout(const NOMAD::StatsInfo *statsInfo)
         // when either all evaluations or all unsuccessful evaluations are shown.
         starSuccess = displayAllEval || displayUnsuccessful;
         appendComment = true;
-        std::cout << statsInfo->display(displayStatsFormat, solFormat, _objWidth, _hWidth, starSuccess, appendComment) << std::endl;
+        out << statsInfo->display(displayStatsFormat, solFormat, _objWidth, _hWidth, starSuccess, appendComment) << '\n';
         _statsLineCount++;
     }
 }
@@ -496,6 +521,9 @@ void NOMAD::OutputQueue::initStatsFile()
 {
     if (!_statsFile.empty())
     {
+        // Write pending stats before closing.
+        _writer->flush();
+
         // Open stats file and clear it (trunc)
         _statsStream.close();
         _statsStream.open(_statsFile.c_str(), std::ofstream::out | std::ios::trunc);
@@ -535,7 +563,7 @@ void NOMAD::OutputQueue::flushStatsToStatsFile(const NOMAD::StatsInfo *statsInfo
     if (displayInteresting)
     {
         // Add stats information.
-        _statsStream << statsInfo->display(_statsFileFormat, solFormatStats, 0, 0, false, false) << std::endl;
+        _writer->push(_statsStream, statsInfo->display(_statsFileFormat, solFormatStats, 0, 0, false, false) + '\n');
         _statsWritten = true;
     }
 }
@@ -58,6 +58,7 @@
 
 #include "../Param/DisplayParameters.hpp"
 #include "../Output/OutputInfo.hpp"
+#include "../Output/OutputWriter.hpp"
 #include "../Output/StatsInfo.hpp"
 
 #include "../nomad_nsbegin.hpp"
@@ -65,6 +66,7 @@
 /// Queue of all information that was not output yet.
 /**
  The output queue is a singleton. Some OutputInfo can be added to the queue. The output information is displayed when calling OutputQueue::Flush and queue is emptied. \n
+ The flush takes the queued information out of the queue, so that other threads can keep adding to the queue while it is formatted. The standard output is written once per flush, and the stats file through the OutputWriter. \n
  The information can be send to the standard display and to a stats file. \n
  The display is formatted with indentation of blocks of information. The display parameters (DisplayParameters) are attributes of the class provided by calling OutputQueue::initParameters. \n
 
@@ -181,6 +183,9 @@ private:
     // because OutputQueue is a singleton anyway. If staticity causes problems,
     // we could remove the static keyword.
     DLL_UTIL_API static omp_lock_t      _s_queue_lock;
+    // Acquire lock before formatting the flushed information,
+    // to keep the order of the output and the indentation level.
+    DLL_UTIL_API static omp_lock_t      _s_flush_lock;
 #endif // _OPENMP
 
     DLL_UTIL_API static bool            _hasBeenInitialized;    ///< Flag for initialization (initialization cannot be performed more than once).
@@ -193,6 +198,8 @@ private:
     /// Display parameters
     std::shared_ptr<DisplayParameters>  _params;
 
+    std::shared_ptr<OutputWriter>       _writer;    ///< Background writer of the stats file. Kept alive until the stats file is closed.
+
     std::string                         _statsFile;
     std::ofstream                       _statsStream;
     bool                                _statsWritten;
@@ -224,13 +231,13 @@ private:
     const std::string _blockStart; ///< Symbol for a block start.
     const std::string _blockEnd; ///< Symbol for an end block.
 
-    void startBlock();
-    void endBlock();
+    void startBlock(std::ostream& out) const;
+    void endBlock(std::ostream& out) const;
 	DLL_UTIL_API void flush();
-    void flushBlock(const OutputInfo &outputInfo);
+    void flushBlock(const OutputInfo &outputInfo, std::ostream& out);
     void flushStatsToStatsFile(const StatsInfo *statsInfo);
-    void flushStatsToStdout(const StatsInfo *statsInfo);
-    void indent(int level);
+    void flushStatsToStdout(const StatsInfo *statsInfo, std::ostream& out);
+    void indent(int level, std::ostream& out) const;
 };
 
 #include "../nomad_nsend.hpp"
@@ -0,0 +1,270 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   OutputWriter.cpp
+ \brief  Background writer of formatted lines into output files (implementation)
+ \see    OutputWriter.hpp
+ */
+#include <utility>
+
+#include "../Output/OutputWriter.hpp"
+
+#ifdef _OPENMP
+namespace
+{
+    // Above this number of buffered characters, the batches are written without waiting for the period.
+    const size_t maxBatchSize = 1 << 20;
+}
+#endif // _OPENMP
+
+
+NOMAD::OutputWriter::OutputWriter(size_t capacity, size_t periodMs)
+#ifdef _OPENMP
+  : _ring(),
+    _mask(0),
+    _pushPos(0),
+    _popPos(0),
+    _period(periodMs),
+    _mutex(),
+    _wakeCond(),
+    _doneCond(),
+    _writtenPos(0),
+    _flushRequested(false),
+    _stop(false),
+    _thread()
+#endif // _OPENMP
+{
+#ifdef _OPENMP
+    size_t size = 2;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    _mask = size - 1;
+    _ring = std::vector<Record>(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        _ring[i]._seq.store(i, std::memory_order_relaxed);
+        _ring[i]._out = nullptr;
+    }
+
+    _thread = std::thread(&NOMAD::OutputWriter::run, this);
+#else
+    (void)capacity;
+    (void)periodMs;
+#endif // _OPENMP
+}
+
+
+NOMAD::OutputWriter::~OutputWriter()
+{
+#ifdef _OPENMP
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wakeCond.notify_one();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+#endif // _OPENMP
+}
+
+
+std::shared_ptr<NOMAD::OutputWriter> NOMAD::OutputWriter::getInstance()
+{
+    static std::shared_ptr<NOMAD::OutputWriter> single = std::make_shared<NOMAD::OutputWriter>();
+    return single;
+}
+
+
+void NOMAD::OutputWriter::push(std::ostream& out, std::string text)
+{
+#ifdef _OPENMP
+    // Claim a position in the ring. The record at this position is free when
+    // its sequence number equals the position.
+    size_t pos = _pushPos.load(std::memory_order_relaxed);
+    Record* record = nullptr;
+    while (true)
+    {
+        record = &_ring[pos & _mask];
+        const size_t seq = record->_seq.load(std::memory_order_acquire);
+        if (seq == pos)
+        {
+            if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (seq < pos)
+        {
+            // The ring is full: wake up the writer and wait for a free record.
+            _wakeCond.notify_one();
+            std::this_thread::yield();
+            pos = _pushPos.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // Another producer took this position.
+            pos = _pushPos.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->_out = &out;
+    record->_text = std::move(text);
+    record->_seq.store(pos + 1, std::memory_order_release);
+
+    // Do not let the ring fill up while the writer sleeps.
+    if (0 == (pos & (_mask >> 1)))
+    {
+        _wakeCond.notify_one();
+    }
+#else
+    out << text << std::flush;
+#endif // _OPENMP
+}
+
+
+void NOMAD::OutputWriter::flush()
+{
+#ifdef _OPENMP
+    // Records claimed after this point are not waited for.
+    const size_t target = _pushPos.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_writtenPos < target)
+    {
+        _flushRequested = true;
+        _wakeCond.notify_one();
+        _doneCond.wait(lock);
+    }
+#endif // _OPENMP
+}
+
+
+#ifdef _OPENMP
+void NOMAD::OutputWriter::run()
+{
+    // Text waiting to be written, per stream, in the order the streams were first seen.
+    std::vector<std::pair<std::ostream*, std::string>> batches;
+    size_t batchSize = 0;
+    auto lastWrite = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        // Drain the records that are ready.
+        while (true)
+        {
+            Record& record = _ring[_popPos & _mask];
+            if (record._seq.load(std::memory_order_acquire) != _popPos + 1)
+            {
+                break;
+            }
+
+            auto batchIt = batches.begin();
+            while (batchIt != batches.end() && batchIt->first != record._out)
+            {
+                ++batchIt;
+            }
+            if (batchIt == batches.end())
+            {
+                batches.emplace_back(record._out, std::string());
+                batchIt = batches.end() - 1;
+            }
+            batchIt->second += record._text;
+            batchSize += record._text.size();
+
+            record._text.clear();
+            record._out = nullptr;
+            // Free the record for the producers of the next turn of the ring.
+            record._seq.store(_popPos + _mask + 1, std::memory_order_release);
+            ++_popPos;
+        }
+
+        bool flushRequested = false;
+        bool stop = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            flushRequested = _flushRequested;
+            _flushRequested = false;
+            stop = _stop;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (flushRequested || stop || batchSize >= maxBatchSize || now - lastWrite >= _period)
+        {
+            for (auto& batch : batches)
+            {
+                batch.first->write(batch.second.data(), static_cast<std::streamsize>(batch.second.size()));
+                batch.first->flush();
+            }
+            // Forget the streams: they may be closed once flush() returns.
+            batches.clear();
+            batchSize = 0;
+            lastWrite = now;
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _writtenPos = _popPos;
+            }
+            _doneCond.notify_all();
+        }
+
+        if (stop && _popPos == _pushPos.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_flushRequested && !_stop)
+        {
+            _wakeCond.wait_for(lock, _period);
+        }
+    }
+}
+#endif // _OPENMP
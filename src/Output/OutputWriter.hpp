@@ -0,0 +1,152 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   OutputWriter.hpp
+ \brief  Background writer of formatted lines into output files.
+ \see    OutputWriter.cpp
+ */
+
+#ifndef __NOMAD_4_5_OUTPUTWRITER__
+#define __NOMAD_4_5_OUTPUTWRITER__
+
+#include <memory>
+#include <ostream>
+#include <string>
+#ifdef _OPENMP
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif // _OPENMP
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Background writer of formatted lines into output files.
+/**
+ * The history and stats lines are formatted by the threads that produce
+   them, and pushed as records (destination stream and text) into a bounded
+   multi-producer single-consumer ring buffer. Pushing does not take any lock.
+ * A background thread drains the ring buffer, batches the text per stream,
+   and writes it periodically, when the batch gets large, or when flush() is
+   called. The records of a stream are written in the order they were pushed.
+ * When the ring buffer is full, the producers wait for the writer to make room.
+ * flush() must be called before closing or reopening a stream that received
+   records.
+ * Without OpenMP, the records are written right away by the calling thread.
+ */
+class DLL_UTIL_API OutputWriter
+{
+private:
+#ifdef _OPENMP
+    /// One record of the ring buffer.
+    struct Record
+    {
+        std::atomic<size_t> _seq;   ///< Position for which the record is ready to be pushed or popped
+        std::ostream*       _out;
+        std::string         _text;
+    };
+
+    std::vector<Record>         _ring;
+    size_t                      _mask;          ///< Size of the ring minus one (the size is a power of 2)
+    std::atomic<size_t>         _pushPos;       ///< Next position for producers
+    size_t                      _popPos;        ///< Next position for the writer thread
+
+    const std::chrono::milliseconds _period;    ///< Delay between two writes of the batches
+
+    std::mutex                  _mutex;         ///< Protects the members below
+    std::condition_variable     _wakeCond;      ///< Wakes up the writer thread
+    std::condition_variable     _doneCond;      ///< Signals that the records up to _writtenPos are written
+    size_t                      _writtenPos;
+    bool                        _flushRequested;
+    bool                        _stop;
+
+    std::thread                 _thread;
+#endif // _OPENMP
+
+public:
+    /// Constructor
+    /**
+     \param capacity    Number of records in the ring buffer, rounded up to a power of 2 -- \b IN.
+     \param periodMs    Delay in milliseconds between two writes -- \b IN.
+     */
+    explicit OutputWriter(size_t capacity = 4096, size_t periodMs = 100);
+
+    /// Destructor. Writes all the pending records.
+    virtual ~OutputWriter();
+
+    /// Access to the writer shared by OutputQueue and OutputDirectToFile.
+    static std::shared_ptr<OutputWriter> getInstance();
+
+    /// Push a formatted text to be written in a stream.
+    /**
+     \param out     The destination stream. It must stay open until the next flush -- \b IN.
+     \param text    The text, including the end of line -- \b IN.
+     */
+    void push(std::ostream& out, std::string text);
+
+    /// Wait until all the records pushed so far are written and the streams flushed.
+    void flush();
+
+    static void Flush()
+    {
+        getInstance()->flush();
+    }
+
+private:
+#ifdef _OPENMP
+    /// Loop of the writer thread.
+    void run();
+#endif // _OPENMP
+};
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_OUTPUTWRITER__
@@ -88,7 +88,9 @@ NOMAD::StatsInfo::StatsInfo()
     _relativeSuccess(false),
     _comment(),
     _genStep(),
-    _success(NOMAD::SuccessType::UNDEFINED)
+    _success(NOMAD::SuccessType::UNDEFINED),
+    _hypervolume(),
+    _spacing()
 {
 }
 
@@ -265,6 +267,14 @@ NOMAD::DisplayStatsType NOMAD::StatsInfo::stringToDisplayStatsType(const std::st
     {
         ret = NOMAD::DisplayStatsType::DS_TOTAL_MODEL_EVAL;
     }
+    else if (s == "HYPERVOLUME")
+    {
+        ret = NOMAD::DisplayStatsType::DS_HYPERVOLUME;
+    }
+    else if (s == "SPACING")
+    {
+        ret = NOMAD::DisplayStatsType::DS_SPACING;
+    }
     else if (s == "TAG")
     {
         ret = NOMAD::DisplayStatsType::DS_TAG;
@@ -349,6 +359,10 @@ std::string NOMAD::StatsInfo::displayStatsTypeToString(const NOMAD::DisplayStats
             return "GEN_STEP";
         case NOMAD::DisplayStatsType::DS_SUCCESS_TYPE:
             return "SUCCESS_TYPE";
+        case NOMAD::DisplayStatsType::DS_HYPERVOLUME:
+            return "HYPERVOLUME";
+        case NOMAD::DisplayStatsType::DS_SPACING:
+            return "SPACING";
         case NOMAD::DisplayStatsType::DS_SURROGATE_EVAL:
             return "SURROGATE_EVAL";
         case NOMAD::DisplayStatsType::DS_TOTAL_MODEL_EVAL:
@@ -562,6 +576,14 @@ std::string NOMAD::StatsInfo::display(const NOMAD::DisplayStatsTypeList& format,
         {
             out += NOMAD::itos(_totalModelEval);
         }
+        else if (NOMAD::DisplayStatsType::DS_HYPERVOLUME == statsType)
+        {
+            out += (doubleFormat.empty()) ? _hypervolume.display() : _hypervolume.display(doubleFormat);
+        }
+        else if (NOMAD::DisplayStatsType::DS_SPACING == statsType)
+        {
+            out += (doubleFormat.empty()) ? _spacing.display() : _spacing.display(doubleFormat);
+        }
         else if (NOMAD::DisplayStatsType::DS_TAG == statsType)
         {
             out +=  NOMAD::itos(_tag);
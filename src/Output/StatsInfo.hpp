@@ -106,6 +106,8 @@ enum class DisplayStatsType
     DS_THREAD_NUM ,    ///< Thread number in which this evaluation was done
     DS_GEN_STEP   ,    ///< Name of the step in which this point was generated
     DS_SUCCESS_TYPE,    ///< Success type for this evaluation
+    DS_HYPERVOLUME,     ///< Hypervolume of the feasible Pareto front (DMultiMads)
+    DS_SPACING,         ///< Spacing of the feasible Pareto front (DMultiMads)
     //DS_VAR        ,    ///< One variable
     //DS_STAT_SUM   ,    ///< Stat sum
     //DS_STAT_AVG   ,    ///< Stat avg
@@ -161,6 +163,8 @@ private:
     std::string     _comment;   ///> General comment, ex. Algorithm from where this point was generated.
     std::string     _genStep;   ///> Step in which this point was generated
     SuccessType     _success;   ///> Success type for this evaluation
+    Double          _hypervolume; ///> Hypervolume of the barrier feasible points, when the barrier computes it
+    Double          _spacing;   ///> Spacing of the barrier feasible points, when the barrier computes it
 
 
 public:
@@ -212,6 +216,8 @@ public:
     void setTag(const size_t tag) { _tag = tag; }
     void setGenStep(const std::string& genStep)     { _genStep = genStep; }
     void setSuccessType(const SuccessType& success) { _success = success; }
+    void setHypervolume(const Double& hypervolume)  { _hypervolume = hypervolume; }
+    void setSpacing(const Double& spacing)          { _spacing = spacing; }
 
     // Should these stats be printed even if DISPLAY_ALL_EVAL is false
     bool alwaysDisplay(const bool displayFailed,
@@ -230,6 +230,45 @@ public:
         return _evalParams->getAttributeValue<T>(name);
     }
 
+    /**
+     Same as above, for an attribute identified by its AttributeId: no name look up.
+     */
+    template<typename T> const T&
+    getAttributeValue(const AttributeId<T> &id) const
+    {
+        if (_evalParams->isRegisteredAttribute(id))
+        {
+            return _evalParams->getAttributeValue(id);
+        }
+        else if (_evaluatorControlGlobalParams->isRegisteredAttribute(id))
+        {
+            return _evaluatorControlGlobalParams->getAttributeValue(id);
+        }
+        else if (_evaluatorControlParams->isRegisteredAttribute(id))
+        {
+            return _evaluatorControlParams->getAttributeValue(id);
+        }
+        else if (_runParams->isRegisteredAttribute(id))
+        {
+            return _runParams->getAttributeValue(id);
+        }
+        else if (_pbParams->isRegisteredAttribute(id))
+        {
+            return _pbParams->getAttributeValue(id);
+        }
+        else if (_dispParams->isRegisteredAttribute(id))
+        {
+            return _dispParams->getAttributeValue(id);
+        }
+        else if (_cacheParams->isRegisteredAttribute(id))
+        {
+            return _cacheParams->getAttributeValue(id);
+        }
+
+        std::string err = "getAttributeValue: attribute " + attributeIdName(id._index) + " is not registered";
+        throw Exception(__FILE__, __LINE__, err);
+    }
+
     const std::shared_ptr<CacheParameters>&             getCacheParams() const { return _cacheParams; }
     const std::shared_ptr<DeprecatedParameters>&        getDeprecatedParams() const { return _deprecatedParams; }
     const std::shared_ptr<DisplayParameters>&           getDispParams() const { return _dispParams; }
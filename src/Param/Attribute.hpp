@@ -55,6 +55,8 @@
 #ifndef __NOMAD_4_5_ABSTRACTATTRIBUTE__
 #define __NOMAD_4_5_ABSTRACTATTRIBUTE__
 
+#include <memory>
+
 #include "../Util/defines.hpp"
 
 #include "../nomad_nsbegin.hpp"
@@ -96,6 +98,9 @@ public:
 
     virtual void resetToDefaultValue() = 0;
 
+    /// Copy of this attribute, with its current value. Used for copy-on-write (see Parameters::shareAttributes).
+    virtual std::shared_ptr<Attribute> clone() const = 0;
+
     Attribute (const std::string& Name, bool algoCompatibilityCheck,
                bool restartAttribute, bool uniqueEntry,
                const std::string& ShortInfo,
@@ -0,0 +1,111 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   AttributeId.cpp
+ \brief  Typed identifiers of the attributes of the parameters (implementation)
+ \see    AttributeId.hpp
+ */
+
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "../Param/AttributeId.hpp"
+
+namespace
+{
+    // Name and type name of each attribute, ordered by index.
+    struct AttributeIdTable
+    {
+        std::vector<std::string> _names;
+        std::vector<std::string> _typeNames;
+        std::unordered_map<std::string, size_t> _indexOfName;
+
+        AttributeIdTable()
+        {
+#define NOMAD_ATTRIBUTE_ID(attName, attType) \
+            _names.push_back(#attName); \
+            _typeNames.push_back(typeid(attType).name());
+            #include "../Attribute/attributeIdsDefinition.hpp"
+            NOMAD_OTHER_ATTRIBUTE_IDS
+#undef NOMAD_ATTRIBUTE_ID
+
+            for (size_t index = 0; index < _names.size(); index++)
+            {
+                _indexOfName[_names[index]] = index;
+            }
+        }
+    };
+
+    const AttributeIdTable& attributeIdTable()
+    {
+        static const AttributeIdTable table;
+        return table;
+    }
+}
+
+
+size_t NOMAD::attributeIdIndex(const std::string& name)
+{
+    const auto& indexOfName = attributeIdTable()._indexOfName;
+    auto it = indexOfName.find(name);
+    return (it != indexOfName.end()) ? it->second : NOMAD::AttributeIndex::NB_ATTRIBUTES;
+}
+
+
+const std::string& NOMAD::attributeIdName(size_t index)
+{
+    return attributeIdTable()._names.at(index);
+}
+
+
+const std::string& NOMAD::attributeIdTypeName(size_t index)
+{
+    static const std::string noType;
+    const auto& typeNames = attributeIdTable()._typeNames;
+    return (index < typeNames.size()) ? typeNames[index] : noType;
+}
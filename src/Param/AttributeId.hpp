@@ -0,0 +1,137 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   AttributeId.hpp
+ \brief  Typed identifiers of the attributes of the parameters.
+ \see    AttributeId.cpp
+ */
+
+#ifndef __NOMAD_4_5_ATTRIBUTEID__
+#define __NOMAD_4_5_ATTRIBUTEID__
+
+#include <string>
+
+#include "../Math/ArrayOfDouble.hpp"
+#include "../Math/ArrayOfPoint.hpp"
+#include "../Math/Double.hpp"
+#include "../Math/Point.hpp"
+#include "../Type/BBInputType.hpp"
+#include "../Type/BBOutputType.hpp"
+#include "../Type/ComputeType.hpp"
+#include "../Type/DirectionType.hpp"
+#include "../Type/DMultiMadsSearchStrategyType.hpp"
+#include "../Type/EvalSortType.hpp"
+#include "../Type/LHSearchType.hpp"
+#include "../Type/ListOfVariableGroup.hpp"
+#include "../Type/SgtelibModelFeasibilityType.hpp"
+#include "../Type/SgtelibModelFormulationType.hpp"
+#include "../Util/ArrayOfString.hpp"
+#include "../nomad_platform.hpp"
+
+#include "../nomad_nsbegin.hpp"
+
+/// Attributes registered directly by RunParameters::init(), not in the definition files.
+#define NOMAD_OTHER_ATTRIBUTE_IDS \
+    NOMAD_ATTRIBUTE_ID( EPSILON, NOMAD::Double ) \
+    NOMAD_ATTRIBUTE_ID( UNDEF_STR, std::string ) \
+    NOMAD_ATTRIBUTE_ID( NOMAD_VERSION, std::string ) \
+    NOMAD_ATTRIBUTE_ID( INF_STR, std::string ) \
+    NOMAD_ATTRIBUTE_ID( PROBLEM_DIR, std::string )
+
+
+/// Index of each attribute in the flat attribute table of Parameters.
+namespace AttributeIndex
+{
+    enum : size_t
+    {
+#define NOMAD_ATTRIBUTE_ID(attName, attType) attName,
+        #include "../Attribute/attributeIdsDefinition.hpp"
+        NOMAD_OTHER_ATTRIBUTE_IDS
+#undef NOMAD_ATTRIBUTE_ID
+        NB_ATTRIBUTES       ///< Number of attributes
+    };
+}
+
+
+/// Typed identifier of an attribute.
+/**
+ Used instead of the attribute name to get or set an attribute value
+ (see Parameters::getAttributeValue and AllParameters::getAttributeValue):
+ the value is accessed by index in the attribute table, without looking up
+ the name, and its type is checked at compile time. \n
+ Example: \code params->getAttributeValue(NOMAD::Attr::MAX_BB_EVAL) \endcode
+ */
+template<typename T>
+struct AttributeId
+{
+    typedef T Type;     ///< Type of the attribute value
+    size_t _index;      ///< Index in AttributeIndex
+};
+
+
+/// The identifiers of all the attributes, named like the attributes.
+namespace Attr
+{
+#define NOMAD_ATTRIBUTE_ID(attName, attType) constexpr AttributeId<attType> attName { AttributeIndex::attName };
+    #include "../Attribute/attributeIdsDefinition.hpp"
+    NOMAD_OTHER_ATTRIBUTE_IDS
+#undef NOMAD_ATTRIBUTE_ID
+}
+
+
+/// Index of the attribute with this name (in capital letters), or AttributeIndex::NB_ATTRIBUTES if there is none.
+DLL_UTIL_API size_t attributeIdIndex(const std::string& name);
+
+/// Name of the attribute with this index.
+DLL_UTIL_API const std::string& attributeIdName(size_t index);
+
+/// Type name (\c typeid(T).name()) of the attribute with this index. Empty string if the index is not valid.
+DLL_UTIL_API const std::string& attributeIdTypeName(size_t index);
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_ATTRIBUTEID__
@@ -107,6 +107,35 @@ void NOMAD::CacheParameters::checkAndComply(const std::shared_ptr<NOMAD::RunPara
         }
     }
 
+    /*----------------------------*/
+    /* Cache type                 */
+    /*----------------------------*/
+    std::string cacheType = getAttributeValueProtected<std::string>("CACHE_TYPE", false);
+    NOMAD::toupper(cacheType);
+    if ("SET" != cacheType && "SHARDED" != cacheType)
+    {
+        std::string err = "Parameter CACHE_TYPE must be SET or SHARDED. Value provided: " + cacheType;
+        throw NOMAD::InvalidParameter(__FILE__,__LINE__, err);
+    }
+    setAttributeValue("CACHE_TYPE", cacheType);
+
+    if (0 == getAttributeValueProtected<size_t>("CACHE_NB_SHARDS", false))
+    {
+        throw NOMAD::InvalidParameter(__FILE__,__LINE__, "Parameter CACHE_NB_SHARDS must be positive.");
+    }
+
+    /*----------------------------*/
+    /* Cache file format          */
+    /*----------------------------*/
+    std::string cacheFileFormat = getAttributeValueProtected<std::string>("CACHE_FILE_FORMAT", false);
+    NOMAD::toupper(cacheFileFormat);
+    if ("TEXT" != cacheFileFormat && "BINARY" != cacheFileFormat)
+    {
+        std::string err = "Parameter CACHE_FILE_FORMAT must be TEXT or BINARY. Value provided: " + cacheFileFormat;
+        throw NOMAD::InvalidParameter(__FILE__,__LINE__, err);
+    }
+    setAttributeValue("CACHE_FILE_FORMAT", cacheFileFormat);
+
     _toBeChecked = false;
 
 }
@@ -184,6 +184,20 @@ void NOMAD::DisplayParameters::checkAndComply(
         setAttributeValue("EVAL_STATS_FILE", evalStatsFileName);
     }
 
+    /*------------------------------------------------------*/
+    /* Profile files                                        */
+    /*------------------------------------------------------*/
+    for (const std::string& profileParamName : { "PROFILE_FILE", "PROFILE_TRACE_FILE" })
+    {
+        auto profileFileName = getAttributeValueProtected<std::string>(profileParamName, false);
+        if (!profileFileName.empty())
+        {
+            auto seed = runParams->getAttributeValue<int>("SEED");
+            NOMAD::completeFileName(profileFileName, problemDir, addSeedToFileNames, seed);
+            setAttributeValue(profileParamName, profileFileName);
+        }
+    }
+
     /*------------------------------------------------------*/
     /* History file                                           */
     /*------------------------------------------------------*/
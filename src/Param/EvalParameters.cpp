@@ -116,6 +116,17 @@ void NOMAD::EvalParameters::checkAndComply(const std::shared_ptr<NOMAD::RunParam
     updateExeParam(runParams, "BB_EXE");
     updateExeParam(runParams, "SURROGATE_EXE");
 
+    if (getAttributeValueProtected<bool>("BB_EXE_SERVER", false))
+    {
+#ifdef _WIN32
+        throw NOMAD::InvalidParameter(__FILE__, __LINE__, "Parameter BB_EXE_SERVER is not available on Windows.");
+#endif
+        if (!getAttributeValueProtected<bool>("BB_REDIRECTION", false))
+        {
+            throw NOMAD::InvalidParameter(__FILE__, __LINE__, "Parameter BB_EXE_SERVER requires BB_REDIRECTION to be true: The outputs are read from the standard output of BB_EXE.");
+        }
+    }
+
 
     /*----------------*/
     /* BB_OUTPUT_TYPE */
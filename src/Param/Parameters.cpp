@@ -132,6 +132,12 @@ void NOMAD::Parameters::copyParameters(const Parameters& params)
             auto value = params.getAttributeValue<NOMAD::LHSearchType>(paramName);
             setAttributeValue(paramName, value );
         }
+        // LHDesignType
+        else if (paramType == typeid(NOMAD::LHDesignType).name())
+        {
+            auto value = params.getAttributeValue<NOMAD::LHDesignType>(paramName);
+            setAttributeValue(paramName, value);
+        }
         // SgtelibModelFeasibilityType
         else if (paramType == typeid(NOMAD::SgtelibModelFeasibilityType).name())
         {
@@ -206,8 +212,40 @@ void NOMAD::Parameters::copyParameters(const Parameters& params)
 }
 
 
+// The copy-on-write copy of parameters. Used only by derived object that implemented the overlay constructor
+void NOMAD::Parameters::shareAttributes(const Parameters& params)
+{
+    _typeName = params._typeName;
+    _toBeChecked = params._toBeChecked;
+    _attributes = params._attributes;
+    _attributeTable = params._attributeTable;
+    _streamedAttribute << params._streamedAttribute.str();
+
+    // From now on, all attributes are shared by params and *this:
+    // - the attributes of params are no longer owned by params;
+    // - no attribute is owned by *this (_ownedGeneration is 0).
+    params._shareGeneration++;
+}
+
+
+const NOMAD::SPtrAtt& NOMAD::Parameters::ownAttribute(size_t index)
+{
+    if (_ownedGeneration[index] != _shareGeneration)
+    {
+        auto att = _attributeTable[index]->clone();
+
+        // The set is ordered by attribute name: erase the shared attribute and insert its copy.
+        _attributes.erase(_attributeTable[index]);
+        _attributes.insert(att);
+
+        _attributeTable[index] = att;
+        _ownedGeneration[index] = _shareGeneration;
+    }
+    return _attributeTable[index];
+}
+
+
 // Initialize static members
-std::map<std::string,std::string> NOMAD::Parameters::_typeOfAttributes;
 NOMAD::ParameterEntries NOMAD::Parameters::_paramEntries;
 
 const NOMAD::AttributeSet NOMAD::Parameters::getAttributes() const
@@ -238,10 +276,13 @@ std::vector<std::string> NOMAD::Parameters::getAttributeNames() const
 // All registered attributes are reset to their default value
 void NOMAD::Parameters::resetToDefaultValues() noexcept
 {
-    for_each(_attributes.begin(), _attributes.end(), [](const SPtrAtt& att)
+    for (size_t index = 0; index < _attributeTable.size(); index++)
     {
-        att->resetToDefaultValue();
-    });
+        if (nullptr != _attributeTable[index])
+        {
+            ownAttribute(index)->resetToDefaultValue();
+        }
+    }
 
     _toBeChecked = true;
 }
@@ -250,17 +291,17 @@ void NOMAD::Parameters::resetToDefaultValues() noexcept
 // Reset this particular attribute to its default value
 void NOMAD::Parameters::resetToDefaultValue(const std::string& paramName)
 {
-    // Get attribute from which to get value
-    SPtrAtt att = getAttribute(paramName);
+    auto name = paramName;
+    NOMAD::toupper(name);
+    const size_t index = NOMAD::attributeIdIndex(name);
 
-    if (nullptr == att)
+    if (NOMAD::AttributeIndex::NB_ATTRIBUTES == index || nullptr == _attributeTable[index])
     {
-        // At this point, Verify att is non-null.
         std::string err = "resetToDefaultValue: attribute " + paramName + " does not exist";
         throw NOMAD::Exception(__FILE__, __LINE__, err);
     }
 
-    att->resetToDefaultValue();
+    ownAttribute(index)->resetToDefaultValue();
 
     _toBeChecked = true;
 }
@@ -482,6 +523,18 @@ bool NOMAD::Parameters::isAlgoCompatible(const NOMAD::Parameters *p)
                     isCompatible = false;
                 }
             }
+            // LHDesignType
+            else if ( paramType == typeid(NOMAD::LHDesignType).name() )
+            {
+                if ( getAttributeValueProtected<NOMAD::LHDesignType>(paramName,false) != p->getAttributeValueProtected<NOMAD::LHDesignType>(paramName,false) )
+                {
+                    std::ostringstream oss;
+                    oss << getAttributeValueProtected<NOMAD::LHDesignType>(paramName,false) << std::endl;
+                    oss << p->getAttributeValueProtected<NOMAD::LHDesignType>(paramName,false);
+                    sdebug = oss.str();
+                    isCompatible = false;
+                }
+            }
             // SgtelibModelFeasibilityType
             else if ( paramType == typeid(NOMAD::SgtelibModelFeasibilityType).name() )
             {
@@ -803,6 +856,12 @@ void NOMAD::Parameters::readEntries(const bool overwrite, std::string problemDir
                 auto lhSearch = NOMAD::LHSearchType(allValues);
                 setAttributeValue(paramName, lhSearch);
             }
+            // LHDesignType
+            else if (paramType == typeid(NOMAD::LHDesignType).name())
+            {
+                checkFormat1(pe);
+                setAttributeValue(paramName, NOMAD::stringToLHDesignType(pe->getAllValues()));
+            }
             // SgtelibModelFeasibilityType
             else if (paramType == typeid(NOMAD::SgtelibModelFeasibilityType).name())
             {
@@ -1225,20 +1284,12 @@ NOMAD::SPtrAtt NOMAD::Parameters::getAttribute(std::string name) const
 {
     NOMAD::toupper(name);
 
-    auto it =   find_if(_attributes.begin(), _attributes.end(),
-                        [name](NOMAD::SPtrAtt const& Att)
-                        {
-                            return name.compare(Att->getName()) == 0;
-                        });
-
-    if (it != _attributes.end())
-    {
-        return *it;
-    }
-    else
+    const size_t index = NOMAD::attributeIdIndex(name);
+    if (NOMAD::AttributeIndex::NB_ATTRIBUTES == index)
     {
         return nullptr;
     }
+    return _attributeTable[index];
 }
 
 
@@ -1535,6 +1586,15 @@ void NOMAD::Parameters::registerAttributes( const std::vector<NOMAD::AttributeDe
                                algoCompatibilityCheck, restartAttribute,
                                uniqueEntry, att._shortInfo , att._helpInfo, keywordsPlus );
         }
+        // LHDesignType
+        else if (   att._type== "NOMAD::LHDesignType"
+                    || att._type== "LHDesignType")
+        {
+            registerAttribute( att._name,
+                               NOMAD::stringToLHDesignType(att._defaultValue),
+                               algoCompatibilityCheck, restartAttribute,
+                               uniqueEntry, att._shortInfo , att._helpInfo, keywordsPlus );
+        }
         // SgtelibModelFeasibilityType
         else if (   att._type== "NOMAD::SgtelibModelFeasibilityType"
                  || att._type== "SgtelibModelFeasibilityType")
@@ -48,6 +48,7 @@
 #define __NOMAD_4_5_PARAMETERS__
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <map>
 #include <set>
@@ -60,6 +61,7 @@
 #include "../Type/ListOfVariableGroup.hpp"
 #include "../Type/DirectionType.hpp"
 #include "../Param/AttributeFactory.hpp"
+#include "../Param/AttributeId.hpp"
 #include "../Param/ParameterEntries.hpp"
 #include "../nomad_platform.hpp"
 
@@ -107,6 +109,10 @@ struct AttributeDefinition
 };
 
 
+/// Tag to construct parameters as a copy-on-write overlay of other parameters (see Parameters::shareAttributes).
+struct ParametersOverlay {};
+
+
 /// Exception class for an invalid parameter.
 class InvalidParameter : public Exception
 {
@@ -169,10 +175,18 @@ protected:
     AttributeSet _attributes;
 
     /**
-     Map of attribute names and type name as string.
-     Static to the class.
+     The same attributes, by index (see AttributeIndex and AttributeId).
+     nullptr for the attributes not registered in these parameters.
      */
-    static std::map<std::string,std::string> _typeOfAttributes;
+    std::vector<SPtrAtt> _attributeTable;
+
+    /**
+     Copy-on-write of the attributes shared with overlays (see shareAttributes).
+     An attribute is owned by these parameters, and can be modified in place,
+     if its generation in _ownedGeneration equals _shareGeneration.
+     */
+    mutable std::atomic<size_t> _shareGeneration;   ///< Incremented each time an overlay shares these attributes
+    std::vector<size_t> _ownedGeneration;           ///< Generation at which each attribute was owned
 
     /// Constructors
     /**
@@ -181,7 +195,10 @@ protected:
     explicit Parameters()
       : _typeName("Unknown"),
         _toBeChecked(true),
-        _attributes()
+        _attributes(),
+        _attributeTable(AttributeIndex::NB_ATTRIBUTES, nullptr),
+        _shareGeneration(1),
+        _ownedGeneration(AttributeIndex::NB_ATTRIBUTES, 0)
     {
     }
 
@@ -201,6 +218,22 @@ protected:
      */
     void copyParameters ( const Parameters& params );
 
+    /// Copy-on-write copy of parameters
+    /**
+     Used by the overlay constructor of selected derived type of parameters,
+     for subproblems that change few attributes of their parent parameters.
+     The attributes of params are shared, not copied, along with their
+     checked state: if no attribute is set, checkAndComply() has nothing to do.
+     An attribute is copied the first time it is set, either in the overlay or
+     in params.
+     \note Pointers obtained by getTypeAttribute do not follow an attribute
+     that is set after it has been shared.
+     */
+    void shareAttributes ( const Parameters& params );
+
+    /// Get the attribute at this index, after copying it if it is shared with other parameters (see shareAttributes).
+    const SPtrAtt& ownAttribute(size_t index);
+
     virtual ~Parameters() {}
 
 
@@ -317,9 +350,8 @@ public:
         }
 
         // Verify attribute type
-        // Must use map access with "at" (not []) because the function is const
         const std::string &typeTName = typeid(T).name();
-        if (typeTName != _typeOfAttributes.at(name))
+        if (typeTName != getAttributeType(name))
         {
             std::string err = "In getAttributeValue<T> the attribute ";
             err += name + " is not of type T = " + typeTName;
@@ -371,7 +403,7 @@ protected:
     /*-------------------*/
     // This template function implementation must be in the header to be available in the library
     /**
-     Insert a new attribute by its name and type (a duplicate attribute triggers exception). Call for the AttributeFactor::Create function to create an Attribute with a templated type. Register the type (as a string) and the name of an Attribute into Parameters::_typeOfAttributes.
+     Insert a new attribute by its name and type (a duplicate attribute triggers exception). Call for the AttributeFactor::Create function to create an Attribute with a templated type. The attribute must have an identifier of the same type (see AttributeId) and is also stored at its index in Parameters::_attributeTable.
      See Parameters::_definition for details.
      */
     template<typename T, typename ... ARGS>
@@ -394,6 +426,23 @@ protected:
 
         NOMAD::toupper(name);
 
+        const size_t index = attributeIdIndex(name);
+        if (AttributeIndex::NB_ATTRIBUTES == index)
+        {
+            std::string err = "Attribute " + name;
+            err += " has no identifier. It must be in an attribute definition file, or in NOMAD_OTHER_ATTRIBUTE_IDS (see AttributeId.hpp).";
+            throw Exception(__FILE__,__LINE__, err);
+        }
+
+        std::string typeName = typeid(T).name();
+        if (typeName != attributeIdTypeName(index))
+        {
+            std::string err = "Trying to add attribute " + name;
+            err += " with type " + typeName;
+            err += " which is different from the type of its identifier " + attributeIdTypeName(index);
+            throw Exception(__FILE__,__LINE__, err);
+        }
+
         auto attribute = AttributeFactory{}.Create<T>(name, default_value,
                                                       algoCompatibilityCheck, restartAttribute, uniqueEntry,
                                                       std::forward<ARGS>(infoArgs)...);
@@ -405,31 +454,17 @@ protected:
             std::string err = "Attribute " + name + " is already in set of attributes.";
             throw Exception(__FILE__,__LINE__, err);
         }
-
-        std::string typeName = typeid(T).name();
-        auto nameTypePair = std::pair<std::string, std::string>(name, typeName);
-        auto ret_t = _typeOfAttributes.insert(nameTypePair);
-
-        if ( !ret_t.second )
-        {
-            // Attribute is already in the map of attribute types.
-            // Verify the type is the same.
-            if ( _typeOfAttributes[name] != typeName )
-            {
-                std::string err = "Trying to add attribute " + name;
-                err += " with type " + typeName;
-                err += " which is different from registered type " + _typeOfAttributes[name];
-                throw Exception(__FILE__,__LINE__, err);
-            }
-        }
+        _attributeTable[index] = attribute;
+        _ownedGeneration[index] = _shareGeneration;
 
     }
 
-    const std::string& getAttributeType(const std::string& name)
+    /// Type name (\c typeid(T).name()) of the attribute. Empty string if there is no such attribute.
+    const std::string& getAttributeType(const std::string& name) const
     {
         auto namecaps = name;
         NOMAD::toupper(namecaps);
-        return _typeOfAttributes[namecaps];
+        return attributeIdTypeName(attributeIdIndex(namecaps));
     }
 
     SPtrAtt getAttribute(std::string name) const;
@@ -437,38 +472,26 @@ protected:
     
 
 
-    // getSpValue: value is of correct type for parameter name.
+    // getSpValue: value is of correct type for parameter identified by id.
     template<typename T>
-    const T&  getSpValue(const std::string &name, bool flagCheckException, bool flagDefault = false) const
+    const T&  getSpValue(const AttributeId<T> &id, bool flagCheckException, bool flagDefault = false) const
     {
-        // Get attribute from which to get value
-        SPtrAtt att;
-        att = getAttribute(name);
+        const SPtrAtt& att = _attributeTable[id._index];
 
         if (nullptr == att)
         {
-            // At this point, Verify att is non-null.
-            std::string err = "getAttributeValue: attribute " + name + " does not exist";
+            std::string err = "getAttributeValue: attribute " + attributeIdName(id._index);
+            err += " is not registered in " + _typeName + " parameters";
             throw Exception(__FILE__, __LINE__, err);
         }
 
-        // Verify attribute type
-        // Must use map access with "at" (not []) because the function is const
-        const std::string &typeTName = typeid(T).name();
-        if (typeTName != _typeOfAttributes.at(name))
-        {
-            std::string err = "In getAttributeValue<T> the attribute ";
-            err += name + " is not of type T = " + typeTName;
-            throw Exception(__FILE__,__LINE__, err);
-        }
-
         // Note: we use getAttributeValue in init() and checkAndComply().
         // We cannot verify toBeChecked() here. It has to be verified at
         // another level.
 
         // Get value from attribute
-        // Dynamic cast to the selected TypeAttribute
-        std::shared_ptr<TypeAttribute<T>> sp = std::dynamic_pointer_cast<TypeAttribute<T>>(att);
+        // The type of the attribute is the type of its identifier (verified by registerAttribute).
+        const TypeAttribute<T>* sp = static_cast<const TypeAttribute<T>*>(att.get());
 
         if (flagDefault)
         {
@@ -478,16 +501,40 @@ protected:
         else
         {
             // All attributes except DIMENSION must be checked before accessing the value
-            if ( _toBeChecked && flagCheckException && name != "DIMENSION" )
+            if ( _toBeChecked && flagCheckException && AttributeIndex::DIMENSION != id._index )
             {
                 std::string err = "In getAttributeValue<T> the attribute ";
-                err += name + " has not been checked";
+                err += attributeIdName(id._index) + " has not been checked";
                 throw ParameterToBeChecked(__FILE__,__LINE__, err);
             }
             return sp->getValue();
         }
     }
 
+    // getSpValue: value is of correct type for parameter name.
+    template<typename T>
+    const T&  getSpValue(const std::string &name, bool flagCheckException, bool flagDefault = false) const
+    {
+        const size_t index = attributeIdIndex(name);
+
+        if (AttributeIndex::NB_ATTRIBUTES == index || nullptr == _attributeTable[index])
+        {
+            std::string err = "getAttributeValue: attribute " + name + " does not exist";
+            throw Exception(__FILE__, __LINE__, err);
+        }
+
+        // Verify attribute type
+        const std::string &typeTName = typeid(T).name();
+        if (typeTName != attributeIdTypeName(index))
+        {
+            std::string err = "In getAttributeValue<T> the attribute ";
+            err += name + " is not of type T = " + typeTName;
+            throw Exception(__FILE__,__LINE__, err);
+        }
+
+        return getSpValue(AttributeId<T>{index}, flagCheckException, flagDefault);
+    }
+
 
     /*----------------------------*/
     /* getAttributeValueProtected */
@@ -515,7 +562,7 @@ protected:
     {
         auto namecaps = name;
         NOMAD::toupper(namecaps);
-        if (typeid(ArrayOfPoint).name() == _typeOfAttributes.at(namecaps))
+        if (typeid(ArrayOfPoint).name() == getAttributeType(namecaps))
         {
             // Special case: Attribute type is an ArrayOfPoint, but user asks to
             // return a Point.
@@ -566,6 +613,16 @@ public:
         return getAttributeValueProtected<T>(namecaps,true,flagDefault);
     }
 
+    /**
+     Get the attribute value from its identifier, without looking up its name. Example: \code getAttributeValue(Attr::MAX_BB_EVAL) \endcode
+     As for the name version, the parameters must have been checked.
+     */
+    template<typename T> const T&
+    getAttributeValue(const AttributeId<T> &id, bool flagDefault = false) const
+    {
+        return getSpValue(id, true, flagDefault);
+    }
+
     /**
      This function is called by AllParameters::readParamLine to identify the type of an attribute given in a file. If the attribute has not been registered, an error message is displayed but no exception is triggered and the execution continues.
      */
@@ -606,8 +663,7 @@ public:
         NOMAD::toupper(namecaps);
         auto att = getAttribute(name);
 
-        // Must use map access with "at" (not []) because the function is const
-        if (typeTName != _typeOfAttributes.at(namecaps))
+        if (typeTName != getAttributeType(namecaps))
         {
             std::string err = "In isAttributeDefaultValue<T> : the attribute " + name;
             err += " is not of type T = " + typeTName;
@@ -637,28 +693,39 @@ public:
     template<typename T>
     void setSpValueDefault(const std::string& name, T value)
     {
-        auto att = getAttribute(name);
+        const size_t index = attributeIdIndex(name);
 
-        if (nullptr == att)
+        if (AttributeIndex::NB_ATTRIBUTES == index || nullptr == _attributeTable[index])
         {
             // At this point, Verify att is non-null.
             std::string err = "setSpValueDefault: attribute " + name + " does not exist";
             throw Exception(__FILE__, __LINE__, err);
         }
-        // Dynamic cast to the selected TypeAttribute
-        std::shared_ptr<TypeAttribute<T>> sp = std::dynamic_pointer_cast<TypeAttribute<T>>( att );
 
         const std::string &typeTName = typeid(T).name();
-        if (typeTName != _typeOfAttributes[name])
+        if (typeTName != attributeIdTypeName(index))
         {
             std::string err = "setSpValueDefault<T> : the attribute " + name;
-            err += " is of type " + _typeOfAttributes[name];
+            err += " is of type " + attributeIdTypeName(index);
             err += " and not of type T = " + typeTName;
             throw Exception(__FILE__,__LINE__, err);
         }
+
+        setSpValue(AttributeId<T>{index}, std::move(value));
+    }
+
+    /**
+     Set the value of the attribute identified by id. The value is of the type of the attribute.
+     */
+    template<typename T>
+    void setSpValue(const AttributeId<T>& id, T value)
+    {
+        // The type of the attribute is the type of its identifier (verified by registerAttribute).
+        TypeAttribute<T>* sp = static_cast<TypeAttribute<T>*>(ownAttribute(id._index).get());
+
         if (!sp->uniqueEntry())
         {
-            if (typeid(ArrayOfString).name() == _typeOfAttributes.at(name))
+            if (typeid(ArrayOfString) == typeid(T))
             {
                 // Special case for DISPLAY parameter
                 ArrayOfString* valueAsAos = (ArrayOfString*)(&value);
@@ -698,7 +765,7 @@ public:
      */
     void setSpValue(const std::string& name, const Point& value)
     {
-        if (typeid(ArrayOfPoint).name() == _typeOfAttributes.at(name))
+        if (typeid(ArrayOfPoint).name() == getAttributeType(name))
         {
             // Special case: Attribute type is an ArrayOfPoint, but user sets
             // a Point.
@@ -722,7 +789,7 @@ public:
      */
     void setSpValue(const std::string& name, DirectionType value)
     {
-        if (typeid(DirectionTypeList).name() == _typeOfAttributes.at(name))
+        if (typeid(DirectionTypeList).name() == getAttributeType(name))
         {
             // Special case: Attribute type is an DirectionTypeList, but user sets
             // a DirectionType.
@@ -746,7 +813,7 @@ public:
      */
     void setSpValue(const std::string& name, const std::string& value)
     {
-        if (typeid(ArrayOfString).name() == _typeOfAttributes.at(name))
+        if (typeid(ArrayOfString).name() == getAttributeType(name))
         {
             // Special case: Attribute type is an ArrayOfString, but user sets
             // a string.
@@ -770,7 +837,7 @@ public:
      */
     void setSpValue(const std::string& name, int value)
     {
-        if (typeid(size_t).name() == _typeOfAttributes.at(name))
+        if (typeid(size_t).name() == getAttributeType(name))
         {
             // Special case: Attribute type is a size_t, but user sets
             // an int.
@@ -818,6 +885,32 @@ public:
         _toBeChecked = true;
     }
 
+    /**
+     Set the attribute value from its identifier, without looking up its name. Example: \code setAttributeValue(Attr::MAX_BB_EVAL, size_t(100)) \endcode
+     The value must be of the type of the attribute.
+     */
+    template<typename T>
+    void setAttributeValue(const AttributeId<T>& id, const typename AttributeId<T>::Type& value)
+    {
+        if (nullptr == _attributeTable[id._index])
+        {
+            std::string err = "setAttributeValue: attribute " + attributeIdName(id._index);
+            err += " is not registered in " + _typeName + " parameters";
+            throw Exception(__FILE__, __LINE__, err);
+        }
+
+        setSpValue(id, value);
+
+        _toBeChecked = true;
+    }
+
+    /// \return \c true if the attribute identified by id is registered in these parameters.
+    template<typename T>
+    bool isRegisteredAttribute(const AttributeId<T>& id) const
+    {
+        return (nullptr != _attributeTable[id._index]);
+    }
+
     auto getAttributeShortInfo(const std::string &name)
     -> decltype(getAttribute(name)->getShortInfo())
     {
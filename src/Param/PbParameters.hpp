@@ -81,6 +81,16 @@ public:
      */
     PbParameters(const PbParameters& params) : PbParameters() { copyParameters(params); }
 
+    /**
+     Overlay of params for a subproblem: the attributes are shared with params and copied only when set. See Parameters::shareAttributes.
+     */
+    PbParameters(const PbParameters& params, ParametersOverlay)
+      : Parameters(),
+        _showWarningMeshSizeRedefined(params._showWarningMeshSizeRedefined)
+    {
+        shareAttributes(params);
+    }
+
     /// Check the sanity of parameters.
     void checkAndComply( );
 
@@ -341,6 +341,22 @@ void NOMAD::RunParameters::checkAndComply(
             err = "DMultiMads does not support the MEGA_SEARCH_POLL option. To deactivate, set MEGA_SEARCH_POLL to FALSE";
             throw NOMAD::Exception(__FILE__,__LINE__, err);
         }
+
+        // The number of objectives is checked when the barrier is created.
+        const auto& hvReferencePoint = getAttributeValueProtected<NOMAD::ArrayOfString>("DMULTIMADS_HV_REFERENCE_POINT", false);
+        for (size_t i = 0; i < hvReferencePoint.size(); i++)
+        {
+            NOMAD::Double d;
+            if (!d.atof(hvReferencePoint[i]) || !d.isDefined())
+            {
+                err = "Parameters check: DMULTIMADS_HV_REFERENCE_POINT must be a list of real values. Invalid value: " + hvReferencePoint[i];
+                throw NOMAD::Exception(__FILE__,__LINE__, err);
+            }
+        }
+        if (getAttributeValueProtected<NOMAD::Double>("DMULTIMADS_HV_STALL_TOLERANCE", false) < 0)
+        {
+            throw NOMAD::Exception(__FILE__,__LINE__, "Parameters check: DMULTIMADS_HV_STALL_TOLERANCE must be non negative" );
+        }
     }
 
     // Precisions on MEGA_SEARCH_POLL
@@ -727,6 +743,7 @@ void NOMAD::RunParameters::setStaticParameters()
             NOMAD::RNG::setSeed (seedToSet);
         }
     }
+    NOMAD::RNG::setStreamsEnabled( getAttributeValueProtected<bool>("RNG_STREAMS",false) );
     NOMAD::Double::setEpsilon ( getAttributeValueProtected<NOMAD::Double>("EPSILON",false).todouble() );
     NOMAD::Double::setHMin ( getAttributeValueProtected<NOMAD::Double>("H_MIN",false).todouble() );
     NOMAD::Double::setUndefStr ( getAttributeValueProtected<std::string>("UNDEF_STR",false) );
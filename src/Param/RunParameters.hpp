@@ -82,6 +82,15 @@ public:
     RunParameters& operator=(const RunParameters& params) { copyParameters(params) ; _mapDirTypeToVG =  params.getMapDirTypeToVG(); return *this; }
     RunParameters(const RunParameters& params) : RunParameters() { copyParameters(params); _mapDirTypeToVG =  params.getMapDirTypeToVG(); }
 
+    /// Overlay of params for a subproblem: the attributes are shared with params and copied only when set. See Parameters::shareAttributes.
+    RunParameters(const RunParameters& params, ParametersOverlay)
+    : Parameters(),
+      _mapDirTypeToVG(params._mapDirTypeToVG),
+      _fixVGForQMS(params._fixVGForQMS)
+    {
+        shareAttributes(params);
+    }
+
     /// Check the sanity of parameters.
     /**
      Register and set default values for all run attributes. The information to register all the attributes is contained in runAttributesDefinition.hpp as a set of strings to be interpreted. This file is created by the writeAttributeDefinition executable, called automatically by makefile when the runAttributeDefinition.txt file is modified.
@@ -113,6 +113,8 @@ public:
 
     void resetToDefaultValue() noexcept { _value = _initValue;}
 
+    std::shared_ptr<Attribute> clone() const override { return std::make_shared<TypeAttribute<T>>(*this); }
+
 };
 
 
@@ -57,6 +57,8 @@
 #include "../Util/Exception.hpp"
 #include "../Util/utils.hpp"
 
+#include <algorithm>    // For std::equal
+
 
 // Convert a string (ex "OBJ", "EB", "PB"...)
 // to a NOMAD::BBOutputType.
@@ -137,6 +139,36 @@ std::string NOMAD::BBOutputTypeListToString( const BBOutputTypeList & bbotList )
 }
 
 
+// Positions of the objectives and constraints, for the last list seen by this thread.
+const NOMAD::BBOutputTypeIndices& NOMAD::getBBOutputTypeIndices(const BBOutputTypeList& bbotList)
+{
+    static thread_local NOMAD::BBOutputTypeList lastList;
+    static thread_local NOMAD::BBOutputTypeIndices lastIndices;
+
+    // Comparing the types is much cheaper than allocating the tables.
+    if (bbotList.size() != lastList.size()
+        || !std::equal(bbotList.begin(), bbotList.end(), lastList.begin()))
+    {
+        lastList = bbotList;
+        lastIndices.objIndices.clear();
+        lastIndices.constraintIndices.clear();
+        for (size_t i = 0; i < bbotList.size(); i++)
+        {
+            if (bbotList[i].isObjective())
+            {
+                lastIndices.objIndices.push_back(i);
+            }
+            else if (bbotList[i].isConstraint())
+            {
+                lastIndices.constraintIndices.push_back(i);
+            }
+        }
+    }
+
+    return lastIndices;
+}
+
+
 // Count the number of constraints
 size_t NOMAD::getNbConstraints(const BBOutputTypeList& bbotList)
 {
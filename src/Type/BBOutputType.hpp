@@ -196,6 +196,22 @@ DLL_UTIL_API size_t getNbObj(const BBOutputTypeList& bbotList);
 /// Count the number of revealing output (for discomads)
 DLL_UTIL_API size_t getNbRevealing(const BBOutputTypeList& bbotList);
 
+/// Positions of the objectives and of the constraints in a BBOutputTypeList
+struct DLL_UTIL_API BBOutputTypeIndices
+{
+    std::vector<size_t> objIndices;         ///< Positions of the OBJ outputs
+    std::vector<size_t> constraintIndices;  ///< Positions of the EB, PB and RPB outputs, in the order of the list
+};
+
+/// Get the positions of the objectives and of the constraints in a BBOutputTypeList
+/**
+ * The same few lists are used for all the evaluations of a run. The
+   positions are computed once, and kept for the last list seen by each
+   thread.
+ * The reference is valid until the next call by the same thread.
+ */
+DLL_UTIL_API const BBOutputTypeIndices& getBBOutputTypeIndices(const BBOutputTypeList& bbotList);
+
 /// Read and interpret BBOutputType
 inline std::ostream& operator<<(std::ostream& os, const BBOutputType &bbot)
 {
@@ -75,3 +75,53 @@ NOMAD::LHSearchType::LHSearchType(const std::string& entries)
         _enable = (_lhsearch0 != 0 || _lhsearch1 != 0);
     }
 }
+
+
+// Convert a string ("LHS", "MAXIMIN_LHS", "SOBOL", "HALTON") to a NOMAD::LHDesignType.
+NOMAD::LHDesignType NOMAD::stringToLHDesignType(const std::string& sConst)
+{
+    std::string s = sConst;
+    NOMAD::toupper(s);
+
+    if (s == "LHS")
+    {
+        return NOMAD::LHDesignType::LHS;
+    }
+    else if (s == "MAXIMIN_LHS")
+    {
+        return NOMAD::LHDesignType::MAXIMIN_LHS;
+    }
+    else if (s == "SOBOL")
+    {
+        return NOMAD::LHDesignType::SOBOL;
+    }
+    else if (s == "HALTON")
+    {
+        return NOMAD::LHDesignType::HALTON;
+    }
+    else
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Unrecognized string for NOMAD::LHDesignType: " + s);
+    }
+
+    return NOMAD::LHDesignType::LHS;
+}
+
+
+// Convert a NOMAD::LHDesignType to a string
+std::string NOMAD::lhDesignTypeToString(NOMAD::LHDesignType lhDesignType)
+{
+    switch (lhDesignType)
+    {
+        case NOMAD::LHDesignType::LHS:
+            return "LHS";
+        case NOMAD::LHDesignType::MAXIMIN_LHS:
+            return "MAXIMIN_LHS";
+        case NOMAD::LHDesignType::SOBOL:
+            return "SOBOL";
+        case NOMAD::LHDesignType::HALTON:
+            return "HALTON";
+        default:
+            return "UNDEFINED";
+    }
+}
@@ -46,7 +46,7 @@
 /*---------------------------------------------------------------------------------*/
 /**
  \file   LHSearchType.hpp
- \brief  Type for parameter LH_SEARCH
+ \brief  Types for parameters LH_SEARCH and LH_DESIGN
  \author Viviane Rochon Montplaisir
  \date   January 2019
  \see    LHSearchType.cpp
@@ -140,6 +140,28 @@ inline std::ostream& operator<<(std::ostream& os, const LHSearchType &lhsearch)
 }
 
 
+/// Space-filling designs for LH_EVAL and LH_SEARCH
+enum class LHDesignType
+{
+    LHS,            ///< Random Latin hypercube
+    MAXIMIN_LHS,    ///< Latin hypercube optimized for the maximin distance
+    SOBOL,          ///< Scrambled Sobol sequence
+    HALTON          ///< Scrambled Halton sequence
+};
+
+/// Convert a string (ex "LHS", "MAXIMIN_LHS", "SOBOL", "HALTON") to a LHDesignType.
+DLL_UTIL_API LHDesignType stringToLHDesignType(const std::string& s);
+
+/// Convert a LHDesignType to a string
+DLL_UTIL_API std::string lhDesignTypeToString(LHDesignType lhDesignType);
+
+inline std::ostream& operator<<(std::ostream& out, LHDesignType lhDesignType)
+{
+    out << lhDesignTypeToString(lhDesignType);
+    return out;
+}
+
+
 #include "../nomad_nsend.hpp"
 
 #endif  // __NOMAD_4_5_LH_SEARCH_TYPE__
@@ -0,0 +1,181 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include "../Util/MemoryPool.hpp"
+
+#include <new>
+
+namespace {
+
+    /// A free block holds the address of the next free block of the same size.
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    /// Free blocks of a given size.
+    struct FreeList
+    {
+        size_t      size;   ///< Size of the blocks. 0 if the list is not used yet.
+        size_t      count;  ///< Number of blocks in the list.
+        FreeBlock*  head;   ///< First block of the list.
+    };
+
+    // Few different sizes are used in a run: the number of variables,
+    // the number of outputs, and the sizes of a few classes.
+    const size_t NB_FREE_LISTS       = 32;
+    const size_t MAX_FREE_BLOCKS     = 1024;
+    const size_t MAX_POOLED_SIZE     = 65536;
+
+    // No destructor, so that the lists stay usable when static objects
+    // are destroyed at exit. The blocks of a thread that exits are not
+    // freed; there are at most NB_FREE_LISTS * MAX_FREE_BLOCKS of them.
+    thread_local FreeList freeLists[NB_FREE_LISTS];
+
+    /// Find the list for this size, or a list not used yet. nullptr if all lists are used by other sizes.
+    FreeList* findFreeList(const size_t size)
+    {
+        for (size_t i = 0; i < NB_FREE_LISTS; i++)
+        {
+            FreeList& freeList = freeLists[i];
+            if (size == freeList.size)
+            {
+                return &freeList;
+            }
+            if (0 == freeList.size)
+            {
+                freeList.size = size;
+                return &freeList;
+            }
+        }
+        return nullptr;
+    }
+}
+
+
+std::atomic<size_t> NOMAD::MemoryPool::_nbAllocations(0);
+std::atomic<size_t> NOMAD::MemoryPool::_nbSystemAllocations(0);
+
+
+void* NOMAD::MemoryPool::allocate(size_t size)
+{
+    _nbAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    // A free block must be able to hold the address of the next one.
+    if (size < sizeof(FreeBlock))
+    {
+        size = sizeof(FreeBlock);
+    }
+
+    if (size <= MAX_POOLED_SIZE)
+    {
+        FreeList* freeList = findFreeList(size);
+        if (nullptr != freeList && nullptr != freeList->head)
+        {
+            FreeBlock* block = freeList->head;
+            freeList->head = block->next;
+            freeList->count--;
+            return block;
+        }
+    }
+
+    _nbSystemAllocations.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+}
+
+
+void NOMAD::MemoryPool::deallocate(void* p, size_t size)
+{
+    if (nullptr == p)
+    {
+        return;
+    }
+
+    if (size < sizeof(FreeBlock))
+    {
+        size = sizeof(FreeBlock);
+    }
+
+    if (size <= MAX_POOLED_SIZE)
+    {
+        FreeList* freeList = findFreeList(size);
+        if (nullptr != freeList && freeList->count < MAX_FREE_BLOCKS)
+        {
+            FreeBlock* block = static_cast<FreeBlock*>(p);
+            block->next = freeList->head;
+            freeList->head = block;
+            freeList->count++;
+            return;
+        }
+    }
+
+    ::operator delete(p);
+}
+
+
+void NOMAD::MemoryPool::releaseThreadCache()
+{
+    for (size_t i = 0; i < NB_FREE_LISTS; i++)
+    {
+        FreeList& freeList = freeLists[i];
+        while (nullptr != freeList.head)
+        {
+            FreeBlock* block = freeList.head;
+            freeList.head = block->next;
+            ::operator delete(block);
+        }
+        freeList.count = 0;
+        freeList.size = 0;
+    }
+}
+
+
+void NOMAD::MemoryPool::resetCounters()
+{
+    _nbAllocations = 0;
+    _nbSystemAllocations = 0;
+}
@@ -0,0 +1,152 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   MemoryPool.hpp
+ \brief  Pool of memory blocks reused for points, evaluations and evaluation points.
+ \see    MemoryPool.cpp
+ */
+
+#ifndef __NOMAD_4_5_MEMORYPOOL__
+#define __NOMAD_4_5_MEMORYPOOL__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Pool of memory blocks.
+/**
+ * Each iteration creates and destroys many objects of the same few sizes:
+   the coordinates of the trial points, their Evals and the EvalPoints
+   themselves. The pool keeps the freed blocks and gives them back on the
+   next allocation of the same size, so that the allocations of an
+   iteration reuse the memory of the previous ones.
+ * The free blocks are kept per thread, without lock. A block freed by
+   another thread than the one that allocated it goes to the free blocks
+   of the thread that frees it.
+ * The number of free blocks kept per size is bounded, and large blocks are
+   not pooled.
+ * The counters are used to verify that the number of allocations from the
+   system drops.
+ */
+class DLL_UTIL_API MemoryPool
+{
+private:
+    static std::atomic<size_t> _nbAllocations;        ///< Number of blocks allocated
+    static std::atomic<size_t> _nbSystemAllocations;  ///< Number of blocks allocated that were not found in the pool
+
+public:
+    // No need for constructor. All is static.
+
+    /// Allocate a block of \c size bytes, reusing a free block of the same size if possible.
+    static void* allocate(size_t size);
+
+    /// Give a block back to the pool.
+    /**
+     \param p       The block, allocated by allocate() -- \b IN.
+     \param size    The size given to allocate() -- \b IN.
+     */
+    static void deallocate(void* p, size_t size);
+
+    /// Free the blocks kept by the pool for the current thread.
+    static void releaseThreadCache();
+
+    /// Number of blocks allocated since the last reset.
+    static size_t getNbAllocations() { return _nbAllocations; }
+
+    /// Number of blocks allocated from the system since the last reset.
+    static size_t getNbSystemAllocations() { return _nbSystemAllocations; }
+
+    /// Reset the counters.
+    static void resetCounters();
+};
+
+
+/// Allocator using the MemoryPool. Used with \c std::allocate_shared.
+template <typename T>
+class PoolAllocator
+{
+public:
+    typedef T value_type;
+
+    PoolAllocator() = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& ) {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(MemoryPool::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        MemoryPool::deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& ) const { return true; }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& ) const { return false; }
+};
+
+
+/// Same as \c std::make_shared, with the object and its control block allocated in the MemoryPool.
+template <typename T, typename... Args>
+std::shared_ptr<T> makeSharedFromPool(Args&&... args)
+{
+    return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_MEMORYPOOL__
@@ -0,0 +1,394 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+
+#include "../Util/Profiler.hpp"
+#include "../Util/Exception.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+    /// Counters of a zone for one thread. Only the owner thread writes them.
+    struct ZoneStats
+    {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> total;
+        std::atomic<uint64_t> self;
+        std::atomic<uint64_t> max;
+    };
+
+    struct TraceEvent
+    {
+        NOMAD::Profiler::ZoneId zone;
+        uint64_t startTime;
+        uint64_t duration;
+    };
+
+    /// Counters and trace events of one thread.
+    struct ThreadData
+    {
+        size_t                          tid;
+        std::unique_ptr<ZoneStats[]>    stats;
+        std::mutex                      traceMutex;     ///< Uncontended, except while the trace is written
+        std::vector<TraceEvent>         trace;
+        size_t                          nbDroppedTraceEvents;
+
+        explicit ThreadData(size_t threadIndex)
+          : tid(threadIndex),
+            stats(new ZoneStats[NOMAD::Profiler::maxNbZones]),
+            traceMutex(),
+            trace(),
+            nbDroppedTraceEvents(0)
+        {
+            reset();
+        }
+
+        void reset()
+        {
+            for (size_t i = 0; i < NOMAD::Profiler::maxNbZones; i++)
+            {
+                stats[i].count.store(0, std::memory_order_relaxed);
+                stats[i].total.store(0, std::memory_order_relaxed);
+                stats[i].self.store(0, std::memory_order_relaxed);
+                stats[i].max.store(0, std::memory_order_relaxed);
+            }
+            std::lock_guard<std::mutex> lock(traceMutex);
+            trace.clear();
+            nbDroppedTraceEvents = 0;
+        }
+    };
+
+    /// Zone names and the data of all threads that timed a zone.
+    /**
+     The data of a thread is kept after the thread ends, so that its time is
+     part of the profile.
+     */
+    struct Registry
+    {
+        std::mutex                                  mutex;
+        std::vector<std::string>                    zoneNames;
+        std::map<std::string, NOMAD::Profiler::ZoneId> zoneIds;
+        std::vector<std::shared_ptr<ThreadData>>    threads;
+    };
+
+    Registry& getRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    ThreadData& getThreadData()
+    {
+        thread_local std::shared_ptr<ThreadData> threadData;
+        if (nullptr == threadData)
+        {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            threadData = std::make_shared<ThreadData>(registry.threads.size());
+            registry.threads.push_back(threadData);
+        }
+        return *threadData;
+    }
+
+    /// Steady clock time at Profiler::start(), in nanoseconds.
+    std::atomic<int64_t> t0(0);
+
+    int64_t steadyNow()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    thread_local NOMAD::ProfileScope* currentScope = nullptr;
+
+    std::string escapeJson(const std::string& s)
+    {
+        std::string escaped;
+        for (char c : s)
+        {
+            if ('"' == c || '\\' == c)
+            {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+}
+
+
+std::atomic<bool> NOMAD::Profiler::_enabled(false);
+std::atomic<bool> NOMAD::Profiler::_traceEnabled(false);
+
+
+NOMAD::Profiler::ZoneId NOMAD::Profiler::registerZone(const std::string& name)
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.zoneIds.find(name);
+    if (it != registry.zoneIds.end())
+    {
+        return it->second;
+    }
+    if (registry.zoneNames.size() >= maxNbZones)
+    {
+        throw NOMAD::Exception(__FILE__, __LINE__, "Profiler: too many zones. Cannot register zone " + name);
+    }
+    NOMAD::Profiler::ZoneId zone = registry.zoneNames.size();
+    registry.zoneNames.push_back(name);
+    registry.zoneIds[name] = zone;
+
+    return zone;
+}
+
+
+void NOMAD::Profiler::start(bool trace)
+{
+    _enabled = false;
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto& threadData : registry.threads)
+        {
+            threadData->reset();
+        }
+    }
+    t0 = steadyNow();
+    _traceEnabled = trace;
+    _enabled = true;
+}
+
+
+void NOMAD::Profiler::stop()
+{
+    _enabled = false;
+    _traceEnabled = false;
+}
+
+
+uint64_t NOMAD::Profiler::now()
+{
+    return static_cast<uint64_t>(steadyNow() - t0.load(std::memory_order_relaxed));
+}
+
+
+void NOMAD::Profiler::record(ZoneId zone, uint64_t startTime, uint64_t duration, uint64_t childTime)
+{
+    ThreadData& threadData = getThreadData();
+    ZoneStats& stats = threadData.stats[zone];
+
+    // Single writer: no need for atomic read-modify-write.
+    stats.count.store(stats.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    stats.total.store(stats.total.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+    stats.self.store(stats.self.load(std::memory_order_relaxed) + (duration > childTime ? duration - childTime : 0), std::memory_order_relaxed);
+    if (duration > stats.max.load(std::memory_order_relaxed))
+    {
+        stats.max.store(duration, std::memory_order_relaxed);
+    }
+
+    if (isTraceEnabled())
+    {
+        std::lock_guard<std::mutex> lock(threadData.traceMutex);
+        if (threadData.trace.size() < maxNbTraceEvents)
+        {
+            threadData.trace.push_back({zone, startTime, duration});
+        }
+        else
+        {
+            threadData.nbDroppedTraceEvents++;
+        }
+    }
+}
+
+
+void NOMAD::Profiler::writeProfile(const std::string& fileName)
+{
+    struct ZoneTotal
+    {
+        std::string name;
+        uint64_t count, total, self, max;
+    };
+
+    const double totalTime = now() * 1e-9;
+    std::vector<ZoneTotal> zoneTotals;
+    size_t nbThreads = 0;
+    size_t nbDroppedTraceEvents = 0;
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        nbThreads = registry.threads.size();
+        for (size_t zone = 0; zone < registry.zoneNames.size(); zone++)
+        {
+            ZoneTotal zoneTotal = {registry.zoneNames[zone], 0, 0, 0, 0};
+            for (const auto& threadData : registry.threads)
+            {
+                const ZoneStats& stats = threadData->stats[zone];
+                zoneTotal.count += stats.count.load(std::memory_order_relaxed);
+                zoneTotal.total += stats.total.load(std::memory_order_relaxed);
+                zoneTotal.self  += stats.self.load(std::memory_order_relaxed);
+                zoneTotal.max   = std::max(zoneTotal.max, stats.max.load(std::memory_order_relaxed));
+            }
+            if (zoneTotal.count > 0)
+            {
+                zoneTotals.push_back(zoneTotal);
+            }
+        }
+        for (const auto& threadData : registry.threads)
+        {
+            std::lock_guard<std::mutex> traceLock(threadData->traceMutex);
+            nbDroppedTraceEvents += threadData->nbDroppedTraceEvents;
+        }
+    }
+    std::sort(zoneTotals.begin(), zoneTotals.end(),
+              [](const ZoneTotal& z1, const ZoneTotal& z2) { return z1.self > z2.self; });
+
+    std::ofstream profileStream(fileName.c_str(), std::ofstream::out | std::ios::trunc);
+    if (profileStream.fail())
+    {
+        std::cout << "Warning: could not open profile file " << fileName << std::endl;
+        return;
+    }
+
+    char line[512];
+    std::snprintf(line, sizeof(line), "Profile of %zu thread(s) over %.6f s", nbThreads, totalTime);
+    profileStream << line << '\n';
+    if (nbDroppedTraceEvents > 0)
+    {
+        profileStream << "Trace events dropped: " << nbDroppedTraceEvents << '\n';
+    }
+    profileStream << '\n';
+    std::snprintf(line, sizeof(line), "%-60s %12s %14s %14s %12s %12s",
+                  "Zone", "Calls", "Total (s)", "Self (s)", "Mean (ms)", "Max (ms)");
+    profileStream << line << '\n';
+    for (const auto& zoneTotal : zoneTotals)
+    {
+        std::snprintf(line, sizeof(line), "%-60s %12llu %14.6f %14.6f %12.4f %12.4f",
+                      zoneTotal.name.c_str(),
+                      static_cast<unsigned long long>(zoneTotal.count),
+                      zoneTotal.total * 1e-9,
+                      zoneTotal.self * 1e-9,
+                      zoneTotal.total * 1e-6 / zoneTotal.count,
+                      zoneTotal.max * 1e-6);
+        profileStream << line << '\n';
+    }
+}
+
+
+void NOMAD::Profiler::writeTrace(const std::string& fileName)
+{
+    std::ofstream traceStream(fileName.c_str(), std::ofstream::out | std::ios::trunc);
+    if (traceStream.fail())
+    {
+        std::cout << "Warning: could not open profile trace file " << fileName << std::endl;
+        return;
+    }
+
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<std::string> names;
+    for (const auto& name : registry.zoneNames)
+    {
+        names.push_back(escapeJson(name));
+    }
+
+    // Timestamps and durations are in microseconds.
+    std::string buffer = "{\"traceEvents\":[";
+    bool first = true;
+    char event[128];
+    for (const auto& threadData : registry.threads)
+    {
+        std::lock_guard<std::mutex> traceLock(threadData->traceMutex);
+        for (const auto& traceEvent : threadData->trace)
+        {
+            buffer += first ? "\n" : ",\n";
+            first = false;
+            buffer += "{\"name\":\"" + names[traceEvent.zone] + "\",\"cat\":\"nomad\",\"ph\":\"X\",\"pid\":0";
+            std::snprintf(event, sizeof(event), ",\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}",
+                          threadData->tid,
+                          traceEvent.startTime * 1e-3,
+                          traceEvent.duration * 1e-3);
+            buffer += event;
+            if (buffer.size() > (1 << 20))
+            {
+                traceStream << buffer;
+                buffer.clear();
+            }
+        }
+    }
+    buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    traceStream << buffer;
+}
+
+
+void NOMAD::ProfileScope::begin()
+{
+    _parent = currentScope;
+    currentScope = this;
+    _startTime = NOMAD::Profiler::now();
+}
+
+
+void NOMAD::ProfileScope::end()
+{
+    const uint64_t endTime = NOMAD::Profiler::now();
+    const uint64_t duration = (endTime > _startTime) ? endTime - _startTime : 0;
+    currentScope = _parent;
+    if (nullptr != _parent)
+    {
+        _parent->_childTime += duration;
+    }
+    NOMAD::Profiler::record(_zone, _startTime, duration, _childTime);
+}
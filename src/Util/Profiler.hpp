@@ -0,0 +1,182 @@
+/*---------------------------------------------------------------------------------*/
+/*  NOMAD - Nonlinear Optimization by Mesh Adaptive Direct Search -                */
+/*                                                                                 */
+/*  NOMAD - Version 4 has been created and developed by                            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  The copyright of NOMAD - version 4 is owned by                                 */
+/*                 Charles Audet               - Polytechnique Montreal            */
+/*                 Sebastien Le Digabel        - Polytechnique Montreal            */
+/*                 Viviane Rochon Montplaisir  - Polytechnique Montreal            */
+/*                 Christophe Tribes           - Polytechnique Montreal            */
+/*                                                                                 */
+/*  NOMAD 4 has been funded by Rio Tinto, Hydro-Québec, Huawei-Canada,             */
+/*  NSERC (Natural Sciences and Engineering Research Council of Canada),           */
+/*  InnovÉÉ (Innovation en Énergie Électrique) and IVADO (The Institute            */
+/*  for Data Valorization)                                                         */
+/*                                                                                 */
+/*  NOMAD v3 was created and developed by Charles Audet, Sebastien Le Digabel,     */
+/*  Christophe Tribes and Viviane Rochon Montplaisir and was funded by AFOSR       */
+/*  and Exxon Mobil.                                                               */
+/*                                                                                 */
+/*  NOMAD v1 and v2 were created and developed by Mark Abramson, Charles Audet,    */
+/*  Gilles Couture, and John E. Dennis Jr., and were funded by AFOSR and           */
+/*  Exxon Mobil.                                                                   */
+/*                                                                                 */
+/*  Contact information:                                                           */
+/*    Polytechnique Montreal - GERAD                                               */
+/*    C.P. 6079, Succ. Centre-ville, Montreal (Quebec) H3C 3A7 Canada              */
+/*    e-mail: nomad@gerad.ca                                                       */
+/*                                                                                 */
+/*  This program is free software: you can redistribute it and/or modify it        */
+/*  under the terms of the GNU Lesser General Public License as published by       */
+/*  the Free Software Foundation, either version 3 of the License, or (at your     */
+/*  option) any later version.                                                     */
+/*                                                                                 */
+/*  This program is distributed in the hope that it will be useful, but WITHOUT    */
+/*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or          */
+/*  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License    */
+/*  for more details.                                                              */
+/*                                                                                 */
+/*  You should have received a copy of the GNU Lesser General Public License       */
+/*  along with this program. If not, see <http://www.gnu.org/licenses/>.           */
+/*                                                                                 */
+/*  You can find information on the NOMAD software at www.gerad.ca/nomad           */
+/*---------------------------------------------------------------------------------*/
+/**
+ \file   Profiler.hpp
+ \brief  Time profile of the zones of code run by NOMAD.
+ \see    Profiler.cpp
+ */
+
+#ifndef __NOMAD_4_5_PROFILER__
+#define __NOMAD_4_5_PROFILER__
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "../nomad_platform.hpp"
+#include "../nomad_nsbegin.hpp"
+
+
+/// Time profile of the zones of code run by NOMAD.
+/**
+ * A zone is a named piece of code, timed with a ProfileScope (see the
+   NOMAD_PROFILE_SCOPE macro). Zones are registered once, the first time
+   they are reached, and get a stable index.
+ * The profiler is enabled at run time, when PROFILE_FILE or
+   PROFILE_TRACE_FILE is set. When it is disabled, a ProfileScope costs a
+   single atomic load.
+ * When enabled, each thread accumulates its own counters per zone, without
+   lock: number of calls, total time, self time (total time minus the time
+   spent in nested zones) and maximum time. Times are measured with
+   \c std::chrono::steady_clock.
+ * If the trace is enabled, each timed call is also recorded with its start
+   time and thread, up to maxNbTraceEvents per thread.
+ * At the end of the run, the counters of all threads are summed and
+   written as a flat profile, and the calls are written in Chrome trace
+   JSON format.
+ */
+class DLL_UTIL_API Profiler
+{
+public:
+    typedef size_t ZoneId;
+
+    static const size_t maxNbZones = 1024;              ///< Maximum number of registered zones
+    static const size_t maxNbTraceEvents = 1048576;     ///< Maximum number of trace events kept per thread
+
+private:
+    static std::atomic<bool> _enabled;          ///< Zones are timed
+    static std::atomic<bool> _traceEnabled;     ///< Timed calls are also kept for the trace
+
+public:
+    // No need for constructor. All is static.
+
+    /// Get the index of the zone with this name. Register the zone if needed.
+    static ZoneId registerZone(const std::string& name);
+
+    /// Reset all counters and trace events and start timing.
+    /**
+     \param trace   Keep each timed call for the trace -- \b IN.
+     */
+    static void start(bool trace);
+
+    /// Stop timing. The counters are kept for writeProfile() and writeTrace().
+    static void stop();
+
+    static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+    static bool isTraceEnabled() { return _traceEnabled.load(std::memory_order_relaxed); }
+
+    /// Time elapsed since start(), in nanoseconds.
+    static uint64_t now();
+
+    /// Write the flat profile, zones sorted by decreasing self time.
+    static void writeProfile(const std::string& fileName);
+
+    /// Write the trace in Chrome trace JSON format.
+    static void writeTrace(const std::string& fileName);
+
+    /// Add a timed call to the counters of the current thread. Called by ProfileScope.
+    static void record(ZoneId zone, uint64_t startTime, uint64_t duration, uint64_t childTime);
+};
+
+
+/// Time the enclosing scope as a call to a profiler zone.
+/**
+ The time of a ProfileScope is subtracted from the self time of the
+ ProfileScope enclosing it on the same thread.
+ */
+class DLL_UTIL_API ProfileScope
+{
+private:
+    Profiler::ZoneId    _zone;
+    bool                _active;        ///< The profiler was enabled when the scope was entered
+    uint64_t            _startTime;
+    uint64_t            _childTime;     ///< Time of the nested scopes
+    ProfileScope*       _parent;        ///< Enclosing scope on this thread
+
+public:
+    explicit ProfileScope(Profiler::ZoneId zone)
+      : _zone(zone),
+        _active(Profiler::isEnabled()),
+        _startTime(0),
+        _childTime(0),
+        _parent(nullptr)
+    {
+        if (_active)
+        {
+            begin();
+        }
+    }
+
+    ~ProfileScope()
+    {
+        if (_active)
+        {
+            end();
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    void begin();
+    void end();
+};
+
+
+#define NOMAD_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NOMAD_PROFILE_CONCAT(a, b) NOMAD_PROFILE_CONCAT_IMPL(a, b)
+
+/// Time the rest of the enclosing scope as a call to the zone \c name (a string literal).
+#define NOMAD_PROFILE_SCOPE(name) \
+    static const NOMAD::Profiler::ZoneId NOMAD_PROFILE_CONCAT(nomadProfileZone, __LINE__) = NOMAD::Profiler::registerZone(name); \
+    NOMAD::ProfileScope NOMAD_PROFILE_CONCAT(nomadProfileScope, __LINE__)(NOMAD_PROFILE_CONCAT(nomadProfileZone, __LINE__))
+
+
+#include "../nomad_nsend.hpp"
+
+#endif // __NOMAD_4_5_PROFILER__
@@ -96,6 +96,7 @@ template<> DLL_UTIL_API std::map<NOMAD::MadsStopType,std::string> & NOMAD::StopR
         {NOMAD::MadsStopType::MIN_FRAME_SIZE_REACHED,"Min frame size reached"},
         {NOMAD::MadsStopType::PONE_SEARCH_FAILED,"Phase one search did not return a feasible point"},
         {NOMAD::MadsStopType::UPDATE_FAILED,"Update failed"},
+        {NOMAD::MadsStopType::HV_STALLED,"Hypervolume improvement stalled"},
         {NOMAD::MadsStopType::X0_FAIL,"Problem with starting point evaluation"}
     };
     return dictionary;
@@ -114,6 +115,7 @@ template<> DLL_UTIL_API bool NOMAD::StopReason<NOMAD::MadsStopType>::checkTermin
         case NOMAD::MadsStopType::MIN_FRAME_SIZE_REACHED:
         case NOMAD::MadsStopType::PONE_SEARCH_FAILED:
         case NOMAD::MadsStopType::UPDATE_FAILED:
+        case NOMAD::MadsStopType::HV_STALLED:
         case NOMAD::MadsStopType::X0_FAIL:
             return true;
         case NOMAD::MadsStopType::STARTED:
@@ -81,6 +81,7 @@ enum class MadsStopType : int
     X0_FAIL                 ,  ///< Problem with starting point evaluation
     PONE_SEARCH_FAILED      ,  ///< Phase one search did not return a feasible point.
     UPDATE_FAILED           ,  ///< Update failed (DMultiMads only).
+    HV_STALLED              ,  ///< Hypervolume improvement stalled (DMultiMads only).
     LAST
 };
 